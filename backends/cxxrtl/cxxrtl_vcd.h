@@ -19,8 +19,18 @@
 #ifndef CXXRTL_VCD_H
 #define CXXRTL_VCD_H
 
+#include <cstring>
+#include <ostream>
 #include <backends/cxxrtl/cxxrtl.h>
 
+// The writer thread of `vcd_writer::start_writer()` is opt-in, so that the header can still be used without
+// linking to a threads library. Define `CXXRTL_VCD_WRITER_THREAD` before including it to enable it.
+#if defined(CXXRTL_VCD_WRITER_THREAD)
+#include <atomic>
+#include <chrono>
+#include <thread>
+#endif
+
 namespace cxxrtl {
 
 class vcd_writer {
@@ -40,6 +50,73 @@ class vcd_writer {
 	std::map<chunk_t*, size_t> aliases;
 	bool streaming = false;
 
+#if defined(CXXRTL_VCD_WRITER_THREAD)
+	// A queue of chunks from the simulation thread to the writer thread, see `start_writer()`. `head` and
+	// `tail` count the chunks written and read so far; the simulation waits while the queue is full.
+	struct chunk_queue {
+		std::vector<chunk_t> ring;
+		size_t mask = 0;
+		std::atomic<size_t> head{0};
+		std::atomic<size_t> tail{0};
+		std::atomic<bool> closed{false};
+
+		// Yields for a while and then sleeps, so that waiting for a slow peer doesn't keep a core busy.
+		static void wait_a_little(int &waited) {
+			if (waited++ < 100)
+				std::this_thread::yield();
+			else
+				std::this_thread::sleep_for(std::chrono::microseconds(50));
+		}
+
+		void write(const chunk_t *data, size_t size) {
+			size_t h = head.load(std::memory_order_relaxed);
+			int waited = 0;
+			while (size > 0) {
+				size_t free = ring.size() - (h - tail.load(std::memory_order_acquire));
+				if (free == 0) {
+					wait_a_little(waited);
+					continue;
+				}
+				size_t count = std::min({size, free, ring.size() - (h & mask)});
+				std::copy(data, data + count, &ring[h & mask]);
+				h += count;
+				data += count;
+				size -= count;
+				head.store(h, std::memory_order_release);
+			}
+		}
+
+		// Returns false if the queue was closed before `size` chunks arrived.
+		bool read(chunk_t *data, size_t size) {
+			size_t t = tail.load(std::memory_order_relaxed);
+			int waited = 0;
+			while (size > 0) {
+				bool was_closed = closed.load(std::memory_order_acquire);
+				size_t avail = head.load(std::memory_order_acquire) - t;
+				if (avail == 0) {
+					if (was_closed)
+						return false;
+					wait_a_little(waited);
+					continue;
+				}
+				size_t count = std::min({size, avail, ring.size() - (t & mask)});
+				std::copy(&ring[t & mask], &ring[t & mask] + count, data);
+				t += count;
+				data += count;
+				size -= count;
+				tail.store(t, std::memory_order_release);
+			}
+			return true;
+		}
+	};
+
+	std::ostream *writer_output = nullptr;
+	size_t writer_queue_size = 0;
+	std::unique_ptr<chunk_queue> queue;
+	std::thread writer;
+	std::vector<chunk_t> record;
+#endif
+
 	void emit_timescale(unsigned number, const std::string &unit) {
 		assert(!streaming);
 		assert(number == 1 || number == 10 || number == 100);
@@ -62,7 +139,7 @@ class vcd_writer {
 		}
 	}
 
-	void emit_ident(size_t ident) {
+	static void emit_ident(std::string &buffer, size_t ident) {
 		do {
 			buffer += '!' + ident % 94; // "base94"
 			ident /= 94;
@@ -85,7 +162,7 @@ class vcd_writer {
 	              size_t lsb_at, bool multipart) {
 		assert(!streaming);
 		buffer += "$var " + type + " " + std::to_string(var.width) + " ";
-		emit_ident(var.ident);
+		emit_ident(buffer, var.ident);
 		buffer += " ";
 		emit_name(name);
 		if (multipart || name.back() == ']' || lsb_at != 0) {
@@ -103,31 +180,83 @@ class vcd_writer {
 		streaming = true;
 	}
 
-	void emit_time(uint64_t timestamp) {
-		assert(streaming);
+	// These are also used by the writer thread, with a buffer of its own and a copy of the value.
+	static void emit_time(std::string &buffer, uint64_t timestamp) {
 		buffer += "#" + std::to_string(timestamp) + "\n";
 	}
 
-	void emit_scalar(const variable &var) {
-		assert(streaming);
+	static void emit_scalar(std::string &buffer, const variable &var, const chunk_t *curr) {
 		assert(var.width == 1);
-		buffer += (*var.curr ? '1' : '0');
-		emit_ident(var.ident);
+		buffer += (*curr ? '1' : '0');
+		emit_ident(buffer, var.ident);
 		buffer += '\n';
 	}
 
-	void emit_vector(const variable &var) {
-		assert(streaming);
+	static void emit_vector(std::string &buffer, const variable &var, const chunk_t *curr) {
 		buffer += 'b';
 		for (size_t bit = var.width - 1; bit != (size_t)-1; bit--) {
-			bool bit_curr = var.curr[bit / (8 * sizeof(chunk_t))] & (1 << (bit % (8 * sizeof(chunk_t))));
+			bool bit_curr = curr[bit / (8 * sizeof(chunk_t))] & (1 << (bit % (8 * sizeof(chunk_t))));
 			buffer += (bit_curr ? '1' : '0');
 		}
 		buffer += ' ';
-		emit_ident(var.ident);
+		emit_ident(buffer, var.ident);
 		buffer += '\n';
 	}
 
+	static void emit_value(std::string &buffer, const variable &var, const chunk_t *curr) {
+		if (var.width == 1)
+			emit_scalar(buffer, var, curr);
+		else
+			emit_vector(buffer, var, curr);
+	}
+
+	static size_t chunks_of(const variable &var) {
+		return (var.width + (sizeof(chunk_t) * 8 - 1)) / (sizeof(chunk_t) * 8);
+	}
+
+#if defined(CXXRTL_VCD_WRITER_THREAD)
+	// Each sample is a record of the timestamp (two chunks), the number of changed variables, and for each
+	// of them its index followed by its value.
+	void queue_sample(uint64_t timestamp) {
+		record.clear();
+		record.push_back((chunk_t)timestamp);
+		record.push_back((chunk_t)(timestamp >> 32));
+		record.push_back(0);
+		for (size_t index = 0; index < variables.size(); index++) {
+			const variable &var = variables[index];
+			if (test_variable(var)) {
+				record.push_back((chunk_t)index);
+				record.insert(record.end(), &var.curr[0], &var.curr[chunks_of(var)]);
+				record[2]++;
+			}
+		}
+		queue->write(record.data(), record.size());
+	}
+
+	void run_writer() {
+		std::string text;
+		std::vector<chunk_t> value;
+		chunk_t header[3];
+		while (queue->read(header, 3)) {
+			emit_time(text, (uint64_t)header[0] | ((uint64_t)header[1] << 32));
+			for (chunk_t count = 0; count < header[2]; count++) {
+				chunk_t index;
+				queue->read(&index, 1);
+				const variable &var = variables[index];
+				value.resize(chunks_of(var));
+				queue->read(value.data(), value.size());
+				emit_value(text, var, value.data());
+			}
+			if (text.size() >= 65536) {
+				writer_output->write(text.data(), text.size());
+				text.clear();
+			}
+		}
+		writer_output->write(text.data(), text.size());
+		writer_output->flush();
+	}
+#endif
+
 	void reset_outlines() {
 		for (auto &outline_it : outlines)
 			outline_it.second = /*warm=*/(outline_it.first == nullptr);
@@ -185,6 +314,37 @@ class vcd_writer {
 public:
 	std::string buffer;
 
+#if defined(CXXRTL_VCD_WRITER_THREAD)
+	~vcd_writer() {
+		stop_writer();
+	}
+
+	// Formats the samples on a thread of its own and writes them to `output`, instead of to `buffer`. The
+	// values that changed are copied into a queue of `queue_size` bytes, and `sample()` only waits for the
+	// writer thread when the queue is full. The header and the first sample are still formatted into
+	// `buffer` and written to `output` by the first `sample()` call; any text already in `buffer` at that
+	// point is written first. No variables can be added after the first sample. Call `stop_writer()`
+	// (or destroy the writer) to wait for the thread and flush `output`.
+	void start_writer(std::ostream &output, size_t queue_size = 4 << 20) {
+		assert(writer_output == nullptr);
+		writer_output = &output;
+		writer_queue_size = queue_size;
+	}
+
+	void stop_writer() {
+		if (writer.joinable()) {
+			queue->closed.store(true, std::memory_order_release);
+			writer.join();
+			queue.reset();
+		} else if (writer_output != nullptr) {
+			writer_output->write(buffer.data(), buffer.size());
+			writer_output->flush();
+			buffer.clear();
+		}
+		writer_output = nullptr;
+	}
+#endif
+
 	void timescale(unsigned number, const std::string &unit) {
 		emit_timescale(number, unit);
 	}
@@ -259,14 +419,29 @@ public:
 			emit_enddefinitions();
 		}
 		reset_outlines();
-		emit_time(timestamp);
+#if defined(CXXRTL_VCD_WRITER_THREAD)
+		if (writer.joinable()) {
+			queue_sample(timestamp);
+			return;
+		}
+#endif
+		emit_time(buffer, timestamp);
 		for (auto var : variables)
-			if (test_variable(var) || first_sample) {
-				if (var.width == 1)
-					emit_scalar(var);
-				else
-					emit_vector(var);
-			}
+			if (test_variable(var) || first_sample)
+				emit_value(buffer, var, var.curr);
+#if defined(CXXRTL_VCD_WRITER_THREAD)
+		if (writer_output != nullptr) {
+			writer_output->write(buffer.data(), buffer.size());
+			buffer.clear();
+			size_t size = 1024;
+			while (size < writer_queue_size / sizeof(chunk_t))
+				size *= 2;
+			queue.reset(new chunk_queue);
+			queue->ring.resize(size);
+			queue->mask = size - 1;
+			writer = std::thread([this] { run_writer(); });
+		}
+#endif
 	}
 };
 
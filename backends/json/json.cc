@@ -23,81 +23,115 @@
 #include "kernel/celltypes.h"
 #include "kernel/cellaigs.h"
 #include "kernel/log.h"
+#include "kernel/threading.h"
 #include <string>
 
+#ifdef _WIN32
+#  include <io.h>
+#else
+#  include <unistd.h>
+#endif
+
 USING_YOSYS_NAMESPACE
 PRIVATE_NAMESPACE_BEGIN
 
-struct JsonWriter
+void append_string(string &out, const char *str)
+{
+	out += '"';
+	for (const char *p = str; *p; p++) {
+		char c = *p;
+		if (c == '\\')
+			out += "\\\\";
+		else if (c == '"')
+			out += "\\\"";
+		else if (c == '\b')
+			out += "\\b";
+		else if (c == '\f')
+			out += "\\f";
+		else if (c == '\n')
+			out += "\\n";
+		else if (c == '\r')
+			out += "\\r";
+		else if (c == '\t')
+			out += "\\t";
+		else if (c < 0x20)
+			out += stringf("\\u%04X", c);
+		else
+			out += c;
+	}
+	out += '"';
+}
+
+string get_string(const string &str)
+{
+	string out;
+	append_string(out, str.c_str());
+	return out;
+}
+
+void append_int(string &out, int value)
+{
+	char buf[16], *p = buf + sizeof(buf);
+	unsigned int v = value < 0 ? 0u - (unsigned int)value : value;
+	do {
+		*--p = '0' + v % 10;
+		v /= 10;
+	} while (v != 0);
+	if (value < 0)
+		*--p = '-';
+	out.append(p, buf + sizeof(buf) - p);
+}
+
+// Renders one module into a string. The signal bits are numbered per module,
+// so the modules of a design can be rendered in parallel.
+struct JsonModuleWriter
 {
-	std::ostream &f;
 	bool use_selection;
 	bool aig_mode;
 	bool compat_int_mode;
 
-	Design *design;
 	Module *module;
+	string out;
 
 	SigMap sigmap;
 	int sigidcounter;
-	dict<SigBit, string> sigids;
+	dict<SigBit, int> sigids;
 	pool<Aig> aig_models;
+	vector<Aig> aig_models_order;
 
-	JsonWriter(std::ostream &f, bool use_selection, bool aig_mode, bool compat_int_mode) :
-			f(f), use_selection(use_selection), aig_mode(aig_mode),
+	JsonModuleWriter(bool use_selection, bool aig_mode, bool compat_int_mode) :
+			use_selection(use_selection), aig_mode(aig_mode),
 			compat_int_mode(compat_int_mode) { }
 
-	string get_string(string str)
-	{
-		string newstr = "\"";
-		for (char c : str) {
-			if (c == '\\')
-				newstr += "\\\\";
-			else if (c == '"')
-				newstr += "\\\"";
-			else if (c == '\b')
-				newstr += "\\b";
-			else if (c == '\f')
-				newstr += "\\f";
-			else if (c == '\n')
-				newstr += "\\n";
-			else if (c == '\r')
-				newstr += "\\r";
-			else if (c == '\t')
-				newstr += "\\t";
-			else if (c < 0x20)
-				newstr += stringf("\\u%04X", c);
-			else
-				newstr += c;
-		}
-		return newstr + "\"";
-	}
-
-	string get_name(IdString name)
+	void write_name(IdString name)
 	{
-		return get_string(RTLIL::unescape_id(name));
+		// same as RTLIL::unescape_id(), without a copy of the name
+		const char *str = name.c_str();
+		if (str[0] == '\\' && str[1] != 0 && str[1] != '$' && str[1] != '\\' && !(str[1] >= '0' && str[1] <= '9'))
+			str++;
+		append_string(out, str);
 	}
 
-	string get_bits(SigSpec sig)
+	void write_bits(const SigSpec &sig)
 	{
 		bool first = true;
-		string str = "[";
+		out += "[";
 		for (auto bit : sigmap(sig)) {
-			str += first ? " " : ", ";
+			out += first ? " " : ", ";
 			first = false;
-			if (sigids.count(bit) == 0) {
-				string &s = sigids[bit];
-				if (bit.wire == nullptr) {
-					if (bit == State::S0) s = "\"0\"";
-					else if (bit == State::S1) s = "\"1\"";
-					else if (bit == State::Sz) s = "\"z\"";
-					else s = "\"x\"";
-				} else
-					s = stringf("%d", sigidcounter++);
+			if (bit.wire == nullptr) {
+				if (bit == State::S0) out += "\"0\"";
+				else if (bit == State::S1) out += "\"1\"";
+				else if (bit == State::Sz) out += "\"z\"";
+				else out += "\"x\"";
+			} else {
+				auto it = sigids.insert(std::make_pair(bit, sigidcounter));
+				if (it.second)
+					sigidcounter++;
+				append_int(out, it.first->second);
 			}
-			str += sigids[bit];
 		}
-		return str + " ]";
+		out += " ]";
 	}
 
 	void write_parameter_value(const Const &value)
@@ -118,14 +152,14 @@ struct JsonWriter
 			}
 			if (state < 2)
 				str += " ";
-			f << get_string(str);
+			append_string(out, str.c_str());
 		} else if (compat_int_mode && GetSize(value) <= 32 && value.is_fully_def()) {
 			if ((value.flags & RTLIL::ConstFlags::CONST_FLAG_SIGNED) != 0)
-				f << stringf("%d", value.as_int());
+				append_int(out, value.as_int());
 			else
-				f << stringf("%u", value.as_int());
+				out += stringf("%u", value.as_int());
 		} else {
-			f << get_string(value.as_string());
+			append_string(out, value.as_string().c_str());
 		}
 	}
 
@@ -133,153 +167,238 @@ struct JsonWriter
 	{
 		bool first = true;
 		for (auto &param : parameters) {
-			f << stringf("%s\n", first ? "" : ",");
-			f << stringf("        %s%s: ", for_module ? "" : "    ", get_name(param.first).c_str());
+			out += first ? "\n" : ",\n";
+			out += for_module ? "        " : "            ";
+			write_name(param.first);
+			out += ": ";
 			write_parameter_value(param.second);
 			first = false;
 		}
 	}
 
+	void write_wire_details(Wire *w)
+	{
+		if (w->start_offset) {
+			out += "          \"offset\": ";
+			append_int(out, w->start_offset);
+			out += ",\n";
+		}
+		if (w->upto)
+			out += "          \"upto\": 1,\n";
+		if (w->is_signed)
+			out += "          \"signed\": 1,\n";
+	}
+
 	void write_module(Module *module_)
 	{
 		module = module_;
-		log_assert(module->design == design);
 		sigmap.set(module);
 		sigids.clear();
 
 		// reserve 0 and 1 to avoid confusion with "0" and "1"
 		sigidcounter = 2;
 
-		if (module->has_processes()) {
-			log_error("Module %s contains processes, which are not supported by JSON backend (run `proc` first).\n", log_id(module));
-		}
+		out += "    ";
+		write_name(module->name);
+		out += ": {\n";
 
-		f << stringf("    %s: {\n", get_name(module->name).c_str());
-
-		f << stringf("      \"attributes\": {");
+		out += "      \"attributes\": {";
 		write_parameters(module->attributes, /*for_module=*/true);
-		f << stringf("\n      },\n");
+		out += "\n      },\n";
 
 		if (module->parameter_default_values.size()) {
-			f << stringf("      \"parameter_default_values\": {");
+			out += "      \"parameter_default_values\": {";
 			write_parameters(module->parameter_default_values, /*for_module=*/true);
-			f << stringf("\n      },\n");
+			out += "\n      },\n";
 		}
 
-		f << stringf("      \"ports\": {");
+		out += "      \"ports\": {";
 		bool first = true;
 		for (auto n : module->ports) {
 			Wire *w = module->wire(n);
 			if (use_selection && !module->selected(w))
 				continue;
-			f << stringf("%s\n", first ? "" : ",");
-			f << stringf("        %s: {\n", get_name(n).c_str());
-			f << stringf("          \"direction\": \"%s\",\n", w->port_input ? w->port_output ? "inout" : "input" : "output");
-			if (w->start_offset)
-				f << stringf("          \"offset\": %d,\n", w->start_offset);
-			if (w->upto)
-				f << stringf("          \"upto\": 1,\n");
-			if (w->is_signed)
-				f << stringf("          \"signed\": %d,\n", w->is_signed);
-			f << stringf("          \"bits\": %s\n", get_bits(w).c_str());
-			f << stringf("        }");
+			out += first ? "\n" : ",\n";
+			out += "        ";
+			write_name(n);
+			out += ": {\n";
+			out += stringf("          \"direction\": \"%s\",\n", w->port_input ? w->port_output ? "inout" : "input" : "output");
+			write_wire_details(w);
+			out += "          \"bits\": ";
+			write_bits(w);
+			out += "\n        }";
 			first = false;
 		}
-		f << stringf("\n      },\n");
+		out += "\n      },\n";
 
-		f << stringf("      \"cells\": {");
+		out += "      \"cells\": {";
 		first = true;
 		for (auto c : module->cells()) {
 			if (use_selection && !module->selected(c))
 				continue;
-			f << stringf("%s\n", first ? "" : ",");
-			f << stringf("        %s: {\n", get_name(c->name).c_str());
-			f << stringf("          \"hide_name\": %s,\n", c->name[0] == '$' ? "1" : "0");
-			f << stringf("          \"type\": %s,\n", get_name(c->type).c_str());
+			out += first ? "\n" : ",\n";
+			out += "        ";
+			write_name(c->name);
+			out += ": {\n";
+			out += c->name[0] == '$' ? "          \"hide_name\": 1,\n" : "          \"hide_name\": 0,\n";
+			out += "          \"type\": ";
+			write_name(c->type);
+			out += ",\n";
 			if (aig_mode) {
 				Aig aig(c);
 				if (!aig.name.empty()) {
-					f << stringf("          \"model\": \"%s\",\n", aig.name.c_str());
-					aig_models.insert(aig);
+					out += stringf("          \"model\": \"%s\",\n", aig.name.c_str());
+					if (aig_models.insert(aig).second)
+						aig_models_order.push_back(aig);
 				}
 			}
-			f << stringf("          \"parameters\": {");
+			out += "          \"parameters\": {";
 			write_parameters(c->parameters);
-			f << stringf("\n          },\n");
-			f << stringf("          \"attributes\": {");
+			out += "\n          },\n";
+			out += "          \"attributes\": {";
 			write_parameters(c->attributes);
-			f << stringf("\n          },\n");
+			out += "\n          },\n";
 			if (c->known()) {
-				f << stringf("          \"port_directions\": {");
+				out += "          \"port_directions\": {";
 				bool first2 = true;
 				for (auto &conn : c->connections()) {
-					string direction = "output";
+					const char *direction = "output";
 					if (c->input(conn.first))
 						direction = c->output(conn.first) ? "inout" : "input";
-					f << stringf("%s\n", first2 ? "" : ",");
-					f << stringf("            %s: \"%s\"", get_name(conn.first).c_str(), direction.c_str());
+					out += first2 ? "\n" : ",\n";
+					out += "            ";
+					write_name(conn.first);
+					out += stringf(": \"%s\"", direction);
 					first2 = false;
 				}
-				f << stringf("\n          },\n");
+				out += "\n          },\n";
 			}
-			f << stringf("          \"connections\": {");
+			out += "          \"connections\": {";
 			bool first2 = true;
 			for (auto &conn : c->connections()) {
-				f << stringf("%s\n", first2 ? "" : ",");
-				f << stringf("            %s: %s", get_name(conn.first).c_str(), get_bits(conn.second).c_str());
+				out += first2 ? "\n" : ",\n";
+				out += "            ";
+				write_name(conn.first);
+				out += ": ";
+				write_bits(conn.second);
 				first2 = false;
 			}
-			f << stringf("\n          }\n");
-			f << stringf("        }");
+			out += "\n          }\n";
+			out += "        }";
 			first = false;
 		}
-		f << stringf("\n      },\n");
+		out += "\n      },\n";
 
 		if (!module->memories.empty()) {
-			f << stringf("      \"memories\": {");
+			out += "      \"memories\": {";
 			first = true;
 			for (auto &it : module->memories) {
 				if (use_selection && !module->selected(it.second))
 					continue;
-				f << stringf("%s\n", first ? "" : ",");
-				f << stringf("        %s: {\n", get_name(it.second->name).c_str());
-				f << stringf("          \"hide_name\": %s,\n", it.second->name[0] == '$' ? "1" : "0");
-				f << stringf("          \"attributes\": {");
+				out += first ? "\n" : ",\n";
+				out += "        ";
+				write_name(it.second->name);
+				out += ": {\n";
+				out += it.second->name[0] == '$' ? "          \"hide_name\": 1,\n" : "          \"hide_name\": 0,\n";
+				out += "          \"attributes\": {";
 				write_parameters(it.second->attributes);
-				f << stringf("\n          },\n");
-				f << stringf("          \"width\": %d,\n", it.second->width);
-				f << stringf("          \"start_offset\": %d,\n", it.second->start_offset);
-				f << stringf("          \"size\": %d\n", it.second->size);
-				f << stringf("        }");
+				out += "\n          },\n";
+				out += stringf("          \"width\": %d,\n", it.second->width);
+				out += stringf("          \"start_offset\": %d,\n", it.second->start_offset);
+				out += stringf("          \"size\": %d\n", it.second->size);
+				out += "        }";
 				first = false;
 			}
-			f << stringf("\n      },\n");
+			out += "\n      },\n";
 		}
 
-		f << stringf("      \"netnames\": {");
+		out += "      \"netnames\": {";
 		first = true;
 		for (auto w : module->wires()) {
 			if (use_selection && !module->selected(w))
 				continue;
-			f << stringf("%s\n", first ? "" : ",");
-			f << stringf("        %s: {\n", get_name(w->name).c_str());
-			f << stringf("          \"hide_name\": %s,\n", w->name[0] == '$' ? "1" : "0");
-			f << stringf("          \"bits\": %s,\n", get_bits(w).c_str());
-			if (w->start_offset)
-				f << stringf("          \"offset\": %d,\n", w->start_offset);
-			if (w->upto)
-				f << stringf("          \"upto\": 1,\n");
-			if (w->is_signed)
-				f << stringf("          \"signed\": %d,\n", w->is_signed);
-			f << stringf("          \"attributes\": {");
+			out += first ? "\n" : ",\n";
+			out += "        ";
+			write_name(w->name);
+			out += ": {\n";
+			out += w->name[0] == '$' ? "          \"hide_name\": 1,\n" : "          \"hide_name\": 0,\n";
+			out += "          \"bits\": ";
+			write_bits(w);
+			out += ",\n";
+			write_wire_details(w);
+			out += "          \"attributes\": {";
 			write_parameters(w->attributes);
-			f << stringf("\n          }\n");
-			f << stringf("        }");
+			out += "\n          }\n";
+			out += "        }";
 			first = false;
 		}
-		f << stringf("\n      }\n");
+		out += "\n      }\n";
 
-		f << stringf("    }");
+		out += "    }";
+	}
+};
+
+struct JsonWriter
+{
+	std::ostream &f;
+	bool use_selection;
+	bool aig_mode;
+	bool compat_int_mode;
+
+	// with "write_json -fd", the output is written to this file descriptor
+	// instead of the stream
+	int fd = -1;
+	string buffer;
+
+	Design *design;
+	pool<Aig> aig_models;
+
+	JsonWriter(std::ostream &f, bool use_selection, bool aig_mode, bool compat_int_mode) :
+			f(f), use_selection(use_selection), aig_mode(aig_mode),
+			compat_int_mode(compat_int_mode) { }
+
+	void write_out(const string &str)
+	{
+		if (fd < 0) {
+			f.write(str.data(), str.size());
+			return;
+		}
+
+		const char *p = str.data();
+		size_t size = str.size();
+		while (size > 0) {
+#ifdef _WIN32
+			int n = _write(fd, p, std::min<size_t>(size, 1 << 30));
+#else
+			ssize_t n = write(fd, p, size);
+#endif
+			if (n < 0 && errno == EINTR)
+				continue;
+			if (n < 0)
+				log_error("Can't write to file descriptor %d: %s\n", fd, strerror(errno));
+			p += n;
+			size -= n;
+		}
+	}
+
+	// Small pieces of output are collected in the buffer and written in large
+	// blocks, larger ones are written directly.
+	void put(const string &str)
+	{
+		if (GetSize(str) >= (1 << 20)) {
+			flush();
+			write_out(str);
+			return;
+		}
+		buffer += str;
+		if (GetSize(buffer) >= (1 << 20))
+			flush();
+	}
+
+	void flush()
+	{
+		write_out(buffer);
+		buffer.clear();
 	}
 
 	void write_design(Design *design_)
@@ -287,48 +406,80 @@ struct JsonWriter
 		design = design_;
 		design->sort();
 
-		f << stringf("{\n");
-		f << stringf("  \"creator\": %s,\n", get_string(yosys_version_str).c_str());
-		f << stringf("  \"modules\": {\n");
 		vector<Module*> modules = use_selection ? design->selected_modules() : design->modules();
-		bool first_module = true;
 		for (auto mod : modules) {
-			if (!first_module)
-				f << stringf(",\n");
-			write_module(mod);
-			first_module = false;
+			log_assert(mod->design == design);
+			if (mod->has_processes())
+				log_error("Module %s contains processes, which are not supported by JSON backend (run `proc` first).\n", log_id(mod));
+		}
+
+		// anything already written to the stream goes first
+		if (fd >= 0)
+			f.flush();
+
+		put("{\n");
+		put(stringf("  \"creator\": %s,\n", get_string(yosys_version_str).c_str()));
+		put("  \"modules\": {\n");
+
+		// The modules are rendered in parallel in batches of a few modules
+		// per thread, which limits the memory used for the rendered modules
+		// that are not written yet.
+		int batch_size = 4 * std::max(yosys_threads, 1);
+		for (int batch = 0; batch < GetSize(modules); batch += batch_size)
+		{
+			int n = std::min(batch_size, GetSize(modules) - batch);
+			vector<string> rendered(n);
+			vector<vector<Aig>> models(n);
+
+			parallel_for_unnamed(n, [&](int i) {
+				JsonModuleWriter writer(use_selection, aig_mode, compat_int_mode);
+				writer.write_module(modules[batch + i]);
+				rendered[i].swap(writer.out);
+				models[i].swap(writer.aig_models_order);
+			});
+
+			for (int i = 0; i < n; i++) {
+				if (batch + i != 0)
+					put(",\n");
+				put(rendered[i]);
+				string().swap(rendered[i]);
+				for (auto &aig : models[i])
+					aig_models.insert(aig);
+			}
 		}
-		f << stringf("\n  }");
+
+		put("\n  }");
 		if (!aig_models.empty()) {
-			f << stringf(",\n  \"models\": {\n");
+			put(",\n  \"models\": {\n");
 			bool first_model = true;
 			for (auto &aig : aig_models) {
 				if (!first_model)
-					f << stringf(",\n");
-				f << stringf("    \"%s\": [\n", aig.name.c_str());
+					put(",\n");
+				put(stringf("    \"%s\": [\n", aig.name.c_str()));
 				int node_idx = 0;
 				for (auto &node : aig.nodes) {
 					if (node_idx != 0)
-						f << stringf(",\n");
-					f << stringf("      /* %3d */ [ ", node_idx);
+						put(",\n");
+					put(stringf("      /* %3d */ [ ", node_idx));
 					if (node.portbit >= 0)
-						f << stringf("\"%sport\", \"%s\", %d", node.inverter ? "n" : "",
-								log_id(node.portname), node.portbit);
+						put(stringf("\"%sport\", \"%s\", %d", node.inverter ? "n" : "",
+								log_id(node.portname), node.portbit));
 					else if (node.left_parent < 0 && node.right_parent < 0)
-						f << stringf("\"%s\"", node.inverter ? "true" : "false");
+						put(stringf("\"%s\"", node.inverter ? "true" : "false"));
 					else
-						f << stringf("\"%s\", %d, %d", node.inverter ? "nand" : "and", node.left_parent, node.right_parent);
+						put(stringf("\"%s\", %d, %d", node.inverter ? "nand" : "and", node.left_parent, node.right_parent));
 					for (auto &op : node.outports)
-						f << stringf(", \"%s\", %d", log_id(op.first), op.second);
-					f << stringf(" ]");
+						put(stringf(", \"%s\", %d", log_id(op.first), op.second));
+					put(" ]");
 					node_idx++;
 				}
-				f << stringf("\n    ]");
+				put("\n    ]");
 				first_model = false;
 			}
-			f << stringf("\n  }");
+			put("\n  }");
 		}
-		f << stringf("\n}\n");
+		put("\n}\n");
+		flush();
 	}
 };
 
@@ -349,6 +500,14 @@ struct JsonBackend : public Backend {
 		log("        emit 32-bit or smaller fully-defined parameter values directly\n");
 		log("        as JSON numbers (for compatibility with old parsers)\n");
 		log("\n");
+		log("    -fd <n>\n");
+		log("        write the output to the already open file descriptor <n> (e.g. a\n");
+		log("        pipe set up by the process that runs yosys) in large blocks,\n");
+		log("        bypassing the C++ stream. can't be combined with a filename.\n");
+		log("\n");
+		log("The modules are rendered in parallel when yosys is run with more than one\n");
+		log("thread (-j).\n");
+		log("\n");
 		log("\n");
 		log("The general syntax of the JSON output created by this command is as follows:\n");
 		log("\n");
@@ -593,6 +752,7 @@ struct JsonBackend : public Backend {
 	{
 		bool aig_mode = false;
 		bool compat_int_mode = false;
+		int fd = -1;
 
 		size_t argidx;
 		for (argidx = 1; argidx < args.size(); argidx++)
@@ -605,13 +765,23 @@ struct JsonBackend : public Backend {
 				compat_int_mode = true;
 				continue;
 			}
+			if (args[argidx] == "-fd" && argidx+1 < args.size()) {
+				fd = atoi(args[++argidx].c_str());
+				if (fd < 0)
+					log_cmd_error("Invalid file descriptor `%s'.\n", args[argidx].c_str());
+				continue;
+			}
 			break;
 		}
 		extra_args(f, filename, args, argidx);
 
+		if (fd >= 0 && filename != "<stdout>")
+			log_cmd_error("Option -fd can't be combined with an output filename.\n");
+
 		log_header(design, "Executing JSON backend.\n");
 
 		JsonWriter json_writer(*f, false, aig_mode, compat_int_mode);
+		json_writer.fd = fd;
 		json_writer.write_design(design);
 	}
 } JsonBackend;
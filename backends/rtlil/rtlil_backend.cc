@@ -23,6 +23,7 @@
  */
 
 #include "rtlil_backend.h"
+#include "rtlil_binary.h"
 #include "kernel/yosys.h"
 #include <errno.h>
 
@@ -431,10 +432,17 @@ struct RTLILBackend : public Backend {
 		log("    -selected\n");
 		log("        only write selected parts of the design.\n");
 		log("\n");
+		log("    -binary\n");
+		log("        write a binary RTLIL file that can be read back with 'read_rtlil\n");
+		log("        -binary'. the binary format is faster to write and read than the\n");
+		log("        text format and is meant for saving and restoring checkpoints. with\n");
+		log("        -selected only fully selected modules are written.\n");
+		log("\n");
 	}
 	void execute(std::ostream *&f, std::string filename, std::vector<std::string> args, RTLIL::Design *design) override
 	{
 		bool selected = false;
+		bool binary = false;
 
 		log_header(design, "Executing RTLIL backend.\n");
 
@@ -445,13 +453,23 @@ struct RTLILBackend : public Backend {
 				selected = true;
 				continue;
 			}
+			if (arg == "-binary") {
+				binary = true;
+				continue;
+			}
 			break;
 		}
-		extra_args(f, filename, args, argidx);
+		extra_args(f, filename, args, argidx, binary);
 
 		design->sort();
 
 		log("Output filename: %s\n", filename.c_str());
+
+		if (binary) {
+			RTLIL_BINARY::write_design(*f, design, selected ? design->selected_whole_modules_warn() : design->modules().to_vector());
+			return;
+		}
+
 		*f << stringf("# Generated by %s\n", yosys_version_str);
 		RTLIL_BACKEND::dump_design(*f, design, selected, true, false);
 	}
@@ -0,0 +1,334 @@
+/*
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ *  ---
+ *
+ *  The writer of the binary RTLIL format, see rtlil_binary.h.
+ *
+ */
+
+#include "rtlil_binary.h"
+#include "kernel/threading.h"
+
+YOSYS_NAMESPACE_BEGIN
+
+namespace {
+
+struct BinaryEncoder
+{
+	std::string data;
+
+	void put_uint(uint64_t value)
+	{
+		while (value >= 0x80) {
+			data.push_back(char(value | 0x80));
+			value >>= 7;
+		}
+		data.push_back(char(value));
+	}
+
+	void put_sint(int64_t value)
+	{
+		put_uint((uint64_t(value) << 1) ^ uint64_t(value >> 63));
+	}
+};
+
+struct ModuleEncoder : BinaryEncoder
+{
+	const dict<RTLIL::IdString, int> &strings;
+	dict<RTLIL::Wire*, int> wire_index;
+
+	ModuleEncoder(const dict<RTLIL::IdString, int> &strings) : strings(strings) { }
+
+	void put_id(RTLIL::IdString id)
+	{
+		put_uint(strings.at(id));
+	}
+
+	void put_bits(const std::vector<RTLIL::State> &bits)
+	{
+		bool packed = true;
+		for (auto bit : bits)
+			if (bit != RTLIL::S0 && bit != RTLIL::S1) {
+				packed = false;
+				break;
+			}
+
+		put_uint(uint64_t(bits.size()) << 1 | packed);
+		if (packed) {
+			for (size_t i = 0; i < bits.size(); i += 8) {
+				unsigned char byte = 0;
+				for (size_t j = i; j < std::min(i + 8, bits.size()); j++)
+					if (bits[j] == RTLIL::S1)
+						byte |= 1 << (j - i);
+				data.push_back(byte);
+			}
+		} else {
+			for (auto bit : bits)
+				data.push_back(char(bit));
+		}
+	}
+
+	void put_const(const RTLIL::Const &value)
+	{
+		put_uint(value.flags);
+		put_bits(value.bits);
+	}
+
+	void put_sigspec(const RTLIL::SigSpec &sig)
+	{
+		put_uint(sig.chunks().size());
+		for (auto &chunk : sig.chunks()) {
+			if (chunk.wire == nullptr) {
+				put_uint(0);
+				put_bits(chunk.data);
+			} else {
+				put_uint(wire_index.at(chunk.wire) + 1);
+				put_uint(chunk.offset);
+				put_uint(chunk.width);
+			}
+		}
+	}
+
+	void put_attributes(const dict<RTLIL::IdString, RTLIL::Const> &attributes)
+	{
+		put_uint(attributes.size());
+		for (auto &it : attributes) {
+			put_id(it.first);
+			put_const(it.second);
+		}
+	}
+
+	void put_case(const RTLIL::CaseRule *rule)
+	{
+		put_attributes(rule->attributes);
+		put_uint(rule->compare.size());
+		for (auto &sig : rule->compare)
+			put_sigspec(sig);
+		put_uint(rule->actions.size());
+		for (auto &action : rule->actions) {
+			put_sigspec(action.first);
+			put_sigspec(action.second);
+		}
+		put_uint(rule->switches.size());
+		for (auto sw : rule->switches) {
+			put_attributes(sw->attributes);
+			put_sigspec(sw->signal);
+			put_uint(sw->cases.size());
+			for (auto cs : sw->cases)
+				put_case(cs);
+		}
+	}
+
+	void put_module(RTLIL::Module *module)
+	{
+		put_attributes(module->attributes);
+		put_uint(module->avail_parameters.size());
+		for (auto &id : module->avail_parameters)
+			put_id(id);
+		put_uint(module->parameter_default_values.size());
+		for (auto &it : module->parameter_default_values) {
+			put_id(it.first);
+			put_const(it.second);
+		}
+
+		put_uint(GetSize(module->wires()));
+		for (auto wire : module->wires()) {
+			int index = GetSize(wire_index);
+			wire_index[wire] = index;
+			put_id(wire->name);
+			put_uint(wire->width);
+			put_sint(wire->start_offset);
+			put_uint(wire->port_id);
+			put_uint((wire->port_input ? 1 : 0) | (wire->port_output ? 2 : 0) | (wire->upto ? 4 : 0) | (wire->is_signed ? 8 : 0));
+			put_attributes(wire->attributes);
+		}
+
+		put_uint(module->memories.size());
+		for (auto &it : module->memories) {
+			put_id(it.second->name);
+			put_uint(it.second->width);
+			put_sint(it.second->start_offset);
+			put_uint(it.second->size);
+			put_attributes(it.second->attributes);
+		}
+
+		put_uint(GetSize(module->cells()));
+		for (auto cell : module->cells()) {
+			put_id(cell->name);
+			put_id(cell->type);
+			put_attributes(cell->attributes);
+			put_uint(cell->parameters.size());
+			for (auto &it : cell->parameters) {
+				put_id(it.first);
+				put_const(it.second);
+			}
+			put_uint(cell->connections().size());
+			for (auto &it : cell->connections()) {
+				put_id(it.first);
+				put_sigspec(it.second);
+			}
+		}
+
+		put_uint(module->processes.size());
+		for (auto &it : module->processes) {
+			RTLIL::Process *proc = it.second;
+			put_id(proc->name);
+			put_attributes(proc->attributes);
+			put_case(&proc->root_case);
+			put_uint(proc->syncs.size());
+			for (auto sync : proc->syncs) {
+				put_uint(sync->type);
+				put_sigspec(sync->signal);
+				put_uint(sync->actions.size());
+				for (auto &action : sync->actions) {
+					put_sigspec(action.first);
+					put_sigspec(action.second);
+				}
+				put_uint(sync->mem_write_actions.size());
+				for (auto &act : sync->mem_write_actions) {
+					put_attributes(act.attributes);
+					put_id(act.memid);
+					put_sigspec(act.address);
+					put_sigspec(act.data);
+					put_sigspec(act.enable);
+					put_const(act.priority_mask);
+				}
+			}
+		}
+
+		put_uint(module->connections().size());
+		for (auto &it : module->connections()) {
+			put_sigspec(it.first);
+			put_sigspec(it.second);
+		}
+	}
+};
+
+// Collects the names used by the modules in the order of their first use.
+struct StringCollector
+{
+	dict<RTLIL::IdString, int> strings;
+	std::vector<RTLIL::IdString> order;
+
+	void add(RTLIL::IdString id)
+	{
+		if (strings.insert(std::make_pair(id, GetSize(order))).second)
+			order.push_back(id);
+	}
+
+	void add_attributes(const dict<RTLIL::IdString, RTLIL::Const> &attributes)
+	{
+		for (auto &it : attributes)
+			add(it.first);
+	}
+
+	void add_case(const RTLIL::CaseRule *rule)
+	{
+		add_attributes(rule->attributes);
+		for (auto sw : rule->switches) {
+			add_attributes(sw->attributes);
+			for (auto cs : sw->cases)
+				add_case(cs);
+		}
+	}
+
+	void add_module(RTLIL::Module *module)
+	{
+		add(module->name);
+		add_attributes(module->attributes);
+		for (auto &id : module->avail_parameters)
+			add(id);
+		for (auto &it : module->parameter_default_values)
+			add(it.first);
+		for (auto wire : module->wires()) {
+			add(wire->name);
+			add_attributes(wire->attributes);
+		}
+		for (auto &it : module->memories) {
+			add(it.second->name);
+			add_attributes(it.second->attributes);
+		}
+		for (auto cell : module->cells()) {
+			add(cell->name);
+			add(cell->type);
+			add_attributes(cell->attributes);
+			for (auto &it : cell->parameters)
+				add(it.first);
+			for (auto &it : cell->connections())
+				add(it.first);
+		}
+		for (auto &it : module->processes) {
+			add(it.second->name);
+			add_attributes(it.second->attributes);
+			add_case(&it.second->root_case);
+			for (auto sync : it.second->syncs)
+				for (auto &act : sync->mem_write_actions) {
+					add_attributes(act.attributes);
+					add(act.memid);
+				}
+		}
+	}
+};
+
+} // namespace
+
+void RTLIL_BINARY::write_design(std::ostream &f, RTLIL::Design *, const std::vector<RTLIL::Module*> &modules)
+{
+	StringCollector collector;
+	for (auto module : modules)
+		collector.add_module(module);
+
+	std::vector<std::string> sections(modules.size());
+	parallel_for_unnamed(GetSize(modules), [&](int i) {
+		ModuleEncoder encoder(collector.strings);
+		encoder.put_module(modules[i]);
+		sections[i] = std::move(encoder.data);
+	});
+
+	BinaryEncoder header;
+	header.data.append(magic, sizeof(magic));
+	header.put_uint(version);
+	header.put_uint(autoidx);
+	header.put_uint(collector.order.size());
+	for (auto id : collector.order) {
+		size_t len = strlen(id.c_str());
+		header.put_uint(len);
+		header.data.append(id.c_str(), len + 1);
+	}
+	f.write(header.data.data(), header.data.size());
+
+	BinaryEncoder index;
+	uint64_t offset = header.data.size();
+	index.put_uint(modules.size());
+	for (int i = 0; i < GetSize(modules); i++) {
+		f.write(sections[i].data(), sections[i].size());
+		index.put_uint(collector.strings.at(modules[i]->name));
+		index.put_uint(offset);
+		index.put_uint(sections[i].size());
+		offset += sections[i].size();
+		std::string().swap(sections[i]);
+	}
+	f.write(index.data.data(), index.data.size());
+
+	char trailer[8];
+	for (int i = 0; i < 8; i++)
+		trailer[i] = char(offset >> (8 * i));
+	f.write(trailer, sizeof(trailer));
+}
+
+YOSYS_NAMESPACE_END
@@ -0,0 +1,77 @@
+/* -*- c++ -*-
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ *  ---
+ *
+ *  The binary RTLIL format of "write_rtlil -binary" and "read_rtlil -binary".
+ *
+ */
+
+#ifndef RTLIL_BINARY_H
+#define RTLIL_BINARY_H
+
+#include "kernel/yosys.h"
+
+YOSYS_NAMESPACE_BEGIN
+
+// A binary RTLIL file contains the same information as the text format. All
+// integers are LEB128 varints ("uint"), signed integers are zigzag encoded
+// ("sint"), names are indices into the string table ("id").
+//
+//   file:    magic[8] uint:version uint:autoidx strings module_section*
+//            index uint64le:index_offset
+//   strings: uint:count (uint:length char[length] '\0')*
+//   index:   uint:count (id:name uint:offset uint:size)*
+//
+// The sections of the modules are independent of each other, the reader
+// locates them through the index at the end of the file and decodes them in
+// parallel. The NUL-terminated strings are interned directly from the
+// memory-mapped file.
+//
+//   module:  attrs uint:count id* (avail_parameters)
+//            uint:count (id const)* (parameter_default_values)
+//            uint:count wire* uint:count memory* uint:count cell*
+//            uint:count process* uint:count (sigspec sigspec)* (connections)
+//   wire:    id:name uint:width sint:start_offset uint:port_id
+//            uint:flags (1 input, 2 output, 4 upto, 8 signed) attrs
+//   memory:  id:name uint:width sint:start_offset uint:size attrs
+//   cell:    id:name id:type attrs uint:count (id const)* uint:count (id sigspec)*
+//   process: id:name attrs case uint:count sync*
+//   case:    attrs uint:count sigspec* uint:count (sigspec sigspec)*
+//            uint:count switch*
+//   switch:  attrs sigspec uint:count case*
+//   sync:    uint:type sigspec uint:count (sigspec sigspec)*
+//            uint:count (attrs id:memid sigspec sigspec sigspec const)*
+//   attrs:   uint:count (id const)*
+//   const:   uint:flags bits
+//   bits:    uint:(width << 1 | packed) data, where data is one bit per
+//            0/1 state if packed, one byte per state otherwise
+//   sigspec: uint:count chunk*, where a chunk is uint:0 bits for constants,
+//            uint:(wire index + 1) uint:offset uint:width otherwise (wires
+//            are numbered in the order of the module section)
+
+namespace RTLIL_BINARY
+{
+	static const char magic[8] = {'\x89', 'Y', 'R', 'T', 'L', 'I', 'L', '\n'};
+	static const int version = 1;
+
+	void write_design(std::ostream &f, RTLIL::Design *design, const std::vector<RTLIL::Module*> &modules);
+}
+
+YOSYS_NAMESPACE_END
+
+#endif
@@ -30,6 +30,17 @@
 #include "kernel/yosys.h"
 #include "libs/sha1/sha1.h"
 #include "ast.h"
+#include "kernel/threading.h"
+#include "backends/rtlil/rtlil_backend.h"
+#include "frontends/rtlil/rtlil_frontend.h"
+
+#include <fstream>
+#ifndef YOSYS_DISABLE_THREADS
+#  include <mutex>
+#endif
+#if !defined(_WIN32) && !defined(__wasm)
+#  include <unistd.h>
+#endif
 
 YOSYS_NAMESPACE_BEGIN
 
@@ -38,24 +49,27 @@ using namespace AST_INTERNAL;
 
 // instantiate global variables (public API)
 namespace AST {
-	std::string current_filename;
+	thread_local std::string current_filename;
 	void (*set_line_num)(int) = NULL;
 	int (*get_line_num)() = NULL;
+	std::string elab_cache_dir;
+	std::atomic<int> elab_cache_hits, elab_cache_misses;
 }
 
-// instantiate global variables (private API)
+// instantiate global variables (private API), these are thread-local so that
+// AstModule::derive_detached() can run in parallel tasks
 namespace AST_INTERNAL {
-	bool flag_dump_ast1, flag_dump_ast2, flag_no_dump_ptr, flag_dump_vlog1, flag_dump_vlog2, flag_dump_rtlil, flag_nolatches, flag_nomeminit;
-	bool flag_nomem2reg, flag_mem2reg, flag_noblackbox, flag_lib, flag_nowb, flag_noopt, flag_icells, flag_pwires, flag_autowire;
-	AstNode *current_ast, *current_ast_mod;
-	std::map<std::string, AstNode*> current_scope;
-	const dict<RTLIL::SigBit, RTLIL::SigBit> *genRTLIL_subst_ptr = NULL;
-	RTLIL::SigSpec ignoreThisSignalsInInitial;
-	AstNode *current_always, *current_top_block, *current_block, *current_block_child;
-	Module *current_module;
-	bool current_always_clocked;
-	dict<std::string, int> current_memwr_count;
-	dict<std::string, pool<int>> current_memwr_visible;
+	thread_local bool flag_dump_ast1, flag_dump_ast2, flag_no_dump_ptr, flag_dump_vlog1, flag_dump_vlog2, flag_dump_rtlil, flag_nolatches, flag_nomeminit;
+	thread_local bool flag_nomem2reg, flag_mem2reg, flag_noblackbox, flag_lib, flag_nowb, flag_noopt, flag_icells, flag_pwires, flag_autowire;
+	thread_local AstNode *current_ast, *current_ast_mod;
+	thread_local std::map<std::string, AstNode*> current_scope;
+	thread_local const dict<RTLIL::SigBit, RTLIL::SigBit> *genRTLIL_subst_ptr = NULL;
+	thread_local RTLIL::SigSpec ignoreThisSignalsInInitial;
+	thread_local AstNode *current_always, *current_top_block, *current_block, *current_block_child;
+	thread_local Module *current_module;
+	thread_local bool current_always_clocked;
+	thread_local dict<std::string, int> current_memwr_count;
+	thread_local dict<std::string, pool<int>> current_memwr_visible;
 }
 
 // convert node types to string
@@ -197,13 +211,63 @@ bool AstNode::get_bool_attribute(RTLIL::IdString id)
 	return attr->integer != 0;
 }
 
+#ifndef YOSYS_DISABLE_AST_POOL
+// simplify() creates and deletes nodes at a high rate (loop unrolling, generate
+// blocks, function inlining), so they are not allocated one by one. Each thread
+// keeps a list of free node slots that is refilled a block at a time, and
+// deleted nodes go back to the list of the thread that deletes them. Blocks
+// are kept for reuse until the process exits. Build with
+// -DYOSYS_DISABLE_AST_POOL (implied by SANITIZER) to use plain new/delete.
+namespace {
+	union AstNodeSlot {
+		AstNodeSlot *next;
+		alignas(AstNode) char data[sizeof(AstNode)];
+	};
+	const int ast_node_block_size = 65536 / sizeof(AstNodeSlot);
+	thread_local AstNodeSlot *ast_node_free_list = nullptr;
+}
+
+void *AstNode::operator new(size_t size)
+{
+	log_assert(size == sizeof(AstNodeSlot::data));
+	if (ast_node_free_list == nullptr) {
+		AstNodeSlot *block = static_cast<AstNodeSlot*>(::operator new(ast_node_block_size * sizeof(AstNodeSlot)));
+		for (int i = 0; i < ast_node_block_size - 1; i++)
+			block[i].next = &block[i+1];
+		block[ast_node_block_size - 1].next = nullptr;
+		ast_node_free_list = block;
+	}
+	AstNodeSlot *slot = ast_node_free_list;
+	ast_node_free_list = slot->next;
+	return slot;
+}
+
+void AstNode::operator delete(void *ptr)
+{
+	if (ptr == nullptr)
+		return;
+	AstNodeSlot *slot = static_cast<AstNodeSlot*>(ptr);
+	slot->next = ast_node_free_list;
+	ast_node_free_list = slot;
+}
+#endif
+
+static unsigned int next_ast_hashidx()
+{
+	static unsigned int hashidx_count = 123456789;
+	if (parallel_task != nullptr) {
+		parallel_task->hashidx = mkhash_xorshift(parallel_task->hashidx);
+		return parallel_task->hashidx;
+	}
+	hashidx_count = mkhash_xorshift(hashidx_count);
+	return hashidx_count;
+}
+
 // create new node (AstNode constructor)
 // (the optional child arguments make it easier to create AST trees)
 AstNode::AstNode(AstNodeType type, AstNode *child1, AstNode *child2, AstNode *child3, AstNode *child4)
 {
-	static unsigned int hashidx_count = 123456789;
-	hashidx_count = mkhash_xorshift(hashidx_count);
-	hashidx_ = hashidx_count;
+	hashidx_ = next_ast_hashidx();
 
 	this->type = type;
 	filename = current_filename;
@@ -243,8 +307,10 @@ AstNode::AstNode(AstNodeType type, AstNode *child1, AstNode *child2, AstNode *ch
 // create a (deep recursive) copy of a node
 AstNode *AstNode::clone() const
 {
-	AstNode *that = new AstNode;
-	*that = *this;
+	// copy-construct instead of default-constructing and assigning, a clone
+	// keeps the hash index of the original but still advances the generator
+	next_ast_hashidx();
+	AstNode *that = new AstNode(*this);
 	for (auto &it : that->children)
 		it = it->clone();
 	for (auto &it : that->attributes)
@@ -998,7 +1064,7 @@ static bool param_has_no_default(const AstNode *param) {
 		(children.size() == 1 && children[0]->type == AST_RANGE);
 }
 
-static RTLIL::Module *process_module(RTLIL::Design *design, AstNode *ast, bool defer, AstNode *original_ast = NULL, bool quiet = false)
+static RTLIL::Module *process_module(RTLIL::Design *design, AstNode *ast, bool defer, AstNode *original_ast = NULL, bool quiet = false, bool add_to_design = true)
 {
 	log_assert(current_scope.empty());
 	log_assert(ast->type == AST_MODULE || ast->type == AST_INTERFACE);
@@ -1216,7 +1282,8 @@ static RTLIL::Module *process_module(RTLIL::Design *design, AstNode *ast, bool d
 		log("--- END OF RTLIL DUMP ---\n");
 	}
 
-	design->add(current_module);
+	if (add_to_design)
+		design->add(current_module);
 	return current_module;
 }
 
@@ -1606,7 +1673,10 @@ RTLIL::IdString AstModule::derive(RTLIL::Design *design, const dict<RTLIL::IdStr
 			explode_interface_port(new_ast, intfmodule, intfname, modport);
 		}
 
-		process_module(design, new_ast, false);
+		if (has_interfaces)
+			process_module(design, new_ast, false);
+		else
+			derive_cached(design, parameters, new_ast, false, true);
 		design->module(modname)->check();
 
 		RTLIL::Module* mod = design->module(modname);
@@ -1657,8 +1727,7 @@ RTLIL::IdString AstModule::derive(RTLIL::Design *design, const dict<RTLIL::IdStr
 
 	if (!design->has(modname) && new_ast) {
 		new_ast->str = modname;
-		process_module(design, new_ast, false, NULL, quiet);
-		design->module(modname)->check();
+		derive_cached(design, parameters, new_ast, quiet, true)->check();
 	} else if (!quiet) {
 		log("Found cached RTLIL representation for module `%s'.\n", modname.c_str());
 	}
@@ -1667,6 +1736,214 @@ RTLIL::IdString AstModule::derive(RTLIL::Design *design, const dict<RTLIL::IdStr
 	return modname;
 }
 
+// elaborate a parametric module like derive() above, but return it instead of
+// adding it to the design (see hierarchy with "yosys -j")
+RTLIL::Module *AstModule::derive_detached(RTLIL::Design *design, const dict<RTLIL::IdString, RTLIL::Const> &parameters)
+{
+	bool quiet = lib || attributes.count(ID::blackbox) || attributes.count(ID::whitebox);
+
+	AstNode *new_ast = NULL;
+	std::string modname = derive_common(design, parameters, &new_ast, quiet);
+	if (new_ast == NULL)
+		return nullptr;
+
+	new_ast->str = modname;
+	RTLIL::Module *mod = derive_cached(design, parameters, new_ast, quiet, false);
+	mod->check();
+
+	delete new_ast;
+	return mod;
+}
+
+static std::string serialize_param_value(const RTLIL::Const &val);
+
+static void elab_cache_hash_ast(SHA1 &hash, const AstNode *node)
+{
+	std::string buf = stringf("%d %d:", node->type, GetSize(node->str)) + node->str;
+	buf += stringf(" %d:", GetSize(node->bits));
+	for (auto bit : node->bits)
+		buf.push_back('0' + bit);
+	buf += stringf(" %d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d %d %d %d %u %a", node->is_input, node->is_output, node->is_reg,
+			node->is_logic, node->is_signed, node->is_string, node->is_wand, node->is_wor, node->range_valid,
+			node->range_swapped, node->was_checked, node->is_unsized, node->is_custom_type, node->is_enum,
+			node->basic_prep, node->lookahead, node->port_id, node->range_left, node->range_right,
+			(unsigned int)node->integer, node->realvalue);
+	for (int i = 0; i < GetSize(node->multirange_dimensions); i++)
+		buf += stringf(" %d", node->multirange_dimensions[i]);
+	for (int i = 0; i < GetSize(node->multirange_swapped); i++)
+		buf += node->multirange_swapped[i] ? " s" : " n";
+	buf += stringf(" %d:%s %u.%u-%u.%u %d %d\n", GetSize(node->filename), node->filename.c_str(),
+			node->location.first_line, node->location.first_column, node->location.last_line,
+			node->location.last_column, GetSize(node->attributes), GetSize(node->children));
+	hash.update(buf);
+
+	for (auto &attr : node->attributes) {
+		hash.update(stringf("%d:%s ", GetSize(attr.first.str()), attr.first.c_str()));
+		elab_cache_hash_ast(hash, attr.second);
+	}
+	for (auto child : node->children)
+		elab_cache_hash_ast(hash, child);
+}
+
+// The key of a derived module in the elaboration cache. It covers everything
+// that process_module() depends on, except for the other modules in the design
+// that simplify() may look up (see get_simplify_design_context_used()).
+static std::string elab_cache_key(const AstModule *module, const std::string &modname, const dict<RTLIL::IdString, RTLIL::Const> &parameters)
+{
+	SHA1 hash;
+	hash.update(stringf("%s\n%d:%s\n", yosys_version_str, GetSize(modname), modname.c_str()));
+	hash.update(stringf("%d%d%d%d%d%d%d%d%d%d%d\n", module->nolatches, module->nomeminit, module->nomem2reg,
+			module->mem2reg, module->noblackbox, module->lib, module->nowb, module->noopt, module->icells,
+			module->pwires, module->autowire));
+
+	std::map<std::string, std::string> sorted_parameters;
+	for (auto &it : parameters)
+		sorted_parameters[it.first.str()] = serialize_param_value(it.second);
+	for (auto &it : sorted_parameters)
+		hash.update(stringf("%s=%s\n", it.first.c_str(), it.second.c_str()));
+
+	elab_cache_hash_ast(hash, module->ast);
+	return hash.final();
+}
+
+#ifndef YOSYS_DISABLE_THREADS
+// the RTLIL parser is not reentrant
+static std::mutex elab_cache_parser_mutex;
+#endif
+
+// returns the module stored in the given cache file, or nullptr if there is
+// no such file or it can't be used
+static AstModule *elab_cache_load(const std::string &filename, const std::string &modname)
+{
+	std::ifstream f(filename, std::ios::binary);
+	if (f.fail())
+		return nullptr;
+
+	// the RTLIL parser exits on errors, so only hand it files that are
+	// known to be complete
+	std::string header, checksum;
+	std::getline(f, header);
+	std::getline(f, checksum);
+	std::stringstream body;
+	body << f.rdbuf();
+	if (f.bad() || header != stringf("# Generated by %s", yosys_version_str) || checksum.compare(0, 11, "# Checksum ") != 0) {
+		log_warning("Ignoring unreadable elaboration cache file `%s'.\n", filename.c_str());
+		return nullptr;
+	}
+	SHA1 hash;
+	hash.update(body.str());
+	if (checksum.substr(11) != hash.final()) {
+		log_warning("Ignoring corrupt elaboration cache file `%s'.\n", filename.c_str());
+		return nullptr;
+	}
+
+	RTLIL::Design cache_design;
+	{
+#ifndef YOSYS_DISABLE_THREADS
+		std::lock_guard<std::mutex> lock(elab_cache_parser_mutex);
+#endif
+		RTLIL_FRONTEND::lexin = &body;
+		RTLIL_FRONTEND::current_design = &cache_design;
+		RTLIL_FRONTEND::flag_nooverwrite = false;
+		RTLIL_FRONTEND::flag_overwrite = false;
+		RTLIL_FRONTEND::flag_lib = false;
+		rtlil_frontend_yydebug = false;
+		rtlil_frontend_yyrestart(NULL);
+		rtlil_frontend_yyparse();
+		rtlil_frontend_yylex_destroy();
+	}
+
+	RTLIL::Module *cached = cache_design.module(modname);
+	if (cached == nullptr) {
+		log_warning("Ignoring elaboration cache file `%s' without module `%s'.\n", filename.c_str(), modname.c_str());
+		return nullptr;
+	}
+
+	AstModule *module = new AstModule;
+	module->name = modname;
+	cached->cloneInto(module);
+	module->fixup_ports();
+	return module;
+}
+
+static void elab_cache_store(const std::string &filename, RTLIL::Design *design, RTLIL::Module *module)
+{
+	std::stringstream body;
+	RTLIL_BACKEND::dump_module(body, "", module, design, false);
+	SHA1 hash;
+	hash.update(body.str());
+
+	// write to a temporary file first, so that concurrent runs using the same
+	// cache never see a partially written file
+#if defined(_WIN32) || defined(__wasm)
+	std::string tmp_filename = make_temp_file(filename + ".tmpXXXXXX");
+#else
+	std::string tmp_filename = filename + ".tmp";
+	std::vector<char> tmp_template(tmp_filename.begin(), tmp_filename.end());
+	tmp_template.insert(tmp_template.end(), {'X', 'X', 'X', 'X', 'X', 'X', 0});
+	int fd = mkstemp(tmp_template.data());
+	if (fd < 0) {
+		log_warning("Can't create temporary elaboration cache file in `%s': %s\n", elab_cache_dir.c_str(), strerror(errno));
+		return;
+	}
+	close(fd);
+	tmp_filename = tmp_template.data();
+#endif
+
+	std::ofstream f(tmp_filename, std::ios::binary);
+	f << stringf("# Generated by %s\n", yosys_version_str);
+	f << stringf("# Checksum %s\n", hash.final().c_str());
+	f << body.rdbuf();
+	f.close();
+
+	if (f.fail() || rename(tmp_filename.c_str(), filename.c_str()) != 0) {
+		log_warning("Can't write elaboration cache file `%s': %s\n", filename.c_str(), strerror(errno));
+		remove(tmp_filename.c_str());
+	}
+}
+
+// run process_module() for derive() and derive_detached(), or load the result
+// from the elaboration cache if it is enabled
+RTLIL::Module *AstModule::derive_cached(RTLIL::Design *design, const dict<RTLIL::IdString, RTLIL::Const> &parameters, AstNode *new_ast, bool quiet, bool add_to_design)
+{
+	if (elab_cache_dir.empty())
+		return process_module(design, new_ast, false, NULL, quiet, add_to_design);
+
+	std::string filename = elab_cache_dir + "/" + elab_cache_key(this, new_ast->str, parameters) + ".il";
+
+	AstModule *module = elab_cache_load(filename, new_ast->str);
+	if (module != nullptr) {
+		elab_cache_hits++;
+		if (!quiet)
+			log("Loaded RTLIL representation for module `%s' from elaboration cache.\n", new_ast->str.c_str());
+		module->ast = new_ast->clone();
+		module->nolatches = nolatches;
+		module->nomeminit = nomeminit;
+		module->nomem2reg = nomem2reg;
+		module->mem2reg = mem2reg;
+		module->noblackbox = noblackbox;
+		module->lib = lib;
+		module->nowb = nowb;
+		module->noopt = noopt;
+		module->icells = icells;
+		module->pwires = pwires;
+		module->autowire = autowire;
+		if (add_to_design)
+			design->add(module);
+		return module;
+	}
+
+	elab_cache_misses++;
+	RTLIL::Module *mod = process_module(design, new_ast, false, NULL, quiet, add_to_design);
+
+	// the result also depends on the modules that were looked up
+	if (get_simplify_design_context_used())
+		log("Not storing module `%s' in elaboration cache, it depends on other modules.\n", mod->name.c_str());
+	else
+		elab_cache_store(filename, design, mod);
+	return mod;
+}
+
 static std::string serialize_param_value(const RTLIL::Const &val) {
 	std::string res;
 	if (val.flags & RTLIL::ConstFlags::CONST_FLAG_STRING)
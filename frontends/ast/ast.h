@@ -32,6 +32,7 @@
 #include "kernel/rtlil.h"
 #include "kernel/fmt.h"
 #include <stdint.h>
+#include <atomic>
 #include <set>
 
 YOSYS_NAMESPACE_BEGIN
@@ -228,6 +229,12 @@ namespace AST
 		void delete_children();
 		~AstNode();
 
+#ifndef YOSYS_DISABLE_AST_POOL
+		// nodes are allocated from a thread-local pool (see ast.cc)
+		static void *operator new(size_t size);
+		static void operator delete(void *ptr);
+#endif
+
 		enum mem2reg_flags
 		{
 			/* status flags */
@@ -359,7 +366,9 @@ namespace AST
 		~AstModule() override;
 		RTLIL::IdString derive(RTLIL::Design *design, const dict<RTLIL::IdString, RTLIL::Const> &parameters, bool mayfail) override;
 		RTLIL::IdString derive(RTLIL::Design *design, const dict<RTLIL::IdString, RTLIL::Const> &parameters, const dict<RTLIL::IdString, RTLIL::Module*> &interfaces, const dict<RTLIL::IdString, RTLIL::IdString> &modports, bool mayfail) override;
+		RTLIL::Module *derive_detached(RTLIL::Design *design, const dict<RTLIL::IdString, RTLIL::Const> &parameters) override;
 		std::string derive_common(RTLIL::Design *design, const dict<RTLIL::IdString, RTLIL::Const> &parameters, AstNode **new_ast_out, bool quiet = false);
+		RTLIL::Module *derive_cached(RTLIL::Design *design, const dict<RTLIL::IdString, RTLIL::Const> &parameters, AstNode *new_ast, bool quiet, bool add_to_design);
 		void expand_interfaces(RTLIL::Design *design, const dict<RTLIL::IdString, RTLIL::Module *> &local_interfaces) override;
 		bool reprocess_if_necessary(RTLIL::Design *design) override;
 		RTLIL::Module *clone() const override;
@@ -369,7 +378,7 @@ namespace AST
 	// this must be set by the language frontend before parsing the sources
 	// the AstNode constructor then uses current_filename and get_line_num()
 	// to initialize the filename and linenum properties of new nodes
-	extern std::string current_filename;
+	extern thread_local std::string current_filename;
 	extern void (*set_line_num)(int);
 	extern int (*get_line_num)();
 
@@ -399,22 +408,31 @@ namespace AST
 	// used to provide simplify() access to the current design for looking up
 	// modules, ports, wires, etc.
 	void set_simplify_design_context(const RTLIL::Design *design);
+
+	// whether simplify() looked up any module in the design context since it
+	// was last set, in which case the result depends on more than the AST
+	bool get_simplify_design_context_used();
+
+	// on-disk cache of derived modules, used by AstModule::derive() while
+	// elab_cache_dir is not empty (see "hierarchy -elab_cache")
+	extern std::string elab_cache_dir;
+	extern std::atomic<int> elab_cache_hits, elab_cache_misses;
 }
 
 namespace AST_INTERNAL
 {
-	// internal state variables
-	extern bool flag_dump_ast1, flag_dump_ast2, flag_no_dump_ptr, flag_dump_rtlil, flag_nolatches, flag_nomeminit;
-	extern bool flag_nomem2reg, flag_mem2reg, flag_lib, flag_noopt, flag_icells, flag_pwires, flag_autowire;
-	extern AST::AstNode *current_ast, *current_ast_mod;
-	extern std::map<std::string, AST::AstNode*> current_scope;
-	extern const dict<RTLIL::SigBit, RTLIL::SigBit> *genRTLIL_subst_ptr;
-	extern RTLIL::SigSpec ignoreThisSignalsInInitial;
-	extern AST::AstNode *current_always, *current_top_block, *current_block, *current_block_child;
-	extern RTLIL::Module *current_module;
-	extern bool current_always_clocked;
-	extern dict<std::string, int> current_memwr_count;
-	extern dict<std::string, pool<int>> current_memwr_visible;
+	// internal state variables (thread-local, see AstModule::derive_detached())
+	extern thread_local bool flag_dump_ast1, flag_dump_ast2, flag_no_dump_ptr, flag_dump_rtlil, flag_nolatches, flag_nomeminit;
+	extern thread_local bool flag_nomem2reg, flag_mem2reg, flag_lib, flag_noopt, flag_icells, flag_pwires, flag_autowire;
+	extern thread_local AST::AstNode *current_ast, *current_ast_mod;
+	extern thread_local std::map<std::string, AST::AstNode*> current_scope;
+	extern thread_local const dict<RTLIL::SigBit, RTLIL::SigBit> *genRTLIL_subst_ptr;
+	extern thread_local RTLIL::SigSpec ignoreThisSignalsInInitial;
+	extern thread_local AST::AstNode *current_always, *current_top_block, *current_block, *current_block_child;
+	extern thread_local RTLIL::Module *current_module;
+	extern thread_local bool current_always_clocked;
+	extern thread_local dict<std::string, int> current_memwr_count;
+	extern thread_local dict<std::string, pool<int>> current_memwr_visible;
 	struct LookaheadRewriter;
 	struct ProcessGenerator;
 
@@ -506,18 +506,27 @@ static std::string prefix_id(const std::string &prefix, const std::string &str)
 	return prefix + str;
 }
 
-// direct access to this global should be limited to the following two functions
-static const RTLIL::Design *simplify_design_context = nullptr;
+// direct access to these globals should be limited to the following functions
+static thread_local const RTLIL::Design *simplify_design_context = nullptr;
+static thread_local bool simplify_design_context_used = false;
 
 void AST::set_simplify_design_context(const RTLIL::Design *design)
 {
 	log_assert(!simplify_design_context || !design);
 	simplify_design_context = design;
+	if (design)
+		simplify_design_context_used = false;
+}
+
+bool AST::get_simplify_design_context_used()
+{
+	return simplify_design_context_used;
 }
 
 // lookup the module with the given name in the current design context
 static const RTLIL::Module* lookup_module(const std::string &name)
 {
+	simplify_design_context_used = true;
 	return simplify_design_context->module(name);
 }
 
@@ -802,6 +811,553 @@ static void check_auto_nosync(AstNode *node)
 		check_auto_nosync(child);
 }
 
+// returns whether the given subtree (except for the node skip) references the
+// memory or variable with the given name
+static bool node_references(const AstNode *node, const std::string &name, const AstNode *skip)
+{
+	if (node == skip)
+		return false;
+	if (node->type == AST_IDENTIFIER && node->str == name)
+		return true;
+	for (auto child : node->children)
+		if (node_references(child, name, skip))
+			return true;
+	return false;
+}
+
+// Evaluates a for-loop in an initial block directly on constant values, instead
+// of unrolling it into one copy of the body per iteration. Supported are loops
+// that are executed unconditionally and whose bodies only contain blocks,
+// nested for-loops, if/case statements and blocking assignments to variables
+// or to whole memory words, where all read values are known constants. The
+// memory writes are turned into coalesced AST_MEMINIT nodes (like for
+// unconditional $readmem calls) and the final values of the variables are
+// assigned in place of the loop. run() returns false, without modifying the
+// AST, for anything else, in which case the loop is unrolled as usual.
+struct InitialLoopEval
+{
+	AstNode *loop;
+	int stage;
+
+	// the variables that have been assigned as a whole, in order
+	std::map<std::string, AstNode::varinfo_t> variables;
+	std::vector<std::string> variables_order;
+	pool<std::string> variables_assigned;
+
+	// the words written to the memories, in order
+	dict<AstNode*, std::map<int, RTLIL::Const>> memories;
+	std::vector<AstNode*> memories_order;
+	dict<AstNode*, bool> memory_ok_cache;
+
+	InitialLoopEval(AstNode *loop, int stage) : loop(loop), stage(stage) { }
+
+	// replace a read of a variable with its value
+	bool substitute(AstNode *node)
+	{
+		const AstNode::varinfo_t &v = variables.at(node->str);
+		AstNode *newNode = nullptr;
+
+		if (node->children.empty()) {
+			newNode = AstNode::mkconst_bits(v.val.bits, v.is_signed);
+		} else {
+			if (node->children.size() != 1 || node->children[0]->type != AST_RANGE)
+				return false;
+			AstNode *range = node->children[0];
+			while (range->simplify(true, false, stage, -1, false, true)) { }
+			if (!range->range_valid)
+				return false;
+			std::vector<RTLIL::State> data;
+			for (int i = min(range->range_left, range->range_right); i <= max(range->range_left, range->range_right); i++) {
+				int index = i - v.offset;
+				if (v.range_swapped)
+					index = -index;
+				data.push_back(0 <= index && index < GetSize(v.val) ? v.val.bits[index] : RTLIL::State::Sx);
+			}
+			newNode = AstNode::mkconst_bits(data, false);
+		}
+
+		newNode->cloneInto(node);
+		delete newNode;
+		return true;
+	}
+
+	// evaluate a call of a constant function, like simplify() does
+	bool eval_fcall(AstNode *node)
+	{
+		if (node->str.compare(0, 2, "\\$") == 0)
+			return node->str == "\\$clog2" || node->str == "\\$signed" || node->str == "\\$unsigned" ||
+					node->str == "\\$countones" || node->str == "\\$onehot" || node->str == "\\$onehot0";
+
+		auto it = current_scope.find(node->str);
+		if (it == current_scope.end() || it->second->type != AST_FUNCTION || it->second->attributes.count(ID::via_celltype))
+			return false;
+
+		for (auto child : node->children) {
+			while (child->simplify(true, false, stage, -1, false, true)) { }
+			if (child->type != AST_CONSTANT && child->type != AST_REALVALUE)
+				return false;
+		}
+
+		std::stringstream sstr;
+		sstr << node->str << "$func$" << RTLIL::encode_filename(node->filename) << ":" << node->location.first_line << "$" << next_autoidx() << '.';
+		std::string prefix = sstr.str();
+
+		AstNode *decl = it->second->clone();
+		decl->replace_result_wire_name_in_function(node->str, "$result");
+		decl->expand_genblock(prefix);
+		decl->str = prefix_id(prefix, "$result");
+		AstNode *result = decl->eval_const_function(node, false);
+		delete decl;
+
+		// expand_genblock() registered the names of the copy in current_scope,
+		// which eval_const_function() copies on every call
+		auto scope_it = current_scope.lower_bound(prefix);
+		while (scope_it != current_scope.end() && scope_it->first.compare(0, prefix.size(), prefix) == 0)
+			scope_it = current_scope.erase(scope_it);
+
+		if (result == nullptr)
+			return false;
+		result->cloneInto(node);
+		delete result;
+		return true;
+	}
+
+	// prepare a copy of an expression for constant folding: replace the
+	// variables with their values and evaluate function calls, and check that
+	// everything else it reads is a parameter
+	bool prepare(AstNode *node)
+	{
+		if (node->type == AST_PREFIX || node->type == AST_TCALL)
+			return false;
+
+		for (auto child : node->children)
+			if (!prepare(child))
+				return false;
+
+		if (node->type == AST_FCALL)
+			return eval_fcall(node);
+
+		if (node->type == AST_IDENTIFIER) {
+			if (variables.count(node->str))
+				return substitute(node);
+			auto it = current_scope.find(node->str);
+			if (it == current_scope.end())
+				return false;
+			AstNodeType decl_type = it->second->type;
+			return decl_type == AST_PARAMETER || decl_type == AST_LOCALPARAM || decl_type == AST_ENUM_ITEM;
+		}
+
+		return true;
+	}
+
+	// returns a prepared copy of the expression, or nullptr
+	AstNode *prepared(const AstNode *expr)
+	{
+		AstNode *buf = expr->clone();
+		if (prepare(buf))
+			return buf;
+		delete buf;
+		return nullptr;
+	}
+
+	// constant fold a prepared expression, deletes it if it is not constant
+	AstNode *fold(AstNode *buf, int width_hint, bool sign_hint, bool in_param)
+	{
+		while (buf->simplify(true, false, stage, width_hint, sign_hint, in_param)) { }
+		if (buf->type == AST_CONSTANT)
+			return buf;
+		delete buf;
+		return nullptr;
+	}
+
+	// evaluate a self-determined expression
+	AstNode *eval(const AstNode *expr, bool in_param)
+	{
+		AstNode *buf = prepared(expr);
+		if (buf == nullptr)
+			return nullptr;
+		int width_hint = -1;
+		bool sign_hint = true;
+		buf->detectSignWidth(width_hint, sign_hint);
+		return fold(buf, width_hint, sign_hint, in_param);
+	}
+
+	// evaluate the right hand side of an assignment to a target of the given width
+	AstNode *eval_rhs(const AstNode *expr, int lhs_width)
+	{
+		AstNode *buf = prepared(expr);
+		if (buf == nullptr)
+			return nullptr;
+		int width_hint = -1;
+		bool sign_hint = true;
+		buf->detectSignWidth(width_hint, sign_hint);
+		return fold(buf, max(width_hint, lhs_width), sign_hint, false);
+	}
+
+	void set_variable(const std::string &name, AstNode *decl, const RTLIL::Const &val)
+	{
+		if (variables_assigned.insert(name).second)
+			variables_order.push_back(name);
+		AstNode::varinfo_t &v = variables[name];
+		v.val = val;
+		v.offset = decl->range_swapped ? decl->range_left : decl->range_right;
+		v.range_swapped = decl->range_swapped;
+		v.is_signed = decl->is_signed;
+		v.explicitly_sized = true;
+	}
+
+	static bool is_variable_decl(const AstNode *decl)
+	{
+		return decl->type == AST_WIRE && decl->range_valid && decl->multirange_dimensions.empty();
+	}
+
+	static int decl_width(const AstNode *decl)
+	{
+		return abs(decl->range_left - decl->range_right) + 1;
+	}
+
+	bool memory_ok(AstNode *mem)
+	{
+		auto it = memory_ok_cache.find(mem);
+		if (it != memory_ok_cache.end())
+			return it->second;
+
+		bool ok = true;
+		// with nomeminit, the memory must be replaced by registers if it is
+		// initialized and written elsewhere, which is decided on the writes
+		if (flag_nomeminit || mem->get_bool_attribute(ID::nomeminit) || current_ast_mod->get_bool_attribute(ID::nomeminit))
+			ok = false;
+		if (mem->children.size() < 2 || !mem->children[0]->range_valid || !mem->children[1]->range_valid || !mem->multirange_dimensions.empty())
+			ok = false;
+		// other accesses in this process (for example reads that require
+		// mem2reg) must see the same writes as with an unrolled loop
+		if (ok && node_references(current_always, mem->str, loop))
+			ok = false;
+
+		memory_ok_cache[mem] = ok;
+		return ok;
+	}
+
+	bool exec_memwr(AstNode *stmt, AstNode *mem)
+	{
+		AstNode *lhs = stmt->children[0];
+		if (lhs->children.size() != 1 || lhs->children[0]->type != AST_RANGE || lhs->children[0]->children.size() != 1)
+			return false;
+		if (!memory_ok(mem))
+			return false;
+
+		int mem_width, mem_size, addr_bits;
+		mem->meminfo(mem_width, mem_size, addr_bits);
+
+		AstNode *addr = eval(lhs->children[0]->children[0], false);
+		if (addr == nullptr)
+			return false;
+		bool addr_ok = addr->bits_only_01() && GetSize(addr->bits) <= 32;
+		int addr_value = addr_ok ? addr->asInt(addr->is_signed) : 0;
+		delete addr;
+
+		int range_left = mem->children[1]->range_left, range_right = mem->children[1]->range_right;
+		if (!addr_ok || addr_value < min(range_left, range_right) || addr_value > max(range_left, range_right))
+			return false;
+
+		AstNode *data = eval_rhs(stmt->children[1], mem_width);
+		if (data == nullptr)
+			return false;
+
+		if (!memories.count(mem))
+			memories_order.push_back(mem);
+		memories[mem][addr_value] = data->bitsAsConst(mem_width, data->is_signed);
+		delete data;
+		return true;
+	}
+
+	bool exec_assign(AstNode *stmt)
+	{
+		AstNode *lhs = stmt->children[0];
+		if (lhs->type != AST_IDENTIFIER)
+			return false;
+
+		auto it = current_scope.find(lhs->str);
+		if (it == current_scope.end())
+			return false;
+		AstNode *decl = it->second;
+
+		if (decl->type == AST_MEMORY)
+			return exec_memwr(stmt, decl);
+
+		if (!is_variable_decl(decl))
+			return false;
+
+		if (lhs->children.empty()) {
+			AstNode *value = eval_rhs(stmt->children[1], decl_width(decl));
+			if (value == nullptr)
+				return false;
+			set_variable(lhs->str, decl, value->bitsAsConst(decl_width(decl), value->is_signed));
+			delete value;
+			return true;
+		}
+
+		// a part of a variable can only be assigned once all of it is known
+		if (!variables.count(lhs->str) || lhs->children.size() != 1 || lhs->children[0]->type != AST_RANGE)
+			return false;
+
+		AstNode *range = prepared(lhs->children[0]);
+		if (range == nullptr)
+			return false;
+		while (range->simplify(true, false, stage, -1, false, true)) { }
+		bool range_ok = range->range_valid;
+		int offset = min(range->range_left, range->range_right);
+		int width = std::abs(range->range_left - range->range_right) + 1;
+		delete range;
+		if (!range_ok)
+			return false;
+
+		AstNode *value = eval_rhs(stmt->children[1], width);
+		if (value == nullptr)
+			return false;
+		RTLIL::Const r = value->bitsAsConst(width, value->is_signed);
+		delete value;
+
+		AstNode::varinfo_t &v = variables.at(lhs->str);
+		for (int i = 0; i < width; i++) {
+			int index = i + offset - v.offset;
+			if (v.range_swapped)
+				index = -index;
+			if (0 <= index && index < GetSize(v.val))
+				v.val.bits[index] = r.bits[i];
+		}
+		return true;
+	}
+
+	// the same as the constant folding of case statements in simplify()
+	bool exec_case(AstNode *stmt)
+	{
+		for (size_t i = 1; i < stmt->children.size(); i++)
+			if (stmt->children[i]->type != AST_COND)
+				return false;
+
+		AstNode *buf = stmt->clone();
+		AstNode *selected = nullptr, *default_body = nullptr;
+		bool ok = true;
+
+		for (auto cond : buf->children) {
+			if (cond == buf->children[0]) {
+				ok = ok && prepare(cond);
+				continue;
+			}
+			for (auto v : cond->children)
+				if (v->type != AST_DEFAULT && v->type != AST_BLOCK)
+					ok = ok && prepare(v);
+		}
+
+		int width_hint = -1;
+		bool sign_hint = true;
+		RTLIL::Const case_expr;
+
+		if (ok) {
+			buf->detectSignWidth(width_hint, sign_hint);
+			while (buf->children[0]->simplify(true, false, stage, width_hint, sign_hint, false)) { }
+			ok = buf->children[0]->type == AST_CONSTANT && buf->children[0]->bits_only_01();
+			if (ok)
+				case_expr = buf->children[0]->bitsAsConst(width_hint, sign_hint);
+		}
+
+		for (size_t i = 1; ok && selected == nullptr && i < buf->children.size(); i++)
+			for (auto v : buf->children[i]->children) {
+				if (v->type == AST_DEFAULT) {
+					default_body = stmt->children[i]->children.back();
+					continue;
+				}
+				if (v->type == AST_BLOCK)
+					continue;
+				while (v->simplify(true, false, stage, width_hint, sign_hint, false)) { }
+				if (v->type != AST_CONSTANT || !v->bits_only_01()) {
+					ok = false;
+					break;
+				}
+				RTLIL::Const case_item_expr = v->bitsAsConst(width_hint, sign_hint);
+				if (RTLIL::const_eq(case_expr, case_item_expr, sign_hint, sign_hint, 1).as_bool()) {
+					selected = stmt->children[i]->children.back();
+					break;
+				}
+			}
+
+		delete buf;
+		if (!ok)
+			return false;
+
+		if (selected == nullptr)
+			selected = default_body;
+		return selected == nullptr || exec(selected);
+	}
+
+	// the same as the unrolling of for-loops in simplify()
+	bool exec_for(AstNode *stmt)
+	{
+		AstNode *init_ast = stmt->children[0];
+		AstNode *while_ast = stmt->children[1];
+		AstNode *next_ast = stmt->children[2];
+		AstNode *body_ast = stmt->children[3];
+
+		if (init_ast->type != AST_ASSIGN_EQ || next_ast->type != AST_ASSIGN_EQ)
+			return false;
+		if (init_ast->children[0]->type != AST_IDENTIFIER || !init_ast->children[0]->children.empty() ||
+				next_ast->children[0]->type != AST_IDENTIFIER || next_ast->children[0]->str != init_ast->children[0]->str)
+			return false;
+
+		std::string var = init_ast->children[0]->str;
+		if (!current_scope.count(var) || !is_variable_decl(current_scope.at(var)))
+			return false;
+		AstNode *var_decl = current_scope.at(var);
+
+		AstNode *varbuf = prepared(init_ast->children[1]);
+		if (varbuf == nullptr || (varbuf = fold(varbuf, 32, true, false)) == nullptr)
+			return false;
+
+		int const_size = varbuf->range_left - varbuf->range_right;
+		int resolved_size = var_decl->range_left - var_decl->range_right;
+		if (const_size < resolved_size) {
+			for (int i = const_size; i < resolved_size; i++)
+				varbuf->bits.push_back(var_decl->is_signed ? varbuf->bits.back() : State::S0);
+			varbuf->range_left = var_decl->range_left;
+			varbuf->range_right = var_decl->range_right;
+			varbuf->range_swapped = var_decl->range_swapped;
+			varbuf->range_valid = var_decl->range_valid;
+		}
+
+		// while the loop runs, the variable is a localparam
+		varbuf = new AstNode(AST_LOCALPARAM, varbuf);
+		varbuf->str = var;
+		bool was_variable = variables.count(var) != 0;
+		AstNode::varinfo_t backup_variable;
+		if (was_variable) {
+			backup_variable = variables.at(var);
+			variables.erase(var);
+		}
+		current_scope[var] = varbuf;
+
+		bool ok = true;
+		while (ok)
+		{
+			AstNode *buf = eval(while_ast, false);
+			if (buf == nullptr) {
+				ok = false;
+				break;
+			}
+			bool done = buf->integer == 0;
+			delete buf;
+			if (done)
+				break;
+
+			if (!exec(body_ast)) {
+				ok = false;
+				break;
+			}
+
+			buf = eval(next_ast->children[1], true);
+			if (buf == nullptr) {
+				ok = false;
+				break;
+			}
+			delete varbuf->children[0];
+			varbuf->children[0] = buf;
+		}
+
+		current_scope[var] = var_decl;
+		if (ok) {
+			AstNode *value = varbuf->children[0];
+			set_variable(var, var_decl, value->bitsAsConst(decl_width(var_decl), value->is_signed));
+		} else if (was_variable) {
+			variables[var] = backup_variable;
+		}
+		delete varbuf;
+		return ok;
+	}
+
+	bool exec(AstNode *stmt)
+	{
+		switch (stmt->type)
+		{
+		case AST_BLOCK:
+			for (auto child : stmt->children) {
+				if (child->type == AST_WIRE || child->type == AST_MEMORY || child->type == AST_PARAMETER ||
+						child->type == AST_LOCALPARAM || child->type == AST_TYPEDEF)
+					return false;
+				if (!exec(child))
+					return false;
+			}
+			return true;
+		case AST_ASSIGN_EQ:
+			return exec_assign(stmt);
+		case AST_CASE:
+			return exec_case(stmt);
+		case AST_FOR:
+			return exec_for(stmt);
+		default:
+			return false;
+		}
+	}
+
+	bool run()
+	{
+		// the loop must be executed unconditionally, so that the memory
+		// writes can be memory initializations (see also readmem)
+		if (current_always == nullptr || current_always->type != AST_INITIAL || current_block_child != loop)
+			return false;
+		bool unconditional = false;
+		std::vector<AstNode*> queue = {current_always->children[0]};
+		while (!unconditional && !queue.empty()) {
+			AstNode *node = queue.back();
+			queue.pop_back();
+			if (node == current_block)
+				unconditional = true;
+			for (auto child : node->children)
+				if (child->type == AST_BLOCK)
+					queue.push_back(child);
+		}
+		if (!unconditional || !exec_for(loop))
+			return false;
+
+		for (auto mem : memories_order)
+		{
+			int mem_width, mem_size, addr_bits;
+			mem->meminfo(mem_width, mem_size, addr_bits);
+			std::vector<RTLIL::State> en_bits(mem_width, State::S1);
+
+			auto &words = memories.at(mem);
+			for (auto it = words.begin(); it != words.end(); )
+			{
+				int cursor = it->first, size = 0;
+				std::vector<RTLIL::State> meminit_bits;
+				for (; it != words.end() && it->first == cursor + size; ++it, size++)
+					meminit_bits.insert(meminit_bits.end(), it->second.bits.begin(), it->second.bits.end());
+
+				AstNode *meminit = new AstNode(AST_MEMINIT, AstNode::mkconst_int(cursor, false),
+						AstNode::mkconst_bits(meminit_bits, false), AstNode::mkconst_bits(en_bits, false),
+						AstNode::mkconst_int(size, false));
+				meminit->str = mem->str;
+				meminit->id2ast = mem;
+				meminit->filename = loop->filename;
+				meminit->location = loop->location;
+				current_ast_mod->children.push_back(meminit);
+			}
+		}
+
+		size_t block_idx = 0;
+		while (current_block->children[block_idx] != loop)
+			block_idx++;
+		for (auto &name : variables_order) {
+			const AstNode::varinfo_t &v = variables.at(name);
+			AstNode *assign = new AstNode(AST_ASSIGN_EQ, new AstNode(AST_IDENTIFIER), AstNode::mkconst_bits(v.val.bits, v.is_signed));
+			assign->children[0]->str = name;
+			assign->filename = assign->children[0]->filename = loop->filename;
+			assign->location = assign->children[0]->location = loop->location;
+			current_block->children.insert(current_block->children.begin() + block_idx++, assign);
+		}
+		return true;
+	}
+};
+
 // convert the AST into a simpler AST that has all parameters substituted by their
 // values, unrolled for-loops, expanded generate blocks, etc. when this function
 // is done with an AST it can be converted into RTLIL using genRTLIL().
@@ -810,15 +1366,15 @@ static void check_auto_nosync(AstNode *node)
 // nodes that link to a different node using names and lexical scoping.
 bool AstNode::simplify(bool const_fold, bool in_lvalue, int stage, int width_hint, bool sign_hint, bool in_param)
 {
-	static int recursion_counter = 0;
-	static bool deep_recursion_warning = false;
+	static thread_local int recursion_counter = 0;
+	static thread_local bool deep_recursion_warning = false;
 
 	if (recursion_counter++ == 1000 && deep_recursion_warning) {
 		log_warning("Deep recursion in AST simplifier.\nDoes this design contain overly long or deeply nested expressions, or excessive recursion?\n");
 		deep_recursion_warning = false;
 	}
 
-	static bool unevaluated_tern_branch = false;
+	static thread_local bool unevaluated_tern_branch = false;
 
 	AstNode *newNode = NULL;
 	bool did_something = false;
@@ -1244,7 +1800,7 @@ bool AstNode::simplify(bool const_fold, bool in_lvalue, int stage, int width_hin
 
 				// create the indirection wire
 				std::stringstream sstr;
-				sstr << "$indirect$" << ref->name.c_str() << "$" << RTLIL::encode_filename(filename) << ":" << location.first_line << "$" << (autoidx++);
+				sstr << "$indirect$" << ref->name.c_str() << "$" << RTLIL::encode_filename(filename) << ":" << location.first_line << "$" << next_autoidx();
 				std::string tmp_str = sstr.str();
 				add_wire_for_ref(ref, tmp_str);
 
@@ -2195,7 +2751,7 @@ bool AstNode::simplify(bool const_fold, bool in_lvalue, int stage, int width_hin
 			std::swap(data_range_left, data_range_right);
 
 		std::stringstream sstr;
-		sstr << "$mem2bits$" << str << "$" << RTLIL::encode_filename(filename) << ":" << location.first_line << "$" << (autoidx++);
+		sstr << "$mem2bits$" << str << "$" << RTLIL::encode_filename(filename) << ":" << location.first_line << "$" << next_autoidx();
 		std::string wire_id = sstr.str();
 
 		AstNode *wire = new AstNode(AST_WIRE, new AstNode(AST_RANGE, mkconst_int(data_range_left, true), mkconst_int(data_range_right, true)));
@@ -2261,6 +2817,16 @@ bool AstNode::simplify(bool const_fold, bool in_lvalue, int stage, int width_hin
 		did_something = true;
 	}
 
+	// evaluate for loops in initial blocks without unrolling them if possible
+	if (type == AST_FOR && children.size() != 0 && current_always && current_always->type == AST_INITIAL)
+	{
+		InitialLoopEval loop_eval(this, stage);
+		if (loop_eval.run()) {
+			delete_children();
+			did_something = true;
+		}
+	}
+
 	// unroll for loops and generate-for blocks
 	if ((type == AST_GENFOR || type == AST_FOR) && children.size() != 0)
 	{
@@ -2796,14 +3362,14 @@ bool AstNode::simplify(bool const_fold, bool in_lvalue, int stage, int width_hin
 			// mask and shift operations, disabled for now
 
 			AstNode *wire_mask = new AstNode(AST_WIRE, new AstNode(AST_RANGE, mkconst_int(source_width-1, true), mkconst_int(0, true)));
-			wire_mask->str = stringf("$bitselwrite$mask$%s:%d$%d", RTLIL::encode_filename(filename).c_str(), location.first_line, autoidx++);
+			wire_mask->str = stringf("$bitselwrite$mask$%s:%d$%s", RTLIL::encode_filename(filename).c_str(), location.first_line, next_autoidx().c_str());
 			wire_mask->attributes[ID::nosync] = AstNode::mkconst_int(1, false);
 			wire_mask->is_logic = true;
 			while (wire_mask->simplify(true, false, 1, -1, false, false)) { }
 			current_ast_mod->children.push_back(wire_mask);
 
 			AstNode *wire_data = new AstNode(AST_WIRE, new AstNode(AST_RANGE, mkconst_int(source_width-1, true), mkconst_int(0, true)));
-			wire_data->str = stringf("$bitselwrite$data$%s:%d$%d", RTLIL::encode_filename(filename).c_str(), location.first_line, autoidx++);
+			wire_data->str = stringf("$bitselwrite$data$%s:%d$%s", RTLIL::encode_filename(filename).c_str(), location.first_line, next_autoidx().c_str());
 			wire_data->attributes[ID::nosync] = AstNode::mkconst_int(1, false);
 			wire_data->is_logic = true;
 			while (wire_data->simplify(true, false, 1, -1, false, false)) { }
@@ -2814,7 +3380,7 @@ bool AstNode::simplify(bool const_fold, bool in_lvalue, int stage, int width_hin
 			shift_expr->detectSignWidth(shamt_width_hint, shamt_sign_hint);
 
 			AstNode *wire_sel = new AstNode(AST_WIRE, new AstNode(AST_RANGE, mkconst_int(shamt_width_hint-1, true), mkconst_int(0, true)));
-			wire_sel->str = stringf("$bitselwrite$sel$%s:%d$%d", RTLIL::encode_filename(filename).c_str(), location.first_line, autoidx++);
+			wire_sel->str = stringf("$bitselwrite$sel$%s:%d$%s", RTLIL::encode_filename(filename).c_str(), location.first_line, next_autoidx().c_str());
 			wire_sel->attributes[ID::nosync] = AstNode::mkconst_int(1, false);
 			wire_sel->is_logic = true;
 			wire_sel->is_signed = shamt_sign_hint;
@@ -2893,7 +3459,7 @@ skip_dynamic_range_lvalue_expansion:;
 	if (stage > 1 && (type == AST_ASSERT || type == AST_ASSUME || type == AST_LIVE || type == AST_FAIR || type == AST_COVER) && current_block != NULL)
 	{
 		std::stringstream sstr;
-		sstr << "$formal$" << RTLIL::encode_filename(filename) << ":" << location.first_line << "$" << (autoidx++);
+		sstr << "$formal$" << RTLIL::encode_filename(filename) << ":" << location.first_line << "$" << next_autoidx();
 		std::string id_check = sstr.str() + "_CHECK", id_en = sstr.str() + "_EN";
 
 		AstNode *wire_check = new AstNode(AST_WIRE);
@@ -3002,7 +3568,7 @@ skip_dynamic_range_lvalue_expansion:;
 			newNode = new AstNode(AST_BLOCK);
 
 			AstNode *wire_tmp = new AstNode(AST_WIRE, new AstNode(AST_RANGE, mkconst_int(width_hint-1, true), mkconst_int(0, true)));
-			wire_tmp->str = stringf("$splitcmplxassign$%s:%d$%d", RTLIL::encode_filename(filename).c_str(), location.first_line, autoidx++);
+			wire_tmp->str = stringf("$splitcmplxassign$%s:%d$%s", RTLIL::encode_filename(filename).c_str(), location.first_line, next_autoidx().c_str());
 			current_ast_mod->children.push_back(wire_tmp);
 			current_scope[wire_tmp->str] = wire_tmp;
 			wire_tmp->attributes[ID::nosync] = AstNode::mkconst_int(1, false);
@@ -3040,7 +3606,7 @@ skip_dynamic_range_lvalue_expansion:;
 			(children[0]->children.size() == 1 || children[0]->children.size() == 2) && children[0]->children[0]->type == AST_RANGE)
 	{
 		std::stringstream sstr;
-		sstr << "$memwr$" << children[0]->str << "$" << RTLIL::encode_filename(filename) << ":" << location.first_line << "$" << (autoidx++);
+		sstr << "$memwr$" << children[0]->str << "$" << RTLIL::encode_filename(filename) << ":" << location.first_line << "$" << next_autoidx();
 		std::string id_addr = sstr.str() + "_ADDR", id_data = sstr.str() + "_DATA", id_en = sstr.str() + "_EN";
 
 		int mem_width, mem_size, addr_bits;
@@ -3241,15 +3807,15 @@ skip_dynamic_range_lvalue_expansion:;
 		{
 			if (str == "\\$initstate")
 			{
-				int myidx = autoidx++;
+				std::string myidx = next_autoidx();
 
 				AstNode *wire = new AstNode(AST_WIRE);
-				wire->str = stringf("$initstate$%d_wire", myidx);
+				wire->str = stringf("$initstate$%s_wire", myidx.c_str());
 				current_ast_mod->children.push_back(wire);
 				while (wire->simplify(true, false, 1, -1, false, false)) { }
 
 				AstNode *cell = new AstNode(AST_CELL, new AstNode(AST_CELLTYPE), new AstNode(AST_ARGUMENT, new AstNode(AST_IDENTIFIER)));
-				cell->str = stringf("$initstate$%d", myidx);
+				cell->str = stringf("$initstate$%s", myidx.c_str());
 				cell->children[0]->str = "$initstate";
 				cell->children[1]->str = "\\Y";
 				cell->children[1]->children[0]->str = wire->str;
@@ -3302,7 +3868,7 @@ skip_dynamic_range_lvalue_expansion:;
 					goto apply_newNode;
 				}
 
-				int myidx = autoidx++;
+				std::string myidx = next_autoidx();
 				AstNode *outreg = nullptr;
 
 				for (int i = 0; i < num_steps; i++)
@@ -3310,7 +3876,7 @@ skip_dynamic_range_lvalue_expansion:;
 					AstNode *reg = new AstNode(AST_WIRE, new AstNode(AST_RANGE,
 							mkconst_int(width_hint-1, true), mkconst_int(0, true)));
 
-					reg->str = stringf("$past$%s:%d$%d$%d", RTLIL::encode_filename(filename).c_str(), location.first_line, myidx, i);
+					reg->str = stringf("$past$%s:%d$%s$%d", RTLIL::encode_filename(filename).c_str(), location.first_line, myidx.c_str(), i);
 					reg->is_reg = true;
 					reg->is_signed = sign_hint;
 
@@ -3840,7 +4406,7 @@ skip_dynamic_range_lvalue_expansion:;
 
 
 		std::stringstream sstr;
-		sstr << str << "$func$" << RTLIL::encode_filename(filename) << ":" << location.first_line << "$" << (autoidx++) << '.';
+		sstr << str << "$func$" << RTLIL::encode_filename(filename) << ":" << location.first_line << "$" << next_autoidx() << '.';
 		std::string prefix = sstr.str();
 
 		AstNode *decl = current_scope[str];
@@ -4945,7 +5511,7 @@ bool AstNode::mem2reg_as_needed_pass2(pool<AstNode*> &mem2reg_set, AstNode *mod,
 			children[0]->children[0]->children[0]->type != AST_CONSTANT)
 	{
 		std::stringstream sstr;
-		sstr << "$mem2reg_wr$" << children[0]->str << "$" << RTLIL::encode_filename(filename) << ":" << location.first_line << "$" << (autoidx++);
+		sstr << "$mem2reg_wr$" << children[0]->str << "$" << RTLIL::encode_filename(filename) << ":" << location.first_line << "$" << next_autoidx();
 		std::string id_addr = sstr.str() + "_ADDR", id_data = sstr.str() + "_DATA";
 
 		int mem_width, mem_size, addr_bits;
@@ -5061,7 +5627,7 @@ bool AstNode::mem2reg_as_needed_pass2(pool<AstNode*> &mem2reg_set, AstNode *mod,
 		else
 		{
 			std::stringstream sstr;
-			sstr << "$mem2reg_rd$" << str << "$" << RTLIL::encode_filename(filename) << ":" << location.first_line << "$" << (autoidx++);
+			sstr << "$mem2reg_rd$" << str << "$" << RTLIL::encode_filename(filename) << ":" << location.first_line << "$" << next_autoidx();
 			std::string id_addr = sstr.str() + "_ADDR", id_data = sstr.str() + "_DATA";
 
 			int mem_width, mem_size, addr_bits;
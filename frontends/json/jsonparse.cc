@@ -21,233 +21,307 @@
 
 YOSYS_NAMESPACE_BEGIN
 
-struct JsonNode
+// A JSON string or number. Numbers with a fractional part are returned as
+// strings.
+struct JsonScalar
 {
-	char type; // S=String, N=Number, A=Array, D=Dict
+	char type; // S=String, N=Number, A=Array, D=Dict (skipped)
 	string data_string;
 	int64_t data_number;
-	vector<JsonNode*> data_array;
-	dict<string, JsonNode*> data_dict;
-	vector<string> data_dict_keys;
+};
+
+// An event-driven JSON reader: the caller walks the document with
+// begin()/next_element()/next_key() and reads the values it is interested
+// in, everything else is skipped without being stored.
+struct JsonReader
+{
+	std::streambuf *sb;
+
+	JsonReader(std::istream &f) : sb(f.rdbuf()) { }
 
-	JsonNode(std::istream &f)
+	int get()
 	{
-		type = 0;
-		data_number = 0;
+		return sb->sbumpc();
+	}
+
+	int peek()
+	{
+		return sb->sgetc();
+	}
 
+	// Returns the type of the next value without consuming it.
+	char peek_type()
+	{
 		while (1)
 		{
-			int ch = f.get();
+			int ch = peek();
 
 			if (ch == EOF)
 				log_error("Unexpected EOF in JSON file.\n");
 
-			if (ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n')
+			if (ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n') {
+				get();
 				continue;
+			}
 
 			if (ch == '"')
-			{
-				type = 'S';
+				return 'S';
+			if (('0' <= ch && ch <= '9') || ch == '-')
+				return 'N';
+			if (ch == '[')
+				return 'A';
+			if (ch == '{')
+				return 'D';
 
-				while (1)
-				{
-					ch = f.get();
+			log_error("Unexpected character in JSON file: '%c'\n", ch);
+		}
+	}
 
-					if (ch == EOF)
-						log_error("Unexpected EOF in JSON string.\n");
+	// Consumes the '[' or '{' of the next value.
+	void begin()
+	{
+		peek_type();
+		get();
+	}
 
-					if (ch == '"')
-						break;
+	// Returns false (and consumes the closing bracket) at the end of the
+	// array or dict.
+	bool next_element(char close)
+	{
+		while (1)
+		{
+			int ch = peek();
 
-					if (ch == '\\') {
-						ch = f.get();
-
-						switch (ch) {
-							case EOF: log_error("Unexpected EOF in JSON string.\n"); break;
-							case '"':
-							case '/':
-							case '\\':           break;
-							case 'b': ch = '\b'; break;
-							case 'f': ch = '\f'; break;
-							case 'n': ch = '\n'; break;
-							case 'r': ch = '\r'; break;
-							case 't': ch = '\t'; break;
-							case 'u':
-								int val = 0;
-								for (int i = 0; i < 4; i++) {
-									ch = f.get();
-									val <<= 4;
-									if (ch >= '0' && '9' >= ch) {
-										val += ch - '0';
-									} else if (ch >= 'A' && 'F' >= ch) {
-										val += 10 + ch - 'A';
-									} else if (ch >= 'a' && 'f' >= ch) {
-										val += 10 + ch - 'a';
-									} else
-										log_error("Unexpected non-digit character in \\uXXXX sequence: %c.\n", ch);
-								}
-								if (val < 128)
-									ch = val;
-								else
-									log_error("Unsupported \\uXXXX sequence in JSON string: %04X.\n", val);
-								break;
-						}
-					}
+			if (ch == EOF)
+				log_error("Unexpected EOF in JSON file.\n");
 
-					data_string += ch;
-				}
+			if (ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n' || ch == ',') {
+				get();
+				continue;
+			}
 
-				break;
+			if (ch == close) {
+				get();
+				return false;
 			}
 
-			if (('0' <= ch && ch <= '9') || ch == '-')
-			{
-				bool negative = false;
-				type = 'N';
-				if (ch == '-') {
-					data_number = 0;
-				       	negative = true;
-				} else {
-					data_number = ch - '0';
-				}
+			return true;
+		}
+	}
 
-				data_string += ch;
+	bool next_key(string &key)
+	{
+		if (!next_element('}'))
+			return false;
 
-				while (1)
-				{
-					ch = f.get();
+		if (peek_type() != 'S')
+			log_error("Unexpected non-string key in JSON dict.\n");
+		parse_string(key);
 
-					if (ch == EOF)
-						break;
+		while (1)
+		{
+			int ch = peek();
 
-					if (ch == '.')
-						goto parse_real;
+			if (ch == EOF)
+				log_error("Unexpected EOF in JSON file.\n");
 
-					if (ch < '0' || '9' < ch) {
-						f.unget();
-						break;
-					}
+			if (ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n' || ch == ':') {
+				get();
+				continue;
+			}
 
-					data_number = data_number*10 + (ch - '0');
-					data_string += ch;
-				}
+			return true;
+		}
+	}
 
-				data_number = negative ? -data_number : data_number;
-				data_string = "";
-				break;
+	void parse_string(string &str)
+	{
+		str.clear();
+		peek_type();
+		get();
 
-			parse_real:
-				type = 'S';
-				data_number = 0;
-				data_string += ch;
+		while (1)
+		{
+			int ch = get();
 
-				while (1)
-				{
-					ch = f.get();
+			if (ch == EOF)
+				log_error("Unexpected EOF in JSON string.\n");
 
-					if (ch == EOF)
-						break;
+			if (ch == '"')
+				break;
 
-					if (ch < '0' || '9' < ch) {
-						f.unget();
+			if (ch == '\\') {
+				ch = get();
+
+				switch (ch) {
+					case EOF: log_error("Unexpected EOF in JSON string.\n"); break;
+					case '"':
+					case '/':
+					case '\\':           break;
+					case 'b': ch = '\b'; break;
+					case 'f': ch = '\f'; break;
+					case 'n': ch = '\n'; break;
+					case 'r': ch = '\r'; break;
+					case 't': ch = '\t'; break;
+					case 'u':
+						int val = 0;
+						for (int i = 0; i < 4; i++) {
+							ch = get();
+							val <<= 4;
+							if (ch >= '0' && '9' >= ch) {
+								val += ch - '0';
+							} else if (ch >= 'A' && 'F' >= ch) {
+								val += 10 + ch - 'A';
+							} else if (ch >= 'a' && 'f' >= ch) {
+								val += 10 + ch - 'a';
+							} else
+								log_error("Unexpected non-digit character in \\uXXXX sequence: %c.\n", ch);
+						}
+						if (val < 128)
+							ch = val;
+						else
+							log_error("Unsupported \\uXXXX sequence in JSON string: %04X.\n", val);
 						break;
-					}
-
-					data_string += ch;
 				}
-
-				break;
 			}
 
-			if (ch == '[')
-			{
-				type = 'A';
-
-				while (1)
-				{
-					ch = f.get();
-
-					if (ch == EOF)
-						log_error("Unexpected EOF in JSON file.\n");
+			str += ch;
+		}
+	}
 
-					if (ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n' || ch == ',')
-						continue;
+	void parse_number(JsonScalar &value)
+	{
+		bool negative = false;
+		int ch = get();
+
+		value.type = 'N';
+		value.data_string.clear();
+		if (ch == '-') {
+			value.data_number = 0;
+			negative = true;
+		} else {
+			value.data_number = ch - '0';
+		}
 
-					if (ch == ']')
-						break;
+		value.data_string += ch;
 
-					f.unget();
-					data_array.push_back(new JsonNode(f));
-				}
+		while (1)
+		{
+			ch = peek();
 
+			if (ch == '.')
 				break;
-			}
-
-			if (ch == '{')
-			{
-				type = 'D';
-
-				while (1)
-				{
-					ch = f.get();
-
-					if (ch == EOF)
-						log_error("Unexpected EOF in JSON file.\n");
 
-					if (ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n' || ch == ',')
-						continue;
+			if (ch == EOF || ch < '0' || '9' < ch) {
+				value.data_number = negative ? -value.data_number : value.data_number;
+				value.data_string.clear();
+				return;
+			}
 
-					if (ch == '}')
-						break;
+			get();
+			value.data_number = value.data_number*10 + (ch - '0');
+			value.data_string += ch;
+		}
 
-					f.unget();
-					JsonNode key(f);
+		value.type = 'S';
+		value.data_number = 0;
+		value.data_string += get();
 
-					while (1)
-					{
-						ch = f.get();
+		while (1)
+		{
+			ch = peek();
 
-						if (ch == EOF)
-							log_error("Unexpected EOF in JSON file.\n");
+			if (ch == EOF || ch < '0' || '9' < ch)
+				break;
 
-						if (ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n' || ch == ':')
-							continue;
+			value.data_string += get();
+		}
+	}
 
-						f.unget();
-						break;
-					}
+	// Reads a string or number, arrays and dicts are skipped.
+	void parse_scalar(JsonScalar &value)
+	{
+		value.type = peek_type();
+		if (value.type == 'S') {
+			value.data_number = 0;
+			parse_string(value.data_string);
+		} else if (value.type == 'N') {
+			parse_number(value);
+		} else {
+			skip_value();
+		}
+	}
 
-					JsonNode *value = new JsonNode(f);
+	void skip_value()
+	{
+		char type = peek_type();
+
+		if (type == 'A') {
+			begin();
+			while (next_element(']'))
+				skip_value();
+		} else if (type == 'D') {
+			string key;
+			begin();
+			while (next_key(key))
+				skip_value();
+		} else {
+			JsonScalar value;
+			parse_scalar(value);
+		}
+	}
+};
 
-					if (key.type != 'S')
-						log_error("Unexpected non-string key in JSON dict.\n");
+// A bit of a "bits" or "connections" array, either a constant or the index
+// of a signal bit.
+struct JsonBit
+{
+	bool constant;
+	int value;
+};
 
-					data_dict[key.data_string] = value;
-					data_dict_keys.push_back(key.data_string);
-				}
+struct JsonPort
+{
+	IdString name;
+	string direction;
+	vector<JsonBit> bits;
+	bool has_direction = false, has_bits = false;
+	bool has_upto = false, has_signed = false, has_offset = false;
+	bool upto = false, is_signed = false;
+	int offset = 0;
+};
 
-				break;
-			}
+struct JsonNetname
+{
+	vector<JsonBit> bits;
+	bool has_bits = false;
+	bool has_upto = false, has_offset = false;
+	bool upto = false;
+	int offset = 0;
+	dict<IdString, Const> attributes;
+};
 
-			log_error("Unexpected character in JSON file: '%c'\n", ch);
-		}
-	}
+struct JsonCell
+{
+	IdString type;
+	dict<IdString, vector<JsonBit>> connections;
+	bool has_connections = false;
+	dict<IdString, Const> attributes, parameters;
+};
 
-	~JsonNode()
-	{
-		for (auto it : data_array)
-			delete it;
-		for (auto &it : data_dict)
-			delete it.second;
-	}
+struct JsonMemory
+{
+	bool has_width = false, has_size = false;
+	int width = 0, size = 0, start_offset = 0;
+	dict<IdString, Const> attributes;
 };
 
-Const json_parse_attr_param_value(JsonNode *node)
+Const json_parse_attr_param_value(const JsonScalar &node)
 {
 	Const value;
 
-	if (node->type == 'S') {
-		string &s = node->data_string;
+	if (node.type == 'S') {
+		const string &s = node.data_string;
 		size_t cursor = s.find_first_not_of("01xz");
 		if (cursor == string::npos) {
 			value = Const::from_string(s);
@@ -257,15 +331,15 @@ Const json_parse_attr_param_value(JsonNode *node)
 			value = Const(s);
 		}
 	} else
-	if (node->type == 'N') {
-		value = Const(node->data_number, 32);
-		if (node->data_number < 0)
+	if (node.type == 'N') {
+		value = Const(node.data_number, 32);
+		if (node.data_number < 0)
 			value.flags |= RTLIL::CONST_FLAG_SIGNED;
 	} else
-	if (node->type == 'A') {
+	if (node.type == 'A') {
 		log_error("JSON attribute or parameter value is an array.\n");
 	} else
-	if (node->type == 'D') {
+	if (node.type == 'D') {
 		log_error("JSON attribute or parameter value is a dict.\n");
 	} else {
 		log_abort();
@@ -274,123 +348,356 @@ Const json_parse_attr_param_value(JsonNode *node)
 	return value;
 }
 
-void json_parse_attr_param(dict<IdString, Const> &results, JsonNode *node)
+// Creates the modules of a JSON file while it is read. The ports, netnames,
+// cells and memories of a module are collected first and imported when the
+// module ends, because the signal bits of "cells" are only named by the
+// "netnames" that follow them in the output of write_json.
+struct JsonImporter
 {
-	if (node->type != 'D')
-		log_error("JSON attributes or parameters node is not a dictionary.\n");
+	JsonReader reader;
+	Design *design;
+	Module *module = nullptr;
+
+	vector<JsonPort> ports;
+	dict<IdString, JsonNetname> netnames;
+	dict<IdString, JsonCell> cells;
+	dict<IdString, JsonMemory> memories;
 
-	for (auto it : node->data_dict)
+	JsonScalar scalar;
+	string key;
+
+	JsonImporter(std::istream &f, Design *design) : reader(f), design(design) { }
+
+	// Imports the dict in the order of the dict iteration (i.e. the reverse
+	// of the file order), like the DOM-based reader did.
+	void parse_attr_param(dict<IdString, Const> &results)
 	{
-		IdString key = RTLIL::escape_id(it.first.c_str());
-		Const value = json_parse_attr_param_value(it.second);
-		results[key] = value;
+		if (reader.peek_type() != 'D')
+			log_error("JSON attributes or parameters node is not a dictionary.\n");
+
+		dict<IdString, Const> values;
+		reader.begin();
+		while (reader.next_key(key)) {
+			IdString id = RTLIL::escape_id(key);
+			reader.parse_scalar(scalar);
+			values[id] = json_parse_attr_param_value(scalar);
+		}
+
+		for (auto &it : values)
+			results[it.first] = std::move(it.second);
 	}
-}
 
-void json_import(Design *design, string &modname, JsonNode *node)
-{
-	log("Importing module %s from JSON tree.\n", modname.c_str());
+	// Reads a number if the next value is one and skips the value otherwise.
+	bool parse_number(int64_t &value)
+	{
+		reader.parse_scalar(scalar);
+		if (scalar.type != 'N')
+			return false;
+		value = scalar.data_number;
+		return true;
+	}
+
+	template<typename F>
+	void parse_bits(vector<JsonBit> &bits, F describe)
+	{
+		reader.begin();
+		while (reader.next_element(']'))
+		{
+			reader.parse_scalar(scalar);
+
+			if (scalar.type == 'S') {
+				if (scalar.data_string == "0")
+					bits.push_back(JsonBit{true, State::S0});
+				else if (scalar.data_string == "1")
+					bits.push_back(JsonBit{true, State::S1});
+				else if (scalar.data_string == "x")
+					bits.push_back(JsonBit{true, State::Sx});
+				else if (scalar.data_string == "z")
+					bits.push_back(JsonBit{true, State::Sz});
+				else
+					log_error("%s has invalid '%s' bit string value on bit %d.\n",
+							describe().c_str(), scalar.data_string.c_str(), GetSize(bits));
+			} else
+			if (scalar.type == 'N') {
+				bits.push_back(JsonBit{false, int(scalar.data_number)});
+			} else
+				log_error("%s has invalid bit value on bit %d.\n", describe().c_str(), GetSize(bits));
+		}
+	}
 
-	Module *module = new RTLIL::Module;
-	module->name = RTLIL::escape_id(modname.c_str());
+	void parse_port(JsonPort &port)
+	{
+		if (reader.peek_type() != 'D')
+			log_error("JSON port node '%s' is not a dictionary.\n", log_id(port.name));
 
-	if (design->module(module->name))
-		log_error("Re-definition of module %s.\n", log_id(module->name));
+		reader.begin();
+		while (reader.next_key(key))
+		{
+			int64_t value;
+
+			if (key == "direction") {
+				reader.parse_scalar(scalar);
+				if (scalar.type != 'S')
+					log_error("JSON port node '%s' has non-string direction attribute.\n", log_id(port.name));
+				port.direction = scalar.data_string;
+				port.has_direction = true;
+			} else if (key == "bits") {
+				if (reader.peek_type() != 'A')
+					log_error("JSON port node '%s' has non-array bits attribute.\n", log_id(port.name));
+				port.bits.clear();
+				parse_bits(port.bits, [&]() { return stringf("JSON port node '%s'", log_id(port.name)); });
+				port.has_bits = true;
+			} else if (key == "upto") {
+				if ((port.has_upto = parse_number(value)))
+					port.upto = value != 0;
+			} else if (key == "signed") {
+				if ((port.has_signed = parse_number(value)))
+					port.is_signed = value != 0;
+			} else if (key == "offset") {
+				if ((port.has_offset = parse_number(value)))
+					port.offset = value;
+			} else
+				reader.skip_value();
+		}
 
-	design->add(module);
+		if (!port.has_direction)
+			log_error("JSON port node '%s' has no direction attribute.\n", log_id(port.name));
 
-	if (node->data_dict.count("attributes"))
-		json_parse_attr_param(module->attributes, node->data_dict.at("attributes"));
+		if (!port.has_bits)
+			log_error("JSON port node '%s' has no bits attribute.\n", log_id(port.name));
 
-	dict<int, SigBit> signal_bits;
+		if (port.direction != "input" && port.direction != "output" && port.direction != "inout")
+			log_error("JSON port node '%s' has invalid '%s' direction attribute.\n", log_id(port.name), port.direction.c_str());
+	}
 
-	if (node->data_dict.count("ports"))
+	void parse_netname(IdString net_name, JsonNetname &net)
 	{
-		JsonNode *ports_node = node->data_dict.at("ports");
+		if (reader.peek_type() != 'D')
+			log_error("JSON netname node '%s' is not a dictionary.\n", log_id(net_name));
+
+		reader.begin();
+		while (reader.next_key(key))
+		{
+			int64_t value;
+
+			if (key == "bits") {
+				if (reader.peek_type() != 'A')
+					log_error("JSON netname node '%s' has non-array bits attribute.\n", log_id(net_name));
+				net.bits.clear();
+				parse_bits(net.bits, [&]() { return stringf("JSON netname node '%s'", log_id(net_name)); });
+				net.has_bits = true;
+			} else if (key == "upto") {
+				if ((net.has_upto = parse_number(value)))
+					net.upto = value != 0;
+			} else if (key == "offset") {
+				if ((net.has_offset = parse_number(value)))
+					net.offset = value;
+			} else if (key == "attributes") {
+				net.attributes.clear();
+				parse_attr_param(net.attributes);
+			} else
+				reader.skip_value();
+		}
+
+		if (!net.has_bits)
+			log_error("JSON netname node '%s' has no bits attribute.\n", log_id(net_name));
+	}
+
+	void parse_cell(IdString cell_name, JsonCell &cell)
+	{
+		if (reader.peek_type() != 'D')
+			log_error("JSON cells node '%s' is not a dictionary.\n", log_id(cell_name));
+
+		reader.begin();
+		while (reader.next_key(key))
+		{
+			if (key == "type") {
+				reader.parse_scalar(scalar);
+				if (scalar.type != 'S')
+					log_error("JSON cells node '%s' has a non-string type.\n", log_id(cell_name));
+				cell.type = RTLIL::escape_id(scalar.data_string);
+			} else if (key == "connections") {
+				if (reader.peek_type() != 'D')
+					log_error("JSON cells node '%s' has non-dictionary connections attribute.\n", log_id(cell_name));
+				cell.connections.clear();
+				reader.begin();
+				while (reader.next_key(key)) {
+					IdString conn_name = RTLIL::escape_id(key);
+					if (reader.peek_type() != 'A')
+						log_error("JSON cells node '%s' connection '%s' is not an array.\n", log_id(cell_name), log_id(conn_name));
+					vector<JsonBit> &bits = cell.connections[conn_name];
+					bits.clear();
+					parse_bits(bits, [&]() { return stringf("JSON cells node '%s' connection '%s'", log_id(cell_name), log_id(conn_name)); });
+				}
+				cell.has_connections = true;
+			} else if (key == "attributes") {
+				cell.attributes.clear();
+				parse_attr_param(cell.attributes);
+			} else if (key == "parameters") {
+				cell.parameters.clear();
+				parse_attr_param(cell.parameters);
+			} else
+				reader.skip_value();
+		}
+
+		if (cell.type.empty())
+			log_error("JSON cells node '%s' has no type attribute.\n", log_id(cell_name));
 
-		if (ports_node->type != 'D')
-			log_error("JSON ports node is not a dictionary.\n");
+		if (!cell.has_connections)
+			log_error("JSON cells node '%s' has no connections attribute.\n", log_id(cell_name));
+	}
+
+	void parse_memory(IdString memory_name, JsonMemory &mem)
+	{
+		if (reader.peek_type() != 'D')
+			log_error("JSON memory node '%s' is not a dictionary.\n", log_id(memory_name));
 
-		for (int port_id = 1; port_id <= GetSize(ports_node->data_dict_keys); port_id++)
+		reader.begin();
+		while (reader.next_key(key))
 		{
-			IdString port_name = RTLIL::escape_id(ports_node->data_dict_keys[port_id-1].c_str());
-			JsonNode *port_node = ports_node->data_dict.at(ports_node->data_dict_keys[port_id-1]);
+			int64_t value;
+
+			if (key == "width") {
+				if (!parse_number(value))
+					log_error("JSON memory node '%s' has a non-number width.\n", log_id(memory_name));
+				mem.width = value;
+				mem.has_width = true;
+			} else if (key == "size") {
+				if (!parse_number(value))
+					log_error("JSON memory node '%s' has a non-number size.\n", log_id(memory_name));
+				mem.size = value;
+				mem.has_size = true;
+			} else if (key == "start_offset") {
+				if (parse_number(value))
+					mem.start_offset = value;
+			} else if (key == "attributes") {
+				mem.attributes.clear();
+				parse_attr_param(mem.attributes);
+			} else
+				reader.skip_value();
+		}
+
+		if (!mem.has_width)
+			log_error("JSON memory node '%s' has no width attribute.\n", log_id(memory_name));
+
+		if (!mem.has_size)
+			log_error("JSON memory node '%s' has no size attribute.\n", log_id(memory_name));
+	}
+
+	void parse_module(const string &modname)
+	{
+		log("Importing module %s from JSON file.\n", modname.c_str());
+
+		module = new RTLIL::Module;
+		module->name = RTLIL::escape_id(modname);
 
-			if (port_node->type != 'D')
-				log_error("JSON port node '%s' is not a dictionary.\n", log_id(port_name));
+		if (design->module(module->name))
+			log_error("Re-definition of module %s.\n", log_id(module->name));
 
-			if (port_node->data_dict.count("direction") == 0)
-				log_error("JSON port node '%s' has no direction attribute.\n", log_id(port_name));
+		design->add(module);
 
-			if (port_node->data_dict.count("bits") == 0)
-				log_error("JSON port node '%s' has no bits attribute.\n", log_id(port_name));
+		if (reader.peek_type() != 'D') {
+			reader.skip_value();
+			return;
+		}
 
-			JsonNode *port_direction_node = port_node->data_dict.at("direction");
-			JsonNode *port_bits_node = port_node->data_dict.at("bits");
+		reader.begin();
+		while (reader.next_key(key))
+		{
+			if (key == "attributes") {
+				parse_attr_param(module->attributes);
+			} else if (key == "ports") {
+				if (reader.peek_type() != 'D')
+					log_error("JSON ports node is not a dictionary.\n");
+				ports.clear();
+				reader.begin();
+				while (reader.next_key(key)) {
+					ports.emplace_back();
+					ports.back().name = RTLIL::escape_id(key);
+					parse_port(ports.back());
+				}
+			} else if (key == "netnames") {
+				if (reader.peek_type() != 'D')
+					log_error("JSON netnames node is not a dictionary.\n");
+				netnames.clear();
+				reader.begin();
+				while (reader.next_key(key)) {
+					IdString net_name = RTLIL::escape_id(key);
+					JsonNetname &net = netnames[net_name];
+					net = JsonNetname();
+					parse_netname(net_name, net);
+				}
+			} else if (key == "cells") {
+				if (reader.peek_type() != 'D')
+					log_error("JSON cells node is not a dictionary.\n");
+				cells.clear();
+				reader.begin();
+				while (reader.next_key(key)) {
+					IdString cell_name = RTLIL::escape_id(key);
+					JsonCell &cell = cells[cell_name];
+					cell = JsonCell();
+					parse_cell(cell_name, cell);
+				}
+			} else if (key == "memories") {
+				if (reader.peek_type() != 'D')
+					log_error("JSON memories node is not a dictionary.\n");
+				memories.clear();
+				reader.begin();
+				while (reader.next_key(key)) {
+					IdString memory_name = RTLIL::escape_id(key);
+					JsonMemory &mem = memories[memory_name];
+					mem = JsonMemory();
+					parse_memory(memory_name, mem);
+				}
+			} else
+				reader.skip_value();
+		}
 
-			if (port_direction_node->type != 'S')
-				log_error("JSON port node '%s' has non-string direction attribute.\n", log_id(port_name));
+		import_module();
+	}
 
-			if (port_bits_node->type != 'A')
-				log_error("JSON port node '%s' has non-array bits attribute.\n", log_id(port_name));
+	void import_module()
+	{
+		dict<int, SigBit> signal_bits;
 
-			Wire *port_wire = module->wire(port_name);
+		for (int port_id = 1; port_id <= GetSize(ports); port_id++)
+		{
+			JsonPort &port = ports[port_id-1];
+			Wire *port_wire = module->wire(port.name);
 
 			if (port_wire == nullptr)
-				port_wire = module->addWire(port_name, GetSize(port_bits_node->data_array));
+				port_wire = module->addWire(port.name, GetSize(port.bits));
 
-			if (port_node->data_dict.count("upto") != 0) {
-				JsonNode *val = port_node->data_dict.at("upto");
-				if (val->type == 'N')
-					port_wire->upto = val->data_number != 0;
-			}
+			if (port.has_upto)
+				port_wire->upto = port.upto;
 
-			if (port_node->data_dict.count("signed") != 0) {
-				JsonNode *val = port_node->data_dict.at("signed");
-				if (val->type == 'N')
-					port_wire->is_signed = val->data_number != 0;
-			}
+			if (port.has_signed)
+				port_wire->is_signed = port.is_signed;
 
-			if (port_node->data_dict.count("offset") != 0) {
-				JsonNode *val = port_node->data_dict.at("offset");
-				if (val->type == 'N')
-					port_wire->start_offset = val->data_number;
-			}
+			if (port.has_offset)
+				port_wire->start_offset = port.offset;
 
-			if (port_direction_node->data_string == "input") {
+			if (port.direction == "input") {
 				port_wire->port_input = true;
 			} else
-			if (port_direction_node->data_string == "output") {
+			if (port.direction == "output") {
 				port_wire->port_output = true;
-			} else
-			if (port_direction_node->data_string == "inout") {
+			} else {
 				port_wire->port_input = true;
 				port_wire->port_output = true;
-			} else
-				log_error("JSON port node '%s' has invalid '%s' direction attribute.\n", log_id(port_name), port_direction_node->data_string.c_str());
+			}
 
 			port_wire->port_id = port_id;
 
-			for (int i = 0; i < GetSize(port_bits_node->data_array); i++)
+			for (int i = 0; i < GetSize(port.bits); i++)
 			{
-				JsonNode *bitval_node = port_bits_node->data_array.at(i);
+				const JsonBit &bitval = port.bits[i];
 				SigBit sigbit(port_wire, i);
 
-				if (bitval_node->type == 'S') {
-					if (bitval_node->data_string == "0")
-						module->connect(sigbit, State::S0);
-					else if (bitval_node->data_string == "1")
-						module->connect(sigbit, State::S1);
-					else if (bitval_node->data_string == "x")
-						module->connect(sigbit, State::Sx);
-					else if (bitval_node->data_string == "z")
-						module->connect(sigbit, State::Sz);
-					else
-						log_error("JSON port node '%s' has invalid '%s' bit string value on bit %d.\n",
-								log_id(port_name), bitval_node->data_string.c_str(), i);
-				} else
-				if (bitval_node->type == 'N') {
-					int bitidx = bitval_node->data_number;
+				if (bitval.constant) {
+					module->connect(sigbit, State(bitval.value));
+				} else {
+					int bitidx = bitval.value;
 					if (signal_bits.count(bitidx)) {
 						if (port_wire->port_output) {
 							module->connect(sigbit, signal_bits.at(bitidx));
@@ -401,223 +708,115 @@ void json_import(Design *design, string &modname, JsonNode *node)
 					} else {
 						signal_bits[bitidx] = sigbit;
 					}
-				} else
-					log_error("JSON port node '%s' has invalid bit value on bit %d.\n", log_id(port_name), i);
+				}
 			}
 		}
 
 		module->fixup_ports();
-	}
-
-	if (node->data_dict.count("netnames"))
-	{
-		JsonNode *netnames_node = node->data_dict.at("netnames");
-
-		if (netnames_node->type != 'D')
-			log_error("JSON netnames node is not a dictionary.\n");
+		ports.clear();
 
-		for (auto &net : netnames_node->data_dict)
+		for (auto &net : netnames)
 		{
-			IdString net_name = RTLIL::escape_id(net.first.c_str());
-			JsonNode *net_node = net.second;
-
-			if (net_node->type != 'D')
-				log_error("JSON netname node '%s' is not a dictionary.\n", log_id(net_name));
-
-			if (net_node->data_dict.count("bits") == 0)
-				log_error("JSON netname node '%s' has no bits attribute.\n", log_id(net_name));
-
-			JsonNode *bits_node = net_node->data_dict.at("bits");
-
-			if (bits_node->type != 'A')
-				log_error("JSON netname node '%s' has non-array bits attribute.\n", log_id(net_name));
-
-			Wire *wire = module->wire(net_name);
+			Wire *wire = module->wire(net.first);
 
 			if (wire == nullptr)
-				wire = module->addWire(net_name, GetSize(bits_node->data_array));
+				wire = module->addWire(net.first, GetSize(net.second.bits));
 
-			if (net_node->data_dict.count("upto") != 0) {
-				JsonNode *val = net_node->data_dict.at("upto");
-				if (val->type == 'N')
-					wire->upto = val->data_number != 0;
-			}
+			if (net.second.has_upto)
+				wire->upto = net.second.upto;
 
-			if (net_node->data_dict.count("offset") != 0) {
-				JsonNode *val = net_node->data_dict.at("offset");
-				if (val->type == 'N')
-					wire->start_offset = val->data_number;
-			}
+			if (net.second.has_offset)
+				wire->start_offset = net.second.offset;
 
-			for (int i = 0; i < GetSize(bits_node->data_array); i++)
+			for (int i = 0; i < GetSize(net.second.bits); i++)
 			{
-				JsonNode *bitval_node = bits_node->data_array.at(i);
+				const JsonBit &bitval = net.second.bits[i];
 				SigBit sigbit(wire, i);
 
-				if (bitval_node->type == 'S') {
-					if (bitval_node->data_string == "0")
-						module->connect(sigbit, State::S0);
-					else if (bitval_node->data_string == "1")
-						module->connect(sigbit, State::S1);
-					else if (bitval_node->data_string == "x")
-						module->connect(sigbit, State::Sx);
-					else if (bitval_node->data_string == "z")
-						module->connect(sigbit, State::Sz);
-					else
-						log_error("JSON netname node '%s' has invalid '%s' bit string value on bit %d.\n",
-								log_id(net_name), bitval_node->data_string.c_str(), i);
-				} else
-				if (bitval_node->type == 'N') {
-					int bitidx = bitval_node->data_number;
+				if (bitval.constant) {
+					module->connect(sigbit, State(bitval.value));
+				} else {
+					int bitidx = bitval.value;
 					if (signal_bits.count(bitidx)) {
 						if (sigbit != signal_bits.at(bitidx))
 							module->connect(sigbit, signal_bits.at(bitidx));
 					} else {
 						signal_bits[bitidx] = sigbit;
 					}
-				} else
-					log_error("JSON netname node '%s' has invalid bit value on bit %d.\n", log_id(net_name), i);
+				}
 			}
 
-			if (net_node->data_dict.count("attributes"))
-				json_parse_attr_param(wire->attributes, net_node->data_dict.at("attributes"));
+			for (auto &it : net.second.attributes)
+				wire->attributes[it.first] = std::move(it.second);
 		}
-	}
-
-	if (node->data_dict.count("cells"))
-	{
-		JsonNode *cells_node = node->data_dict.at("cells");
-
-		if (cells_node->type != 'D')
-			log_error("JSON cells node is not a dictionary.\n");
+		netnames.clear();
 
-		for (auto &cell_node_it : cells_node->data_dict)
+		for (auto &cell_it : cells)
 		{
-			IdString cell_name = RTLIL::escape_id(cell_node_it.first.c_str());
-			JsonNode *cell_node = cell_node_it.second;
-
-			if (cell_node->type != 'D')
-				log_error("JSON cells node '%s' is not a dictionary.\n", log_id(cell_name));
-
-			if (cell_node->data_dict.count("type") == 0)
-				log_error("JSON cells node '%s' has no type attribute.\n", log_id(cell_name));
-
-			JsonNode *type_node = cell_node->data_dict.at("type");
-
-			if (type_node->type != 'S')
-				log_error("JSON cells node '%s' has a non-string type.\n", log_id(cell_name));
-
-			IdString cell_type = RTLIL::escape_id(type_node->data_string.c_str());
-
-			Cell *cell = module->addCell(cell_name, cell_type);
-
-			if (cell_node->data_dict.count("connections") == 0)
-				log_error("JSON cells node '%s' has no connections attribute.\n", log_id(cell_name));
-
-			JsonNode *connections_node = cell_node->data_dict.at("connections");
-
-			if (connections_node->type != 'D')
-				log_error("JSON cells node '%s' has non-dictionary connections attribute.\n", log_id(cell_name));
+			Cell *cell = module->addCell(cell_it.first, cell_it.second.type);
 
-			for (auto &conn_it : connections_node->data_dict)
+			for (auto &conn_it : cell_it.second.connections)
 			{
-				IdString conn_name = RTLIL::escape_id(conn_it.first.c_str());
-				JsonNode *conn_node = conn_it.second;
-
-				if (conn_node->type != 'A')
-					log_error("JSON cells node '%s' connection '%s' is not an array.\n", log_id(cell_name), log_id(conn_name));
-
 				SigSpec sig;
 
-				for (int i = 0; i < GetSize(conn_node->data_array); i++)
-				{
-					JsonNode *bitval_node = conn_node->data_array.at(i);
-
-					if (bitval_node->type == 'S') {
-						if (bitval_node->data_string == "0")
-							sig.append(State::S0);
-						else if (bitval_node->data_string == "1")
-							sig.append(State::S1);
-						else if (bitval_node->data_string == "x")
-							sig.append(State::Sx);
-						else if (bitval_node->data_string == "z")
-							sig.append(State::Sz);
-						else
-							log_error("JSON cells node '%s' connection '%s' has invalid '%s' bit string value on bit %d.\n",
-									log_id(cell_name), log_id(conn_name), bitval_node->data_string.c_str(), i);
-					} else
-					if (bitval_node->type == 'N') {
-						int bitidx = bitval_node->data_number;
-						if (signal_bits.count(bitidx) == 0)
-							signal_bits[bitidx] = module->addWire(NEW_ID);
-						sig.append(signal_bits.at(bitidx));
-					} else
-						log_error("JSON cells node '%s' connection '%s' has invalid bit value on bit %d.\n",
-								log_id(cell_name), log_id(conn_name), i);
-
+				for (auto &bitval : conn_it.second) {
+					if (bitval.constant) {
+						sig.append(State(bitval.value));
+					} else {
+						if (signal_bits.count(bitval.value) == 0)
+							signal_bits[bitval.value] = module->addWire(NEW_ID);
+						sig.append(signal_bits.at(bitval.value));
+					}
 				}
 
-				cell->setPort(conn_name, sig);
+				cell->setPort(conn_it.first, sig);
 			}
 
-			if (cell_node->data_dict.count("attributes"))
-				json_parse_attr_param(cell->attributes, cell_node->data_dict.at("attributes"));
+			cell->attributes.swap(cell_it.second.attributes);
+			cell->parameters.swap(cell_it.second.parameters);
+		}
+		cells.clear();
 
-			if (cell_node->data_dict.count("parameters"))
-				json_parse_attr_param(cell->parameters, cell_node->data_dict.at("parameters"));
+		for (auto &memory_it : memories)
+		{
+			RTLIL::Memory *mem = new RTLIL::Memory;
+			mem->name = memory_it.first;
+			mem->width = memory_it.second.width;
+			mem->size = memory_it.second.size;
+			mem->start_offset = memory_it.second.start_offset;
+			mem->attributes.swap(memory_it.second.attributes);
+			module->memories[mem->name] = mem;
 		}
+		memories.clear();
+
+		// remove duplicates from connections array
+		pool<RTLIL::SigSig> unique_connections(module->connections_.begin(), module->connections_.end());
+		module->connections_ = std::vector<RTLIL::SigSig>(unique_connections.begin(), unique_connections.end());
 	}
 
-	if (node->data_dict.count("memories"))
+	void parse()
 	{
-		JsonNode *memories_node = node->data_dict.at("memories");
-
-		if (memories_node->type != 'D')
-			log_error("JSON memories node is not a dictionary.\n");
+		if (reader.peek_type() != 'D')
+			log_error("JSON root node is not a dictionary.\n");
 
-		for (auto &memory_node_it : memories_node->data_dict)
+		reader.begin();
+		while (reader.next_key(key))
 		{
-			IdString memory_name = RTLIL::escape_id(memory_node_it.first.c_str());
-			JsonNode *memory_node = memory_node_it.second;
-
-			RTLIL::Memory *mem = new RTLIL::Memory;
-			mem->name = memory_name;
-
-			if (memory_node->type != 'D')
-				log_error("JSON memory node '%s' is not a dictionary.\n", log_id(memory_name));
-
-			if (memory_node->data_dict.count("width") == 0)
-				log_error("JSON memory node '%s' has no width attribute.\n", log_id(memory_name));
-			JsonNode *width_node = memory_node->data_dict.at("width");
-			if (width_node->type != 'N')
-				log_error("JSON memory node '%s' has a non-number width.\n", log_id(memory_name));
-			mem->width = width_node->data_number;
-
-			if (memory_node->data_dict.count("size") == 0)
-				log_error("JSON memory node '%s' has no size attribute.\n", log_id(memory_name));
-			JsonNode *size_node = memory_node->data_dict.at("size");
-			if (size_node->type != 'N')
-				log_error("JSON memory node '%s' has a non-number size.\n", log_id(memory_name));
-			mem->size = size_node->data_number;
-
-			mem->start_offset = 0;
-			if (memory_node->data_dict.count("start_offset") != 0) {
-				JsonNode *val = memory_node->data_dict.at("start_offset");
-				if (val->type == 'N')
-					mem->start_offset = val->data_number;
+			if (key != "modules") {
+				reader.skip_value();
+				continue;
 			}
 
-			if (memory_node->data_dict.count("attributes"))
-				json_parse_attr_param(mem->attributes, memory_node->data_dict.at("attributes"));
+			if (reader.peek_type() != 'D')
+				log_error("JSON modules node is not a dictionary.\n");
 
-			module->memories[mem->name] = mem;
+			string modname;
+			reader.begin();
+			while (reader.next_key(modname))
+				parse_module(modname);
 		}
 	}
-
-	// remove duplicates from connections array
-	pool<RTLIL::SigSig> unique_connections(module->connections_.begin(), module->connections_.end());
-	module->connections_ = std::vector<RTLIL::SigSig>(unique_connections.begin(), unique_connections.end());
-}
+};
 
 struct JsonFrontend : public Frontend {
 	JsonFrontend() : Frontend("json", "read JSON file") { }
@@ -646,21 +845,8 @@ struct JsonFrontend : public Frontend {
 		}
 		extra_args(f, filename, args, argidx);
 
-		JsonNode root(*f);
-
-		if (root.type != 'D')
-			log_error("JSON root node is not a dictionary.\n");
-
-		if (root.data_dict.count("modules") != 0)
-		{
-			JsonNode *modules = root.data_dict.at("modules");
-
-			if (modules->type != 'D')
-				log_error("JSON modules node is not a dictionary.\n");
-
-			for (auto &it : modules->data_dict)
-				json_import(design, it.first, it.second);
-		}
+		JsonImporter importer(*f, design);
+		importer.parse();
 	}
 } JsonFrontend;
 
@@ -546,13 +546,20 @@ struct LibertyFrontend : public Frontend {
 
 		log_header(design, "Executing Liberty frontend: %s\n", filename.c_str());
 
-		LibertyParser parser(*f);
+		// plain files (opened as ifstream by extra_args) go through the
+		// session's parse cache, other streams are parsed directly
+		std::shared_ptr<LibertyParser> parser;
+		if (dynamic_cast<std::ifstream*>(f) != nullptr)
+			parser = LibertyParser::load(filename);
+		else
+			parser = std::make_shared<LibertyParser>(*f);
+		parser->parse_all_cells();
 		int cell_count = 0;
 
 		std::map<std::string, std::tuple<int, int, bool>> global_type_map;
-		parse_type_map(global_type_map, parser.ast);
+		parse_type_map(global_type_map, parser->ast);
 
-		for (auto cell : parser.ast->children)
+		for (auto cell : parser->ast->children)
 		{
 			if (cell->id != "cell" || cell->args.size() != 1)
 				continue;
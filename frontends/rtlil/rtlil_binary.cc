@@ -0,0 +1,388 @@
+/*
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ *  ---
+ *
+ *  The reader of the binary RTLIL format, see backends/rtlil/rtlil_binary.h.
+ *
+ */
+
+#include "rtlil_frontend.h"
+#include "backends/rtlil/rtlil_binary.h"
+#include "kernel/threading.h"
+
+YOSYS_NAMESPACE_BEGIN
+
+namespace {
+
+struct BinaryDecoder
+{
+	const unsigned char *ptr, *end;
+
+	BinaryDecoder(const char *begin, const char *end) :
+			ptr((const unsigned char*)begin), end((const unsigned char*)end) { }
+
+	[[noreturn]] static void corrupt()
+	{
+		log_error("Binary RTLIL file is truncated or corrupt.\n");
+	}
+
+	uint64_t get_uint()
+	{
+		uint64_t value = 0;
+		for (int shift = 0;; shift += 7) {
+			if (ptr == end || shift > 63)
+				corrupt();
+			unsigned char byte = *ptr++;
+			value |= uint64_t(byte & 0x7f) << shift;
+			if (!(byte & 0x80))
+				return value;
+		}
+	}
+
+	int get_int()
+	{
+		uint64_t value = get_uint();
+		if (value > uint64_t(INT_MAX))
+			corrupt();
+		return value;
+	}
+
+	int get_sint()
+	{
+		uint64_t value = get_uint();
+		int64_t result = int64_t(value >> 1) ^ -int64_t(value & 1);
+		if (result < INT_MIN || result > INT_MAX)
+			corrupt();
+		return result;
+	}
+};
+
+struct ModuleDecoder : BinaryDecoder
+{
+	const std::vector<RTLIL::IdString> &ids;
+	RTLIL::Module *module = nullptr;
+	std::vector<RTLIL::Wire*> wires;
+
+	ModuleDecoder(const char *begin, const char *end, const std::vector<RTLIL::IdString> &ids) :
+			BinaryDecoder(begin, end), ids(ids) { }
+
+	RTLIL::IdString get_id()
+	{
+		uint64_t index = get_uint();
+		if (index >= ids.size())
+			corrupt();
+		return ids[index];
+	}
+
+	void get_bits(std::vector<RTLIL::State> &bits)
+	{
+		uint64_t header = get_uint();
+		uint64_t width = header >> 1;
+		bool packed = header & 1;
+		if ((packed ? (width + 7) / 8 : width) > uint64_t(end - ptr))
+			corrupt();
+
+		bits.resize(width);
+		if (packed) {
+			for (uint64_t i = 0; i < width; i++)
+				bits[i] = (ptr[i / 8] >> (i % 8)) & 1 ? RTLIL::S1 : RTLIL::S0;
+			ptr += (width + 7) / 8;
+		} else {
+			for (uint64_t i = 0; i < width; i++) {
+				if (ptr[i] > RTLIL::Sm)
+					corrupt();
+				bits[i] = RTLIL::State(ptr[i]);
+			}
+			ptr += width;
+		}
+	}
+
+	RTLIL::Const get_const()
+	{
+		RTLIL::Const value;
+		value.flags = get_int();
+		get_bits(value.bits);
+		return value;
+	}
+
+	RTLIL::SigChunk get_chunk()
+	{
+		uint64_t index = get_uint();
+		if (index == 0) {
+			RTLIL::SigChunk chunk;
+			get_bits(chunk.data);
+			chunk.width = GetSize(chunk.data);
+			return chunk;
+		}
+		if (index > wires.size())
+			corrupt();
+		RTLIL::Wire *wire = wires[index - 1];
+		int offset = get_int();
+		int width = get_int();
+		if (offset + int64_t(width) > wire->width)
+			corrupt();
+		return RTLIL::SigChunk(wire, offset, width);
+	}
+
+	RTLIL::SigSpec get_sigspec()
+	{
+		uint64_t count = get_uint();
+		if (count == 1)
+			return get_chunk();
+		if (count > uint64_t(end - ptr))
+			corrupt();
+		std::vector<RTLIL::SigChunk> chunks;
+		chunks.reserve(count);
+		for (uint64_t i = 0; i < count; i++)
+			chunks.push_back(get_chunk());
+		return chunks;
+	}
+
+	RTLIL::SigSig get_sigsig()
+	{
+		RTLIL::SigSpec lhs = get_sigspec();
+		RTLIL::SigSpec rhs = get_sigspec();
+		return RTLIL::SigSig(std::move(lhs), std::move(rhs));
+	}
+
+	void get_attributes(dict<RTLIL::IdString, RTLIL::Const> &attributes)
+	{
+		for (uint64_t count = get_uint(); count > 0; count--) {
+			RTLIL::IdString id = get_id();
+			attributes[id] = get_const();
+		}
+	}
+
+	void get_case(RTLIL::CaseRule *rule)
+	{
+		get_attributes(rule->attributes);
+		for (uint64_t count = get_uint(); count > 0; count--)
+			rule->compare.push_back(get_sigspec());
+		for (uint64_t count = get_uint(); count > 0; count--)
+			rule->actions.push_back(get_sigsig());
+		for (uint64_t count = get_uint(); count > 0; count--) {
+			RTLIL::SwitchRule *sw = new RTLIL::SwitchRule;
+			rule->switches.push_back(sw);
+			get_attributes(sw->attributes);
+			sw->signal = get_sigspec();
+			for (uint64_t n = get_uint(); n > 0; n--) {
+				RTLIL::CaseRule *cs = new RTLIL::CaseRule;
+				sw->cases.push_back(cs);
+				get_case(cs);
+			}
+		}
+	}
+
+	void get_process()
+	{
+		RTLIL::IdString name = get_id();
+		if (module->processes.count(name))
+			corrupt();
+		RTLIL::Process *proc = module->addProcess(name);
+		get_attributes(proc->attributes);
+		get_case(&proc->root_case);
+
+		for (uint64_t count = get_uint(); count > 0; count--) {
+			RTLIL::SyncRule *sync = new RTLIL::SyncRule;
+			proc->syncs.push_back(sync);
+			uint64_t type = get_uint();
+			if (type > RTLIL::STi)
+				corrupt();
+			sync->type = RTLIL::SyncType(type);
+			sync->signal = get_sigspec();
+			for (uint64_t n = get_uint(); n > 0; n--)
+				sync->actions.push_back(get_sigsig());
+			for (uint64_t n = get_uint(); n > 0; n--) {
+				RTLIL::MemWriteAction act;
+				get_attributes(act.attributes);
+				act.memid = get_id();
+				act.address = get_sigspec();
+				act.data = get_sigspec();
+				act.enable = get_sigspec();
+				act.priority_mask = get_const();
+				sync->mem_write_actions.push_back(std::move(act));
+			}
+		}
+	}
+
+	RTLIL::Module *get_module(RTLIL::IdString name)
+	{
+		module = new RTLIL::Module;
+		module->name = name;
+		get_attributes(module->attributes);
+		for (uint64_t count = get_uint(); count > 0; count--)
+			module->avail_parameters(get_id());
+		for (uint64_t count = get_uint(); count > 0; count--) {
+			RTLIL::IdString id = get_id();
+			module->parameter_default_values[id] = get_const();
+		}
+
+		uint64_t num_wires = get_uint();
+		if (num_wires > uint64_t(end - ptr))
+			corrupt();
+		wires.reserve(num_wires);
+		for (uint64_t i = 0; i < num_wires; i++) {
+			RTLIL::IdString id = get_id();
+			if (module->wire(id) != nullptr)
+				corrupt();
+			RTLIL::Wire *wire = module->addWire(id, get_int());
+			wire->start_offset = get_sint();
+			wire->port_id = get_int();
+			int flags = get_int();
+			wire->port_input = flags & 1;
+			wire->port_output = flags & 2;
+			wire->upto = flags & 4;
+			wire->is_signed = flags & 8;
+			get_attributes(wire->attributes);
+			wires.push_back(wire);
+		}
+
+		for (uint64_t count = get_uint(); count > 0; count--) {
+			RTLIL::IdString id = get_id();
+			if (module->memories.count(id))
+				corrupt();
+			RTLIL::Memory *memory = new RTLIL::Memory;
+			memory->name = id;
+			module->memories[id] = memory;
+			memory->width = get_int();
+			memory->start_offset = get_sint();
+			memory->size = get_int();
+			get_attributes(memory->attributes);
+		}
+
+		for (uint64_t count = get_uint(); count > 0; count--) {
+			RTLIL::IdString id = get_id();
+			if (module->cell(id) != nullptr)
+				corrupt();
+			RTLIL::Cell *cell = module->addCell(id, get_id());
+			get_attributes(cell->attributes);
+			for (uint64_t n = get_uint(); n > 0; n--) {
+				RTLIL::IdString param = get_id();
+				cell->parameters[param] = get_const();
+			}
+			for (uint64_t n = get_uint(); n > 0; n--) {
+				RTLIL::IdString port = get_id();
+				cell->setPort(port, get_sigspec());
+			}
+		}
+
+		for (uint64_t count = get_uint(); count > 0; count--)
+			get_process();
+
+		for (uint64_t count = get_uint(); count > 0; count--)
+			module->connect(get_sigsig());
+
+		if (ptr != end)
+			corrupt();
+
+		module->fixup_ports();
+		return module;
+	}
+};
+
+} // namespace
+
+void RTLIL_FRONTEND::read_rtlil_binary(std::istream *f, const std::string &filename, RTLIL::Design *design)
+{
+	InputBuffer input(f, filename);
+	const char *data = input.data, *data_end = input.data + input.size;
+
+	if (input.size < sizeof(RTLIL_BINARY::magic) + 8 || memcmp(data, RTLIL_BINARY::magic, sizeof(RTLIL_BINARY::magic)) != 0)
+		log_error("`%s' is not a binary RTLIL file.\n", filename.c_str());
+
+	BinaryDecoder header(data + sizeof(RTLIL_BINARY::magic), data_end - 8);
+	uint64_t version = header.get_uint();
+	if (version != RTLIL_BINARY::version)
+		log_error("Binary RTLIL file `%s' has version %d, expected version %d.\n", filename.c_str(), int(version), RTLIL_BINARY::version);
+	uint64_t file_autoidx = header.get_uint();
+
+	std::vector<const char*> strings(header.get_uint());
+	for (auto &str : strings) {
+		uint64_t len = header.get_uint();
+		if (len >= uint64_t(header.end - header.ptr) || header.ptr[len] != 0 || (len > 0 && header.ptr[0] != '\\' && header.ptr[0] != '$'))
+			BinaryDecoder::corrupt();
+		str = (const char*)header.ptr;
+		header.ptr += len + 1;
+	}
+
+	std::vector<RTLIL::IdString> ids(strings.size());
+	const int block_size = 1 << 16;
+	parallel_for_unnamed((GetSize(strings) + block_size - 1) / block_size, [&](int block) {
+		for (int i = block * block_size; i < std::min(GetSize(strings), (block + 1) * block_size); i++)
+			if (strings[i][0] != 0)
+				ids[i] = strings[i];
+	});
+
+	uint64_t index_offset = 0;
+	for (int i = 0; i < 8; i++)
+		index_offset |= uint64_t((unsigned char)data_end[i - 8]) << (8 * i);
+	if (index_offset < uint64_t((const char*)header.ptr - data) || index_offset > input.size - 8)
+		BinaryDecoder::corrupt();
+
+	struct Section {
+		RTLIL::IdString name;
+		const char *begin, *end;
+		RTLIL::Module *module;
+	};
+	std::vector<Section> sections;
+
+	BinaryDecoder index(data + index_offset, data_end - 8);
+	for (uint64_t count = index.get_uint(); count > 0; count--) {
+		uint64_t name = index.get_uint();
+		uint64_t offset = index.get_uint();
+		uint64_t size = index.get_uint();
+		if (name >= ids.size() || offset < uint64_t((const char*)header.ptr - data) || offset > index_offset || size > index_offset - offset)
+			BinaryDecoder::corrupt();
+		sections.push_back(Section{ids[name], data + offset, data + offset + size, nullptr});
+	}
+
+	parallel_for_unnamed(GetSize(sections), [&](int i) {
+		ModuleDecoder decoder(sections[i].begin, sections[i].end, ids);
+		sections[i].module = decoder.get_module(sections[i].name);
+	});
+
+	for (auto &section : sections)
+	{
+		RTLIL::Module *module = section.module;
+		if (design->has(module->name)) {
+			RTLIL::Module *existing_mod = design->module(module->name);
+			if (!flag_overwrite && (flag_lib || module->get_bool_attribute(ID::blackbox))) {
+				log("Ignoring blackbox re-definition of module %s.\n", module->name.c_str());
+				delete module;
+				continue;
+			} else if (!flag_nooverwrite && !flag_overwrite && !existing_mod->get_bool_attribute(ID::blackbox)) {
+				log_error("RTLIL error: redefinition of module %s.\n", module->name.c_str());
+			} else if (flag_nooverwrite) {
+				log("Ignoring re-definition of module %s.\n", module->name.c_str());
+				delete module;
+				continue;
+			} else {
+				log("Replacing existing%s module %s.\n", existing_mod->get_bool_attribute(ID::blackbox) ? " blackbox" : "", module->name.c_str());
+				design->remove(existing_mod);
+			}
+		}
+		design->add(module);
+		if (flag_lib)
+			module->makeblackbox();
+	}
+
+	autoidx = max(autoidx, int(std::min<uint64_t>(file_autoidx, INT_MAX)));
+	log("Read %d modules and %d names from binary RTLIL file.\n", GetSize(sections), GetSize(ids));
+}
+
+YOSYS_NAMESPACE_END
@@ -55,12 +55,24 @@ struct RTLILFrontend : public Frontend {
 		log("    -lib\n");
 		log("        only create empty blackbox modules\n");
 		log("\n");
+		log("    -fast\n");
+		log("        use the hand-written reader instead of the flex/bison parser. it\n");
+		log("        reads the input file through a memory mapping and is considerably\n");
+		log("        faster on large files.\n");
+		log("\n");
+		log("    -binary\n");
+		log("        read a binary RTLIL file as written by 'write_rtlil -binary'. the\n");
+		log("        modules in the file are decoded in parallel when yosys is run with\n");
+		log("        more than one thread (-j).\n");
+		log("\n");
 	}
 	void execute(std::istream *&f, std::string filename, std::vector<std::string> args, RTLIL::Design *design) override
 	{
 		RTLIL_FRONTEND::flag_nooverwrite = false;
 		RTLIL_FRONTEND::flag_overwrite = false;
 		RTLIL_FRONTEND::flag_lib = false;
+		bool flag_fast = false;
+		bool flag_binary = false;
 
 		log_header(design, "Executing RTLIL frontend.\n");
 
@@ -81,12 +93,30 @@ struct RTLILFrontend : public Frontend {
 				RTLIL_FRONTEND::flag_lib = true;
 				continue;
 			}
+			if (arg == "-fast") {
+				flag_fast = true;
+				continue;
+			}
+			if (arg == "-binary") {
+				flag_binary = true;
+				continue;
+			}
 			break;
 		}
-		extra_args(f, filename, args, argidx);
+		extra_args(f, filename, args, argidx, flag_binary);
 
 		log("Input filename: %s\n", filename.c_str());
 
+		if (flag_binary) {
+			RTLIL_FRONTEND::read_rtlil_binary(f, filename, design);
+			return;
+		}
+
+		if (flag_fast) {
+			RTLIL_FRONTEND::read_rtlil_fast(f, filename, design);
+			return;
+		}
+
 		RTLIL_FRONTEND::lexin = f;
 		RTLIL_FRONTEND::current_design = design;
 		rtlil_frontend_yydebug = false;
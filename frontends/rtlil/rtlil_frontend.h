@@ -35,6 +35,25 @@ namespace RTLIL_FRONTEND {
 	extern bool flag_nooverwrite;
 	extern bool flag_overwrite;
 	extern bool flag_lib;
+
+	// The contents of an input file, memory-mapped if the stream is a plain
+	// file opened by Frontend::extra_args(), otherwise read into a string.
+	struct InputBuffer
+	{
+		const char *data = nullptr;
+		size_t size = 0;
+		std::string buffer;
+		void *map = nullptr;
+
+		InputBuffer(std::istream *f, const std::string &filename);
+		~InputBuffer();
+	};
+
+	// the hand-written reader in rtlil_reader.cc, see "read_rtlil -fast"
+	void read_rtlil_fast(std::istream *f, const std::string &filename, RTLIL::Design *design);
+
+	// the reader for the binary format in rtlil_binary.cc, see "read_rtlil -binary"
+	void read_rtlil_binary(std::istream *f, const std::string &filename, RTLIL::Design *design);
 }
 
 YOSYS_NAMESPACE_END
@@ -0,0 +1,861 @@
+/*
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ *  ---
+ *
+ *  A hand-written reader for the RTLIL text representation ("read_rtlil
+ *  -fast"). It accepts the same grammar as rtlil_lexer.l and rtlil_parser.y
+ *  but works directly on the input buffer, which is memory-mapped for
+ *  regular files, instead of copying every token into a heap string.
+ *
+ */
+
+#include "rtlil_frontend.h"
+#include "kernel/log.h"
+
+#include <fstream>
+#include <sstream>
+
+#if !defined(_WIN32) && !defined(__wasm)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#  define YOSYS_RTLIL_READER_MMAP
+#endif
+
+YOSYS_NAMESPACE_BEGIN
+
+namespace {
+
+// Maps the names in the input buffer to IdStrings without creating a
+// std::string for every occurrence. Each distinct name is interned once per
+// file, the cache keeps a reference so that the index stays valid.
+struct IdStringCache
+{
+	struct Entry {
+		const char *str;
+		int len;
+		int index;
+	};
+
+	std::vector<Entry> table;
+	std::vector<RTLIL::IdString> ids;
+	int count = 0;
+
+	IdStringCache() : table(1024, Entry{nullptr, 0, 0}) { }
+
+	static unsigned int hash(const char *str, int len)
+	{
+		unsigned int h = mkhash_init;
+		for (int i = 0; i < len; i++)
+			h = mkhash(h, (unsigned char)str[i]);
+		return h;
+	}
+
+	void rehash()
+	{
+		std::vector<Entry> old_table(table.size() * 2, Entry{nullptr, 0, 0});
+		std::swap(table, old_table);
+		for (auto &entry : old_table) {
+			if (entry.str == nullptr)
+				continue;
+			size_t mask = table.size() - 1;
+			for (size_t i = hash(entry.str, entry.len) & mask;; i = (i + 1) & mask)
+				if (table[i].str == nullptr) {
+					table[i] = entry;
+					break;
+				}
+		}
+	}
+
+	RTLIL::IdString operator()(const char *str, int len)
+	{
+		size_t mask = table.size() - 1;
+		size_t i = hash(str, len) & mask;
+		for (;; i = (i + 1) & mask) {
+			Entry &entry = table[i];
+			if (entry.str == nullptr)
+				break;
+			if (entry.len == len && memcmp(entry.str, str, len) == 0) {
+				RTLIL::IdString id;
+				id.index_ = RTLIL::IdString::get_reference(entry.index);
+				return id;
+			}
+		}
+
+		RTLIL::IdString id(std::string(str, len));
+		ids.push_back(id);
+		table[i] = Entry{str, len, id.index_};
+		if (2 * ++count > GetSize(table))
+			rehash();
+		return id;
+	}
+};
+
+struct RTLILReader
+{
+	enum TokenType { TokEOF, TokEOL, TokID, TokValue, TokInt, TokString, TokKeyword, TokInvalid, TokChar };
+
+	enum Keyword {
+		KwAutoidx, KwModule, KwAttribute, KwParameter, KwSigned, KwReal, KwWire, KwMemory,
+		KwWidth, KwUpto, KwOffset, KwSize, KwInput, KwOutput, KwInout, KwCell, KwConnect,
+		KwSwitch, KwCase, KwAssign, KwSync, KwLow, KwHigh, KwPosedge, KwNegedge, KwEdge,
+		KwAlways, KwGlobal, KwInit, KwUpdate, KwMemwr, KwProcess, KwEnd
+	};
+
+	RTLIL::Design *design;
+	const char *ptr, *end;
+	int line = 1;
+
+	// the current token
+	TokenType tok_type;
+	const char *tok_str;
+	int tok_len;
+	int tok_int;
+	Keyword tok_keyword;
+	std::string tok_string;
+
+	IdStringCache ids;
+	RTLIL::Module *module = nullptr;
+	dict<RTLIL::IdString, RTLIL::Const> attrbuf;
+
+	RTLILReader(RTLIL::Design *design, const char *begin, const char *end) : design(design), ptr(begin), end(end) { }
+
+	[[noreturn]] void error(const std::string &message)
+	{
+		log_error("Parser error in line %d: %s\n", line, message.c_str());
+	}
+
+	[[noreturn]] void syntax_error()
+	{
+		error("syntax error");
+	}
+
+	static bool is_space(char c)
+	{
+		return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+	}
+
+	bool lookup_keyword(const char *str, int len)
+	{
+		static const struct { const char *str; Keyword keyword; } keywords[] = {
+			{"autoidx", KwAutoidx}, {"module", KwModule}, {"attribute", KwAttribute},
+			{"parameter", KwParameter}, {"signed", KwSigned}, {"real", KwReal}, {"wire", KwWire},
+			{"memory", KwMemory}, {"width", KwWidth}, {"upto", KwUpto}, {"offset", KwOffset},
+			{"size", KwSize}, {"input", KwInput}, {"output", KwOutput}, {"inout", KwInout},
+			{"cell", KwCell}, {"connect", KwConnect}, {"switch", KwSwitch}, {"case", KwCase},
+			{"assign", KwAssign}, {"sync", KwSync}, {"low", KwLow}, {"high", KwHigh},
+			{"posedge", KwPosedge}, {"negedge", KwNegedge}, {"edge", KwEdge}, {"always", KwAlways},
+			{"global", KwGlobal}, {"init", KwInit}, {"update", KwUpdate}, {"memwr", KwMemwr},
+			{"process", KwProcess}, {"end", KwEnd}
+		};
+		for (auto &it : keywords)
+			if (it.str[0] == str[0] && int(strlen(it.str)) == len && memcmp(it.str, str, len) == 0) {
+				tok_keyword = it.keyword;
+				return true;
+			}
+		return false;
+	}
+
+	// Returns false if the value does not fit into 63 bits.
+	static bool parse_decimal(const char *begin, const char *end, int64_t &value)
+	{
+		value = 0;
+		for (const char *p = begin; p != end; p++) {
+			if (value > (INT64_MAX - 9) / 10)
+				return false;
+			value = 10 * value + (*p - '0');
+		}
+		return true;
+	}
+
+	// The tokens are the same as those of rtlil_lexer.l, the string of the
+	// token (tok_str, tok_len) points into the input buffer.
+	void next()
+	{
+		while (ptr != end) {
+			if (*ptr == ' ' || *ptr == '\t')
+				ptr++;
+			else if (*ptr == '#')
+				while (ptr != end && *ptr != '\n')
+					ptr++;
+			else
+				break;
+		}
+
+		tok_str = ptr;
+		if (ptr == end) {
+			tok_type = TokEOF;
+			tok_len = 0;
+			return;
+		}
+
+		char c = *ptr;
+		if (c == '\r' || c == '\n') {
+			for (; ptr != end && (*ptr == '\r' || *ptr == '\n'); ptr++)
+				if (*ptr == '\n')
+					line++;
+			tok_type = TokEOL;
+		} else if (c == '\\' || c == '$') {
+			for (ptr++; ptr != end && !is_space(*ptr); ptr++) { }
+			tok_type = ptr - tok_str > 1 ? TokID : TokChar;
+			if (tok_type == TokChar)
+				ptr = tok_str + 1;
+		} else if ('a' <= c && c <= 'z') {
+			for (ptr++; ptr != end && 'a' <= *ptr && *ptr <= 'z'; ptr++) { }
+			tok_type = lookup_keyword(tok_str, ptr - tok_str) ? TokKeyword : TokInvalid;
+		} else if (('0' <= c && c <= '9') || (c == '-' && ptr+1 != end && '0' <= ptr[1] && ptr[1] <= '9')) {
+			for (ptr++; ptr != end && '0' <= *ptr && *ptr <= '9'; ptr++) { }
+			if (c != '-' && ptr != end && *ptr == '\'') {
+				for (ptr++; ptr != end && *ptr && strchr("01xzm-", *ptr); ptr++) { }
+				tok_type = TokValue;
+			} else {
+				// literals out of the range of int are invalid, as in the lexer
+				bool negative = c == '-';
+				int64_t value;
+				if (!parse_decimal(tok_str + negative, ptr, value) || (negative ? -value < INT_MIN : value > INT_MAX)) {
+					tok_type = TokInvalid;
+				} else {
+					tok_type = TokInt;
+					tok_int = negative ? -value : value;
+				}
+			}
+		} else if (c == '"') {
+			lex_string();
+		} else {
+			ptr++;
+			tok_type = TokChar;
+		}
+		tok_len = ptr - tok_str;
+	}
+
+	void lex_string()
+	{
+		tok_string.clear();
+		for (ptr++;; ptr++) {
+			if (ptr == end || *ptr == '\n')
+				error("unterminated string");
+			if (*ptr == '"')
+				break;
+			if (*ptr != '\\' || ptr+1 == end || ptr[1] == '\n') {
+				tok_string += *ptr;
+				continue;
+			}
+			char c = *++ptr;
+			if (c == 'n')
+				c = '\n';
+			else if (c == 't')
+				c = '\t';
+			else if ('0' <= c && c <= '7') {
+				c = c - '0';
+				if (ptr+1 != end && '0' <= ptr[1] && ptr[1] <= '7')
+					c = c * 8 + *++ptr - '0';
+				if (ptr+1 != end && '0' <= ptr[1] && ptr[1] <= '7')
+					c = c * 8 + *++ptr - '0';
+			}
+			tok_string += c;
+		}
+		ptr++;
+		tok_type = TokString;
+	}
+
+	bool is_keyword(Keyword keyword) const
+	{
+		return tok_type == TokKeyword && tok_keyword == keyword;
+	}
+
+	bool is_char(char c) const
+	{
+		return tok_type == TokChar && *tok_str == c;
+	}
+
+	void expect_keyword(Keyword keyword)
+	{
+		if (!is_keyword(keyword))
+			syntax_error();
+		next();
+	}
+
+	void expect_char(char c)
+	{
+		if (!is_char(c))
+			syntax_error();
+		next();
+	}
+
+	void expect_eol()
+	{
+		if (tok_type != TokEOL)
+			syntax_error();
+		while (tok_type == TokEOL)
+			next();
+	}
+
+	RTLIL::IdString expect_id()
+	{
+		if (tok_type != TokID)
+			syntax_error();
+		RTLIL::IdString id = ids(tok_str, tok_len);
+		next();
+		return id;
+	}
+
+	int expect_int()
+	{
+		if (tok_type != TokInt)
+			syntax_error();
+		int value = tok_int;
+		next();
+		return value;
+	}
+
+	void check_no_attributes()
+	{
+		if (attrbuf.size() != 0)
+			error("dangling attribute");
+	}
+
+	bool at_constant() const
+	{
+		return tok_type == TokValue || tok_type == TokInt || tok_type == TokString;
+	}
+
+	RTLIL::Const parse_constant()
+	{
+		RTLIL::Const value;
+		if (tok_type == TokValue) {
+			const char *quote = (const char*)memchr(tok_str, '\'', tok_len);
+			int64_t width;
+			if (!parse_decimal(tok_str, quote, width) || width > INT_MAX)
+				error("constant too wide");
+			auto &bits = value.bits;
+			bits.reserve(std::max<int>(width, tok_str + tok_len - quote - 1));
+			for (const char *p = tok_str + tok_len - 1; p != quote; p--) {
+				switch (*p) {
+				case '0': bits.push_back(RTLIL::S0); break;
+				case '1': bits.push_back(RTLIL::S1); break;
+				case 'z': bits.push_back(RTLIL::Sz); break;
+				case '-': bits.push_back(RTLIL::Sa); break;
+				case 'm': bits.push_back(RTLIL::Sm); break;
+				default: bits.push_back(RTLIL::Sx); break;
+				}
+			}
+			if (bits.empty())
+				bits.push_back(RTLIL::Sx);
+			RTLIL::State padding = bits.back() == RTLIL::S1 ? RTLIL::S0 : bits.back();
+			if (GetSize(bits) < width)
+				bits.resize(width, padding);
+			else
+				bits.resize(width);
+		} else if (tok_type == TokInt) {
+			value = RTLIL::Const(tok_int, 32);
+		} else if (tok_type == TokString) {
+			value = RTLIL::Const(tok_string);
+		} else {
+			syntax_error();
+		}
+		next();
+		return value;
+	}
+
+	RTLIL::SigSpec parse_slice(RTLIL::Wire *wire)
+	{
+		expect_char('[');
+		int msb = expect_int(), lsb = msb;
+		if (is_char(':')) {
+			next();
+			lsb = expect_int();
+			if (msb >= wire->width || lsb < 0 || msb < lsb)
+				error("invalid slice");
+		} else {
+			if (msb >= wire->width || msb < 0)
+				error("bit index out of range");
+		}
+		expect_char(']');
+		return RTLIL::SigSpec(wire, lsb, msb - lsb + 1);
+	}
+
+	RTLIL::SigSpec parse_sigspec()
+	{
+		RTLIL::SigSpec sig;
+
+		if (tok_type == TokID) {
+			RTLIL::IdString id = ids(tok_str, tok_len);
+			RTLIL::Wire *wire = module->wire(id);
+			if (wire == nullptr)
+				error(stringf("RTLIL error: wire %s not found", id.c_str()));
+			next();
+			// slice the wire directly instead of extracting from a SigSpec
+			// of the complete wire, which would unpack all of its bits
+			sig = is_char('[') ? parse_slice(wire) : RTLIL::SigSpec(wire);
+		} else if (is_char('{')) {
+			next();
+			std::vector<RTLIL::SigSpec> parts;
+			while (!is_char('}'))
+				parts.push_back(parse_sigspec());
+			next();
+			for (auto it = parts.rbegin(); it != parts.rend(); it++)
+				sig.append(*it);
+		} else {
+			sig = RTLIL::SigSpec(parse_constant());
+		}
+
+		while (is_char('[')) {
+			next();
+			int msb = expect_int();
+			if (is_char(':')) {
+				next();
+				int lsb = expect_int();
+				if (msb >= sig.size() || msb < 0 || msb < lsb)
+					error("invalid slice");
+				sig = sig.extract(lsb, msb - lsb + 1);
+			} else {
+				if (msb >= sig.size() || msb < 0)
+					error("bit index out of range");
+				sig = sig.extract(msb);
+			}
+			expect_char(']');
+		}
+
+		return sig;
+	}
+
+	void parse_attribute()
+	{
+		expect_keyword(KwAttribute);
+		RTLIL::IdString id = expect_id();
+		attrbuf[id] = parse_constant();
+		expect_eol();
+	}
+
+	void parse_module()
+	{
+		expect_keyword(KwModule);
+		RTLIL::IdString name = expect_id();
+		expect_eol();
+
+		bool delete_current_module = false;
+		if (design->has(name)) {
+			RTLIL::Module *existing_mod = design->module(name);
+			if (!RTLIL_FRONTEND::flag_overwrite && (RTLIL_FRONTEND::flag_lib || (attrbuf.count(ID::blackbox) && attrbuf.at(ID::blackbox).as_bool()))) {
+				log("Ignoring blackbox re-definition of module %s.\n", name.c_str());
+				delete_current_module = true;
+			} else if (!RTLIL_FRONTEND::flag_nooverwrite && !RTLIL_FRONTEND::flag_overwrite && !existing_mod->get_bool_attribute(ID::blackbox)) {
+				error(stringf("RTLIL error: redefinition of module %s.", name.c_str()));
+			} else if (RTLIL_FRONTEND::flag_nooverwrite) {
+				log("Ignoring re-definition of module %s.\n", name.c_str());
+				delete_current_module = true;
+			} else {
+				log("Replacing existing%s module %s.\n", existing_mod->get_bool_attribute(ID::blackbox) ? " blackbox" : "", name.c_str());
+				design->remove(existing_mod);
+			}
+		}
+
+		module = new RTLIL::Module;
+		module->name = name;
+		module->attributes.swap(attrbuf);
+		if (!delete_current_module)
+			design->add(module);
+
+		while (!is_keyword(KwEnd))
+		{
+			if (tok_type != TokKeyword)
+				syntax_error();
+
+			switch (tok_keyword)
+			{
+			case KwParameter: {
+				next();
+				RTLIL::IdString id = expect_id();
+				module->avail_parameters(id);
+				if (tok_type != TokEOL)
+					module->parameter_default_values[id] = parse_constant();
+				expect_eol();
+				break;
+			}
+			case KwAttribute:
+				parse_attribute();
+				break;
+			case KwWire:
+				parse_wire();
+				break;
+			case KwMemory:
+				parse_memory();
+				break;
+			case KwCell:
+				parse_cell();
+				break;
+			case KwProcess:
+				parse_process();
+				break;
+			case KwConnect: {
+				next();
+				RTLIL::SigSpec lhs = parse_sigspec();
+				RTLIL::SigSpec rhs = parse_sigspec();
+				expect_eol();
+				check_no_attributes();
+				module->connect(lhs, rhs);
+				break;
+			}
+			default:
+				syntax_error();
+			}
+		}
+		next();
+
+		check_no_attributes();
+		module->fixup_ports();
+		if (delete_current_module)
+			delete module;
+		else if (RTLIL_FRONTEND::flag_lib)
+			module->makeblackbox();
+		module = nullptr;
+		expect_eol();
+	}
+
+	void parse_wire()
+	{
+		expect_keyword(KwWire);
+
+		int width = 1, start_offset = 0, port_id = 0;
+		bool upto = false, is_signed = false, port_input = false, port_output = false;
+
+		while (tok_type == TokKeyword) {
+			Keyword keyword = tok_keyword;
+			next();
+			switch (keyword) {
+			case KwWidth:
+				if (tok_type == TokInvalid)
+					error("RTLIL error: invalid wire width");
+				width = expect_int();
+				break;
+			case KwUpto:
+				upto = true;
+				break;
+			case KwSigned:
+				is_signed = true;
+				break;
+			case KwOffset:
+				start_offset = expect_int();
+				break;
+			case KwInput:
+			case KwOutput:
+			case KwInout:
+				port_id = expect_int();
+				port_input = keyword != KwOutput;
+				port_output = keyword != KwInput;
+				break;
+			default:
+				syntax_error();
+			}
+		}
+
+		RTLIL::IdString id = expect_id();
+		expect_eol();
+
+		if (module->wire(id) != nullptr)
+			error(stringf("RTLIL error: redefinition of wire %s.", id.c_str()));
+
+		RTLIL::Wire *wire = module->addWire(id, width);
+		wire->start_offset = start_offset;
+		wire->port_id = port_id;
+		wire->port_input = port_input;
+		wire->port_output = port_output;
+		wire->upto = upto;
+		wire->is_signed = is_signed;
+		wire->attributes.swap(attrbuf);
+	}
+
+	void parse_memory()
+	{
+		expect_keyword(KwMemory);
+
+		RTLIL::Memory *memory = new RTLIL::Memory;
+		memory->attributes.swap(attrbuf);
+
+		while (tok_type == TokKeyword) {
+			Keyword keyword = tok_keyword;
+			next();
+			switch (keyword) {
+			case KwWidth:
+				memory->width = expect_int();
+				break;
+			case KwSize:
+				memory->size = expect_int();
+				break;
+			case KwOffset:
+				memory->start_offset = expect_int();
+				break;
+			default:
+				syntax_error();
+			}
+		}
+
+		RTLIL::IdString id = expect_id();
+		expect_eol();
+
+		if (module->memories.count(id) != 0)
+			error(stringf("RTLIL error: redefinition of memory %s.", id.c_str()));
+		memory->name = id;
+		module->memories[id] = memory;
+	}
+
+	void parse_cell()
+	{
+		expect_keyword(KwCell);
+		RTLIL::IdString type = expect_id();
+		RTLIL::IdString name = expect_id();
+		expect_eol();
+
+		if (module->cell(name) != nullptr)
+			error(stringf("RTLIL error: redefinition of cell %s.", name.c_str()));
+		RTLIL::Cell *cell = module->addCell(name, type);
+		cell->attributes.swap(attrbuf);
+
+		while (!is_keyword(KwEnd))
+		{
+			if (is_keyword(KwParameter)) {
+				next();
+				int flags = 0;
+				if (is_keyword(KwSigned)) {
+					flags = RTLIL::CONST_FLAG_SIGNED;
+					next();
+				} else if (is_keyword(KwReal)) {
+					flags = RTLIL::CONST_FLAG_REAL;
+					next();
+				}
+				RTLIL::IdString id = expect_id();
+				RTLIL::Const &value = cell->parameters[id];
+				value = parse_constant();
+				value.flags |= flags;
+				expect_eol();
+			} else if (is_keyword(KwConnect)) {
+				next();
+				RTLIL::IdString port = expect_id();
+				if (cell->hasPort(port))
+					error(stringf("RTLIL error: redefinition of cell port %s.", port.c_str()));
+				cell->setPort(port, parse_sigspec());
+				expect_eol();
+			} else {
+				syntax_error();
+			}
+		}
+		next();
+		expect_eol();
+	}
+
+	void parse_case_body(RTLIL::CaseRule *rule)
+	{
+		while (1)
+		{
+			if (is_keyword(KwAttribute)) {
+				parse_attribute();
+			} else if (is_keyword(KwSwitch)) {
+				parse_switch(rule);
+			} else if (is_keyword(KwAssign)) {
+				next();
+				check_no_attributes();
+				RTLIL::SigSpec lhs = parse_sigspec();
+				RTLIL::SigSpec rhs = parse_sigspec();
+				expect_eol();
+				rule->actions.push_back(RTLIL::SigSig(std::move(lhs), std::move(rhs)));
+			} else {
+				break;
+			}
+		}
+	}
+
+	void parse_switch(RTLIL::CaseRule *parent)
+	{
+		expect_keyword(KwSwitch);
+		RTLIL::SwitchRule *rule = new RTLIL::SwitchRule;
+		parent->switches.push_back(rule);
+		rule->signal = parse_sigspec();
+		rule->attributes.swap(attrbuf);
+		expect_eol();
+
+		while (is_keyword(KwAttribute))
+			parse_attribute();
+
+		while (is_keyword(KwCase))
+		{
+			next();
+			RTLIL::CaseRule *case_rule = new RTLIL::CaseRule;
+			case_rule->attributes.swap(attrbuf);
+			rule->cases.push_back(case_rule);
+			if (tok_type != TokEOL) {
+				case_rule->compare.push_back(parse_sigspec());
+				while (is_char(',')) {
+					next();
+					case_rule->compare.push_back(parse_sigspec());
+				}
+			}
+			expect_eol();
+			parse_case_body(case_rule);
+		}
+
+		expect_keyword(KwEnd);
+		expect_eol();
+	}
+
+	void parse_process()
+	{
+		expect_keyword(KwProcess);
+		RTLIL::IdString name = expect_id();
+		expect_eol();
+
+		if (module->processes.count(name) != 0)
+			error(stringf("RTLIL error: redefinition of process %s.", name.c_str()));
+		RTLIL::Process *process = module->addProcess(name);
+		process->attributes.swap(attrbuf);
+
+		parse_case_body(&process->root_case);
+
+		while (is_keyword(KwSync))
+		{
+			next();
+			RTLIL::SyncRule *rule = new RTLIL::SyncRule;
+			process->syncs.push_back(rule);
+
+			if (tok_type != TokKeyword)
+				syntax_error();
+			switch (tok_keyword) {
+			case KwLow: rule->type = RTLIL::ST0; break;
+			case KwHigh: rule->type = RTLIL::ST1; break;
+			case KwPosedge: rule->type = RTLIL::STp; break;
+			case KwNegedge: rule->type = RTLIL::STn; break;
+			case KwEdge: rule->type = RTLIL::STe; break;
+			case KwAlways: rule->type = RTLIL::STa; break;
+			case KwGlobal: rule->type = RTLIL::STg; break;
+			case KwInit: rule->type = RTLIL::STi; break;
+			default: syntax_error();
+			}
+			next();
+			if (rule->type != RTLIL::STa && rule->type != RTLIL::STg && rule->type != RTLIL::STi)
+				rule->signal = parse_sigspec();
+			expect_eol();
+
+			while (1)
+			{
+				if (is_keyword(KwUpdate)) {
+					next();
+					RTLIL::SigSpec lhs = parse_sigspec();
+					RTLIL::SigSpec rhs = parse_sigspec();
+					expect_eol();
+					rule->actions.push_back(RTLIL::SigSig(std::move(lhs), std::move(rhs)));
+				} else if (is_keyword(KwAttribute)) {
+					parse_attribute();
+					if (!is_keyword(KwAttribute) && !is_keyword(KwMemwr))
+						syntax_error();
+				} else if (is_keyword(KwMemwr)) {
+					next();
+					RTLIL::MemWriteAction act;
+					act.attributes.swap(attrbuf);
+					act.memid = expect_id();
+					act.address = parse_sigspec();
+					act.data = parse_sigspec();
+					act.enable = parse_sigspec();
+					act.priority_mask = parse_constant();
+					expect_eol();
+					rule->mem_write_actions.push_back(std::move(act));
+				} else {
+					break;
+				}
+			}
+		}
+
+		expect_keyword(KwEnd);
+		expect_eol();
+	}
+
+	void parse()
+	{
+		next();
+		while (tok_type == TokEOL)
+			next();
+
+		while (tok_type != TokEOF)
+		{
+			if (is_keyword(KwModule)) {
+				parse_module();
+			} else if (is_keyword(KwAttribute)) {
+				parse_attribute();
+			} else if (is_keyword(KwAutoidx)) {
+				next();
+				autoidx = max(autoidx, expect_int());
+				expect_eol();
+			} else {
+				syntax_error();
+			}
+		}
+
+		check_no_attributes();
+	}
+};
+
+} // namespace
+
+RTLIL_FRONTEND::InputBuffer::InputBuffer(std::istream *f, const std::string &filename)
+{
+#ifdef YOSYS_RTLIL_READER_MMAP
+	// an ifstream is the plain file opened by Frontend::extra_args(),
+	// decompressed files and here documents are string streams
+	if (dynamic_cast<std::ifstream*>(f) != nullptr) {
+		int fd = open(filename.c_str(), O_RDONLY);
+		struct stat st;
+		if (fd >= 0 && fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+			map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (map == MAP_FAILED) {
+				map = nullptr;
+			} else {
+				madvise(map, st.st_size, MADV_SEQUENTIAL);
+				data = (const char*)map;
+				size = st.st_size;
+			}
+		}
+		if (fd >= 0)
+			close(fd);
+		if (map != nullptr)
+			return;
+	}
+#else
+	(void)filename;
+#endif
+	std::stringstream ss;
+	ss << f->rdbuf();
+	buffer = ss.str();
+	data = buffer.data();
+	size = buffer.size();
+}
+
+RTLIL_FRONTEND::InputBuffer::~InputBuffer()
+{
+#ifdef YOSYS_RTLIL_READER_MMAP
+	if (map != nullptr)
+		munmap(map, size);
+#endif
+}
+
+void RTLIL_FRONTEND::read_rtlil_fast(std::istream *f, const std::string &filename, RTLIL::Design *design)
+{
+	RTLIL_FRONTEND::InputBuffer input(f, filename);
+	RTLILReader reader(design, input.data, input.data + input.size);
+	reader.parse();
+}
+
+YOSYS_NAMESPACE_END
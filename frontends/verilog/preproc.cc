@@ -40,13 +40,14 @@
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/stat.h>
 
 YOSYS_NAMESPACE_BEGIN
 using namespace VERILOG_FRONTEND;
 
-static std::list<std::string> output_code;
-static std::list<std::string> input_buffer;
-static size_t input_buffer_charp;
+static thread_local std::list<std::string> output_code;
+static thread_local std::list<std::string> input_buffer;
+static thread_local size_t input_buffer_charp;
 
 static void return_char(char ch)
 {
@@ -375,6 +376,50 @@ void define_map_t::clear()
 	defines.clear();
 }
 
+static bool same_define(const define_body_t &a, const define_body_t &b)
+{
+	if (a.body != b.body || a.has_args != b.has_args || GetSize(a.args.args) != GetSize(b.args.args))
+		return false;
+	for (int i = 0; i < GetSize(a.args.args); i++) {
+		const macro_arg_t &x = a.args.args[i], &y = b.args.args[i];
+		if (x.name != y.name || x.has_default != y.has_default || x.default_value != y.default_value)
+			return false;
+	}
+	return true;
+}
+
+// The definitions that were added or changed between from and to, and
+// nullptr for those that were erased.
+using define_changes_t = std::map<std::string, std::shared_ptr<define_body_t>>;
+
+static define_changes_t diff_defines(const define_map_t &from, const define_map_t &to)
+{
+	define_changes_t changes;
+	for (auto &it : to.defines) {
+		const define_body_t *old = from.find(it.first);
+		if (old == nullptr || !same_define(*old, *it.second))
+			changes[it.first] = std::make_shared<define_body_t>(*it.second);
+	}
+	for (auto &it : from.defines)
+		if (to.find(it.first) == nullptr)
+			changes[it.first] = nullptr;
+	return changes;
+}
+
+static void apply_define_changes(define_map_t &defines, const define_changes_t &changes)
+{
+	for (auto &it : changes)
+		if (it.second)
+			defines.add(it.first, *it.second);
+		else
+			defines.erase(it.first);
+}
+
+void define_map_t::apply_diff(const define_map_t &from, const define_map_t &to)
+{
+	apply_define_changes(*this, diff_defines(from, to));
+}
+
 void define_map_t::log() const
 {
 	for (auto &it : defines) {
@@ -640,8 +685,8 @@ read_define_args()
 }
 
 // Read a `define preprocessor directive. This is called just after reading the token containing
-// "`define".
-static void
+// "`define". Returns the name of the macro.
+static std::string
 read_define(const std::string &filename,
             define_map_t      &defines_map,
             define_map_t      &global_defines_cache)
@@ -742,6 +787,140 @@ read_define(const std::string &filename,
 	} else {
 		log_file_error(filename, 0, "Invalid name for macro definition: >>%s<<.\n", name.c_str());
 	}
+	return name;
+}
+
+// The include cache. Projects tend to include the same package and define
+// headers from every source file, so the preprocessed output of an included
+// file is kept for the session and reused when the file is included again
+// under the same conditions: an entry is keyed on the path of the file, the
+// include directories and all macro definitions at the point of the
+// `include, and is only used while the size and modification time of the
+// file and of the files it includes are unchanged.
+struct IncludeCacheEntry
+{
+	std::string output;
+	// path and stamp of the file and of all files included by it
+	std::vector<std::pair<std::string, std::string>> files;
+	// the changes of the file to the local and the global macro definitions
+	define_changes_t defines, global_defines;
+};
+
+// An included file whose output is recorded for the include cache. It ends
+// with the `file_pop at the given depth of the filename stack.
+struct IncludeRecording
+{
+	std::string key;
+	size_t depth, output_start, macro_arg_depth;
+	int ifdef_pass_level;
+	bool cacheable;
+	std::unique_ptr<define_map_t> defines_before;
+	std::set<std::string> global_names;
+	std::vector<std::pair<std::string, std::string>> files;
+};
+
+static dict<std::string, std::shared_ptr<const IncludeCacheEntry>> include_cache;
+#ifndef YOSYS_DISABLE_THREADS
+// guards include_cache and yosys_input_files, read_verilog -batch runs the
+// preprocessor on several threads
+static std::mutex include_cache_mutex;
+#endif
+
+static std::string file_stamp(const std::string &filename)
+{
+	struct stat st;
+	if (stat(filename.c_str(), &st) != 0)
+		return std::string();
+	return stringf("%lld:%lld", (long long)st.st_size, (long long)st.st_mtime);
+}
+
+static void append_key(std::string &key, const std::string &str)
+{
+	key += std::to_string(str.size()) + ":" + str;
+}
+
+static std::string include_cache_key(const std::string &filename, const std::list<std::string> &include_dirs, const define_map_t &defines)
+{
+	std::string key;
+	append_key(key, filename);
+	for (auto &dir : include_dirs)
+		append_key(key, dir);
+	key += "|";
+	for (auto &it : defines.defines) {
+		append_key(key, it.first);
+		append_key(key, it.second->body);
+		key += it.second->has_args ? "(" : " ";
+		for (auto &arg : it.second->args.args) {
+			append_key(key, arg.name);
+			if (arg.has_default)
+				append_key(key, "=" + arg.default_value);
+		}
+	}
+	return key;
+}
+
+static std::shared_ptr<const IncludeCacheEntry> include_cache_lookup(const std::string &key)
+{
+	std::shared_ptr<const IncludeCacheEntry> entry;
+	{
+#ifndef YOSYS_DISABLE_THREADS
+		std::lock_guard<std::mutex> lock(include_cache_mutex);
+#endif
+		auto it = include_cache.find(key);
+		if (it == include_cache.end())
+			return nullptr;
+		entry = it->second;
+	}
+	for (auto &file : entry->files)
+		if (file_stamp(file.first) != file.second)
+			return nullptr;
+	return entry;
+}
+
+// Ends the innermost recording, adding it to the include cache if the
+// included file left the preprocessor in the state it found it in.
+static void finish_recording(std::vector<IncludeRecording> &recordings, bool complete, const define_map_t &defines,
+		const define_map_t &global_defines_cache, int ifdef_fail_level, int ifdef_pass_level, size_t macro_arg_depth)
+{
+	IncludeRecording rec = std::move(recordings.back());
+	recordings.pop_back();
+
+	if (!complete || ifdef_fail_level != 0 || ifdef_pass_level != rec.ifdef_pass_level || macro_arg_depth != rec.macro_arg_depth)
+		rec.cacheable = false;
+
+	if (rec.cacheable) {
+		auto entry = std::make_shared<IncludeCacheEntry>();
+		auto it = output_code.end();
+		for (size_t i = rec.output_start; i < output_code.size(); i++)
+			--it;
+		for (; it != output_code.end(); ++it)
+			entry->output += *it;
+		entry->files = rec.files;
+		entry->defines = diff_defines(*rec.defines_before, defines);
+		for (auto &name : rec.global_names) {
+			const define_body_t *body = global_defines_cache.find(name);
+			entry->global_defines[name] = body ? std::make_shared<define_body_t>(*body) : nullptr;
+		}
+#ifndef YOSYS_DISABLE_THREADS
+		std::lock_guard<std::mutex> lock(include_cache_mutex);
+#endif
+		include_cache[rec.key] = entry;
+	}
+
+	if (!recordings.empty()) {
+		IncludeRecording &parent = recordings.back();
+		parent.cacheable = parent.cacheable && rec.cacheable;
+		parent.global_names.insert(rec.global_names.begin(), rec.global_names.end());
+		parent.files.insert(parent.files.end(), rec.files.begin(), rec.files.end());
+	}
+}
+
+static void add_input_file(const std::string &filename)
+{
+#ifndef YOSYS_DISABLE_THREADS
+	std::lock_guard<std::mutex> lock(include_cache_mutex);
+#endif
+	yosys_input_files.insert(filename);
 }
 
 std::string
@@ -749,7 +928,8 @@ frontend_verilog_preproc(std::istream                 &f,
                          std::string                   filename,
                          const define_map_t           &pre_defines,
                          define_map_t                 &global_defines_cache,
-                         const std::list<std::string> &include_dirs)
+                         const std::list<std::string> &include_dirs,
+                         bool                         *resetall)
 {
 	define_map_t defines;
 	defines.merge(pre_defines);
@@ -757,6 +937,7 @@ frontend_verilog_preproc(std::istream                 &f,
 
 	macro_arg_stack_t macro_arg_stack;
 	std::vector<std::string> filename_stack;
+	std::vector<IncludeRecording> recordings;
 	// We are inside pass_level levels of satisfied ifdefs, and then within
 	// fail_level levels of unsatisfied ifdefs.  The unsatisfied ones are
 	// always within satisfied ones — even if some condition within is true,
@@ -911,10 +1092,42 @@ frontend_verilog_preproc(std::istream                 &f,
 			}
 			if (ff.fail()) {
 				output_code.push_back("`file_notfound " + fn);
-			} else {
-				input_file(ff, fixed_fn);
-				yosys_input_files.insert(fixed_fn);
+				if (!recordings.empty())
+					recordings.back().cacheable = false;
+				continue;
 			}
+			std::string key = include_cache_key(fixed_fn, include_dirs, defines);
+			auto entry = include_cache_lookup(key);
+			if (entry != nullptr) {
+				// the newline is the one input_file() adds after the `file_pop
+				output_code.push_back(entry->output + "\n");
+				apply_define_changes(defines, entry->defines);
+				apply_define_changes(global_defines_cache, entry->global_defines);
+				for (auto &file : entry->files)
+					add_input_file(file.first);
+				if (!recordings.empty()) {
+					IncludeRecording &parent = recordings.back();
+					for (auto &it : entry->global_defines)
+						parent.global_names.insert(it.first);
+					parent.files.insert(parent.files.end(), entry->files.begin(), entry->files.end());
+				}
+				continue;
+			}
+			IncludeRecording rec;
+			rec.key = key;
+			rec.depth = filename_stack.size() + 1;
+			rec.output_start = output_code.size();
+			rec.macro_arg_depth = macro_arg_stack.size();
+			rec.ifdef_pass_level = ifdef_pass_level;
+			rec.defines_before.reset(new define_map_t);
+			rec.defines_before->clear();
+			rec.defines_before->merge(defines);
+			std::string stamp = file_stamp(fixed_fn);
+			rec.cacheable = !stamp.empty();
+			rec.files.push_back(std::make_pair(fixed_fn, stamp));
+			recordings.push_back(std::move(rec));
+			input_file(ff, fixed_fn);
+			add_input_file(fixed_fn);
 			continue;
 		}
 
@@ -931,13 +1144,21 @@ frontend_verilog_preproc(std::istream                 &f,
 
 		if (tok == "`file_pop") {
 			output_code.push_back(tok);
+			// a recording of a deeper file lost its `file_pop (e.g. to an
+			// unterminated comment)
+			while (!recordings.empty() && recordings.back().depth > filename_stack.size())
+				finish_recording(recordings, false, defines, global_defines_cache, ifdef_fail_level, ifdef_pass_level, macro_arg_stack.size());
+			if (!recordings.empty() && recordings.back().depth == filename_stack.size())
+				finish_recording(recordings, true, defines, global_defines_cache, ifdef_fail_level, ifdef_pass_level, macro_arg_stack.size());
 			filename = filename_stack.back();
 			filename_stack.pop_back();
 			continue;
 		}
 
 		if (tok == "`define") {
-			read_define(filename, defines, global_defines_cache);
+			std::string name = read_define(filename, defines, global_defines_cache);
+			if (!recordings.empty())
+				recordings.back().global_names.insert(name);
 			continue;
 		}
 
@@ -948,6 +1169,8 @@ frontend_verilog_preproc(std::istream                 &f,
 			// printf("undef: >>%s<<\n", name.c_str());
 			defines.erase(name);
 			global_defines_cache.erase(name);
+			if (!recordings.empty())
+				recordings.back().global_names.insert(name);
 			continue;
 		}
 
@@ -961,13 +1184,20 @@ frontend_verilog_preproc(std::istream                 &f,
 		}
 
 		if (tok == "`resetall") {
-			default_nettype_wire = true;
+			if (resetall != nullptr)
+				*resetall = true;
+			else
+				default_nettype_wire = true;
+			if (!recordings.empty())
+				recordings.back().cacheable = false;
 			continue;
 		}
 
 		if (tok == "`undefineall" && sv_mode) {
 			defines.clear();
 			global_defines_cache.clear();
+			if (!recordings.empty())
+				recordings.back().cacheable = false;
 			continue;
 		}
 
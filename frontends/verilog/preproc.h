@@ -51,6 +51,10 @@ struct define_map_t
 	// Find a definition by name. If no match, returns null.
 	const define_body_t *find(const std::string &name) const;
 
+	// Apply the changes that turn the definitions in from into those in to
+	// (added, changed and erased definitions) to this map.
+	void apply_diff(const define_map_t &from, const define_map_t &to);
+
 	// Erase a definition by name (no effect if not defined).
 	void erase(const std::string &name);
 
@@ -66,12 +70,16 @@ struct define_map_t
 
 struct define_map_t;
 
+// Included files are cached for the session (see preproc.cc). If resetall
+// is given, a `resetall sets it instead of default_nettype_wire, so that
+// files can be preprocessed on several threads.
 std::string
 frontend_verilog_preproc(std::istream                 &f,
                          std::string                   filename,
                          const define_map_t           &pre_defines,
                          define_map_t                 &global_defines_cache,
-                         const std::list<std::string> &include_dirs);
+                         const std::list<std::string> &include_dirs,
+                         bool                         *resetall = nullptr);
 
 YOSYS_NAMESPACE_END
 
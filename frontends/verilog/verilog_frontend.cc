@@ -29,6 +29,7 @@
 #include "verilog_frontend.h"
 #include "preproc.h"
 #include "kernel/yosys.h"
+#include "kernel/threading.h"
 #include "libs/sha1/sha1.h"
 #include <stdarg.h>
 
@@ -161,6 +162,13 @@ struct VerilogFrontend : public Frontend {
 		log("    -nopp\n");
 		log("        do not run the pre-processor\n");
 		log("\n");
+		log("    -batch\n");
+		log("        run the pre-processor on all given files first, in parallel when\n");
+		log("        running with 'yosys -j <N>', and then parse them in the given order.\n");
+		log("        every file sees the macros defined before this command, but not\n");
+		log("        those defined by the other files. the macro definitions of the\n");
+		log("        files are applied in order afterwards.\n");
+		log("\n");
 		log("    -nodpi\n");
 		log("        disable DPI-C support\n");
 		log("\n");
@@ -247,6 +255,7 @@ struct VerilogFrontend : public Frontend {
 		bool flag_mem2reg = false;
 		bool flag_ppdump = false;
 		bool flag_nopp = false;
+		bool flag_batch = false;
 		bool flag_nodpi = false;
 		bool flag_noopt = false;
 		bool flag_icells = false;
@@ -368,6 +377,10 @@ struct VerilogFrontend : public Frontend {
 				flag_nopp = true;
 				continue;
 			}
+			if (arg == "-batch") {
+				flag_batch = true;
+				continue;
+			}
 			if (arg == "-nodpi") {
 				flag_nodpi = true;
 				continue;
@@ -458,71 +471,119 @@ struct VerilogFrontend : public Frontend {
 
 		extra_args(f, filename, args, argidx);
 
-		log_header(design, "Executing Verilog-2005 frontend: %s\n", filename.c_str());
+		// with -batch, all remaining files are opened now and preprocessed
+		// before the first one is parsed
+		std::vector<std::string> filenames = {filename};
+		std::vector<std::istream*> files = {f};
+		std::vector<std::unique_ptr<std::istream>> batch_files;
+		if (flag_batch) {
+			while (!next_args.empty()) {
+				std::istream *ff = nullptr;
+				std::string fn;
+				extra_args(ff, fn, next_args, argidx);
+				batch_files.emplace_back(ff);
+				filenames.push_back(fn);
+				files.push_back(ff);
+			}
+		}
 
-		log("Parsing %s%s input from `%s' to AST representation.\n",
-				formal_mode ? "formal " : "", sv_mode ? "SystemVerilog" : "Verilog", filename.c_str());
+		bool batch = GetSize(files) > 1 && !flag_nopp;
+		bool default_nettype = default_nettype_wire;
+		std::vector<std::string> batch_code(GetSize(files));
+		std::vector<char> batch_resetall(GetSize(files));
+
+		if (batch) {
+			log_header(design, "Preprocessing %d Verilog files.\n", GetSize(files));
+			std::vector<std::unique_ptr<define_map_t>> batch_defines(GetSize(files));
+			parallel_for(GetSize(files), [&](int i) {
+				batch_defines[i].reset(new define_map_t);
+				batch_defines[i]->clear();
+				batch_defines[i]->merge(*design->verilog_defines);
+				bool resetall = false;
+				batch_code[i] = frontend_verilog_preproc(*files[i], filenames[i], defines_map, *batch_defines[i], include_dirs, &resetall);
+				batch_resetall[i] = resetall;
+			});
+			define_map_t defines_before;
+			defines_before.clear();
+			defines_before.merge(*design->verilog_defines);
+			for (auto &defines : batch_defines)
+				design->verilog_defines->apply_diff(defines_before, *defines);
+		}
 
-		AST::current_filename = filename;
-		AST::set_line_num = &frontend_verilog_yyset_lineno;
-		AST::get_line_num = &frontend_verilog_yyget_lineno;
+		for (int i = 0; i < GetSize(files); i++)
+		{
+			log_header(design, "Executing Verilog-2005 frontend: %s\n", filenames[i].c_str());
 
-		current_ast = new AST::AstNode(AST::AST_DESIGN);
+			log("Parsing %s%s input from `%s' to AST representation.\n",
+					formal_mode ? "formal " : "", sv_mode ? "SystemVerilog" : "Verilog", filenames[i].c_str());
 
-		lexin = f;
-		std::string code_after_preproc;
+			AST::current_filename = filenames[i];
+			AST::set_line_num = &frontend_verilog_yyset_lineno;
+			AST::get_line_num = &frontend_verilog_yyget_lineno;
 
-		if (!flag_nopp) {
-			code_after_preproc = frontend_verilog_preproc(*f, filename, defines_map, *design->verilog_defines, include_dirs);
-			if (flag_ppdump)
-				log("-- Verilog code after preprocessor --\n%s-- END OF DUMP --\n", code_after_preproc.c_str());
-			lexin = new std::istringstream(code_after_preproc);
-		}
+			current_ast = new AST::AstNode(AST::AST_DESIGN);
 
-		// make package typedefs available to parser
-		add_package_types(pkg_user_types, design->verilog_packages);
+			lexin = files[i];
+			std::string code_after_preproc;
+			default_nettype_wire = default_nettype;
 
-		UserTypeMap global_types_map;
-		for (auto def : design->verilog_globals) {
-			if (def->type == AST::AST_TYPEDEF) {
-				global_types_map[def->str] = def;
+			if (!flag_nopp) {
+				if (batch) {
+					code_after_preproc = std::move(batch_code[i]);
+					if (batch_resetall[i])
+						default_nettype_wire = true;
+				} else
+					code_after_preproc = frontend_verilog_preproc(*files[i], filenames[i], defines_map, *design->verilog_defines, include_dirs);
+				if (flag_ppdump)
+					log("-- Verilog code after preprocessor --\n%s-- END OF DUMP --\n", code_after_preproc.c_str());
+				lexin = new std::istringstream(code_after_preproc);
 			}
-		}
 
-		log_assert(user_type_stack.empty());
-		// use previous global typedefs as bottom level of user type stack
-		user_type_stack.push_back(std::move(global_types_map));
-		// add a new empty type map to allow overriding existing global definitions
-		user_type_stack.push_back(UserTypeMap());
-
-		frontend_verilog_yyset_lineno(1);
-		frontend_verilog_yyrestart(NULL);
-		frontend_verilog_yyparse();
-		frontend_verilog_yylex_destroy();
-
-		for (auto &child : current_ast->children) {
-			if (child->type == AST::AST_MODULE)
-				for (auto &attr : attributes)
-					if (child->attributes.count(attr) == 0)
-						child->attributes[attr] = AST::AstNode::mkconst_int(1, false);
-		}
+			// make package typedefs available to parser
+			add_package_types(pkg_user_types, design->verilog_packages);
 
-		if (flag_nodpi)
-			error_on_dpi_function(current_ast);
+			UserTypeMap global_types_map;
+			for (auto def : design->verilog_globals) {
+				if (def->type == AST::AST_TYPEDEF) {
+					global_types_map[def->str] = def;
+				}
+			}
+
+			log_assert(user_type_stack.empty());
+			// use previous global typedefs as bottom level of user type stack
+			user_type_stack.push_back(std::move(global_types_map));
+			// add a new empty type map to allow overriding existing global definitions
+			user_type_stack.push_back(UserTypeMap());
+
+			frontend_verilog_yyset_lineno(1);
+			frontend_verilog_yyrestart(NULL);
+			frontend_verilog_yyparse();
+			frontend_verilog_yylex_destroy();
 
-		AST::process(design, current_ast, flag_dump_ast1, flag_dump_ast2, flag_no_dump_ptr, flag_dump_vlog1, flag_dump_vlog2, flag_dump_rtlil, flag_nolatches,
-				flag_nomeminit, flag_nomem2reg, flag_mem2reg, flag_noblackbox, lib_mode, flag_nowb, flag_noopt, flag_icells, flag_pwires, flag_nooverwrite, flag_overwrite, flag_defer, default_nettype_wire);
+			for (auto &child : current_ast->children) {
+				if (child->type == AST::AST_MODULE)
+					for (auto &attr : attributes)
+						if (child->attributes.count(attr) == 0)
+							child->attributes[attr] = AST::AstNode::mkconst_int(1, false);
+			}
+
+			if (flag_nodpi)
+				error_on_dpi_function(current_ast);
 
+			AST::process(design, current_ast, flag_dump_ast1, flag_dump_ast2, flag_no_dump_ptr, flag_dump_vlog1, flag_dump_vlog2, flag_dump_rtlil, flag_nolatches,
+					flag_nomeminit, flag_nomem2reg, flag_mem2reg, flag_noblackbox, lib_mode, flag_nowb, flag_noopt, flag_icells, flag_pwires, flag_nooverwrite, flag_overwrite, flag_defer, default_nettype_wire);
 
-		if (!flag_nopp)
-			delete lexin;
 
-		// only the previous and new global type maps remain
-		log_assert(user_type_stack.size() == 2);
-		user_type_stack.clear();
+			if (!flag_nopp)
+				delete lexin;
 
-		delete current_ast;
-		current_ast = NULL;
+			// only the previous and new global type maps remain
+			log_assert(user_type_stack.size() == 2);
+			user_type_stack.clear();
+
+			delete current_ast;
+			current_ast = NULL;
+		}
 
 		log("Successfully finished Verilog frontend.\n");
 	}
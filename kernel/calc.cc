@@ -22,10 +22,15 @@
 // Second Edition (2nd ed.). Wiley. ISBN 978-0-471-11709-4, page 244
 
 #include "kernel/yosys.h"
+#include "kernel/packedconst.h"
 #include "libs/bigint/BigIntegerLibrary.hh"
 
 YOSYS_NAMESPACE_BEGIN
 
+// Constants narrower than this are processed one RTLIL::State at a time,
+// packing them into a PackedConst only pays off for wider values.
+static const int packed_min_width = 256;
+
 static void extend_u0(RTLIL::Const &arg, int width, bool is_signed)
 {
 	RTLIL::State padding = RTLIL::State::S0;
@@ -41,23 +46,60 @@ static void extend_u0(RTLIL::Const &arg, int width, bool is_signed)
 
 static BigInteger const2big(const RTLIL::Const &val, bool as_signed, int &undef_bit_pos)
 {
-	BigUnsigned mag;
-
 	BigInteger::Sign sign = BigInteger::positive;
-	State inv_sign_bit = RTLIL::State::S1;
-	size_t num_bits = val.bits.size();
+	int num_bits = GetSize(val);
 
 	if (as_signed && num_bits && val.bits[num_bits-1] == RTLIL::State::S1) {
-		inv_sign_bit = RTLIL::State::S0;
 		sign = BigInteger::negative;
 		num_bits--;
 	}
 
-	for (size_t i = 0; i < num_bits; i++)
-		if (val.bits[i] == RTLIL::State::S0 || val.bits[i] == RTLIL::State::S1)
-			mag.setBit(i, val.bits[i] == inv_sign_bit);
-		else if (undef_bit_pos < 0)
-			undef_bit_pos = i;
+	if (num_bits < packed_min_width)
+	{
+		BigUnsigned mag;
+		RTLIL::State inv_sign_bit = sign == BigInteger::negative ? RTLIL::State::S0 : RTLIL::State::S1;
+
+		for (int i = 0; i < num_bits; i++)
+			if (val.bits[i] == RTLIL::State::S0 || val.bits[i] == RTLIL::State::S1)
+				mag.setBit(i, val.bits[i] == inv_sign_bit);
+			else if (undef_bit_pos < 0)
+				undef_bit_pos = i;
+
+		if (sign == BigInteger::negative)
+			mag += 1;
+
+		return BigInteger(mag, sign);
+	}
+
+	PackedConst packed(val, num_bits, false);
+
+	if (packed.has_undef && undef_bit_pos < 0)
+		for (int i = 0; i < num_bits; i++)
+			if (packed.get_undef(i)) {
+				undef_bit_pos = i;
+				break;
+			}
+
+	// magnitude of negative numbers: invert the defined bits and add one
+	std::vector<BigUnsigned::Blk> blocks;
+	for (int i = 0; i < GetSize(packed.value); i++) {
+		uint64_t word = packed.value[i];
+		if (sign == BigInteger::negative) {
+			word = ~word & ~packed.undef[i];
+			if (i == GetSize(packed.value)-1 && num_bits % 64 != 0)
+				word &= (uint64_t(1) << (num_bits % 64)) - 1;
+		}
+		if (sizeof(BigUnsigned::Blk) >= sizeof(uint64_t)) {
+			blocks.push_back(word);
+		} else {
+			blocks.push_back(word & 0xffffffff);
+			blocks.push_back(word >> 32);
+		}
+	}
+
+	BigUnsigned mag;
+	if (!blocks.empty())
+		mag = BigUnsigned(blocks.data(), blocks.size());
 
 	if (sign == BigInteger::negative)
 		mag += 1;
@@ -71,30 +113,44 @@ static RTLIL::Const big2const(const BigInteger &val, int result_len, int undef_b
 		return RTLIL::Const(RTLIL::State::Sx, result_len);
 
 	BigUnsigned mag = val.getMagnitude();
-	RTLIL::Const result(0, result_len);
 
-	if (!mag.isZero())
+	if (result_len < packed_min_width)
 	{
-		if (val.getSign() < 0)
-		{
-			mag--;
-			for (int i = 0; i < result_len; i++)
-				result.bits[i] = mag.getBit(i) ? RTLIL::State::S0 : RTLIL::State::S1;
-		}
-		else
+		RTLIL::Const result(0, result_len);
+
+		if (!mag.isZero())
 		{
+			bool negative = val.getSign() < 0;
+			if (negative)
+				mag--;
+
 			for (int i = 0; i < result_len; i++)
-				result.bits[i] = mag.getBit(i) ? RTLIL::State::S1 : RTLIL::State::S0;
+				result.bits[i] = mag.getBit(i) != negative ? RTLIL::State::S1 : RTLIL::State::S0;
 		}
+
+		return result;
 	}
 
-#if 0
-	if (undef_bit_pos >= 0)
-		for (int i = undef_bit_pos; i < result_len; i++)
-			result.bits[i] = RTLIL::State::Sx;
-#endif
+	PackedConst result(result_len);
 
-	return result;
+	if (!mag.isZero())
+	{
+		bool negative = val.getSign() < 0;
+		if (negative)
+			mag--;
+
+		for (int i = 0; i < GetSize(result.value); i++) {
+			uint64_t word;
+			if (sizeof(BigUnsigned::Blk) >= sizeof(uint64_t))
+				word = mag.getBlock(i);
+			else
+				word = uint64_t(mag.getBlock(2*i)) | uint64_t(mag.getBlock(2*i+1)) << 32;
+			result.value[i] = negative ? ~word : word;
+		}
+		result.normalize();
+	}
+
+	return result.as_const();
 }
 
 static RTLIL::State logic_and(RTLIL::State a, RTLIL::State b)
@@ -129,64 +185,118 @@ static RTLIL::State logic_xnor(RTLIL::State a, RTLIL::State b)
 	return a == b ? RTLIL::State::S1 : RTLIL::State::S0;
 }
 
+// Word-parallel versions of logic_and() etc., operating on one word of the
+// value and undef planes of a PackedConst (see kernel/packedconst.h).
+static void logic_and_word(uint64_t a, uint64_t a_undef, uint64_t b, uint64_t b_undef, uint64_t &y, uint64_t &y_undef)
+{
+	y = a & b;
+	y_undef = (a | a_undef) & (b | b_undef) & ~y;
+}
+
+static void logic_or_word(uint64_t a, uint64_t a_undef, uint64_t b, uint64_t b_undef, uint64_t &y, uint64_t &y_undef)
+{
+	y = a | b;
+	y_undef = (a_undef | b_undef) & ~y;
+}
+
+static void logic_xor_word(uint64_t a, uint64_t a_undef, uint64_t b, uint64_t b_undef, uint64_t &y, uint64_t &y_undef)
+{
+	y_undef = a_undef | b_undef;
+	y = (a ^ b) & ~y_undef;
+}
+
+static void logic_xnor_word(uint64_t a, uint64_t a_undef, uint64_t b, uint64_t b_undef, uint64_t &y, uint64_t &y_undef)
+{
+	y_undef = a_undef | b_undef;
+	y = ~(a ^ b) & ~y_undef;
+}
+
 RTLIL::Const RTLIL::const_not(const RTLIL::Const &arg1, const RTLIL::Const&, bool signed1, bool, int result_len)
 {
 	if (result_len < 0)
 		result_len = arg1.bits.size();
 
-	RTLIL::Const arg1_ext = arg1;
-	extend_u0(arg1_ext, result_len, signed1);
+	if (result_len < packed_min_width)
+	{
+		RTLIL::Const arg1_ext = arg1;
+		extend_u0(arg1_ext, result_len, signed1);
+
+		RTLIL::Const result(RTLIL::State::Sx, result_len);
+		for (int i = 0; i < result_len; i++) {
+			if (arg1_ext.bits[i] == RTLIL::State::S0)
+				result.bits[i] = RTLIL::State::S1;
+			else if (arg1_ext.bits[i] == RTLIL::State::S1)
+				result.bits[i] = RTLIL::State::S0;
+		}
 
-	RTLIL::Const result(RTLIL::State::Sx, result_len);
-	for (size_t i = 0; i < size_t(result_len); i++) {
-		if (i >= arg1_ext.bits.size())
-			result.bits[i] = RTLIL::State::S0;
-		else if (arg1_ext.bits[i] == RTLIL::State::S0)
-			result.bits[i] = RTLIL::State::S1;
-		else if (arg1_ext.bits[i] == RTLIL::State::S1)
-			result.bits[i] = RTLIL::State::S0;
+		return result;
 	}
 
-	return result;
+	PackedConst a(arg1, result_len, signed1);
+	for (int i = 0; i < GetSize(a.value); i++)
+		a.value[i] = ~a.value[i] & ~a.undef[i];
+	a.normalize();
+
+	return a.as_const();
 }
 
 static RTLIL::Const logic_wrapper(RTLIL::State(*logic_func)(RTLIL::State, RTLIL::State),
-		RTLIL::Const arg1, RTLIL::Const arg2, bool signed1, bool signed2, int result_len = -1)
+		void(*logic_word_func)(uint64_t, uint64_t, uint64_t, uint64_t, uint64_t&, uint64_t&),
+		const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len = -1)
 {
 	if (result_len < 0)
 		result_len = max(arg1.bits.size(), arg2.bits.size());
 
-	extend_u0(arg1, result_len, signed1);
-	extend_u0(arg2, result_len, signed2);
+	if (result_len < packed_min_width)
+	{
+		RTLIL::Const arg1_ext = arg1, arg2_ext = arg2;
+		extend_u0(arg1_ext, result_len, signed1);
+		extend_u0(arg2_ext, result_len, signed2);
 
-	RTLIL::Const result(RTLIL::State::Sx, result_len);
-	for (size_t i = 0; i < size_t(result_len); i++) {
-		RTLIL::State a = i < arg1.bits.size() ? arg1.bits[i] : RTLIL::State::S0;
-		RTLIL::State b = i < arg2.bits.size() ? arg2.bits[i] : RTLIL::State::S0;
-		result.bits[i] = logic_func(a, b);
+		RTLIL::Const result(RTLIL::State::Sx, result_len);
+		for (int i = 0; i < result_len; i++)
+			result.bits[i] = logic_func(arg1_ext.bits[i], arg2_ext.bits[i]);
+
+		return result;
 	}
 
-	return result;
+	PackedConst a(arg1, result_len, signed1);
+	PackedConst b(arg2, result_len, signed2);
+	PackedConst result(result_len);
+
+	for (int i = 0; i < GetSize(result.value); i++)
+		logic_word_func(a.value[i], a.undef[i], b.value[i], b.undef[i], result.value[i], result.undef[i]);
+	result.normalize();
+
+	return result.as_const();
 }
 
 RTLIL::Const RTLIL::const_and(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
-	return logic_wrapper(logic_and, arg1, arg2, signed1, signed2, result_len);
+	return logic_wrapper(logic_and, logic_and_word, arg1, arg2, signed1, signed2, result_len);
 }
 
 RTLIL::Const RTLIL::const_or(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
-	return logic_wrapper(logic_or, arg1, arg2, signed1, signed2, result_len);
+	return logic_wrapper(logic_or, logic_or_word, arg1, arg2, signed1, signed2, result_len);
 }
 
 RTLIL::Const RTLIL::const_xor(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
-	return logic_wrapper(logic_xor, arg1, arg2, signed1, signed2, result_len);
+	return logic_wrapper(logic_xor, logic_xor_word, arg1, arg2, signed1, signed2, result_len);
 }
 
 RTLIL::Const RTLIL::const_xnor(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
-	return logic_wrapper(logic_xnor, arg1, arg2, signed1, signed2, result_len);
+	return logic_wrapper(logic_xnor, logic_xnor_word, arg1, arg2, signed1, signed2, result_len);
+}
+
+static RTLIL::Const logic_reduce_result(RTLIL::State bit, int result_len)
+{
+	RTLIL::Const result(bit);
+	while (int(result.bits.size()) < result_len)
+		result.bits.push_back(RTLIL::State::S0);
+	return result;
 }
 
 static RTLIL::Const logic_reduce_wrapper(RTLIL::State initial, RTLIL::State(*logic_func)(RTLIL::State, RTLIL::State), const RTLIL::Const &arg1, int result_len)
@@ -196,30 +306,50 @@ static RTLIL::Const logic_reduce_wrapper(RTLIL::State initial, RTLIL::State(*log
 	for (size_t i = 0; i < arg1.bits.size(); i++)
 		temp = logic_func(temp, arg1.bits[i]);
 
-	RTLIL::Const result(temp);
-	while (int(result.bits.size()) < result_len)
-		result.bits.push_back(RTLIL::State::S0);
-	return result;
+	return logic_reduce_result(temp, result_len);
 }
 
 RTLIL::Const RTLIL::const_reduce_and(const RTLIL::Const &arg1, const RTLIL::Const&, bool, bool, int result_len)
 {
-	return logic_reduce_wrapper(RTLIL::State::S1, logic_and, arg1, result_len);
+	if (GetSize(arg1) < packed_min_width)
+		return logic_reduce_wrapper(RTLIL::State::S1, logic_and, arg1, result_len);
+
+	PackedConst a(arg1);
+	RTLIL::State y = a.any_zero() ? RTLIL::State::S0 : a.has_undef ? RTLIL::State::Sx : RTLIL::State::S1;
+	return logic_reduce_result(y, result_len);
 }
 
 RTLIL::Const RTLIL::const_reduce_or(const RTLIL::Const &arg1, const RTLIL::Const&, bool, bool, int result_len)
 {
-	return logic_reduce_wrapper(RTLIL::State::S0, logic_or, arg1, result_len);
+	if (GetSize(arg1) < packed_min_width)
+		return logic_reduce_wrapper(RTLIL::State::S0, logic_or, arg1, result_len);
+
+	PackedConst a(arg1);
+	RTLIL::State y = a.any_value() ? RTLIL::State::S1 : a.has_undef ? RTLIL::State::Sx : RTLIL::State::S0;
+	return logic_reduce_result(y, result_len);
 }
 
 RTLIL::Const RTLIL::const_reduce_xor(const RTLIL::Const &arg1, const RTLIL::Const&, bool, bool, int result_len)
 {
-	return logic_reduce_wrapper(RTLIL::State::S0, logic_xor, arg1, result_len);
+	if (GetSize(arg1) < packed_min_width)
+		return logic_reduce_wrapper(RTLIL::State::S0, logic_xor, arg1, result_len);
+
+	PackedConst a(arg1);
+	if (a.has_undef)
+		return logic_reduce_result(RTLIL::State::Sx, result_len);
+
+	uint64_t parity = 0;
+	for (auto word : a.value)
+		parity ^= word;
+	for (int shift = 32; shift > 0; shift >>= 1)
+		parity ^= parity >> shift;
+
+	return logic_reduce_result((parity & 1) ? RTLIL::State::S1 : RTLIL::State::S0, result_len);
 }
 
 RTLIL::Const RTLIL::const_reduce_xnor(const RTLIL::Const &arg1, const RTLIL::Const&, bool, bool, int result_len)
 {
-	RTLIL::Const buffer = logic_reduce_wrapper(RTLIL::State::S0, logic_xor, arg1, result_len);
+	RTLIL::Const buffer = RTLIL::const_reduce_xor(arg1, RTLIL::Const(), false, false, result_len);
 	if (!buffer.bits.empty()) {
 		if (buffer.bits.front() == RTLIL::State::S0)
 			buffer.bits.front() = RTLIL::State::S1;
@@ -231,7 +361,7 @@ RTLIL::Const RTLIL::const_reduce_xnor(const RTLIL::Const &arg1, const RTLIL::Con
 
 RTLIL::Const RTLIL::const_reduce_bool(const RTLIL::Const &arg1, const RTLIL::Const&, bool, bool, int result_len)
 {
-	return logic_reduce_wrapper(RTLIL::State::S0, logic_or, arg1, result_len);
+	return RTLIL::const_reduce_or(arg1, RTLIL::Const(), false, false, result_len);
 }
 
 RTLIL::Const RTLIL::const_logic_not(const RTLIL::Const &arg1, const RTLIL::Const&, bool signed1, bool, int result_len)
@@ -292,15 +422,24 @@ static RTLIL::Const const_shift_worker(const RTLIL::Const &arg1, const RTLIL::Co
 	if (undef_bit_pos >= 0)
 		return result;
 
-	for (int i = 0; i < result_len; i++) {
-		BigInteger pos = BigInteger(i) + offset;
-		if (pos < 0)
-			result.bits[i] = vacant_bits;
-		else if (pos >= BigInteger(int(arg1.bits.size())))
-			result.bits[i] = sign_ext ? arg1.bits.back() : vacant_bits;
-		else
-			result.bits[i] = arg1.bits[pos.toInt()];
-	}
+	// all offsets outside of [-result_len, size of arg1] give the same result
+	int arg1_size = GetSize(arg1);
+	int shift;
+	if (offset < BigInteger(-result_len))
+		shift = -result_len;
+	else if (offset > BigInteger(arg1_size))
+		shift = arg1_size;
+	else
+		shift = offset.toInt();
+
+	// result bit i is arg1 bit i+shift, copied range by range
+	RTLIL::State upper_bits = sign_ext && arg1_size > 0 ? arg1.bits.back() : vacant_bits;
+	int copy_begin = min(max(-shift, 0), result_len);
+	int copy_end = max(min(arg1_size - shift, result_len), copy_begin);
+
+	std::fill(result.bits.begin(), result.bits.begin() + copy_begin, vacant_bits);
+	std::copy(arg1.bits.begin() + copy_begin + shift, arg1.bits.begin() + copy_end + shift, result.bits.begin() + copy_begin);
+	std::fill(result.bits.begin() + copy_end, result.bits.end(), upper_bits);
 
 	return result;
 }
@@ -341,49 +480,96 @@ RTLIL::Const RTLIL::const_shiftx(const RTLIL::Const &arg1, const RTLIL::Const &a
 	return const_shift_worker(arg1, arg2, false, signed2, +1, result_len, RTLIL::State::Sx);
 }
 
-RTLIL::Const RTLIL::const_lt(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
+// Compares arg1 and arg2 as integers, returns <0, 0 or >0. Sets undef (and
+// returns 0) if any input bit is undefined.
+static int const_compare(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, bool &undef)
 {
-	int undef_bit_pos = -1;
-	bool y = const2big(arg1, signed1, undef_bit_pos) < const2big(arg2, signed2, undef_bit_pos);
-	RTLIL::Const result(undef_bit_pos >= 0 ? RTLIL::State::Sx : y ? RTLIL::State::S1 : RTLIL::State::S0);
+	// one extra bit, so that unsigned values are never negative
+	int width = max(GetSize(arg1), GetSize(arg2)) + 1;
 
-	while (int(result.bits.size()) < result_len)
-		result.bits.push_back(RTLIL::State::S0);
-	return result;
+	if (width < packed_min_width) {
+		int undef_bit_pos = -1;
+		BigInteger a = const2big(arg1, signed1, undef_bit_pos);
+		BigInteger b = const2big(arg2, signed2, undef_bit_pos);
+		undef = undef_bit_pos >= 0;
+		return undef || a == b ? 0 : a < b ? -1 : 1;
+	}
+
+	PackedConst a(arg1, width, signed1);
+	PackedConst b(arg2, width, signed2);
+
+	undef = a.has_undef || b.has_undef;
+	if (undef)
+		return 0;
+
+	bool a_neg = a.get_value(width-1), b_neg = b.get_value(width-1);
+	if (a_neg != b_neg)
+		return a_neg ? -1 : 1;
+
+	for (int i = GetSize(a.value)-1; i >= 0; i--)
+		if (a.value[i] != b.value[i])
+			return a.value[i] < b.value[i] ? -1 : 1;
+	return 0;
 }
 
-RTLIL::Const RTLIL::const_le(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
+static RTLIL::Const compare_result(bool y, bool undef, int result_len)
 {
-	int undef_bit_pos = -1;
-	bool y = const2big(arg1, signed1, undef_bit_pos) <= const2big(arg2, signed2, undef_bit_pos);
-	RTLIL::Const result(undef_bit_pos >= 0 ? RTLIL::State::Sx : y ? RTLIL::State::S1 : RTLIL::State::S0);
+	RTLIL::Const result(undef ? RTLIL::State::Sx : y ? RTLIL::State::S1 : RTLIL::State::S0);
 
 	while (int(result.bits.size()) < result_len)
 		result.bits.push_back(RTLIL::State::S0);
 	return result;
 }
 
+RTLIL::Const RTLIL::const_lt(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
+{
+	bool undef;
+	int cmp = const_compare(arg1, arg2, signed1, signed2, undef);
+	return compare_result(cmp < 0, undef, result_len);
+}
+
+RTLIL::Const RTLIL::const_le(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
+{
+	bool undef;
+	int cmp = const_compare(arg1, arg2, signed1, signed2, undef);
+	return compare_result(cmp <= 0, undef, result_len);
+}
+
 RTLIL::Const RTLIL::const_eq(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
-	RTLIL::Const arg1_ext = arg1;
-	RTLIL::Const arg2_ext = arg2;
 	RTLIL::Const result(RTLIL::State::S0, result_len);
 
-	int width = max(arg1_ext.bits.size(), arg2_ext.bits.size());
-	extend_u0(arg1_ext, width, signed1 && signed2);
-	extend_u0(arg2_ext, width, signed1 && signed2);
+	int width = max(arg1.bits.size(), arg2.bits.size());
 
-	RTLIL::State matched_status = RTLIL::State::S1;
-	for (size_t i = 0; i < arg1_ext.bits.size(); i++) {
-		if (arg1_ext.bits.at(i) == RTLIL::State::S0 && arg2_ext.bits.at(i) == RTLIL::State::S1)
-			return result;
-		if (arg1_ext.bits.at(i) == RTLIL::State::S1 && arg2_ext.bits.at(i) == RTLIL::State::S0)
-			return result;
-		if (arg1_ext.bits.at(i) > RTLIL::State::S1 || arg2_ext.bits.at(i) > RTLIL::State::S1)
-			matched_status = RTLIL::State::Sx;
+	if (width < packed_min_width)
+	{
+		RTLIL::Const arg1_ext = arg1;
+		RTLIL::Const arg2_ext = arg2;
+		extend_u0(arg1_ext, width, signed1 && signed2);
+		extend_u0(arg2_ext, width, signed1 && signed2);
+
+		RTLIL::State matched_status = RTLIL::State::S1;
+		for (int i = 0; i < width; i++) {
+			if (arg1_ext.bits[i] == RTLIL::State::S0 && arg2_ext.bits[i] == RTLIL::State::S1)
+				return result;
+			if (arg1_ext.bits[i] == RTLIL::State::S1 && arg2_ext.bits[i] == RTLIL::State::S0)
+				return result;
+			if (arg1_ext.bits[i] > RTLIL::State::S1 || arg2_ext.bits[i] > RTLIL::State::S1)
+				matched_status = RTLIL::State::Sx;
+		}
+
+		result.bits.front() = matched_status;
+		return result;
 	}
 
-	result.bits.front() = matched_status;
+	PackedConst a(arg1, width, signed1 && signed2);
+	PackedConst b(arg2, width, signed1 && signed2);
+
+	for (int i = 0; i < GetSize(a.value); i++)
+		if ((a.value[i] ^ b.value[i]) & ~a.undef[i] & ~b.undef[i])
+			return result;
+
+	result.bits.front() = a.has_undef || b.has_undef ? RTLIL::State::Sx : RTLIL::State::S1;
 	return result;
 }
 
@@ -407,10 +593,8 @@ RTLIL::Const RTLIL::const_eqx(const RTLIL::Const &arg1, const RTLIL::Const &arg2
 	extend_u0(arg1_ext, width, signed1 && signed2);
 	extend_u0(arg2_ext, width, signed1 && signed2);
 
-	for (size_t i = 0; i < arg1_ext.bits.size(); i++) {
-		if (arg1_ext.bits.at(i) != arg2_ext.bits.at(i))
-			return result;
-	}
+	if (arg1_ext.bits != arg2_ext.bits)
+		return result;
 
 	result.bits.front() = RTLIL::State::S1;
 	return result;
@@ -428,38 +612,65 @@ RTLIL::Const RTLIL::const_nex(const RTLIL::Const &arg1, const RTLIL::Const &arg2
 
 RTLIL::Const RTLIL::const_ge(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
-	int undef_bit_pos = -1;
-	bool y = const2big(arg1, signed1, undef_bit_pos) >= const2big(arg2, signed2, undef_bit_pos);
-	RTLIL::Const result(undef_bit_pos >= 0 ? RTLIL::State::Sx : y ? RTLIL::State::S1 : RTLIL::State::S0);
-
-	while (int(result.bits.size()) < result_len)
-		result.bits.push_back(RTLIL::State::S0);
-	return result;
+	bool undef;
+	int cmp = const_compare(arg1, arg2, signed1, signed2, undef);
+	return compare_result(cmp >= 0, undef, result_len);
 }
 
 RTLIL::Const RTLIL::const_gt(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
-	int undef_bit_pos = -1;
-	bool y = const2big(arg1, signed1, undef_bit_pos) > const2big(arg2, signed2, undef_bit_pos);
-	RTLIL::Const result(undef_bit_pos >= 0 ? RTLIL::State::Sx : y ? RTLIL::State::S1 : RTLIL::State::S0);
+	bool undef;
+	int cmp = const_compare(arg1, arg2, signed1, signed2, undef);
+	return compare_result(cmp > 0, undef, result_len);
+}
 
-	while (int(result.bits.size()) < result_len)
-		result.bits.push_back(RTLIL::State::S0);
-	return result;
+// Word-parallel addition (or subtraction, as a + ~b + 1) modulo 2^result_len.
+// Like const2big()/big2const(), an undefined bit anywhere in the inputs makes
+// the whole result undefined.
+static RTLIL::Const const_add_worker(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len, bool subtract)
+{
+	if (result_len < 0)
+		result_len = max(arg1.bits.size(), arg2.bits.size());
+
+	int width = max(result_len, max(GetSize(arg1), GetSize(arg2)));
+
+	if (width < packed_min_width) {
+		int undef_bit_pos = -1;
+		BigInteger a = const2big(arg1, signed1, undef_bit_pos);
+		BigInteger b = const2big(arg2, signed2, undef_bit_pos);
+		return big2const(subtract ? a - b : a + b, result_len, undef_bit_pos);
+	}
+
+	PackedConst a(arg1, width, signed1);
+	PackedConst b(arg2, width, signed2);
+
+	if (a.has_undef || b.has_undef)
+		return RTLIL::Const(RTLIL::State::Sx, result_len);
+
+	PackedConst result(result_len);
+	uint64_t carry = subtract ? 1 : 0;
+	for (int i = 0; i < GetSize(result.value); i++) {
+		uint64_t b_word = subtract ? ~b.value[i] : b.value[i];
+		uint64_t sum = a.value[i] + b_word;
+		uint64_t carry_out = sum < b_word;
+		sum += carry;
+		carry_out |= sum < carry;
+		result.value[i] = sum;
+		carry = carry_out;
+	}
+	result.normalize();
+
+	return result.as_const();
 }
 
 RTLIL::Const RTLIL::const_add(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
-	int undef_bit_pos = -1;
-	BigInteger y = const2big(arg1, signed1, undef_bit_pos) + const2big(arg2, signed2, undef_bit_pos);
-	return big2const(y, result_len >= 0 ? result_len : max(arg1.bits.size(), arg2.bits.size()), undef_bit_pos);
+	return const_add_worker(arg1, arg2, signed1, signed2, result_len, false);
 }
 
 RTLIL::Const RTLIL::const_sub(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
 {
-	int undef_bit_pos = -1;
-	BigInteger y = const2big(arg1, signed1, undef_bit_pos) - const2big(arg2, signed2, undef_bit_pos);
-	return big2const(y, result_len >= 0 ? result_len : max(arg1.bits.size(), arg2.bits.size()), undef_bit_pos);
+	return const_add_worker(arg1, arg2, signed1, signed2, result_len, true);
 }
 
 RTLIL::Const RTLIL::const_mul(const RTLIL::Const &arg1, const RTLIL::Const &arg2, bool signed1, bool signed2, int result_len)
@@ -18,6 +18,8 @@
  */
 
 #include "kernel/yosys.h"
+#include "kernel/threading.h"
+#include "kernel/modtools.h"
 #include "libs/sha1/sha1.h"
 
 #ifdef YOSYS_ENABLE_READLINE
@@ -342,6 +344,12 @@ int main(int argc, char **argv)
 		printf("    -g\n");
 		printf("        globally enable debug log messages\n");
 		printf("\n");
+		printf("    -j <threads>\n");
+		printf("        run module-parallel passes (e.g. opt_expr, opt_clean, opt_merge) on\n");
+		printf("        the specified number of threads. with more than one thread the\n");
+		printf("        names of module ports are never freed, which avoids contention on\n");
+		printf("        their reference counts\n");
+		printf("\n");
 		printf("    -V\n");
 		printf("        print version information and exit\n");
 		printf("\n");
@@ -368,7 +376,7 @@ int main(int argc, char **argv)
 	}
 
 	int opt;
-	while ((opt = getopt(argc, argv, "MXAQTVCSgm:f:Hh:b:o:p:l:L:qv:tds:c:W:w:e:r:D:P:E:x:B:")) != -1)
+	while ((opt = getopt(argc, argv, "MXAQTVCSgm:f:Hh:b:o:p:l:L:qv:tds:c:W:w:e:r:D:P:E:x:B:j:")) != -1)
 	{
 		switch (opt)
 		{
@@ -509,6 +517,19 @@ int main(int argc, char **argv)
 		case 'C':
 			run_tcl_shell = true;
 			break;
+		case 'j':
+			yosys_threads = atoi(optarg);
+			if (yosys_threads <= 0) {
+				fprintf(stderr, "Invalid number of threads for -j: %s\n", optarg);
+				exit(1);
+			}
+#ifdef YOSYS_DISABLE_THREADS
+			if (yosys_threads > 1)
+				fprintf(stderr, "Warning: This version of Yosys was built without thread support, ignoring -j.\n");
+			yosys_threads = 1;
+#endif
+			RTLIL::IdString::permanent_port_names = yosys_threads > 1;
+			break;
 		default:
 			fprintf(stderr, "Run '%s -h' for help.\n", argv[0]);
 			exit(1);
@@ -689,6 +710,10 @@ int main(int argc, char **argv)
 				log("%5d%% %5d calls %8.3f sec %s\n", int(100*std::get<0>(*it) / total_ns),
 						std::get<1>(*it), std::get<0>(*it) / 1000000000.0, std::get<2>(*it).c_str());
 			}
+			auto &mi_stats = ModIndex::stats();
+			if (mi_stats.created || mi_stats.reused)
+				log("Shared ModIndex: %d created, %d reloaded, %d reused\n",
+						int(mi_stats.created), int(mi_stats.reloaded), int(mi_stats.reused));
 		}
 		else
 		{
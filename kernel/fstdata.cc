@@ -18,6 +18,8 @@
  */
 
 #include "kernel/fstdata.h"
+#include "kernel/threading.h"
+#include <fstream>
 
 USING_YOSYS_NAMESPACE
 
@@ -63,7 +65,20 @@ FstData::FstData(std::string filename) : ctx(nullptr)
 	}
 	for (int i=0;i<zeros; i++) timescale_str += "0";
 	timescale_str += g_units[unit];
+	fst_filename = filename;
 	extractVarNames();
+
+	size_t num_handles = fstReaderGetMaxHandle(ctx) + 1;
+	slot_offset.resize(num_handles);
+	slot_size.resize(num_handles);
+	last_width.resize(num_handles, -1);
+	past_width.resize(num_handles, -1);
+	is_changed.resize(num_handles);
+	is_clock.resize(num_handles);
+	for (auto &it : handle_to_var)
+		if (it.first < num_handles)
+			moveSlot(it.first, it.second.width);
+	scanBlocks();
 }
 
 FstData::~FstData()
@@ -182,9 +197,85 @@ void FstData::extractVarNames()
 }
 
 
-static void reconstruct_clb_varlen_attimes(void *user_data, uint64_t pnt_time, fstHandle pnt_facidx, const unsigned char *pnt_value, uint32_t plen)
+// Finds the value change blocks in the section headers of the file. Files
+// that are compressed as a whole have none and are read sequentially.
+void FstData::scanBlocks()
+{
+	std::ifstream f(fst_filename, std::ios::binary);
+	auto read_uint64 = [&]() {
+		uint64_t val = 0;
+		for (int i = 0; i < 8; i++)
+			val = (val << 8) | (f.get() & 0xff);
+		return val;
+	};
+	auto read_varint = [&]() {
+		uint64_t val = 0;
+		for (int shift = 0; f; shift += 7) {
+			int ch = f.get();
+			val |= uint64_t(ch & 0x7f) << shift;
+			if (!(ch & 0x80))
+				break;
+		}
+		return val;
+	};
+
+	std::streamoff pos = 0;
+	while (f.seekg(pos))
+	{
+		int sectype = f.get();
+		uint64_t seclen = read_uint64();
+		if (!f || sectype == FST_BL_SKIP)
+			break;
+		if (sectype == FST_BL_VCDATA || sectype == FST_BL_VCDATA_DYN_ALIAS || sectype == FST_BL_VCDATA_DYN_ALIAS2) {
+			if (!seclen)
+				break;
+			Block block;
+			block.start_time = read_uint64();
+			block.end_time = read_uint64();
+			block.size = seclen;
+			read_uint64(); // memory required for traversal
+			read_varint(); // uncompressed frame length
+			read_varint(); // compressed frame length
+			uint64_t frame_maxhandle = read_varint();
+			if (!f)
+				break;
+			// fstapi reports a frame value for every signal but the variable
+			// length ones
+			block.frame_size = 0;
+			for (auto &it : handle_to_var)
+				if (it.first <= frame_maxhandle && it.second.width > 0)
+					block.frame_size++;
+			blocks.push_back(block);
+		}
+		pos += 1 + seclen;
+	}
+}
+
+// The states of the value characters, the same as in Const::from_string().
+static const struct StateTable {
+	State states[256];
+	StateTable() {
+		for (auto &state : states)
+			state = State::Sa;
+		states['0'] = State::S0;
+		states['1'] = State::S1;
+		states['x'] = State::Sx;
+		states['z'] = State::Sz;
+		states['m'] = State::Sm;
+	}
+} state_table;
+
+static void decode_value(State *bits, const unsigned char *pnt_value, size_t len)
+{
+	for (size_t i = len; i-- > 0; )
+		*bits++ = state_table.states[pnt_value[i]];
+}
+
+static void reconstruct_clb_varlen_attimes(void *user_data, uint64_t pnt_time, fstHandle pnt_facidx, const unsigned char *pnt_value, uint32_t /* plen */)
 {
 	FstData *ptr = (FstData*)user_data;
+	// values are used up to the first NUL, like those of the other callback
+	uint32_t plen = (pnt_value) ?  strlen((const char *)pnt_value) : 0;
 	ptr->reconstruct_callback_attimes(pnt_time, pnt_facidx, pnt_value, plen);
 }
 
@@ -195,22 +286,86 @@ static void reconstruct_clb_attimes(void *user_data, uint64_t pnt_time, fstHandl
 	ptr->reconstruct_callback_attimes(pnt_time, pnt_facidx, pnt_value, plen);
 }
 
-void FstData::reconstruct_callback_attimes(uint64_t pnt_time, fstHandle pnt_facidx, const unsigned char *pnt_value, uint32_t /* plen */)
+// The value changes of a run of blocks, decoded by one task of
+// reconstructAllAtTimes().
+struct FstDecodedBlocks
+{
+	struct Change {
+		uint64_t time;
+		fstHandle handle;
+		int width;
+		size_t offset;
+	};
+	std::vector<Change> changes;
+	std::vector<State> bits;
+	int skip = 0;
+
+	void add(uint64_t pnt_time, fstHandle pnt_facidx, const unsigned char *pnt_value, size_t len)
+	{
+		if (!pnt_value)
+			return;
+		changes.push_back({pnt_time, pnt_facidx, int(len), bits.size()});
+		bits.resize(bits.size() + len);
+		decode_value(bits.data() + changes.back().offset, pnt_value, len);
+	}
+};
+
+static void decode_clb_varlen(void *user_data, uint64_t pnt_time, fstHandle pnt_facidx, const unsigned char *pnt_value, uint32_t /* plen */)
+{
+	FstDecodedBlocks *ptr = (FstDecodedBlocks*)user_data;
+	ptr->add(pnt_time, pnt_facidx, pnt_value, pnt_value ? strlen((const char *)pnt_value) : 0);
+}
+
+static void decode_clb(void *user_data, uint64_t pnt_time, fstHandle pnt_facidx, const unsigned char *pnt_value)
+{
+	FstDecodedBlocks *ptr = (FstDecodedBlocks*)user_data;
+	// the frame only comes through this callback
+	if (ptr->skip > 0) {
+		ptr->skip--;
+		return;
+	}
+	ptr->add(pnt_time, pnt_facidx, pnt_value, pnt_value ? strlen((const char *)pnt_value) : 0);
+}
+
+void FstData::reconstruct_callback_attimes(uint64_t pnt_time, fstHandle pnt_facidx, const unsigned char *pnt_value, uint32_t plen)
 {
 	if (pnt_time > end_time || !pnt_value) return;
-	// if we are past the timestamp
-	bool is_clock = false;
-	if (!all_samples) {
-		for(auto &s : clk_signals) {
-			if (s==pnt_facidx)  { 
-				is_clock=true;
-				break;
-			}
-		}
+	State *bits = valueChange(pnt_time, pnt_facidx, plen, state_table.states[pnt_value[0]]);
+	decode_value(bits, pnt_value, plen);
+}
+
+void FstData::updatePastData()
+{
+	for (auto handle : changed) {
+		int offset = slot_offset[handle];
+		std::copy(last_bits.begin() + offset, last_bits.begin() + offset + last_width[handle], past_bits.begin() + offset);
+		past_width[handle] = last_width[handle];
+		is_changed[handle] = false;
 	}
+	changed.clear();
+}
+
+// Gives a handle a new slot at the end, for values that do not fit the
+// width of the signal (e.g. of reals), keeping its past value.
+void FstData::moveSlot(fstHandle handle, int size)
+{
+	int offset = GetSize(last_bits);
+	last_bits.resize(offset + size);
+	past_bits.resize(offset + size);
+	if (past_width[handle] > 0)
+		std::copy_n(past_bits.begin() + slot_offset[handle], past_width[handle], past_bits.begin() + offset);
+	slot_offset[handle] = offset;
+	slot_size[handle] = size;
+}
 
+// Handles the time of a value change, with `bit` the new value if it has a
+// width of 1. Returns where the new value goes, nullptr if it is too late.
+State *FstData::valueChange(uint64_t pnt_time, fstHandle pnt_facidx, int width, State bit)
+{
+	if (pnt_time > end_time) return nullptr;
+	// if we are past the timestamp
 	if (pnt_time > past_time) {
-		past_data = last_data;
+		updatePastData();
 		past_time = pnt_time;
 	}
 
@@ -219,46 +374,138 @@ void FstData::reconstruct_callback_attimes(uint64_t pnt_time, fstHandle pnt_faci
 			callback(last_time);
 			last_time = pnt_time;
 		} else {
-			if (is_clock) {
-				std::string val = std::string((const char *)pnt_value);
-				std::string prev = past_data[pnt_facidx];
-				if ((prev!="1" && val=="1") || (prev!="0" && val=="0")) {
+			if (is_clock[pnt_facidx]) {
+				State prev = past_bits[slot_offset[pnt_facidx]];
+				bool prev_one = past_width[pnt_facidx] == 1 && prev == State::S1;
+				bool prev_zero = past_width[pnt_facidx] == 1 && prev == State::S0;
+				bool val_one = width == 1 && bit == State::S1;
+				bool val_zero = width == 1 && bit == State::S0;
+				if ((!prev_one && val_one) || (!prev_zero && val_zero)) {
 					callback(last_time);
 					last_time = pnt_time;
 				}
 			}
 		}
 	}
-	// always update last_data
-	last_data[pnt_facidx] =  std::string((const char *)pnt_value);
+	// always update the last value
+	if (!is_changed[pnt_facidx]) {
+		is_changed[pnt_facidx] = true;
+		changed.push_back(pnt_facidx);
+	}
+	if (width > slot_size[pnt_facidx])
+		moveSlot(pnt_facidx, width);
+	last_width[pnt_facidx] = width;
+	return last_bits.data() + slot_offset[pnt_facidx];
 }
 
 void FstData::reconstructAllAtTimes(std::vector<fstHandle> &signal, uint64_t start, uint64_t end, CallbackFunction cb)
 {
-	clk_signals = signal;
 	callback = cb;
 	start_time = start;
 	end_time = end;
-	last_data.clear();
+	for (size_t i = 0; i < is_clock.size(); i++) {
+		last_width[i] = past_width[i] = -1;
+		is_changed[i] = is_clock[i] = false;
+	}
+	changed.clear();
+	for (auto handle : signal)
+		is_clock.at(handle) = true;
 	last_time = start_time;
-	past_data.clear();
 	past_time = start_time;
-	all_samples = clk_signals.empty();
+	all_samples = signal.empty();
+
+	// With "yosys -j <N>", runs of blocks are decompressed and decoded in
+	// parallel, each with a reader of its own that is limited to their time
+	// range. Runs are only split where the times of two blocks do not
+	// overlap but for the time that one ends and the next starts at. The
+	// reader of the previous run may also report the changes of the next
+	// block at that time, which does no harm, as they are applied twice in a
+	// row. Then the value changes are applied in file order.
+	uint64_t total_size = 0;
+	for (auto &block : blocks)
+		total_size += block.size;
+	uint64_t run_size = std::min<uint64_t>(1 << 20, total_size / (2 * std::max(yosys_threads, 1)) + 1);
+	std::vector<Block> runs;
+	for (auto &block : blocks) {
+		if (block.start_time > end_time)
+			break;
+		if (runs.empty())
+			runs.push_back(block);
+		else if (runs.back().size >= run_size && runs.back().end_time < block.start_time)
+			runs.push_back(block);
+		else if (runs.back().size >= run_size && runs.back().end_time == block.start_time && block.end_time > block.start_time) {
+			// a block usually starts at the last time of the previous one,
+			// so start the reader just after that to skip the previous block
+			runs.push_back(block);
+			runs.back().start_time++;
+		} else {
+			runs.back().end_time = std::max(runs.back().end_time, block.end_time);
+			runs.back().size += block.size;
+		}
+	}
+
+	if (yosys_threads <= 1 || GetSize(runs) <= 1) {
+		fstReaderSetUnlimitedTimeRange(ctx);
+		fstReaderSetFacProcessMaskAll(ctx);
+		fstReaderIterBlocks2(ctx, reconstruct_clb_attimes, reconstruct_clb_varlen_attimes, this, nullptr);
+	} else {
+		std::vector<void*> readers(std::min(yosys_threads, GetSize(runs)));
+		// kept from wave to wave, to reuse the memory
+		std::vector<FstDecodedBlocks> decoded(GetSize(readers));
+		try {
+			for (int first = 0; first < GetSize(runs); first += GetSize(readers))
+			{
+				int n = std::min(GetSize(readers), GetSize(runs) - first);
+				parallel_for_unnamed(n, [&](int i) {
+					if (readers[i] == nullptr && (readers[i] = fstReaderOpen(fst_filename.c_str())) == nullptr)
+						log_error("Error opening '%s' as FST file\n", fst_filename.c_str());
+					const Block &run = runs[first + i];
+					// a reader that does not start at the first block reports
+					// the frame of its first block, which holds the values
+					// that the previous runs end with
+					decoded[i].changes.clear();
+					decoded[i].bits.clear();
+					decoded[i].skip = first + i > 0 ? run.frame_size : 0;
+					fstReaderSetLimitTimeRange(readers[i], run.start_time, run.end_time);
+					fstReaderSetFacProcessMaskAll(readers[i]);
+					fstReaderIterBlocks2(readers[i], decode_clb, decode_clb_varlen, &decoded[i], nullptr);
+				});
+				for (int i = 0; i < n; i++)
+					for (auto &change : decoded[i].changes) {
+						const State *value = decoded[i].bits.data() + change.offset;
+						State *bits = valueChange(change.time, change.handle, change.width, change.width ? value[0] : State::Sx);
+						if (bits)
+							std::copy(value, value + change.width, bits);
+					}
+			}
+		} catch (...) {
+			for (auto reader : readers)
+				if (reader)
+					fstReaderClose(reader);
+			throw;
+		}
+		for (auto reader : readers)
+			if (reader)
+				fstReaderClose(reader);
+	}
 
-	fstReaderSetUnlimitedTimeRange(ctx);
-	fstReaderSetFacProcessMaskAll(ctx);
-	fstReaderIterBlocks2(ctx, reconstruct_clb_attimes, reconstruct_clb_varlen_attimes, this, nullptr);
 	if (last_time!=end_time) {
-		past_data = last_data;
+		updatePastData();
 		callback(last_time);
 	}
-	past_data = last_data;
+	updatePastData();
 	callback(end_time);
 }
 
 std::string FstData::valueOf(fstHandle signal)
 {
-	if (past_data.find(signal) == past_data.end())
+	return constValueOf(signal).as_string();
+}
+
+Const FstData::constValueOf(fstHandle signal)
+{
+	if (signal >= past_width.size() || past_width[signal] < 0)
 		log_error("Signal id %d not found\n", (int)signal);
-	return past_data[signal];
+	auto begin = past_bits.begin() + slot_offset[signal];
+	return Const(std::vector<State>(begin, begin + past_width[signal]));
 }
@@ -53,28 +53,51 @@ class FstData
 	void reconstructAllAtTimes(std::vector<fstHandle> &signal, uint64_t start_time, uint64_t end_time, CallbackFunction cb);
 
 	std::string valueOf(fstHandle signal);
+	// Same as Const::from_string(valueOf(signal)), without the string.
+	RTLIL::Const constValueOf(fstHandle signal);
 	fstHandle getHandle(std::string name);
 	dict<int,fstHandle> getMemoryHandles(std::string name);
 	double getTimescale() { return timescale; }
 	const char *getTimescaleString() { return timescale_str.c_str(); }
 private:
+	// A value change block of the file, see scanBlocks().
+	struct Block
+	{
+		uint64_t start_time, end_time;
+		uint64_t size;
+		// the number of values in the frame, the values of all signals at
+		// start_time that fstapi reports first when it starts at this block
+		int frame_size;
+	};
+
 	void extractVarNames();
+	void scanBlocks();
+	RTLIL::State *valueChange(uint64_t pnt_time, fstHandle pnt_facidx, int width, RTLIL::State bit);
+	void updatePastData();
+	void moveSlot(fstHandle handle, int size);
 
 	struct fstReaderContext *ctx;
+	std::string fst_filename;
 	std::vector<FstVar> vars;
 	std::map<fstHandle, FstVar> handle_to_var;
 	std::map<std::string, fstHandle> name_to_handle;
 	std::map<std::string, dict<int, fstHandle>> memory_to_handle;
-	std::map<fstHandle, std::string> last_data;
+	std::vector<Block> blocks;
+	// The values at last_time and past_time, in slots of two flat buffers
+	// that are laid out in handle order. A width of -1 means that there is
+	// no value yet, the handles that changed since past_time are in
+	// `changed`.
+	std::vector<RTLIL::State> last_bits, past_bits;
+	std::vector<int> slot_offset, slot_size, last_width, past_width;
+	std::vector<bool> is_changed, is_clock;
+	std::vector<fstHandle> changed;
 	uint64_t last_time;
-	std::map<fstHandle, std::string> past_data;
 	uint64_t past_time;
 	double timescale;
 	std::string timescale_str;
 	uint64_t start_time;
 	uint64_t end_time;
 	CallbackFunction callback;
-	std::vector<fstHandle> clk_signals;
 	bool all_samples;
 	std::string tmp_file;
 };
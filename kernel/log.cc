@@ -61,9 +61,10 @@ string log_last_error;
 void (*log_error_atexit)() = NULL;
 void (*log_verific_callback)(int msg_type, const char *message_id, const char* file_path, unsigned int line_no, const char *msg) = NULL;
 
-int log_make_debug = 0;
+thread_local int log_make_debug = 0;
 int log_force_debug = 0;
-int log_debug_suppressed = 0;
+thread_local int log_debug_suppressed = 0;
+thread_local LogCapture *log_capture = nullptr;
 
 vector<int> header_count;
 vector<char*> log_id_cache;
@@ -74,6 +75,19 @@ static struct timeval initial_tv = { 0, 0 };
 static bool next_print_log = false;
 static int log_newline_count = 0;
 
+// serializes the global state touched by warnings and errors in parallel tasks
+#ifndef YOSYS_DISABLE_THREADS
+static std::recursive_mutex log_mutex;
+
+struct log_task_lock {
+	bool locked;
+	log_task_lock() : locked(log_capture != nullptr) { if (locked) log_mutex.lock(); }
+	~log_task_lock() { if (locked) log_mutex.unlock(); }
+};
+#else
+struct log_task_lock { log_task_lock() { } };
+#endif
+
 static void log_id_cache_clear()
 {
 	for (auto p : log_id_cache)
@@ -116,6 +130,11 @@ void logv(const char *format, va_list ap)
 	if (str.empty())
 		return;
 
+	if (log_capture) {
+		log_capture->append(str);
+		return;
+	}
+
 	size_t nnl_pos = str.find_last_not_of('\n');
 	if (nnl_pos == std::string::npos)
 		log_newline_count += GetSize(str);
@@ -207,6 +226,13 @@ void logv_header(RTLIL::Design *design, const char *format, va_list ap)
 {
 	bool pop_errfile = false;
 
+	// the header number is assigned when the output of the task is replayed,
+	// design dumps (-H/-hdump) are not available for such headers
+	if (log_capture) {
+		log_capture->append_header(vstringf(format, ap));
+		return;
+	}
+
 	log_spacer();
 	if (header_count.size() > 0)
 		header_count.back()++;
@@ -247,6 +273,7 @@ static void logv_warning_with_prefix(const char *prefix,
 {
 	std::string message = vstringf(format, ap);
 	bool suppressed = false;
+	log_task_lock lock;
 
 	for (auto &re : log_nowarn_regexes)
 		if (std::regex_search(message, re))
@@ -277,6 +304,11 @@ static void logv_warning_with_prefix(const char *prefix,
 			log("%s%s", prefix, message.c_str());
 			log_flush();
 		}
+		else if (log_capture)
+		{
+			log_capture->append(prefix + message, log_errfile != NULL && !log_quiet_warnings);
+			log_warnings.insert(message);
+		}
 		else
 		{
 			if (log_errfile != NULL && !log_quiet_warnings)
@@ -337,6 +369,14 @@ static void logv_error_with_prefix(const char *prefix,
 #ifdef EMSCRIPTEN
 	auto backup_log_files = log_files;
 #endif
+	log_task_lock lock;
+	if (log_capture) {
+		// an error terminates the process, print the output of this task now
+		LogCapture *capture = log_capture;
+		log_capture = nullptr;
+		capture->replay();
+	}
+
 	int bak_log_make_debug = log_make_debug;
 	log_make_debug = 0;
 	log_suppressed();
@@ -431,6 +471,7 @@ void log_experimental(const char *format, ...)
 	string s = vstringf(format, ap);
 	va_end(ap);
 
+	log_task_lock lock;
 	if (log_experimentals_ignored.count(s) == 0 && log_experimentals.count(s) == 0) {
 		log_warning("Feature '%s' is experimental.\n", s.c_str());
 		log_experimentals.insert(s);
@@ -596,6 +637,9 @@ void log_reset_stack()
 
 void log_flush()
 {
+	if (log_capture)
+		return;
+
 	for (auto f : log_files)
 		fflush(f);
 
@@ -620,6 +664,11 @@ const char *log_signal(const RTLIL::SigSpec &sig, bool autoint)
 	std::stringstream buf;
 	RTLIL_BACKEND::dump_sigspec(buf, sig, autoint);
 
+	if (log_capture) {
+		log_capture->strings.push_back(buf.str());
+		return log_capture->strings.back().c_str();
+	}
+
 	if (string_buf.size() < 100) {
 		string_buf.push_back(buf.str());
 		return string_buf.back().c_str();
@@ -638,6 +687,11 @@ const char *log_const(const RTLIL::Const &value, bool autoint)
 
 	std::string str = "\"" + value.decode_string() + "\"";
 
+	if (log_capture) {
+		log_capture->strings.push_back(str);
+		return log_capture->strings.back().c_str();
+	}
+
 	if (string_buf.size() < 100) {
 		string_buf.push_back(str);
 		return string_buf.back().c_str();
@@ -651,8 +705,14 @@ const char *log_const(const RTLIL::Const &value, bool autoint)
 
 const char *log_id(const RTLIL::IdString &str)
 {
-	log_id_cache.push_back(strdup(str.c_str()));
-	const char *p = log_id_cache.back();
+	const char *p;
+	if (log_capture) {
+		log_capture->strings.push_back(str.c_str());
+		p = log_capture->strings.back().c_str();
+	} else {
+		log_id_cache.push_back(strdup(str.c_str()));
+		p = log_id_cache.back();
+	}
 	if (p[0] != '\\')
 		return p;
 	if (p[1] == '$' || p[1] == '\\' || p[1] == 0)
@@ -683,6 +743,47 @@ void log_wire(RTLIL::Wire *wire, std::string indent)
 	log("%s", buf.str().c_str());
 }
 
+void LogCapture::append(const std::string &str, bool to_errfile)
+{
+	if (!chunks.empty() && !to_errfile && !chunks.back().to_errfile && !chunks.back().header)
+		chunks.back().text += str;
+	else
+		chunks.push_back({str, to_errfile, false});
+}
+
+void LogCapture::append_header(const std::string &str)
+{
+	chunks.push_back({str, false, true});
+}
+
+void LogCapture::replay()
+{
+	// the log_make_debug filter has already been applied when capturing
+	int bak_log_make_debug = log_make_debug;
+	log_make_debug = 0;
+
+	for (auto &chunk : chunks) {
+		if (chunk.header) {
+			log_header(nullptr, "%s", chunk.text.c_str());
+			continue;
+		}
+		bool to_errfile = chunk.to_errfile && log_errfile != NULL;
+		if (to_errfile)
+			log_files.push_back(log_errfile);
+		log("%s", chunk.text.c_str());
+		if (to_errfile)
+			log_files.pop_back();
+	}
+	log_flush();
+
+	log_make_debug = bak_log_make_debug;
+	log_debug_suppressed += debug_suppressed;
+
+	chunks.clear();
+	strings.clear();
+	debug_suppressed = 0;
+}
+
 void log_check_expected()
 {
 	// copy out all of the expected logs so that they cannot be re-checked
@@ -115,9 +115,34 @@ extern int log_verbose_level;
 extern string log_last_error;
 extern void (*log_error_atexit)();
 
-extern int log_make_debug;
+extern thread_local int log_make_debug;
 extern int log_force_debug;
-extern int log_debug_suppressed;
+extern thread_local int log_debug_suppressed;
+
+// Collects the log output of a task of parallel_for() (kernel/threading.h),
+// which is replayed on the main thread once all tasks have completed.
+struct LogCapture
+{
+	struct Chunk {
+		std::string text;
+		// whether it should also go to log_errfile (for warnings)
+		bool to_errfile;
+		// whether it is the message of a log_header() call, which is only
+		// numbered when it is replayed
+		bool header;
+	};
+
+	std::vector<Chunk> chunks;
+	// backing store for the strings returned by log_id(), log_signal(), ..
+	std::vector<shared_str> strings;
+	int debug_suppressed = 0;
+
+	void append(const std::string &str, bool to_errfile = false);
+	void append_header(const std::string &str);
+	void replay();
+};
+
+extern thread_local LogCapture *log_capture;
 
 void logv(const char *format, va_list ap);
 void logv_header(RTLIL::Design *design, const char *format, va_list ap);
@@ -236,9 +261,10 @@ static inline void log_assert_worker(bool cond, const char *expr, const char *fi
 
 #if defined(YOSYS_ENABLE_COVER) && (defined(__linux__) || defined(__FreeBSD__))
 
+// (not counted in the tasks of parallel_for(), see kernel/threading.h)
 #define cover(_id) do { \
     static CoverData __d __attribute__((section("yosys_cover_list"), aligned(1), used)) = { __FILE__, __FUNCTION__, _id, __LINE__, 0 }; \
-    __d.counter++; \
+    if (YOSYS_NAMESPACE_PREFIX log_capture == nullptr) __d.counter++; \
 } while (0)
 
 struct CoverData {
@@ -77,6 +77,17 @@ struct ModIndex : public RTLIL::Monitor
 	std::map<RTLIL::SigBit, SigBitInfo> database;
 	int auto_reload_counter;
 	bool auto_reload_module;
+	bool persistent = false;
+
+	// Usage counters of the persistent index (see get()), for "yosys -d".
+	struct Stats {
+		std::atomic<int> created{0}, reloaded{0}, reused{0};
+	};
+
+	static Stats &stats() {
+		static Stats s;
+		return s;
+	}
 
 	void port_add(RTLIL::Cell *cell, RTLIL::IdString port, const RTLIL::SigSpec &sig)
 	{
@@ -123,7 +134,7 @@ struct ModIndex : public RTLIL::Monitor
 				port_add(cell, conn.first, conn.second);
 
 		if (auto_reload_module) {
-			if (++auto_reload_counter > 2)
+			if (++auto_reload_counter > 2 && !persistent)
 				log_warning("Auto-reload in ModIndex -- possible performance bug!\n");
 			auto_reload_module = false;
 		}
@@ -224,6 +235,10 @@ struct ModIndex : public RTLIL::Monitor
 	{
 		log_assert(module == mod);
 		auto_reload_module = true;
+
+		// the wires in the database may be deleted before the next reload
+		database.clear();
+		sigmap.clear();
 	}
 
 	ModIndex(RTLIL::Module *_m) : sigmap(_m), module(_m)
@@ -238,6 +253,33 @@ struct ModIndex : public RTLIL::Monitor
 		module->monitors.erase(this);
 	}
 
+	// Returns the ModIndex that is owned by the module and shared by all
+	// passes that use this function. It is kept up to date through the
+	// monitor notifications and only rebuilt after the module connections
+	// are replaced, or after a pass that changed the module without
+	// notifying monitors (see Pass::notifies_monitors()). The index,
+	// including the sigmap, is up to date when this function returns.
+	static ModIndex &get(RTLIL::Module *module)
+	{
+		RTLIL::Monitor *&mon = module->owned_monitors[ID(ModIndex)];
+		ModIndex *index = dynamic_cast<ModIndex*>(mon);
+
+		if (index == nullptr) {
+			log_assert(mon == nullptr);
+			index = new ModIndex(module);
+			index->persistent = true;
+			mon = index;
+			stats().created++;
+		} else if (index->auto_reload_module)
+			stats().reloaded++;
+		else
+			stats().reused++;
+
+		if (index->auto_reload_module)
+			index->reload_module();
+		return *index;
+	}
+
 	SigBitInfo *query(RTLIL::SigBit bit)
 	{
 		if (auto_reload_module)
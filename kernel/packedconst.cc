@@ -0,0 +1,143 @@
+/*
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ */
+
+#include "kernel/packedconst.h"
+
+YOSYS_NAMESPACE_BEGIN
+
+#if !defined(__BYTE_ORDER__) || __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#  define PACKEDCONST_LITTLE_ENDIAN
+#endif
+
+// Sets the bits [from, to) in the given bit plane.
+static void set_range(std::vector<uint64_t> &words, int from, int to)
+{
+	for (int i = from; i < to; ) {
+		if (i % 64 == 0 && i + 64 <= to) {
+			words[i / 64] = ~uint64_t(0);
+			i += 64;
+		} else {
+			words[i / 64] |= uint64_t(1) << (i % 64);
+			i++;
+		}
+	}
+}
+
+PackedConst::PackedConst(const RTLIL::Const &c, int width, bool is_signed) : PackedConst(width)
+{
+	int n = std::min(GetSize(c), width);
+	const RTLIL::State *bits = c.bits.data();
+	int i = 0;
+
+#ifdef PACKEDCONST_LITTLE_ENDIAN
+	// Eight states at a time: a state is S1 if it is 1, and undefined if it
+	// has bit 1 or 2 set (Sx = 2, Sz = 3, Sa = 4, Sm = 5). The multiplication
+	// gathers the lowest bit of each byte into the top byte of the product.
+	for (; i + 8 <= n; i += 8) {
+		uint64_t chunk;
+		memcpy(&chunk, bits + i, 8);
+		uint64_t u = ((chunk >> 1) | (chunk >> 2)) & 0x0101010101010101ULL;
+		uint64_t v = chunk & ~u & 0x0101010101010101ULL;
+		value[i / 64] |= ((v * 0x0102040810204080ULL) >> 56) << (i % 64);
+		undef[i / 64] |= ((u * 0x0102040810204080ULL) >> 56) << (i % 64);
+	}
+#endif
+
+	for (; i < n; i++) {
+		if (bits[i] == RTLIL::State::S1)
+			value[i / 64] |= uint64_t(1) << (i % 64);
+		else if (bits[i] != RTLIL::State::S0)
+			undef[i / 64] |= uint64_t(1) << (i % 64);
+	}
+
+	RTLIL::State padding = is_signed && !c.bits.empty() ? c.bits.back() : RTLIL::State::S0;
+	if (padding == RTLIL::State::S1)
+		set_range(value, n, width);
+	else if (padding != RTLIL::State::S0)
+		set_range(undef, n, width);
+
+	for (auto w : undef)
+		if (w != 0) {
+			has_undef = true;
+			break;
+		}
+}
+
+RTLIL::Const PackedConst::as_const() const
+{
+	RTLIL::Const result;
+	result.bits.resize(width);
+	RTLIL::State *bits = result.bits.data();
+
+	for (int i = 0; i < width; i++) {
+		int v = (value[i / 64] >> (i % 64)) & 1;
+		int u = (undef[i / 64] >> (i % 64)) & 1;
+		bits[i] = RTLIL::State(v | (u << 1));
+	}
+
+	return result;
+}
+
+void PackedConst::normalize()
+{
+	if (width % 64 != 0) {
+		uint64_t mask = (uint64_t(1) << (width % 64)) - 1;
+		value.back() &= mask;
+		undef.back() &= mask;
+	}
+
+	has_undef = false;
+	for (int i = 0; i < GetSize(undef); i++) {
+		value[i] &= ~undef[i];
+		if (undef[i] != 0)
+			has_undef = true;
+	}
+}
+
+bool PackedConst::is_fully_zero() const
+{
+	if (has_undef)
+		return false;
+	for (auto w : value)
+		if (w != 0)
+			return false;
+	return true;
+}
+
+bool PackedConst::any_value() const
+{
+	for (auto w : value)
+		if (w != 0)
+			return true;
+	return false;
+}
+
+bool PackedConst::any_zero() const
+{
+	for (int i = 0; i < GetSize(value); i++) {
+		uint64_t zero = ~(value[i] | undef[i]);
+		if (i == GetSize(value) - 1 && width % 64 != 0)
+			zero &= (uint64_t(1) << (width % 64)) - 1;
+		if (zero != 0)
+			return true;
+	}
+	return false;
+}
+
+YOSYS_NAMESPACE_END
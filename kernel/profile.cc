@@ -0,0 +1,234 @@
+/*
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ */
+
+#include "kernel/profile.h"
+#include "kernel/json.h"
+
+#include <chrono>
+
+#if defined(__linux__) || defined(__FreeBSD__)
+#  include <sys/resource.h>
+#endif
+#if defined(YOSYS_ENABLE_PLUGINS) && !defined(_WIN32)
+#  include <dlfcn.h>
+#endif
+
+YOSYS_NAMESPACE_BEGIN
+
+PassProfiler *pass_profiler = nullptr;
+
+// The counter exported by tests/bench/malloc_count.c when it is preloaded.
+static int64_t query_allocations()
+{
+#if defined(YOSYS_ENABLE_PLUGINS) && !defined(_WIN32)
+	typedef unsigned long long (*malloc_count_get_t)();
+	static malloc_count_get_t malloc_count_get = (malloc_count_get_t)dlsym(RTLD_DEFAULT, "malloc_count_get");
+	if (malloc_count_get != nullptr)
+		return malloc_count_get();
+#endif
+	return -1;
+}
+
+PassProfiler::Sample PassProfiler::sample() const
+{
+	Sample s;
+	s.time_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	s.maxrss_kb = 0;
+#if defined(__linux__) || defined(__FreeBSD__)
+	struct rusage ru;
+	if (getrusage(RUSAGE_SELF, &ru) == 0)
+		s.maxrss_kb = ru.ru_maxrss;
+#endif
+	s.allocations = query_allocations();
+	s.wires_created = wires_created;
+	s.wires_destroyed = wires_destroyed;
+	s.cells_created = cells_created;
+	s.cells_destroyed = cells_destroyed;
+	return s;
+}
+
+void PassProfiler::set_command(const std::vector<std::string> &args)
+{
+	if (std::this_thread::get_id() == owner)
+		next_command = args;
+}
+
+int PassProfiler::begin(Pass *pass)
+{
+	if (std::this_thread::get_id() != owner)
+		return -1;
+
+	std::vector<std::string> args;
+	std::swap(args, next_command);
+
+	std::string command;
+	for (auto &arg : args)
+		command += (command.empty() ? "" : " ") + arg;
+	if (command.empty())
+		command = pass->pass_name;
+
+	// Frontend::execute() and Backend::execute() run pre_execute() again
+	// for the same command, which is not worth a separate event.
+	if (!stack.empty() && events[stack.back()].pass == pass && (args.empty() || events[stack.back()].command == command))
+		return -1;
+
+	Event event;
+	event.pass = pass;
+	event.command = command;
+	event.parent = stack.empty() ? -1 : stack.back();
+	event.depth = GetSize(stack);
+	event.children_ns = 0;
+	event.begin = sample();
+	event.end = event.begin;
+
+	stack.push_back(GetSize(events));
+	events.push_back(event);
+	return stack.back();
+}
+
+void PassProfiler::end(int index)
+{
+	if (index < 0)
+		return;
+
+	log_assert(std::this_thread::get_id() == owner);
+	if (std::find(stack.begin(), stack.end(), index) == stack.end())
+		return;
+
+	Sample s = sample();
+	while (1) {
+		int i = stack.back();
+		stack.pop_back();
+		auto &event = events[i];
+		event.end = s;
+		if (event.parent >= 0)
+			events[event.parent].children_ns += event.end.time_ns - event.begin.time_ns;
+		if (i == index)
+			break;
+	}
+}
+
+void PassProfiler::end_all()
+{
+	if (!stack.empty())
+		end(stack.front());
+}
+
+void PassProfiler::log_report() const
+{
+	log("%9s %9s %9s %10s %8s %8s %8s %8s  %s\n", "time", "self", "peak RSS",
+			"allocs", "+cells", "-cells", "+wires", "-wires", "command");
+	for (auto &event : events) {
+		int64_t time_ns = event.end.time_ns - event.begin.time_ns;
+		std::string allocs = event.begin.allocations < 0 ? "-" :
+				stringf("%lld", (long long)(event.end.allocations - event.begin.allocations));
+		log("%8.3fs %8.3fs %+7.1fMB %10s %8lld %8lld %8lld %8lld  %*s%s\n",
+				time_ns / 1e9, (time_ns - event.children_ns) / 1e9,
+				(event.end.maxrss_kb - event.begin.maxrss_kb) / 1024.0, allocs.c_str(),
+				(long long)(event.end.cells_created - event.begin.cells_created),
+				(long long)(event.end.cells_destroyed - event.begin.cells_destroyed),
+				(long long)(event.end.wires_created - event.begin.wires_created),
+				(long long)(event.end.wires_destroyed - event.begin.wires_destroyed),
+				2 * event.depth, "", event.command.c_str());
+	}
+}
+
+// Integers are written as doubles since Json only has 32 bit integers.
+static void write_counters(PrettyJson &json, const PassProfiler::Event &event)
+{
+	json.entry("maxrss_delta_kb", double(event.end.maxrss_kb - event.begin.maxrss_kb));
+	if (event.begin.allocations >= 0)
+		json.entry("allocations", double(event.end.allocations - event.begin.allocations));
+	json.entry("cells_created", double(event.end.cells_created - event.begin.cells_created));
+	json.entry("cells_destroyed", double(event.end.cells_destroyed - event.begin.cells_destroyed));
+	json.entry("wires_created", double(event.end.wires_created - event.begin.wires_created));
+	json.entry("wires_destroyed", double(event.end.wires_destroyed - event.begin.wires_destroyed));
+}
+
+void PassProfiler::write_json(PrettyJson &json) const
+{
+	int64_t origin_ns = events.empty() ? 0 : events.front().begin.time_ns;
+
+	json.begin_object();
+	json.entry("generator", yosys_version_str);
+	json.name("events");
+	json.begin_array();
+	for (auto &event : events) {
+		int64_t time_ns = event.end.time_ns - event.begin.time_ns;
+		json.begin_object();
+		json.compact();
+		json.entry("pass", event.pass->pass_name);
+		json.entry("command", event.command);
+		json.entry("parent", event.parent);
+		json.entry("depth", event.depth);
+		json.entry("begin_ns", double(event.begin.time_ns - origin_ns));
+		json.entry("runtime_ns", double(time_ns));
+		json.entry("self_ns", double(time_ns - event.children_ns));
+		json.entry("maxrss_kb", double(event.end.maxrss_kb));
+		write_counters(json, event);
+		json.end_object();
+	}
+	json.end_array();
+	json.end_object();
+}
+
+void PassProfiler::write_trace(PrettyJson &json) const
+{
+	int64_t origin_ns = events.empty() ? 0 : events.front().begin.time_ns;
+
+	json.begin_object();
+	json.entry("displayTimeUnit", "ms");
+	json.name("traceEvents");
+	json.begin_array();
+	for (auto &event : events) {
+		json.begin_object();
+		json.compact();
+		json.entry("name", event.pass->pass_name);
+		json.entry("cat", "pass");
+		json.entry("ph", "X");
+		json.entry("ts", (event.begin.time_ns - origin_ns) / 1e3);
+		json.entry("dur", (event.end.time_ns - event.begin.time_ns) / 1e3);
+		json.entry("pid", 1);
+		json.entry("tid", 1);
+		json.name("args");
+		json.begin_object();
+		json.entry("command", event.command);
+		write_counters(json, event);
+		json.end_object();
+		json.end_object();
+
+		// a counter track with the peak RSS at the end of each pass
+		json.begin_object();
+		json.compact();
+		json.entry("name", "maxrss");
+		json.entry("ph", "C");
+		json.entry("ts", (event.end.time_ns - origin_ns) / 1e3);
+		json.entry("pid", 1);
+		json.name("args");
+		json.begin_object();
+		json.entry("MB", event.end.maxrss_kb / 1024.0);
+		json.end_object();
+		json.end_object();
+	}
+	json.end_array();
+	json.end_object();
+}
+
+YOSYS_NAMESPACE_END
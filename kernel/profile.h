@@ -0,0 +1,95 @@
+/* -*- c++ -*-
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ */
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include "kernel/yosys.h"
+
+#include <atomic>
+#include <thread>
+
+YOSYS_NAMESPACE_BEGIN
+
+class PrettyJson;
+
+// Records one event per pass invocation (including the passes called by
+// script passes) while active, see the "profile" command. Pass::pre_execute()
+// and Pass::post_execute() call begin() and end(), Pass::call() provides the
+// command line through set_command().
+//
+// Events are nested on a single stack and are only recorded for the thread
+// that started profiling. Passes called on other threads (for example from
+// the tasks of "hierarchy -j") are part of the enclosing event.
+struct PassProfiler
+{
+	// The values of the process-wide counters at one point in time.
+	// allocations is -1 if the malloc counter of malloc_count.so (in
+	// tests/bench) is not available, and maxrss_kb is 0 where getrusage()
+	// does not report it.
+	struct Sample
+	{
+		int64_t time_ns, maxrss_kb, allocations;
+		int64_t wires_created, wires_destroyed, cells_created, cells_destroyed;
+	};
+
+	struct Event
+	{
+		Pass *pass;
+		std::string command;
+		int parent, depth;
+		Sample begin, end;
+		int64_t children_ns;
+	};
+
+	// Maintained by the constructors and destructors of RTLIL::Wire and
+	// RTLIL::Cell while pass_profiler is set. These are atomic because
+	// module-parallel passes create and remove objects on several threads.
+	std::atomic<int64_t> wires_created{0}, wires_destroyed{0};
+	std::atomic<int64_t> cells_created{0}, cells_destroyed{0};
+
+	// events, stack and next_command are only accessed on this thread
+	std::thread::id owner = std::this_thread::get_id();
+	std::vector<Event> events;
+	std::vector<int> stack;
+	std::vector<std::string> next_command;
+
+	Sample sample() const;
+
+	// Sets the command line for the event of the next begin() call.
+	void set_command(const std::vector<std::string> &args);
+	// Returns the index of the new event, or -1 if no event was created.
+	int begin(Pass *pass);
+	// Closes the given event and all events that are still open within it
+	// (after an exception was thrown by a nested pass).
+	void end(int index);
+	// Closes all open events, called when profiling is stopped.
+	void end_all();
+
+	void log_report() const;
+	void write_json(PrettyJson &json) const;
+	void write_trace(PrettyJson &json) const;
+};
+
+// The active profiler, or nullptr.
+extern PassProfiler *pass_profiler;
+
+YOSYS_NAMESPACE_END
+
+#endif
@@ -19,6 +19,8 @@
 
 #include "kernel/yosys.h"
 #include "kernel/satgen.h"
+#include "kernel/threading.h"
+#include "kernel/profile.h"
 
 #include <string.h>
 #include <stdlib.h>
@@ -155,6 +157,7 @@ Pass::pre_post_exec_state_t Pass::pre_execute()
 	call_counter++;
 	state.begin_ns = PerformanceTimer::query();
 	state.parent_pass = current_pass;
+	state.profile_event = pass_profiler ? pass_profiler->begin(this) : -1;
 	current_pass = this;
 	clear_flags();
 	return state;
@@ -170,6 +173,25 @@ void Pass::post_execute(Pass::pre_post_exec_state_t state)
 	current_pass = state.parent_pass;
 	if (current_pass)
 		current_pass->runtime_ns -= time_ns;
+
+	if (pass_profiler)
+		pass_profiler->end(state.profile_event);
+}
+
+void Pass::for_each_module(RTLIL::Design *design, const std::vector<RTLIL::Module*> &modules, std::function<void(RTLIL::Module*)> worker)
+{
+	// design monitors, xtrace and memhasher all rely on observing changes in
+	// program order (module monitors only observe their own module, whose
+	// changes are still made in order by a single task)
+	bool parallel = module_parallel_flag && !yosys_xtrace && !memhasher_active && design->monitors.empty();
+
+	if (!parallel) {
+		for (auto module : modules)
+			worker(module);
+		return;
+	}
+
+	parallel_for(GetSize(modules), [&](int i) { worker(modules[i]); });
 }
 
 void Pass::help()
@@ -314,9 +336,16 @@ void Pass::call(RTLIL::Design *design, std::vector<std::string> args)
 		log_experimental("%s", args[0].c_str());
 
 	size_t orig_sel_stack_pos = design->selection_stack.size();
-	auto state = pass_register[args[0]]->pre_execute();
-	pass_register[args[0]]->execute(args, design);
-	pass_register[args[0]]->post_execute(state);
+	Pass *pass = pass_register[args[0]];
+	if (pass_profiler)
+		pass_profiler->set_command(args);
+	auto state = pass->pre_execute();
+	pass->execute(args, design);
+	pass->post_execute(state);
+	if (!pass->notifies_monitors_flag)
+		for (auto module : design->modules())
+			for (auto &it : module->owned_monitors)
+				it.second->notify_blackout(module);
 	while (design->selection_stack.size() > orig_sel_stack_pos)
 		design->selection_stack.pop_back();
 }
@@ -609,11 +638,15 @@ void Frontend::frontend_call(RTLIL::Design *design, std::istream *f, std::string
 		log_cmd_error("No such frontend: %s\n", args[0].c_str());
 
 	if (f != NULL) {
+		if (pass_profiler)
+			pass_profiler->set_command(args);
 		auto state = frontend_register[args[0]]->pre_execute();
 		frontend_register[args[0]]->execute(f, filename, args, design);
 		frontend_register[args[0]]->post_execute(state);
 	} else if (filename == "-") {
 		std::istream *f_cin = &std::cin;
+		if (pass_profiler)
+			pass_profiler->set_command(args);
 		auto state = frontend_register[args[0]]->pre_execute();
 		frontend_register[args[0]]->execute(f_cin, "<stdin>", args, design);
 		frontend_register[args[0]]->post_execute(state);
@@ -731,11 +764,15 @@ void Backend::backend_call(RTLIL::Design *design, std::ostream *f, std::string f
 	size_t orig_sel_stack_pos = design->selection_stack.size();
 
 	if (f != NULL) {
+		if (pass_profiler)
+			pass_profiler->set_command(args);
 		auto state = backend_register[args[0]]->pre_execute();
 		backend_register[args[0]]->execute(f, filename, args, design);
 		backend_register[args[0]]->post_execute(state);
 	} else if (filename == "-") {
 		std::ostream *f_cout = &std::cout;
+		if (pass_profiler)
+			pass_profiler->set_command(args);
 		auto state = backend_register[args[0]]->pre_execute();
 		backend_register[args[0]]->execute(f_cout, "<stdout>", args, design);
 		backend_register[args[0]]->post_execute(state);
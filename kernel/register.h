@@ -37,14 +37,33 @@ struct Pass
 	int call_counter;
 	int64_t runtime_ns;
 	bool experimental_flag = false;
+	bool module_parallel_flag = false;
+	bool notifies_monitors_flag = false;
 
 	void experimental() {
 		experimental_flag = true;
 	}
 
+	// Declares that the workers passed to for_each_module() only access the
+	// module they are called for, so that they can run concurrently.
+	void module_parallel() {
+		module_parallel_flag = true;
+	}
+
+	// Declares that the pass only changes modules through the RTLIL API
+	// calls that notify monitors, and does not rename or remove wires or
+	// cells otherwise. The monitors owned by the modules (such as the
+	// persistent ModIndex) then stay valid across the pass.
+	void notifies_monitors() {
+		notifies_monitors_flag = true;
+	}
+
+	void for_each_module(RTLIL::Design *design, const std::vector<RTLIL::Module*> &modules, std::function<void(RTLIL::Module*)> worker);
+
 	struct pre_post_exec_state_t {
 		Pass *parent_pass;
 		int64_t begin_ns;
+		int profile_event;
 	};
 
 	pre_post_exec_state_t pre_execute();
@@ -78,7 +97,8 @@ struct ScriptPass : Pass
 	RTLIL::Design *active_design;
 	std::string active_run_from, active_run_to;
 
-	ScriptPass(std::string name, std::string short_help = "** document me **") : Pass(name, short_help) { }
+	// the passes called by the script invalidate the owned monitors themselves
+	ScriptPass(std::string name, std::string short_help = "** document me **") : Pass(name, short_help) { notifies_monitors(); }
 
 	virtual void script() = 0;
 
@@ -24,31 +24,343 @@
 #include "frontends/verilog/verilog_frontend.h"
 #include "frontends/verilog/preproc.h"
 #include "backends/rtlil/rtlil_backend.h"
+#include "kernel/threading.h"
+#include "kernel/profile.h"
 
 #include <string.h>
 #include <algorithm>
+#ifndef YOSYS_DISABLE_THREADS
+#  include <mutex>
+#endif
 
 YOSYS_NAMESPACE_BEGIN
 
 bool RTLIL::IdString::destruct_guard_ok = false;
 RTLIL::IdString::destruct_guard_t RTLIL::IdString::destruct_guard;
-std::vector<char*> RTLIL::IdString::global_id_storage_;
-dict<char*, int, hash_cstr_ops> RTLIL::IdString::global_id_index_;
+char **RTLIL::IdString::global_id_storage_[RTLIL::IdString::max_chunks];
+std::atomic<int> *RTLIL::IdString::global_refcount_storage_[RTLIL::IdString::max_chunks];
+std::atomic<int> RTLIL::IdString::global_id_count_(1);
 #ifndef YOSYS_NO_IDS_REFCNT
-std::vector<int> RTLIL::IdString::global_refcount_storage_;
 std::vector<int> RTLIL::IdString::global_free_idx_list_;
 #endif
+bool RTLIL::IdString::permanent_port_names = false;
 #ifdef YOSYS_USE_STICKY_IDS
 int RTLIL::IdString::last_created_idx_[8];
 int RTLIL::IdString::last_created_idx_ptr_;
 #endif
 
+// The index from names to ids, split into shards that are selected by the top
+// bits of the hash of the name. Each shard is an open-addressing hash table
+// with linear probing, a slot holds the hash of the name in its upper and the
+// id in its lower 32 bits, or is zero if it is empty. Readers access the table
+// without a lock, writers hold the lock of the shard. A table that is replaced
+// while yosys_parallel_active is set is only freed when the workers are done.
+
+namespace {
+	struct IdIndexTable {
+		int mask, used;
+		std::atomic<uint64_t> *slots;
+	};
+
+	struct IdIndexShard {
+	#ifndef YOSYS_DISABLE_THREADS
+		std::mutex mutex;
+	#endif
+		std::atomic<IdIndexTable*> table{nullptr};
+	};
+
+#ifndef YOSYS_DISABLE_THREADS
+	// Holds the given mutex while yosys_parallel_active is set.
+	struct ParallelLock {
+		std::mutex *mutex;
+		ParallelLock(std::mutex &m) : mutex(yosys_parallel_active ? &m : nullptr) { if (mutex) mutex->lock(); }
+		~ParallelLock() { if (mutex) mutex->unlock(); }
+	};
+#endif
+}
+
+static const int id_index_shard_bits = 6;
+static IdIndexShard id_index_shards[1 << id_index_shard_bits];
+
+#ifndef YOSYS_DISABLE_THREADS
+static std::mutex id_alloc_mutex, id_deferred_mutex;
+#  define ID_PARALLEL_LOCK(_m) ParallelLock lock(_m)
+#else
+#  define ID_PARALLEL_LOCK(_m) do { } while (0)
+#endif
+static std::vector<int> id_deferred_free_list;
+static std::vector<IdIndexTable*> id_retired_tables;
+
+static inline unsigned int id_index_hash(const char *p)
+{
+	unsigned int h = hash_cstr_ops::hash(p);
+	h ^= h >> 16;
+	h *= 0x85ebca6b;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35;
+	h ^= h >> 16;
+	return h;
+}
+
+static inline IdIndexShard &id_index_shard(unsigned int hash)
+{
+	return id_index_shards[hash >> (32 - id_index_shard_bits)];
+}
+
+static int id_index_lookup(const IdIndexShard &shard, const char *p, unsigned int hash)
+{
+	IdIndexTable *table = shard.table.load(std::memory_order_acquire);
+	if (table == nullptr)
+		return 0;
+	for (int i = hash & table->mask;; i = (i + 1) & table->mask) {
+		uint64_t slot = table->slots[i].load(std::memory_order_acquire);
+		if (slot == 0)
+			return 0;
+		int idx = slot & 0xffffffff;
+		if ((slot >> 32) == hash && !strcmp(RTLIL::IdString::global_id(idx), p))
+			return idx;
+	}
+}
+
+static void id_index_put(IdIndexTable *table, uint64_t entry)
+{
+	int i = (entry >> 32) & table->mask;
+	while (table->slots[i].load(std::memory_order_relaxed) != 0)
+		i = (i + 1) & table->mask;
+	table->slots[i].store(entry, std::memory_order_release);
+	table->used++;
+}
+
+static void id_index_free_table(IdIndexTable *table)
+{
+	delete[] table->slots;
+	delete table;
+}
+
+static void id_index_insert(IdIndexShard &shard, int idx, unsigned int hash)
+{
+	IdIndexTable *table = shard.table.load(std::memory_order_relaxed);
+
+	if (table == nullptr || 4 * (table->used + 1) > 3 * (table->mask + 1))
+	{
+		int size = table ? 2 * (table->mask + 1) : 64;
+		IdIndexTable *new_table = new IdIndexTable;
+		new_table->mask = size - 1;
+		new_table->used = 0;
+		new_table->slots = new std::atomic<uint64_t>[size];
+		for (int i = 0; i < size; i++)
+			new_table->slots[i].store(0, std::memory_order_relaxed);
+
+		if (table != nullptr)
+			for (int i = 0; i <= table->mask; i++) {
+				uint64_t slot = table->slots[i].load(std::memory_order_relaxed);
+				if (slot != 0)
+					id_index_put(new_table, slot);
+			}
+
+		shard.table.store(new_table, std::memory_order_release);
+
+		if (table != nullptr) {
+			if (yosys_parallel_active) {
+				ID_PARALLEL_LOCK(id_deferred_mutex);
+				id_retired_tables.push_back(table);
+			} else
+				id_index_free_table(table);
+		}
+		table = new_table;
+	}
+
+	id_index_put(table, (uint64_t(hash) << 32) | idx);
+}
+
+#ifndef YOSYS_NO_IDS_REFCNT
+// Only called while yosys_parallel_active is not set, uses backward shift
+// deletion so that the table never contains tombstones.
+static void id_index_erase(IdIndexShard &shard, int idx, unsigned int hash)
+{
+	IdIndexTable *table = shard.table.load(std::memory_order_relaxed);
+	uint64_t entry = (uint64_t(hash) << 32) | idx;
+
+	int i = hash & table->mask;
+	while (table->slots[i].load(std::memory_order_relaxed) != entry)
+		i = (i + 1) & table->mask;
+
+	for (int j = (i + 1) & table->mask;; j = (j + 1) & table->mask) {
+		uint64_t slot = table->slots[j].load(std::memory_order_relaxed);
+		if (slot == 0)
+			break;
+		// move the entry to the hole unless its home slot lies in (i, j]
+		int home = (slot >> 32) & table->mask;
+		if (((j - home) & table->mask) >= ((j - i) & table->mask)) {
+			table->slots[i].store(slot, std::memory_order_relaxed);
+			i = j;
+		}
+	}
+
+	table->slots[i].store(0, std::memory_order_relaxed);
+	table->used--;
+}
+#endif
+
+static int id_alloc_index()
+{
+	ID_PARALLEL_LOCK(id_alloc_mutex);
+
+#ifndef YOSYS_NO_IDS_REFCNT
+	if (!RTLIL::IdString::global_free_idx_list_.empty()) {
+		int idx = RTLIL::IdString::global_free_idx_list_.back();
+		RTLIL::IdString::global_free_idx_list_.pop_back();
+		return idx;
+	}
+#endif
+
+	int idx = RTLIL::IdString::global_id_count_.load(std::memory_order_relaxed);
+	log_assert(idx < 0x40000000);
+
+	int chunk = idx >> RTLIL::IdString::chunk_bits;
+	if (RTLIL::IdString::global_id_storage_[chunk] == nullptr) {
+		int size = 1 << RTLIL::IdString::chunk_bits;
+		RTLIL::IdString::global_id_storage_[chunk] = new char*[size]();
+		RTLIL::IdString::global_refcount_storage_[chunk] = new std::atomic<int>[size];
+		for (int i = 0; i < size; i++)
+			RTLIL::IdString::global_refcount_storage_[chunk][i].store(0, std::memory_order_relaxed);
+	}
+
+	RTLIL::IdString::global_id_count_.store(idx + 1, std::memory_order_relaxed);
+	return idx;
+}
+
+int RTLIL::IdString::get_reference(const char *p)
+{
+	log_assert(destruct_guard_ok);
+
+	if (!p[0])
+		return 0;
+
+	unsigned int hash = id_index_hash(p);
+	IdIndexShard &shard = id_index_shard(hash);
+
+	int idx = id_index_lookup(shard, p, hash);
+	if (idx) {
+	#ifdef YOSYS_XTRACE_GET_PUT
+		if (yosys_xtrace)
+			log("#X# GET-BY-NAME '%s' (index %d, refcount %d)\n", global_id(idx), idx, int(global_refcount(idx)));
+	#endif
+		return get_reference(idx);
+	}
+
+	log_assert(p[0] == '$' || p[0] == '\\');
+	log_assert(p[1] != 0);
+	for (const char *c = p; *c; c++)
+		if ((unsigned)*c <= (unsigned)' ')
+			log_error("Found control character or space (0x%02x) in string '%s' which is not allowed in RTLIL identifiers\n", *c, p);
+
+	{
+		ID_PARALLEL_LOCK(shard.mutex);
+
+		// another thread may have created the name in the meantime
+		idx = id_index_lookup(shard, p, hash);
+		if (idx)
+			return get_reference(idx);
+
+		idx = id_alloc_index();
+		global_id(idx) = strdup(p);
+		global_refcount(idx).store(1, std::memory_order_relaxed);
+		id_index_insert(shard, idx, hash);
+	}
+
+	if (yosys_xtrace) {
+		log("#X# New IdString '%s' with index %d.\n", p, idx);
+		log_backtrace("-X- ", yosys_xtrace-1);
+	}
+
+#ifdef YOSYS_XTRACE_GET_PUT
+	if (yosys_xtrace)
+		log("#X# GET-BY-NAME '%s' (index %d, refcount %d)\n", global_id(idx), idx, int(global_refcount(idx)));
+#endif
+
+#ifdef YOSYS_USE_STICKY_IDS
+	// Avoid Create->Delete->Create pattern
+	if (last_created_idx_[last_created_idx_ptr_])
+		put_reference(last_created_idx_[last_created_idx_ptr_]);
+	last_created_idx_[last_created_idx_ptr_] = idx;
+	get_reference(last_created_idx_[last_created_idx_ptr_]);
+	last_created_idx_ptr_ = (last_created_idx_ptr_ + 1) & 7;
+#endif
+
+	return idx;
+}
+
+void RTLIL::IdString::make_permanent(int idx)
+{
+	if (idx)
+		global_refcount(idx).store(permanent_refcount, std::memory_order_relaxed);
+}
+
+RTLIL::IdString RTLIL::IdString::permanent(const char *str)
+{
+	IdString id(str);
+	make_permanent(id.index_);
+	return id;
+}
+
+#ifndef YOSYS_NO_IDS_REFCNT
+void RTLIL::IdString::free_reference(int idx)
+{
+	if (yosys_xtrace) {
+		log("#X# Removed IdString '%s' with index %d.\n", global_id(idx), idx);
+		log_backtrace("-X- ", yosys_xtrace-1);
+	}
+
+	char *p = global_id(idx);
+	unsigned int hash = id_index_hash(p);
+	id_index_erase(id_index_shard(hash), idx, hash);
+	free(p);
+	global_id(idx) = nullptr;
+	global_free_idx_list_.push_back(idx);
+}
+
+void RTLIL::IdString::defer_free_reference(int idx)
+{
+	ID_PARALLEL_LOCK(id_deferred_mutex);
+	id_deferred_free_list.push_back(idx);
+}
+#endif
+
+void RTLIL::IdString::free_deferred_references()
+{
+	log_assert(!yosys_parallel_active);
+
+	for (auto table : id_retired_tables)
+		id_index_free_table(table);
+	id_retired_tables.clear();
+
+#ifndef YOSYS_NO_IDS_REFCNT
+	// an index may be listed more than once, and names may have been
+	// referenced again after their count dropped to zero
+	for (int idx : id_deferred_free_list)
+		if (global_id(idx) != nullptr && global_refcount(idx).load(std::memory_order_relaxed) == 0)
+			free_reference(idx);
+	id_deferred_free_list.clear();
+#endif
+}
+
 #define X(_id) IdString RTLIL::ID::_id;
 #include "kernel/constids.inc"
 #undef X
 
 dict<std::string, std::string> RTLIL::constpad;
 
+// Objects created by a parallel task take their hash index from the task, so
+// that the iteration order of hashlib containers does not depend on scheduling.
+static unsigned int next_hashidx(unsigned int &hashidx_count)
+{
+	if (parallel_task != nullptr)
+		return parallel_task->hashidx = mkhash_xorshift(parallel_task->hashidx);
+	hashidx_count = mkhash_xorshift(hashidx_count);
+	return hashidx_count;
+}
+
 const pool<IdString> &RTLIL::builtin_ff_cell_types() {
 	static const pool<IdString> res = {
 		ID($sr),
@@ -281,17 +593,10 @@ int RTLIL::Const::as_int(bool is_signed) const
 
 std::string RTLIL::Const::as_string() const
 {
-	std::string ret;
-	ret.reserve(bits.size());
-	for (size_t i = bits.size(); i > 0; i--)
-		switch (bits[i-1]) {
-			case S0: ret += "0"; break;
-			case S1: ret += "1"; break;
-			case Sx: ret += "x"; break;
-			case Sz: ret += "z"; break;
-			case Sa: ret += "-"; break;
-			case Sm: ret += "m"; break;
-		}
+	static const char state_chars[] = "01xz-m";
+	std::string ret(bits.size(), 0);
+	for (size_t i = 0, n = bits.size(); i < n; i++)
+		ret[n-1-i] = state_chars[bits[i]];
 	return ret;
 }
 
@@ -606,8 +911,7 @@ RTLIL::Design::Design()
   : verilog_defines (new define_map_t)
 {
 	static unsigned int hashidx_count = 123456789;
-	hashidx_count = mkhash_xorshift(hashidx_count);
-	hashidx_ = hashidx_count;
+	hashidx_ = next_hashidx(hashidx_count);
 
 	refcount_modules_ = 0;
 	selection_stack.push_back(RTLIL::Selection());
@@ -906,8 +1210,7 @@ std::vector<RTLIL::Module*> RTLIL::Design::selected_whole_modules_warn(bool incl
 RTLIL::Module::Module()
 {
 	static unsigned int hashidx_count = 123456789;
-	hashidx_count = mkhash_xorshift(hashidx_count);
-	hashidx_ = hashidx_count;
+	hashidx_ = next_hashidx(hashidx_count);
 
 	design = nullptr;
 	refcount_wires_ = 0;
@@ -920,6 +1223,8 @@ RTLIL::Module::Module()
 
 RTLIL::Module::~Module()
 {
+	for (auto &pr : owned_monitors)
+		delete pr.second;
 	for (auto &pr : wires_)
 		delete pr.second;
 	for (auto &pr : memories)
@@ -979,6 +1284,11 @@ bool RTLIL::Module::reprocess_if_necessary(RTLIL::Design *)
 	return false;
 }
 
+RTLIL::Module *RTLIL::Module::derive_detached(RTLIL::Design*, const dict<RTLIL::IdString, RTLIL::Const> &)
+{
+	return nullptr;
+}
+
 RTLIL::IdString RTLIL::Module::derive(RTLIL::Design*, const dict<RTLIL::IdString, RTLIL::Const> &, bool mayfail)
 {
 	if (mayfail)
@@ -1992,7 +2302,7 @@ void RTLIL::Module::cloneInto(RTLIL::Module *new_mod) const
 		RTLIL::Module *mod;
 		void operator()(RTLIL::SigSpec &sig)
 		{
-			sig.pack();
+			sig.modify_chunks();
 			for (auto &c : sig.chunks_)
 				if (c.wire != NULL)
 					c.wire = mod->wires_.at(c.wire->name);
@@ -2099,18 +2409,18 @@ void RTLIL::Module::remove(const pool<RTLIL::Wire*> &wires)
 		const pool<RTLIL::Wire*> *wires_p;
 
 		void operator()(RTLIL::SigSpec &sig) {
-			sig.pack();
+			sig.modify_chunks();
 			for (auto &c : sig.chunks_)
 				if (c.wire != NULL && wires_p->count(c.wire)) {
-					c.wire = module->addWire(stringf("$delete_wire$%d", autoidx++), c.width);
+					c.wire = module->addWire("$delete_wire$" + next_autoidx(), c.width);
 					c.offset = 0;
 				}
 		}
 
 		void operator()(RTLIL::SigSpec &lhs, RTLIL::SigSpec &rhs) {
 			log_assert(GetSize(lhs) == GetSize(rhs));
-			lhs.unpack();
-			rhs.unpack();
+			lhs.modify_bits();
+			rhs.modify_bits();
 			for (int i = 0; i < GetSize(lhs); i++) {
 				RTLIL::SigBit &lhs_bit = lhs.bits_[i];
 				RTLIL::SigBit &rhs_bit = rhs.bits_[i];
@@ -2321,6 +2631,8 @@ void RTLIL::Module::fixup_ports()
 	for (size_t i = 0; i < all_ports.size(); i++) {
 		ports.push_back(all_ports[i]->name);
 		all_ports[i]->port_id = i+1;
+		if (RTLIL::IdString::permanent_port_names)
+			RTLIL::IdString::make_permanent(all_ports[i]->name.index_);
 	}
 }
 
@@ -3249,8 +3561,7 @@ RTLIL::SigSpec RTLIL::Module::Initstate(RTLIL::IdString name, const std::string
 RTLIL::Wire::Wire()
 {
 	static unsigned int hashidx_count = 123456789;
-	hashidx_count = mkhash_xorshift(hashidx_count);
-	hashidx_ = hashidx_count;
+	hashidx_ = next_hashidx(hashidx_count);
 
 	module = nullptr;
 	width = 1;
@@ -3261,6 +3572,9 @@ RTLIL::Wire::Wire()
 	upto = false;
 	is_signed = false;
 
+	if (pass_profiler)
+		pass_profiler->wires_created.fetch_add(1, std::memory_order_relaxed);
+
 #ifdef WITH_PYTHON
 	RTLIL::Wire::get_all_wires()->insert(std::pair<unsigned int, RTLIL::Wire*>(hashidx_, this));
 #endif
@@ -3268,6 +3582,9 @@ RTLIL::Wire::Wire()
 
 RTLIL::Wire::~Wire()
 {
+	if (pass_profiler)
+		pass_profiler->wires_destroyed.fetch_add(1, std::memory_order_relaxed);
+
 #ifdef WITH_PYTHON
 	RTLIL::Wire::get_all_wires()->erase(hashidx_);
 #endif
@@ -3284,8 +3601,7 @@ std::map<unsigned int, RTLIL::Wire*> *RTLIL::Wire::get_all_wires(void)
 RTLIL::Memory::Memory()
 {
 	static unsigned int hashidx_count = 123456789;
-	hashidx_count = mkhash_xorshift(hashidx_count);
-	hashidx_ = hashidx_count;
+	hashidx_ = next_hashidx(hashidx_count);
 
 	width = 1;
 	start_offset = 0;
@@ -3298,19 +3614,20 @@ RTLIL::Memory::Memory()
 RTLIL::Process::Process() : module(nullptr)
 {
 	static unsigned int hashidx_count = 123456789;
-	hashidx_count = mkhash_xorshift(hashidx_count);
-	hashidx_ = hashidx_count;
+	hashidx_ = next_hashidx(hashidx_count);
 }
 
 RTLIL::Cell::Cell() : module(nullptr)
 {
 	static unsigned int hashidx_count = 123456789;
-	hashidx_count = mkhash_xorshift(hashidx_count);
-	hashidx_ = hashidx_count;
+	hashidx_ = next_hashidx(hashidx_count);
 
 	// log("#memtrace# %p\n", this);
 	memhasher();
 
+	if (pass_profiler)
+		pass_profiler->cells_created.fetch_add(1, std::memory_order_relaxed);
+
 #ifdef WITH_PYTHON
 	RTLIL::Cell::get_all_cells()->insert(std::pair<unsigned int, RTLIL::Cell*>(hashidx_, this));
 #endif
@@ -3318,6 +3635,9 @@ RTLIL::Cell::Cell() : module(nullptr)
 
 RTLIL::Cell::~Cell()
 {
+	if (pass_profiler)
+		pass_profiler->cells_destroyed.fetch_add(1, std::memory_order_relaxed);
+
 #ifdef WITH_PYTHON
 	RTLIL::Cell::get_all_cells()->erase(hashidx_);
 #endif
@@ -3808,19 +4128,15 @@ void RTLIL::SigSpec::pack() const
 {
 	RTLIL::SigSpec *that = (RTLIL::SigSpec*)this;
 
-	if (that->bits_.empty())
+	if (packed())
 		return;
 
 	cover("kernel.rtlil.sigspec.convert.pack");
-	log_assert(that->chunks_.empty());
-
-	std::vector<RTLIL::SigBit> old_bits;
-	old_bits.swap(that->bits_);
 
 	RTLIL::SigChunk *last = NULL;
 	int last_end_offset = 0;
 
-	for (auto &bit : old_bits) {
+	for (auto &bit : that->bits_) {
 		if (last && bit.wire == last->wire) {
 			if (bit.wire == NULL) {
 				last->data.push_back(bit.data);
@@ -3844,19 +4160,15 @@ void RTLIL::SigSpec::unpack() const
 {
 	RTLIL::SigSpec *that = (RTLIL::SigSpec*)this;
 
-	if (that->chunks_.empty())
+	if (unpacked())
 		return;
 
 	cover("kernel.rtlil.sigspec.convert.unpack");
-	log_assert(that->bits_.empty());
 
 	that->bits_.reserve(that->width_);
 	for (auto &c : that->chunks_)
 		for (int i = 0; i < c.width; i++)
 			that->bits_.emplace_back(c, i);
-
-	that->chunks_.clear();
-	that->hash_ = 0;
 }
 
 void RTLIL::SigSpec::updhash() const
@@ -3867,18 +4179,39 @@ void RTLIL::SigSpec::updhash() const
 		return;
 
 	cover("kernel.rtlil.sigspec.hash");
-	that->pack();
 
 	that->hash_ = mkhash_init;
-	for (auto &c : that->chunks_)
-		if (c.wire == NULL) {
-			for (auto &v : c.data)
-				that->hash_ = mkhash(that->hash_, v);
-		} else {
-			that->hash_ = mkhash(that->hash_, c.wire->name.index_);
-			that->hash_ = mkhash(that->hash_, c.offset);
-			that->hash_ = mkhash(that->hash_, c.width);
+	if (packed())
+	{
+		for (auto &c : that->chunks_)
+			if (c.wire == NULL) {
+				for (auto &v : c.data)
+					that->hash_ = mkhash(that->hash_, v);
+			} else {
+				that->hash_ = mkhash(that->hash_, c.wire->name.index_);
+				that->hash_ = mkhash(that->hash_, c.offset);
+				that->hash_ = mkhash(that->hash_, c.width);
+			}
+	}
+	else
+	{
+		// same value as above, for the chunks that pack() would create
+		for (int i = 0; i < width_; ) {
+			const RTLIL::SigBit &bit = bits_[i];
+			if (bit.wire == NULL) {
+				that->hash_ = mkhash(that->hash_, bit.data);
+				i++;
+				continue;
+			}
+			int width = 1;
+			while (i + width < width_ && bits_[i + width].wire == bit.wire && bits_[i + width].offset == bit.offset + width)
+				width++;
+			that->hash_ = mkhash(that->hash_, bit.wire->name.index_);
+			that->hash_ = mkhash(that->hash_, bit.offset);
+			that->hash_ = mkhash(that->hash_, width);
+			i += width;
 		}
+	}
 
 	if (that->hash_ == 0)
 		that->hash_ = 1;
@@ -3886,7 +4219,7 @@ void RTLIL::SigSpec::updhash() const
 
 void RTLIL::SigSpec::sort()
 {
-	unpack();
+	modify_bits();
 	cover("kernel.rtlil.sigspec.sort");
 	std::sort(bits_.begin(), bits_.end());
 }
@@ -3921,7 +4254,7 @@ void RTLIL::SigSpec::replace(const RTLIL::SigSpec &pattern, const RTLIL::SigSpec
 	pattern.unpack();
 	with.unpack();
 	unpack();
-	other->unpack();
+	other->modify_bits();
 
 	for (int i = 0; i < GetSize(pattern.bits_); i++) {
 		if (pattern.bits_[i].wire != NULL) {
@@ -3950,7 +4283,7 @@ void RTLIL::SigSpec::replace(const dict<RTLIL::SigBit, RTLIL::SigBit> &rules, RT
 
 	if (rules.empty()) return;
 	unpack();
-	other->unpack();
+	other->modify_bits();
 
 	for (int i = 0; i < GetSize(bits_); i++) {
 		auto it = rules.find(bits_[i]);
@@ -3975,7 +4308,7 @@ void RTLIL::SigSpec::replace(const std::map<RTLIL::SigBit, RTLIL::SigBit> &rules
 
 	if (rules.empty()) return;
 	unpack();
-	other->unpack();
+	other->modify_bits();
 
 	for (int i = 0; i < GetSize(bits_); i++) {
 		auto it = rules.find(bits_[i]);
@@ -4004,10 +4337,10 @@ void RTLIL::SigSpec::remove2(const RTLIL::SigSpec &pattern, RTLIL::SigSpec *othe
 	else
 		cover("kernel.rtlil.sigspec.remove");
 
-	unpack();
+	modify_bits();
 	if (other != NULL) {
 		log_assert(width_ == other->width_);
-		other->unpack();
+		other->modify_bits();
 	}
 
 	for (int i = GetSize(bits_) - 1; i >= 0; i--)
@@ -4049,11 +4382,11 @@ void RTLIL::SigSpec::remove2(const pool<RTLIL::SigBit> &pattern, RTLIL::SigSpec
 	else
 		cover("kernel.rtlil.sigspec.remove");
 
-	unpack();
+	modify_bits();
 
 	if (other != NULL) {
 		log_assert(width_ == other->width_);
-		other->unpack();
+		other->modify_bits();
 	}
 
 	for (int i = GetSize(bits_) - 1; i >= 0; i--) {
@@ -4077,11 +4410,11 @@ void RTLIL::SigSpec::remove2(const std::set<RTLIL::SigBit> &pattern, RTLIL::SigS
 	else
 		cover("kernel.rtlil.sigspec.remove");
 
-	unpack();
+	modify_bits();
 
 	if (other != NULL) {
 		log_assert(width_ == other->width_);
-		other->unpack();
+		other->modify_bits();
 	}
 
 	for (int i = GetSize(bits_) - 1; i >= 0; i--) {
@@ -4164,7 +4497,7 @@ void RTLIL::SigSpec::replace(int offset, const RTLIL::SigSpec &with)
 {
 	cover("kernel.rtlil.sigspec.replace_pos");
 
-	unpack();
+	modify_bits();
 	with.unpack();
 
 	log_assert(offset >= 0);
@@ -4183,6 +4516,7 @@ void RTLIL::SigSpec::remove_const()
 	{
 		cover("kernel.rtlil.sigspec.remove_const.packed");
 
+		modify_chunks();
 		std::vector<RTLIL::SigChunk> new_chunks;
 		new_chunks.reserve(GetSize(chunks_));
 
@@ -4205,6 +4539,7 @@ void RTLIL::SigSpec::remove_const()
 	{
 		cover("kernel.rtlil.sigspec.remove_const.unpacked");
 
+		modify_bits();
 		std::vector<RTLIL::SigBit> new_bits;
 		new_bits.reserve(width_);
 
@@ -4223,7 +4558,7 @@ void RTLIL::SigSpec::remove(int offset, int length)
 {
 	cover("kernel.rtlil.sigspec.remove_pos");
 
-	unpack();
+	modify_bits();
 
 	log_assert(offset >= 0);
 	log_assert(length >= 0);
@@ -4237,9 +4572,38 @@ void RTLIL::SigSpec::remove(int offset, int length)
 
 RTLIL::SigSpec RTLIL::SigSpec::extract(int offset, int length) const
 {
-	unpack();
-	cover("kernel.rtlil.sigspec.extract_pos");
-	return std::vector<RTLIL::SigBit>(bits_.begin() + offset, bits_.begin() + offset + length);
+	log_assert(offset >= 0);
+	log_assert(length >= 0);
+	log_assert(offset + length <= width_);
+
+	if (unpacked()) {
+		cover("kernel.rtlil.sigspec.extract_pos");
+		return std::vector<RTLIL::SigBit>(bits_.begin() + offset, bits_.begin() + offset + length);
+	}
+
+	// slices of the chunks of a packed SigSpec cannot be merged with each
+	// other, so they can be used as the chunks of the result directly
+	cover("kernel.rtlil.sigspec.extract_pos.packed");
+
+	RTLIL::SigSpec ret;
+	int pos = 0;
+	for (auto &c : chunks_) {
+		if (pos >= offset + length)
+			break;
+		if (pos + c.width > offset) {
+			int begin = max(offset - pos, 0);
+			int end = min(offset + length - pos, c.width);
+			if (begin == 0 && end == c.width)
+				ret.chunks_.push_back(c);
+			else
+				ret.chunks_.push_back(c.extract(begin, end - begin));
+		}
+		pos += c.width;
+	}
+	ret.width_ = length;
+
+	ret.check();
+	return ret;
 }
 
 void RTLIL::SigSpec::append(const RTLIL::SigSpec &signal)
@@ -4254,9 +4618,12 @@ void RTLIL::SigSpec::append(const RTLIL::SigSpec &signal)
 
 	cover("kernel.rtlil.sigspec.append");
 
-	if (packed() != signal.packed()) {
-		pack();
+	if (packed()) {
+		modify_chunks();
 		signal.pack();
+	} else {
+		modify_bits();
+		signal.unpack();
 	}
 
 	if (packed())
@@ -4283,9 +4650,12 @@ void RTLIL::SigSpec::append(const RTLIL::SigSpec &signal)
 
 void RTLIL::SigSpec::append(const RTLIL::SigBit &bit)
 {
+	hash_ = 0;
+
 	if (packed())
 	{
 		cover("kernel.rtlil.sigspec.append_bit.packed");
+		bits_.clear();
 
 		if (chunks_.size() == 0)
 			chunks_.push_back(bit);
@@ -4374,9 +4744,9 @@ void RTLIL::SigSpec::check(Module *mod) const
 			w += chunk.width;
 		}
 		log_assert(w == width_);
-		log_assert(bits_.empty());
 	}
-	else
+
+	if (width_ <= 64 && unpacked())
 	{
 		cover("kernel.rtlil.sigspec.check.unpacked");
 
@@ -4387,7 +4757,13 @@ void RTLIL::SigSpec::check(Module *mod) const
 		}
 
 		log_assert(width_ == GetSize(bits_));
-		log_assert(chunks_.empty());
+
+		if (packed()) {
+			int i = 0;
+			for (auto &chunk : chunks_)
+				for (int j = 0; j < chunk.width; j++)
+					log_assert(bits_[i++] == RTLIL::SigBit(chunk, j));
+		}
 	}
 }
 #endif
@@ -4440,6 +4816,23 @@ bool RTLIL::SigSpec::operator ==(const RTLIL::SigSpec &other) const
 	if (width_ == 0)
 		return true;
 
+	if (!packed() && !other.packed())
+	{
+		updhash();
+		other.updhash();
+
+		if (hash_ != other.hash_)
+			return false;
+
+		if (bits_ != other.bits_) {
+			cover("kernel.rtlil.sigspec.comp_eq.hash_collision");
+			return false;
+		}
+
+		cover("kernel.rtlil.sigspec.comp_eq.equal");
+		return true;
+	}
+
 	pack();
 	other.pack();
 
@@ -84,6 +84,15 @@ namespace RTLIL
 		#undef YOSYS_NO_IDS_REFCNT
 
 		// the global id string cache
+		//
+		// The strings and reference counts are stored in chunks of 2^16 entries
+		// that are never moved or freed, so c_str() and the reference counting do
+		// not need a lock. The string-to-index hash table is split into shards
+		// (see rtlil.cc): looking up an existing name is lock-free, only the
+		// creation of a new name locks its shard. While module-parallel workers
+		// are running (yosys_parallel_active) the reference counts are updated
+		// atomically, and names whose count drops to zero are only freed after
+		// the workers have finished (free_deferred_references()).
 
 		static bool destruct_guard_ok; // POD, will be initialized to zero
 		static struct destruct_guard_t {
@@ -91,27 +100,45 @@ namespace RTLIL
 			~destruct_guard_t() { destruct_guard_ok = false; }
 		} destruct_guard;
 
-		static std::vector<char*> global_id_storage_;
-		static dict<char*, int, hash_cstr_ops> global_id_index_;
+		static constexpr int chunk_bits = 16;
+		static constexpr int chunk_mask = (1 << chunk_bits) - 1;
+		static constexpr int max_chunks = 0x40000000 >> chunk_bits;
+
+		static char **global_id_storage_[max_chunks];
+		static std::atomic<int> *global_refcount_storage_[max_chunks];
+		static std::atomic<int> global_id_count_;
 	#ifndef YOSYS_NO_IDS_REFCNT
-		static std::vector<int> global_refcount_storage_;
 		static std::vector<int> global_free_idx_list_;
 	#endif
 
+		// A negative reference count marks a name that is never freed. This is
+		// used for the ID::* constants and the ID() macro, and for the names of
+		// module ports when permanent_port_names is set.
+		static constexpr int permanent_refcount = INT_MIN / 2;
+		static bool permanent_port_names;
+
 	#ifdef YOSYS_USE_STICKY_IDS
 		static int last_created_idx_ptr_;
 		static int last_created_idx_[8];
 	#endif
 
+		static inline char *&global_id(int idx) {
+			return global_id_storage_[idx >> chunk_bits][idx & chunk_mask];
+		}
+
+		static inline std::atomic<int> &global_refcount(int idx) {
+			return global_refcount_storage_[idx >> chunk_bits][idx & chunk_mask];
+		}
+
 		static inline void xtrace_db_dump()
 		{
 		#ifdef YOSYS_XTRACE_GET_PUT
-			for (int idx = 0; idx < GetSize(global_id_storage_); idx++)
+			for (int idx = 1; idx < global_id_count_; idx++)
 			{
-				if (global_id_storage_.at(idx) == nullptr)
+				if (global_id(idx) == nullptr)
 					log("#X# DB-DUMP index %d: FREE\n", idx);
 				else
-					log("#X# DB-DUMP index %d: '%s' (ref %d)\n", idx, global_id_storage_.at(idx), global_refcount_storage_.at(idx));
+					log("#X# DB-DUMP index %d: '%s' (ref %d)\n", idx, global_id(idx), int(global_refcount(idx)));
 			}
 		#endif
 		}
@@ -135,125 +162,68 @@ namespace RTLIL
 		{
 			if (idx) {
 		#ifndef YOSYS_NO_IDS_REFCNT
-				global_refcount_storage_[idx]++;
+				std::atomic<int> &refcount = global_refcount(idx);
+				int count = refcount.load(std::memory_order_relaxed);
+				if (count >= 0) {
+					if (yosys_parallel_active)
+						refcount.fetch_add(1, std::memory_order_relaxed);
+					else
+						refcount.store(count + 1, std::memory_order_relaxed);
+				}
 		#endif
 		#ifdef YOSYS_XTRACE_GET_PUT
 				if (yosys_xtrace)
-					log("#X# GET-BY-INDEX '%s' (index %d, refcount %d)\n", global_id_storage_.at(idx), idx, global_refcount_storage_.at(idx));
+					log("#X# GET-BY-INDEX '%s' (index %d, refcount %d)\n", global_id(idx), idx, int(global_refcount(idx)));
 		#endif
 			}
 			return idx;
 		}
 
-		static int get_reference(const char *p)
-		{
-			log_assert(destruct_guard_ok);
-
-			if (!p[0])
-				return 0;
-
-			auto it = global_id_index_.find((char*)p);
-			if (it != global_id_index_.end()) {
-		#ifndef YOSYS_NO_IDS_REFCNT
-				global_refcount_storage_.at(it->second)++;
-		#endif
-		#ifdef YOSYS_XTRACE_GET_PUT
-				if (yosys_xtrace)
-					log("#X# GET-BY-NAME '%s' (index %d, refcount %d)\n", global_id_storage_.at(it->second), it->second, global_refcount_storage_.at(it->second));
-		#endif
-				return it->second;
-			}
-
-			log_assert(p[0] == '$' || p[0] == '\\');
-			log_assert(p[1] != 0);
-			for (const char *c = p; *c; c++)
-				if ((unsigned)*c <= (unsigned)' ')
-					log_error("Found control character or space (0x%02x) in string '%s' which is not allowed in RTLIL identifiers\n", *c, p);
-
-		#ifndef YOSYS_NO_IDS_REFCNT
-			if (global_free_idx_list_.empty()) {
-				if (global_id_storage_.empty()) {
-					global_refcount_storage_.push_back(0);
-					global_id_storage_.push_back((char*)"");
-					global_id_index_[global_id_storage_.back()] = 0;
-				}
-				log_assert(global_id_storage_.size() < 0x40000000);
-				global_free_idx_list_.push_back(global_id_storage_.size());
-				global_id_storage_.push_back(nullptr);
-				global_refcount_storage_.push_back(0);
-			}
-
-			int idx = global_free_idx_list_.back();
-			global_free_idx_list_.pop_back();
-			global_id_storage_.at(idx) = strdup(p);
-			global_id_index_[global_id_storage_.at(idx)] = idx;
-			global_refcount_storage_.at(idx)++;
-		#else
-			if (global_id_storage_.empty()) {
-				global_id_storage_.push_back((char*)"");
-				global_id_index_[global_id_storage_.back()] = 0;
-			}
-			int idx = global_id_storage_.size();
-			global_id_storage_.push_back(strdup(p));
-			global_id_index_[global_id_storage_.back()] = idx;
-		#endif
-
-			if (yosys_xtrace) {
-				log("#X# New IdString '%s' with index %d.\n", p, idx);
-				log_backtrace("-X- ", yosys_xtrace-1);
-			}
-
-		#ifdef YOSYS_XTRACE_GET_PUT
-			if (yosys_xtrace)
-				log("#X# GET-BY-NAME '%s' (index %d, refcount %d)\n", global_id_storage_.at(idx), idx, global_refcount_storage_.at(idx));
-		#endif
+		static int get_reference(const char *p);
 
-		#ifdef YOSYS_USE_STICKY_IDS
-			// Avoid Create->Delete->Create pattern
-			if (last_created_idx_[last_created_idx_ptr_])
-				put_reference(last_created_idx_[last_created_idx_ptr_]);
-			last_created_idx_[last_created_idx_ptr_] = idx;
-			get_reference(last_created_idx_[last_created_idx_ptr_]);
-			last_created_idx_ptr_ = (last_created_idx_ptr_ + 1) & 7;
-		#endif
+		// Marks a name as permanent, see permanent_refcount.
+		static void make_permanent(int idx);
+		static IdString permanent(const char *str);
 
-			return idx;
-		}
+		// Frees the names whose reference count dropped to zero while
+		// yosys_parallel_active was set. Called by parallel_for().
+		static void free_deferred_references();
 
 	#ifndef YOSYS_NO_IDS_REFCNT
 		static inline void put_reference(int idx)
 		{
 			// put_reference() may be called from destructors after the destructor of
-			// global_refcount_storage_ has been run. in this case we simply do nothing.
+			// global_free_idx_list_ has been run. in this case we simply do nothing.
 			if (!destruct_guard_ok || !idx)
 				return;
 
 		#ifdef YOSYS_XTRACE_GET_PUT
 			if (yosys_xtrace) {
-				log("#X# PUT '%s' (index %d, refcount %d)\n", global_id_storage_.at(idx), idx, global_refcount_storage_.at(idx));
+				log("#X# PUT '%s' (index %d, refcount %d)\n", global_id(idx), idx, int(global_refcount(idx)));
 			}
 		#endif
 
-			int &refcount = global_refcount_storage_[idx];
+			std::atomic<int> &refcount = global_refcount(idx);
+			int count = refcount.load(std::memory_order_relaxed);
 
-			if (--refcount > 0)
+			if (count < 0)
 				return;
 
-			log_assert(refcount == 0);
-			free_reference(idx);
-		}
-		static inline void free_reference(int idx)
-		{
-			if (yosys_xtrace) {
-				log("#X# Removed IdString '%s' with index %d.\n", global_id_storage_.at(idx), idx);
-				log_backtrace("-X- ", yosys_xtrace-1);
+			if (yosys_parallel_active) {
+				if (refcount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+					defer_free_reference(idx);
+				return;
 			}
 
-			global_id_index_.erase(global_id_storage_.at(idx));
-			free(global_id_storage_.at(idx));
-			global_id_storage_.at(idx) = nullptr;
-			global_free_idx_list_.push_back(idx);
+			refcount.store(--count, std::memory_order_relaxed);
+			if (count > 0)
+				return;
+
+			log_assert(count == 0);
+			free_reference(idx);
 		}
+		static void free_reference(int idx);
+		static void defer_free_reference(int idx);
 	#else
 		static inline void put_reference(int) { }
 	#endif
@@ -285,11 +255,11 @@ namespace RTLIL
 		}
 
 		inline const char *c_str() const {
-			return global_id_storage_.at(index_);
+			return index_ ? global_id(index_) : "";
 		}
 
 		inline std::string str() const {
-			return std::string(global_id_storage_.at(index_));
+			return std::string(c_str());
 		}
 
 		inline bool operator<(const IdString &rhs) const {
@@ -708,7 +678,7 @@ struct RTLIL::Const
 	inline unsigned int hash() const {
 		unsigned int h = mkhash_init;
 		for (auto b : bits)
-			mkhash(h, b);
+			h = mkhash(h, b);
 		return h;
 	}
 };
@@ -826,6 +796,13 @@ struct RTLIL::SigSpec
 private:
 	int width_;
 	unsigned long hash_;
+
+	// A SigSpec is stored as chunks (packed) and/or as bits (unpacked): each
+	// vector is valid if it is not empty (both are valid if width_ is zero).
+	// Read-only access creates the missing representation and keeps the other
+	// one, so that alternating calls to chunks() and bits() do not convert
+	// back and forth. Modifications go through modify_chunks() or
+	// modify_bits(), which drop the other representation and the hash.
 	std::vector<RTLIL::SigChunk> chunks_; // LSB at index 0
 	std::vector<RTLIL::SigBit> bits_; // LSB at index 0
 
@@ -834,14 +811,30 @@ private:
 	void updhash() const;
 
 	inline bool packed() const {
-		return bits_.empty();
+		return !chunks_.empty() || width_ == 0;
+	}
+
+	inline bool unpacked() const {
+		return !bits_.empty() || width_ == 0;
 	}
 
 	inline void inline_unpack() const {
-		if (!chunks_.empty())
+		if (!unpacked())
 			unpack();
 	}
 
+	inline void modify_chunks() {
+		pack();
+		bits_.clear();
+		hash_ = 0;
+	}
+
+	inline void modify_bits() {
+		inline_unpack();
+		chunks_.clear();
+		hash_ = 0;
+	}
+
 	// Only used by Module::remove(const pool<Wire*> &wires)
 	// but cannot be more specific as it isn't yet declared
 	friend struct RTLIL::Module;
@@ -850,6 +843,32 @@ public:
 	SigSpec() : width_(0), hash_(0) {}
 	SigSpec(std::initializer_list<RTLIL::SigSpec> parts);
 
+	// A moved-from SigSpec is left empty. With the default move operations
+	// it would keep its width without bits or chunks, and hashlib hashes
+	// the moved-from key after inserting into an empty pool.
+	SigSpec(const RTLIL::SigSpec &other) = default;
+	SigSpec(RTLIL::SigSpec &&other) : width_(other.width_), hash_(other.hash_),
+			chunks_(std::move(other.chunks_)), bits_(std::move(other.bits_)) {
+		other.width_ = 0;
+		other.hash_ = 0;
+		other.chunks_.clear();
+		other.bits_.clear();
+	}
+	RTLIL::SigSpec &operator=(const RTLIL::SigSpec &other) = default;
+	RTLIL::SigSpec &operator=(RTLIL::SigSpec &&other) {
+		if (this != &other) {
+			width_ = other.width_;
+			hash_ = other.hash_;
+			chunks_ = std::move(other.chunks_);
+			bits_ = std::move(other.bits_);
+			other.width_ = 0;
+			other.hash_ = 0;
+			other.chunks_.clear();
+			other.bits_.clear();
+		}
+		return *this;
+	}
+
 	SigSpec(const RTLIL::Const &value);
 	SigSpec(RTLIL::Const &&value);
 	SigSpec(const RTLIL::SigChunk &chunk);
@@ -877,7 +896,7 @@ public:
 	inline int size() const { return width_; }
 	inline bool empty() const { return width_ == 0; }
 
-	inline RTLIL::SigBit &operator[](int index) { inline_unpack(); return bits_.at(index); }
+	inline RTLIL::SigBit &operator[](int index) { modify_bits(); return bits_.at(index); }
 	inline const RTLIL::SigBit &operator[](int index) const { inline_unpack(); return bits_.at(index); }
 
 	inline RTLIL::SigSpecIterator begin() { RTLIL::SigSpecIterator it; it.sig_p = this; it.index = 0; return it; }
@@ -930,7 +949,7 @@ public:
 
 	RTLIL::SigSpec repeat(int num) const;
 
-	void reverse() { inline_unpack(); std::reverse(bits_.begin(), bits_.end()); }
+	void reverse() { modify_bits(); std::reverse(bits_.begin(), bits_.end()); }
 
 	bool operator <(const RTLIL::SigSpec &other) const;
 	bool operator ==(const RTLIL::SigSpec &other) const;
@@ -1018,9 +1037,9 @@ struct RTLIL::Monitor
 	unsigned int hash() const { return hashidx_; }
 
 	Monitor() {
-		static unsigned int hashidx_count = 123456789;
-		hashidx_count = mkhash_xorshift(hashidx_count);
-		hashidx_ = hashidx_count;
+		// monitors may be created by module-parallel passes
+		static std::atomic<unsigned int> hashidx_count(123456789);
+		hashidx_ = mkhash_xorshift(hashidx_count++);
 	}
 
 	virtual ~Monitor() { }
@@ -1151,6 +1170,12 @@ public:
 	RTLIL::Design *design;
 	pool<RTLIL::Monitor*> monitors;
 
+	// Monitors that are owned by the module and deleted with it, such as the
+	// persistent ModIndex (see ModIndex::get()). They are sent a blackout
+	// notification after each pass that may have changed the module without
+	// notifying monitors (see Pass::notifies_monitors()).
+	dict<RTLIL::IdString, RTLIL::Monitor*> owned_monitors;
+
 	int refcount_wires_;
 	int refcount_cells_;
 
@@ -1170,6 +1195,12 @@ public:
 	virtual ~Module();
 	virtual RTLIL::IdString derive(RTLIL::Design *design, const dict<RTLIL::IdString, RTLIL::Const> &parameters, bool mayfail = false);
 	virtual RTLIL::IdString derive(RTLIL::Design *design, const dict<RTLIL::IdString, RTLIL::Const> &parameters, const dict<RTLIL::IdString, RTLIL::Module*> &interfaces, const dict<RTLIL::IdString, RTLIL::IdString> &modports, bool mayfail = false);
+	// Elaborates the module derive() would add to the design for the given
+	// parameters, and returns it without adding it. Returns nullptr if there
+	// is nothing to elaborate or this is not supported, derive() then has to
+	// be used. Does not modify the design, so that calls for different
+	// modules or parameters can run in parallel tasks (kernel/threading.h).
+	virtual RTLIL::Module *derive_detached(RTLIL::Design *design, const dict<RTLIL::IdString, RTLIL::Const> &parameters);
 	virtual size_t count_id(const RTLIL::IdString& id);
 	virtual void expand_interfaces(RTLIL::Design *design, const dict<RTLIL::IdString, RTLIL::Module *> &local_interfaces);
 	virtual bool reprocess_if_necessary(RTLIL::Design *design);
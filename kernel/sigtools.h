@@ -309,8 +309,14 @@ struct SigMap
 
 	void apply(RTLIL::SigSpec &sig) const
 	{
-		for (auto &bit : sig)
-			apply(bit);
+		// only modify the SigSpec (and drop its chunks and hash) if a bit
+		// actually changes, most signals are mapped to themselves
+		const RTLIL::SigSpec &csig = sig;
+		int i = 0, n = GetSize(csig);
+		while (i < n && database.find(csig[i]) == csig[i])
+			i++;
+		for (; i < n; i++)
+			apply(sig[i]);
 	}
 
 	RTLIL::SigBit operator()(RTLIL::SigBit bit) const
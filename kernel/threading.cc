@@ -0,0 +1,272 @@
+/*
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ */
+
+#include "kernel/threading.h"
+
+YOSYS_NAMESPACE_BEGIN
+
+int yosys_threads = 1;
+thread_local ParallelTask *parallel_task = nullptr;
+
+#ifndef YOSYS_DISABLE_THREADS
+
+ThreadPool::ThreadPool(int num_threads)
+{
+	for (int i = 1; i < num_threads; i++)
+		threads.emplace_back([this]() { thread_main(); });
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		shutdown = true;
+	}
+	work_cv.notify_all();
+	for (auto &t : threads)
+		t.join();
+}
+
+void ThreadPool::work()
+{
+	for (int i; (i = next_index++) < job_size; )
+		(*job)(i);
+}
+
+void ThreadPool::thread_main()
+{
+	unsigned int seen_generation = 0;
+	while (1)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			work_cv.wait(lock, [&]() { return shutdown || generation != seen_generation; });
+			if (shutdown)
+				return;
+			seen_generation = generation;
+		}
+
+		work();
+
+		std::lock_guard<std::mutex> lock(mutex);
+		if (--pending == 0)
+			done_cv.notify_one();
+	}
+}
+
+void ThreadPool::run(int n, const std::function<void(int)> &worker)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		job = &worker;
+		job_size = n;
+		next_index = 0;
+		pending = GetSize(threads);
+		generation++;
+	}
+	work_cv.notify_all();
+
+	work();
+
+	std::unique_lock<std::mutex> lock(mutex);
+	done_cv.wait(lock, [&]() { return pending == 0; });
+	job = nullptr;
+}
+
+static ThreadPool *thread_pool = nullptr;
+
+static ThreadPool &get_thread_pool(int num_threads)
+{
+	if (thread_pool != nullptr && thread_pool->size() != num_threads) {
+		delete thread_pool;
+		thread_pool = nullptr;
+	}
+	if (thread_pool == nullptr)
+		thread_pool = new ThreadPool(num_threads);
+	return *thread_pool;
+}
+
+void parallel_shutdown()
+{
+	delete thread_pool;
+	thread_pool = nullptr;
+}
+
+static void wait_a_little(int &waited)
+{
+	if (waited++ < 100)
+		std::this_thread::yield();
+	else
+		std::this_thread::sleep_for(std::chrono::microseconds(50));
+}
+
+ByteQueue::ByteQueue(size_t capacity) : head(0), tail(0), closed(false)
+{
+	size_t size = 4096;
+	while (size < capacity)
+		size *= 2;
+	buffer.resize(size);
+	mask = size - 1;
+}
+
+void ByteQueue::write(const void *data, size_t size)
+{
+	const char *p = (const char *)data;
+	size_t h = head.load(std::memory_order_relaxed);
+	int waited = 0;
+	while (size > 0) {
+		size_t free = capacity() - (h - tail.load(std::memory_order_acquire));
+		if (free == 0) {
+			if (waited == 0)
+				num_stalls++;
+			wait_a_little(waited);
+			continue;
+		}
+		size_t n = std::min({size, free, capacity() - (h & mask)});
+		memcpy(buffer.data() + (h & mask), p, n);
+		h += n;
+		p += n;
+		size -= n;
+		head.store(h, std::memory_order_release);
+		waited = 0;
+	}
+}
+
+void ByteQueue::close()
+{
+	closed.store(true, std::memory_order_release);
+}
+
+bool ByteQueue::read(void *data, size_t size)
+{
+	char *p = (char *)data;
+	size_t t = tail.load(std::memory_order_relaxed);
+	int waited = 0;
+	while (size > 0) {
+		// check `closed` first, the data written before close() is visible then
+		bool was_closed = closed.load(std::memory_order_acquire);
+		size_t avail = head.load(std::memory_order_acquire) - t;
+		if (avail == 0) {
+			if (was_closed)
+				return false;
+			wait_a_little(waited);
+			continue;
+		}
+		size_t n = std::min({size, avail, capacity() - (t & mask)});
+		memcpy(p, buffer.data() + (t & mask), n);
+		t += n;
+		p += n;
+		size -= n;
+		tail.store(t, std::memory_order_release);
+		waited = 0;
+	}
+	return true;
+}
+
+#else
+
+void parallel_shutdown()
+{
+}
+
+#endif
+
+static void run_tasks(int n, const std::function<void(int)> &worker, int num_threads, bool reserve_autoidx)
+{
+	// a single task would run on its own anyway, it uses the global state
+	if (parallel_task != nullptr || n <= 1 || (num_threads <= 1 && !reserve_autoidx)) {
+		for (int i = 0; i < n; i++)
+			worker(i);
+		return;
+	}
+
+	std::vector<ParallelTask> tasks(n);
+	for (int i = 0; i < n; i++) {
+		auto &task = tasks[i];
+		task.index = i;
+		task.autoidx = reserve_autoidx ? autoidx++ : -1;
+		task.autoidx_sub = 0;
+		task.hashidx = mkhash_xorshift(mkhash(123456789, reserve_autoidx ? task.autoidx : i)) | 1;
+	}
+
+#ifndef YOSYS_DISABLE_THREADS
+	if (num_threads > 1 && n > 1)
+	{
+		int make_debug = log_make_debug;
+
+		auto run_task = [&](int i) {
+			auto &task = tasks[i];
+			int bak_log_make_debug = log_make_debug;
+			int bak_log_debug_suppressed = log_debug_suppressed;
+			log_make_debug = make_debug;
+			log_debug_suppressed = 0;
+			parallel_task = &task;
+			log_capture = &task.log;
+			try {
+				worker(i);
+			} catch (...) {
+				task.error = std::current_exception();
+			}
+			log_capture = nullptr;
+			parallel_task = nullptr;
+			task.log.debug_suppressed += log_debug_suppressed;
+			log_make_debug = bak_log_make_debug;
+			log_debug_suppressed = bak_log_debug_suppressed;
+		};
+
+		yosys_parallel_active = true;
+		get_thread_pool(num_threads).run(n, run_task);
+		yosys_parallel_active = false;
+		RTLIL::IdString::free_deferred_references();
+
+		for (auto &task : tasks)
+			task.log.replay();
+
+		for (auto &task : tasks)
+			if (task.error)
+				std::rethrow_exception(task.error);
+		return;
+	}
+#endif
+
+	// The same tasks one after the other, logging directly. Generated names
+	// are the same as with threads.
+	for (int i = 0; i < n; i++) {
+		parallel_task = &tasks[i];
+		try {
+			worker(i);
+		} catch (...) {
+			parallel_task = nullptr;
+			throw;
+		}
+		parallel_task = nullptr;
+	}
+}
+
+void parallel_for(int n, const std::function<void(int)> &worker, int num_threads)
+{
+	run_tasks(n, worker, num_threads, true);
+}
+
+void parallel_for_unnamed(int n, const std::function<void(int)> &worker, int num_threads)
+{
+	run_tasks(n, worker, num_threads, false);
+}
+
+YOSYS_NAMESPACE_END
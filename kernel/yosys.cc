@@ -19,6 +19,7 @@
 
 #include "kernel/yosys.h"
 #include "kernel/celltypes.h"
+#include "kernel/threading.h"
 
 #ifdef YOSYS_ENABLE_READLINE
 #  include <readline/readline.h>
@@ -78,6 +79,7 @@
 YOSYS_NAMESPACE_BEGIN
 
 int autoidx = 1;
+bool yosys_parallel_active = false;
 int yosys_xtrace = 0;
 RTLIL::Design *yosys_design = NULL;
 CellTypes yosys_celltypes;
@@ -416,6 +418,16 @@ std::string get_base_tmpdir()
 	return tmpdir;
 }
 
+std::string get_mem_tmpdir()
+{
+#ifdef __linux__
+	char *var = std::getenv("TMPDIR");
+	if ((var == nullptr || strlen(var) == 0) && access("/dev/shm", W_OK | X_OK) == 0)
+		return "/dev/shm";
+#endif
+	return get_base_tmpdir();
+}
+
 std::string make_temp_file(std::string template_str)
 {
 	size_t pos = template_str.rfind("XXXXXX");
@@ -547,7 +559,7 @@ void yosys_setup()
 	init_share_dirname();
 	init_abc_executable_name();
 
-#define X(_id) RTLIL::ID::_id = "\\" # _id;
+#define X(_id) RTLIL::ID::_id = RTLIL::IdString::permanent("\\" # _id);
 #include "kernel/constids.inc"
 #undef X
 
@@ -578,6 +590,7 @@ void yosys_shutdown()
 	already_shutdown = true;
 	log_pop();
 
+	parallel_shutdown();
 	Pass::done_register();
 
 	delete yosys_design;
@@ -631,7 +644,7 @@ RTLIL::IdString new_id(std::string file, int line, std::string func)
 	if (pos != std::string::npos)
 		func = func.substr(pos+1);
 
-	return stringf("$auto$%s:%d:%s$%d", file.c_str(), line, func.c_str(), autoidx++);
+	return stringf("$auto$%s:%d:%s$%s", file.c_str(), line, func.c_str(), next_autoidx().c_str());
 }
 
 RTLIL::IdString new_id_suffix(std::string file, int line, std::string func, std::string suffix)
@@ -648,7 +661,16 @@ RTLIL::IdString new_id_suffix(std::string file, int line, std::string func, std:
 	if (pos != std::string::npos)
 		func = func.substr(pos+1);
 
-	return stringf("$auto$%s:%d:%s$%s$%d", file.c_str(), line, func.c_str(), suffix.c_str(), autoidx++);
+	return stringf("$auto$%s:%d:%s$%s$%s", file.c_str(), line, func.c_str(), suffix.c_str(), next_autoidx().c_str());
+}
+
+std::string next_autoidx()
+{
+	if (parallel_task != nullptr) {
+		log_assert(parallel_task->autoidx >= 0);
+		return stringf("%d.%d", parallel_task->autoidx, parallel_task->autoidx_sub++);
+	}
+	return stringf("%d", autoidx++);
 }
 
 RTLIL::Design *yosys_get_design()
@@ -53,6 +53,7 @@
 #include <memory>
 #include <cmath>
 #include <cstddef>
+#include <atomic>
 
 #include <sstream>
 #include <fstream>
@@ -60,6 +61,10 @@
 #include <ostream>
 #include <iostream>
 
+#ifndef YOSYS_DISABLE_THREADS
+#  include <mutex>
+#endif
+
 #include <stdarg.h>
 #include <stdlib.h>
 #include <string.h>
@@ -282,6 +287,9 @@ bool patmatch(const char *pattern, const char *string);
 int run_command(const std::string &command, std::function<void(const std::string&)> process_line = std::function<void(const std::string&)>());
 #endif
 std::string get_base_tmpdir();
+// like get_base_tmpdir(), but prefers a memory-backed file system (/dev/shm)
+// unless TMPDIR is set
+std::string get_mem_tmpdir();
 std::string make_temp_file(std::string template_str = get_base_tmpdir() + "/yosys_XXXXXX");
 std::string make_temp_dir(std::string template_str = get_base_tmpdir() + "/yosys_XXXXXX");
 bool check_file_exists(std::string filename, bool is_exec = false);
@@ -295,6 +303,9 @@ inline int GetSize(RTLIL::Wire *wire);
 extern int autoidx;
 extern int yosys_xtrace;
 
+// Set while the worker threads of parallel_for() (kernel/threading.h) are running.
+extern bool yosys_parallel_active;
+
 YOSYS_NAMESPACE_END
 
 #include "kernel/log.h"
@@ -328,6 +339,10 @@ extern RTLIL::Design *yosys_design;
 RTLIL::IdString new_id(std::string file, int line, std::string func);
 RTLIL::IdString new_id_suffix(std::string file, int line, std::string func, std::string suffix);
 
+// Returns the next value of autoidx as used in generated names. Inside of a
+// parallel task (kernel/threading.h) this is "<task autoidx>.<n>" instead.
+std::string next_autoidx();
+
 #define NEW_ID \
 	YOSYS_NAMESPACE_PREFIX new_id(__FILE__, __LINE__, __FUNCTION__)
 #define NEW_ID_SUFFIX(suffix) \
@@ -342,7 +357,7 @@ RTLIL::IdString new_id_suffix(std::string file, int line, std::string func, std:
 //  sed -i.orig -r 's/"\\\\([a-zA-Z0-9_]+)"/ID(\1)/g; s/"(\$[a-zA-Z0-9_]+)"/ID(\1)/g;' <filename>
 //
 #define ID(_id) ([]() { const char *p = "\\" #_id, *q = p[1] == '$' ? p+1 : p; \
-        static const YOSYS_NAMESPACE_PREFIX RTLIL::IdString id(q); return id; })()
+        static const YOSYS_NAMESPACE_PREFIX RTLIL::IdString id = YOSYS_NAMESPACE_PREFIX RTLIL::IdString::permanent(q); return id; })()
 namespace ID = RTLIL::ID;
 
 RTLIL::Design *yosys_get_design();
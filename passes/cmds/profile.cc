@@ -0,0 +1,124 @@
+/*
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ */
+
+#include "kernel/yosys.h"
+#include "kernel/profile.h"
+#include "kernel/json.h"
+
+USING_YOSYS_NAMESPACE
+PRIVATE_NAMESPACE_BEGIN
+
+struct ProfilePass : public Pass {
+	ProfilePass() : Pass("profile", "run command and record a profile of all passes") { }
+	void help() override
+	{
+		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
+		log("\n");
+		log("    profile [options] cmd\n");
+		log("\n");
+		log("Execute the specified command and record the following for it and for each\n");
+		log("pass it calls (such as the steps of a synth_* script):\n");
+		log("\n");
+		log("  - the wall-clock time, and the time not spent in nested passes (self),\n");
+		log("  - the increase of the peak resident set size of the process,\n");
+		log("  - the number of cells and wires created and destroyed,\n");
+		log("  - the number of calls to malloc(), calloc() and realloc(), if yosys was\n");
+		log("    started with tests/bench/malloc_count.so in LD_PRELOAD.\n");
+		log("\n");
+		log("The profile is logged as a table with one line per pass invocation, nested\n");
+		log("passes are indented.\n");
+		log("\n");
+		log("    -json <filename>\n");
+		log("        write the profile to the given file in JSON format.\n");
+		log("\n");
+		log("    -trace <filename>\n");
+		log("        write the profile to the given file in the Chrome trace event\n");
+		log("        format, for viewing in chrome://tracing or Perfetto.\n");
+		log("\n");
+		log("    -q\n");
+		log("        do not log the profile.\n");
+		log("\n");
+	}
+	void execute(std::vector<std::string> args, RTLIL::Design *design) override
+	{
+		std::string json_filename, trace_filename;
+		bool quiet = false;
+
+		size_t argidx;
+		for (argidx = 1; argidx < args.size(); argidx++)
+		{
+			if (args[argidx] == "-json" && argidx+1 < args.size()) {
+				json_filename = args[++argidx];
+				continue;
+			}
+			if (args[argidx] == "-trace" && argidx+1 < args.size()) {
+				trace_filename = args[++argidx];
+				continue;
+			}
+			if (args[argidx] == "-q") {
+				quiet = true;
+				continue;
+			}
+			break;
+		}
+
+		std::vector<std::string> new_args(args.begin() + argidx, args.end());
+
+		// the outer profile already includes the passes of this command
+		if (pass_profiler) {
+			Pass::call(design, new_args);
+			return;
+		}
+
+		PassProfiler profiler;
+		pass_profiler = &profiler;
+
+		try {
+			Pass::call(design, new_args);
+		} catch (...) {
+			pass_profiler = nullptr;
+			throw;
+		}
+
+		profiler.end_all();
+		pass_profiler = nullptr;
+
+		log_header(design, "Pass profile.\n");
+		if (!quiet)
+			profiler.log_report();
+
+		if (!json_filename.empty()) {
+			PrettyJson json;
+			if (!json.write_to_file(json_filename))
+				log_error("Can't open file `%s' for writing: %s\n", json_filename.c_str(), strerror(errno));
+			profiler.write_json(json);
+			log("Wrote profile to `%s'.\n", json_filename.c_str());
+		}
+
+		if (!trace_filename.empty()) {
+			PrettyJson json;
+			if (!json.write_to_file(trace_filename))
+				log_error("Can't open file `%s' for writing: %s\n", trace_filename.c_str(), strerror(errno));
+			profiler.write_trace(json);
+			log("Wrote trace to `%s'.\n", trace_filename.c_str());
+		}
+	}
+} ProfilePass;
+
+PRIVATE_NAMESPACE_END
@@ -325,24 +325,23 @@ statdata_t hierarchy_worker(std::map<RTLIL::IdString, statdata_t> &mod_stat, RTL
 	return mod_data;
 }
 
-void read_liberty_cellarea(dict<IdString, double> &cell_area, string liberty_file)
+void read_liberty_cellarea(dict<IdString, double> &cell_area, string liberty_file, const pool<IdString> &cell_types)
 {
-	std::ifstream f;
-	f.open(liberty_file.c_str());
 	yosys_input_files.insert(liberty_file);
-	if (f.fail())
-		log_cmd_error("Can't open liberty file `%s': %s\n", liberty_file.c_str(), strerror(errno));
-	LibertyParser libparser(f);
-	f.close();
+	std::shared_ptr<LibertyParser> libparser = LibertyParser::load(liberty_file);
 
-	for (auto cell : libparser.ast->children)
+	for (auto type : cell_types)
 	{
-		if (cell->id != "cell" || cell->args.size() != 1)
+		if (!type.begins_with("\\"))
+			continue;
+
+		LibertyAst *cell = libparser->cell(type.str().substr(1));
+		if (cell == nullptr)
 			continue;
 
 		LibertyAst *ar = cell->find("area");
 		if (ar != nullptr && !ar->value.empty())
-			cell_area["\\" + cell->args[0]] = atof(ar->value.c_str());
+			cell_area[type] = atof(ar->value.c_str());
 	}
 }
 
@@ -384,6 +383,7 @@ struct StatPass : public Pass {
 		RTLIL::Module *top_mod = nullptr;
 		std::map<RTLIL::IdString, statdata_t> mod_stat;
 		dict<IdString, double> cell_area;
+		std::vector<string> liberty_files;
 		string techname;
 
 		size_t argidx;
@@ -396,7 +396,7 @@ struct StatPass : public Pass {
 			if (args[argidx] == "-liberty" && argidx+1 < args.size()) {
 				string liberty_file = args[++argidx];
 				rewrite_filename(liberty_file);
-				read_liberty_cellarea(cell_area, liberty_file);
+				liberty_files.push_back(liberty_file);
 				continue;
 			}
 			if (args[argidx] == "-tech" && argidx+1 < args.size()) {
@@ -417,6 +417,15 @@ struct StatPass : public Pass {
 		}
 		extra_args(args, argidx, design);
 
+		if (!liberty_files.empty()) {
+			pool<IdString> cell_types;
+			for (auto mod : design->selected_modules())
+				for (auto cell : mod->selected_cells())
+					cell_types.insert(cell->type);
+			for (auto &liberty_file : liberty_files)
+				read_liberty_cellarea(cell_area, liberty_file, cell_types);
+		}
+
 		if(!json_mode)
 			log_header(design, "Printing statistics.\n");
 
@@ -19,6 +19,8 @@
  */
 
 #include "kernel/yosys.h"
+#include "kernel/threading.h"
+#include "frontends/ast/ast.h"
 #include "frontends/verific/verific.h"
 #include <stdlib.h>
 #include <stdio.h>
@@ -715,6 +717,95 @@ RTLIL::Wire *find_implicit_port_wire(Module *module, Cell *cell, const std::stri
 	return module->wire(port);
 }
 
+// Elaborate the parametric modules that expand_module() is going to derive
+// for the cells of the given modules in tasks (in parallel with "yosys -j"),
+// and add them to the design in a deterministic order. expand_module() then
+// finds the derived modules in the design. Cells that may involve interfaces
+// are left to expand_module(). This does not depend on the number of
+// threads, so that the generated names do not either.
+void derive_parallel(RTLIL::Design *design, const std::set<RTLIL::Module*, IdString::compare_ptr_by_name<Module>> &modules)
+{
+	if (yosys_xtrace || memhasher_active)
+		return;
+
+	for (auto mod : design->modules())
+		if (mod->get_bool_attribute(ID::is_interface))
+			return;
+
+	struct DeriveJob {
+		RTLIL::Module *mod;
+		const dict<RTLIL::IdString, RTLIL::Const> *parameters;
+		RTLIL::Module *result;
+	};
+	std::vector<DeriveJob> jobs;
+	pool<std::string> seen;
+
+	for (auto module : modules)
+	for (auto cell : module->cells())
+	{
+		if (cell->type.begins_with("$array:"))
+			continue;
+
+		RTLIL::Module *mod = design->module(cell->type);
+		if (mod == nullptr)
+			mod = design->module("$abstract" + cell->type.str());
+		else if (cell->parameters.empty())
+			continue;
+		if (mod == nullptr || mod->get_blackbox_attribute())
+			continue;
+
+		std::string key = mod->name.str();
+		for (auto &it : cell->parameters)
+			key += stringf(" %s=%d:%s", it.first.c_str(), it.second.flags, it.second.as_string().c_str());
+		if (!seen.insert(key).second)
+			continue;
+
+		jobs.push_back({mod, &cell->parameters, nullptr});
+	}
+
+	if (GetSize(jobs) < 2)
+		return;
+
+	parallel_for(GetSize(jobs), [&](int i) {
+		jobs[i].result = jobs[i].mod->derive_detached(design, *jobs[i].parameters);
+	});
+
+	for (auto &job : jobs) {
+		if (job.result == nullptr)
+			continue;
+		// different spellings of the same parameters (by name or position)
+		if (design->has(job.result->name))
+			delete job.result;
+		else
+			design->add(job.result);
+	}
+}
+
+// Enables the elaboration cache of the AST frontend while in scope.
+struct ElabCacheScope
+{
+	ElabCacheScope(const std::string &dir)
+	{
+		if (!dir.empty() && !check_file_exists(dir))
+			log_cmd_error("Elaboration cache directory `%s' does not exist.\n", dir.c_str());
+		AST::elab_cache_dir = dir;
+		AST::elab_cache_hits = 0;
+		AST::elab_cache_misses = 0;
+	}
+
+	~ElabCacheScope()
+	{
+		AST::elab_cache_dir.clear();
+	}
+
+	void log_stats()
+	{
+		if (!AST::elab_cache_dir.empty())
+			log("Elaboration cache `%s': %d hits, %d misses.\n", AST::elab_cache_dir.c_str(),
+					int(AST::elab_cache_hits), int(AST::elab_cache_misses));
+	}
+};
+
 struct HierarchyPass : public Pass {
 	HierarchyPass() : Pass("hierarchy", "check, expand and clean up design hierarchy") { }
 	void help() override
@@ -730,6 +821,9 @@ struct HierarchyPass : public Pass {
 		log("needed. It also resolves assignments to wired logic data types (wand/wor),\n");
 		log("resolves positional module parameters, unrolls array instances, and more.\n");
 		log("\n");
+		log("With 'yosys -j <N>', the parametric modules needed on each level of the\n");
+		log("hierarchy are elaborated in parallel (unless the design uses interfaces).\n");
+		log("\n");
 		log("    -check\n");
 		log("        also check the design hierarchy. this generates an error when\n");
 		log("        an unknown module is used as cell type.\n");
@@ -778,6 +872,16 @@ struct HierarchyPass : public Pass {
 		log("    -auto-top\n");
 		log("        automatically determine the top of the design hierarchy and mark it.\n");
 		log("\n");
+		log("    -elab_cache <directory>\n");
+		log("        store the RTLIL of the parametric modules elaborated by the Verilog\n");
+		log("        frontend in the given (existing) directory, and load them from there\n");
+		log("        instead of elaborating them again when the module source, the\n");
+		log("        parameters, the frontend options and the yosys version match. Modules\n");
+		log("        whose elaboration looks up other modules (e.g. to determine port\n");
+		log("        widths) are not stored. The number of cache hits and misses is\n");
+		log("        logged at the end. The directory can also be set with the scratchpad\n");
+		log("        variable 'hierarchy.elab_cache'.\n");
+		log("\n");
 		log("    -chparam name value \n");
 		log("       elaborate the top module using this parameter value. Modules on which\n");
 		log("       this parameter does not exist may cause a warning message to be output.\n");
@@ -822,6 +926,7 @@ struct HierarchyPass : public Pass {
 		std::vector<std::string> generate_cells;
 		std::vector<generate_port_decl_t> generate_ports;
 		std::map<std::string, std::string> parameters;
+		std::string elab_cache_dir = design->scratchpad_get_string("hierarchy.elab_cache");
 
 		size_t argidx;
 		for (argidx = 1; argidx < args.size(); argidx++)
@@ -911,6 +1016,10 @@ struct HierarchyPass : public Pass {
 				auto_top_mode = true;
 				continue;
 			}
+			if (args[argidx] == "-elab_cache" && argidx+1 < args.size()) {
+				elab_cache_dir = args[++argidx];
+				continue;
+			}
 			if (args[argidx] == "-chparam"  && argidx+2 < args.size()) {
 				const std::string &key = args[++argidx];
 				const std::string &value = args[++argidx];
@@ -925,6 +1034,8 @@ struct HierarchyPass : public Pass {
 		}
 		extra_args(args, argidx, design, false);
 
+		ElabCacheScope elab_cache(elab_cache_dir);
+
 		if (!load_top_mod.empty())
 		{
 			IdString top_name = RTLIL::escape_id(load_top_mod);
@@ -1047,6 +1158,8 @@ struct HierarchyPass : public Pass {
 					used_modules.insert(mod);
 			}
 
+			derive_parallel(design, used_modules);
+
 			for (auto module : used_modules) {
 				if (expand_module(design, module, flag_check, flag_simcheck, flag_smtcheck, libdirs))
 					did_something = true;
@@ -1434,6 +1547,7 @@ struct HierarchyPass : public Pass {
 		for (auto module : blackbox_derivatives)
 			design->remove(module);
 
+		elab_cache.log_stats();
 		log_pop();
 	}
 } HierarchyPass;
@@ -26,7 +26,7 @@ USING_YOSYS_NAMESPACE
 PRIVATE_NAMESPACE_BEGIN
 
 struct OptPass : public Pass {
-	OptPass() : Pass("opt", "perform simple optimizations") { }
+	OptPass() : Pass("opt", "perform simple optimizations") { notifies_monitors(); }
 	void help() override
 	{
 		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
@@ -62,6 +62,10 @@ struct OptPass : public Pass {
 		log("Note: Options in square brackets (such as [-keepdc]) are passed through to\n");
 		log("the opt_* commands when given to 'opt'.\n");
 		log("\n");
+		log("When called with -incremental, all calls of opt_expr use the -incremental\n");
+		log("option, so that after the first call only the cells affected by the changes of\n");
+		log("the other passes are revisited.\n");
+		log("\n");
 		log("\n");
 	}
 	void execute(std::vector<std::string> args, RTLIL::Design *design) override
@@ -74,6 +78,7 @@ struct OptPass : public Pass {
 		bool opt_share = false;
 		bool fast_mode = false;
 		bool noff_mode = false;
+		bool incremental = false;
 
 		log_header(design, "Executing OPT pass (performing simple optimizations).\n");
 		log_push();
@@ -141,10 +146,32 @@ struct OptPass : public Pass {
 				noff_mode = true;
 				continue;
 			}
+			if (args[argidx] == "-incremental") {
+				incremental = true;
+				continue;
+			}
 			break;
 		}
 		extra_args(args, argidx, design);
 
+		// removes the worklists of opt_expr when done, also if a pass throws
+		struct IncrementalGuard {
+			RTLIL::Design *design = nullptr;
+			~IncrementalGuard() {
+				if (design != nullptr)
+					for (auto module : design->modules())
+						if (module->owned_monitors.count(ID(OptExprWorklist))) {
+							delete module->owned_monitors.at(ID(OptExprWorklist));
+							module->owned_monitors.erase(ID(OptExprWorklist));
+						}
+			}
+		} incremental_guard;
+
+		if (incremental) {
+			opt_expr_args += " -incremental";
+			incremental_guard.design = design;
+		}
+
 		if (fast_mode)
 		{
 			while (1) {
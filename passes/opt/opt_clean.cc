@@ -25,6 +25,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <set>
+#include <atomic>
 
 USING_YOSYS_NAMESPACE
 PRIVATE_NAMESPACE_BEGIN
@@ -40,6 +41,11 @@ struct keep_cache_t
 	{
 		this->design = design;
 		cache.clear();
+
+		// fill the cache upfront, so that module-parallel workers only read it
+		if (design != nullptr)
+			for (auto module : design->modules())
+				query(module);
 	}
 
 	bool query(Module *module)
@@ -94,7 +100,8 @@ struct keep_cache_t
 
 keep_cache_t keep_cache;
 CellTypes ct_reg, ct_all;
-int count_rm_cells, count_rm_wires;
+std::atomic<int> count_rm_cells, count_rm_wires;
+std::atomic<bool> design_did_something;
 
 void rmunused_module_cells(Module *module, bool verbose)
 {
@@ -197,7 +204,7 @@ void rmunused_module_cells(Module *module, bool verbose)
 	for (auto cell : unused) {
 		if (verbose)
 			log_debug("  removing unused `%s' cell `%s'.\n", cell->type.c_str(), cell->name.c_str());
-		module->design->scratchpad_set_bool("opt.did_something", true);
+		design_did_something = true;
 		if (RTLIL::builtin_ff_cell_types().count(cell->type))
 			ffinit.remove_init(cell->getPort(ID::Q));
 		module->remove(cell);
@@ -329,7 +336,14 @@ bool rmunused_module_signals(RTLIL::Module *module, bool purge_mode, bool verbos
 		}
 	}
 
-	module->connections_.clear();
+	// The cell ports are remapped in place below. Monitors (such as the
+	// worklists of "opt_expr -incremental") are still told about it.
+	bool notify_monitors = !module->monitors.empty() || !module->design->monitors.empty();
+
+	if (notify_monitors)
+		module->new_connections(std::vector<RTLIL::SigSig>());
+	else
+		module->connections_.clear();
 
 	SigPool used_signals;
 	SigPool raw_used_signals;
@@ -337,7 +351,17 @@ bool rmunused_module_signals(RTLIL::Module *module, bool purge_mode, bool verbos
 	for (auto &it : module->cells_) {
 		RTLIL::Cell *cell = it.second;
 		for (auto &it2 : cell->connections_) {
-			assign_map.apply(it2.second);
+			if (notify_monitors) {
+				RTLIL::SigSpec old_sig = it2.second;
+				assign_map.apply(it2.second);
+				if (it2.second != old_sig) {
+					for (auto mon : module->monitors)
+						mon->notify_connect(cell, it2.first, old_sig, it2.second);
+					for (auto mon : module->design->monitors)
+						mon->notify_connect(cell, it2.first, old_sig, it2.second);
+				}
+			} else
+				assign_map.apply(it2.second);
 			raw_used_signals.add(it2.second);
 			used_signals.add(it2.second);
 			if (!ct_all.cell_output(cell->type, it2.first))
@@ -482,7 +506,7 @@ bool rmunused_module_signals(RTLIL::Module *module, bool purge_mode, bool verbos
 		log_debug("  removed %d unused temporary wires.\n", del_temp_wires_count);
 
 	if (!del_wires_queue.empty())
-		module->design->scratchpad_set_bool("opt.did_something", true);
+		design_did_something = true;
 
 	return !del_wires_queue.empty();
 }
@@ -563,7 +587,7 @@ bool rmunused_module_init(RTLIL::Module *module, bool verbose)
 	}
 
 	if (did_something)
-		module->design->scratchpad_set_bool("opt.did_something", true);
+		design_did_something = true;
 
 	return did_something;
 }
@@ -590,7 +614,7 @@ void rmunused_module(RTLIL::Module *module, bool purge_mode, bool verbose, bool
 		module->remove(cell);
 	}
 	if (!delcells.empty())
-		module->design->scratchpad_set_bool("opt.did_something", true);
+		design_did_something = true;
 
 	rmunused_module_cells(module, verbose);
 	while (rmunused_module_signals(module, purge_mode, verbose)) { }
@@ -600,7 +624,7 @@ void rmunused_module(RTLIL::Module *module, bool purge_mode, bool verbose, bool
 }
 
 struct OptCleanPass : public Pass {
-	OptCleanPass() : Pass("opt_clean", "remove unused cells and wires") { }
+	OptCleanPass() : Pass("opt_clean", "remove unused cells and wires") { module_parallel(); notifies_monitors(); }
 	void help() override
 	{
 		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
@@ -645,15 +669,21 @@ struct OptCleanPass : public Pass {
 
 		count_rm_cells = 0;
 		count_rm_wires = 0;
+		design_did_something = false;
 
-		for (auto module : design->selected_whole_modules_warn()) {
-			if (module->has_processes_warn())
-				continue;
+		std::vector<RTLIL::Module*> modules;
+		for (auto module : design->selected_whole_modules_warn())
+			if (!module->has_processes_warn())
+				modules.push_back(module);
+
+		for_each_module(design, modules, [&](RTLIL::Module *module) {
 			rmunused_module(module, purge_mode, true, true);
-		}
+		});
 
+		if (design_did_something)
+			design->scratchpad_set_bool("opt.did_something", true);
 		if (count_rm_cells > 0 || count_rm_wires > 0)
-			log("Removed %d unused cells and %d unused wires.\n", count_rm_cells, count_rm_wires);
+			log("Removed %d unused cells and %d unused wires.\n", int(count_rm_cells), int(count_rm_wires));
 
 		design->optimize();
 		design->sort();
@@ -667,7 +697,7 @@ struct OptCleanPass : public Pass {
 } OptCleanPass;
 
 struct CleanPass : public Pass {
-	CleanPass() : Pass("clean", "remove unused cells and wires") { }
+	CleanPass() : Pass("clean", "remove unused cells and wires") { module_parallel(); notifies_monitors(); }
 	void help() override
 	{
 		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
@@ -707,16 +737,22 @@ struct CleanPass : public Pass {
 
 		count_rm_cells = 0;
 		count_rm_wires = 0;
+		design_did_something = false;
 
-		for (auto module : design->selected_whole_modules()) {
-			if (module->has_processes())
-				continue;
+		std::vector<RTLIL::Module*> modules;
+		for (auto module : design->selected_whole_modules())
+			if (!module->has_processes())
+				modules.push_back(module);
+
+		for_each_module(design, modules, [&](RTLIL::Module *module) {
 			rmunused_module(module, purge_mode, ys_debug(), true);
-		}
+		});
 
+		if (design_did_something)
+			design->scratchpad_set_bool("opt.did_something", true);
 		log_suppressed();
 		if (count_rm_cells > 0 || count_rm_wires > 0)
-			log("Removed %d unused cells and %d unused wires.\n", count_rm_cells, count_rm_wires);
+			log("Removed %d unused cells and %d unused wires.\n", int(count_rm_cells), int(count_rm_wires));
 
 		design->optimize();
 		design->sort();
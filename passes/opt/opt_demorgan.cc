@@ -168,7 +168,7 @@ void demorgan_worker(
 }
 
 struct OptDemorganPass : public Pass {
-	OptDemorganPass() : Pass("opt_demorgan", "Optimize reductions with DeMorgan equivalents") { }
+	OptDemorganPass() : Pass("opt_demorgan", "Optimize reductions with DeMorgan equivalents") { notifies_monitors(); }
 	void help() override
 	{
 		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
@@ -183,13 +183,13 @@ struct OptDemorganPass : public Pass {
 	{
 		log_header(design, "Executing OPT_DEMORGAN pass (push inverters through $reduce_* cells).\n");
 
-		int argidx = 0;
+		int argidx = 1;
 		extra_args(args, argidx, design);
 
 		unsigned int cells_changed = 0;
 		for (auto module : design->selected_modules())
 		{
-			ModIndex index(module);
+			ModIndex &index = ModIndex::get(module);
 			for (auto cell : module->selected_cells())
 				demorgan_worker(index, cell, cells_changed);
 		}
@@ -845,7 +845,7 @@ struct OptDffWorker
 };
 
 struct OptDffPass : public Pass {
-	OptDffPass() : Pass("opt_dff", "perform DFF optimizations") { }
+	OptDffPass() : Pass("opt_dff", "perform DFF optimizations") { notifies_monitors(); }
 	void help() override
 	{
 		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
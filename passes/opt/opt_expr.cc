@@ -25,11 +25,146 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <algorithm>
+#include <atomic>
 
 USING_YOSYS_NAMESPACE
 PRIVATE_NAMESPACE_BEGIN
 
-bool did_something;
+thread_local bool did_something;
+
+// Records the changes to a module between calls of "opt_expr -incremental",
+// see the help message of opt_expr. The ports of cells and the module
+// connections are observed through RTLIL::Monitor. Changes to the type or the
+// parameters of a cell are not notified, they are found by comparing against
+// the type and parameter hash seen when the cell was last checked. The
+// worklist is owned by the module, so that a pass that changes the module
+// without notifying monitors sends it a blackout.
+struct OptExprWorklist : public RTLIL::Monitor
+{
+	RTLIL::Module *module;
+
+	// visit all cells during the current call (first call, blackout)
+	bool full = true;
+
+	// type and hash of the parameters of the cells when they were last checked
+	dict<RTLIL::Cell*, std::pair<RTLIL::IdString, unsigned int>, hash_ptr_ops> signatures;
+
+	// Cells with changed ports. They are only compared by pointer, as cells
+	// may be deleted after they were recorded.
+	pool<RTLIL::Cell*, hash_ptr_ops> dirty_cells;
+
+	// Wire bits that are driven differently now: outputs of changed cells
+	// and both sides of new module connections. They are recorded by name
+	// because wires may be deleted as well.
+	pool<std::pair<RTLIL::IdString, int>> changed_bits;
+
+	// cells visited during the current call
+	pool<RTLIL::Cell*, hash_ptr_ops> visited;
+
+	OptExprWorklist(RTLIL::Module *module) : module(module) {
+		module->monitors.insert(this);
+	}
+
+	~OptExprWorklist() {
+		module->monitors.erase(this);
+	}
+
+	void add_changed(const RTLIL::SigSpec &sig)
+	{
+		for (auto &chunk : sig.chunks())
+			if (chunk.wire != nullptr)
+				for (int i = 0; i < chunk.width; i++)
+					changed_bits.insert(std::make_pair(chunk.wire->name, chunk.offset + i));
+	}
+
+	void notify_connect(RTLIL::Cell *cell, const RTLIL::IdString &port, const RTLIL::SigSpec &old_sig, const RTLIL::SigSpec &sig) override
+	{
+		dirty_cells.insert(cell);
+		if (!cell->input(port)) {
+			add_changed(old_sig);
+			add_changed(sig);
+		}
+	}
+
+	void notify_connect(RTLIL::Module*, const RTLIL::SigSig &sigsig) override
+	{
+		add_changed(sigsig.first);
+		add_changed(sigsig.second);
+	}
+
+	void notify_connect(RTLIL::Module*, const std::vector<RTLIL::SigSig> &sigsig_vec) override
+	{
+		pool<RTLIL::SigSig> old_conns(module->connections().begin(), module->connections().end());
+		for (auto &sigsig : sigsig_vec)
+			if (!old_conns.count(sigsig)) {
+				add_changed(sigsig.first);
+				add_changed(sigsig.second);
+			}
+		pool<RTLIL::SigSig> new_conns(sigsig_vec.begin(), sigsig_vec.end());
+		for (auto &sigsig : module->connections())
+			if (!new_conns.count(sigsig)) {
+				add_changed(sigsig.first);
+				add_changed(sigsig.second);
+			}
+	}
+
+	void notify_blackout(RTLIL::Module*) override
+	{
+		full = true;
+		signatures.clear();
+	}
+
+	// Returns the worklist of the module, creating it on first use.
+	static OptExprWorklist *get(RTLIL::Module *module)
+	{
+		RTLIL::Monitor *&mon = module->owned_monitors[ID(OptExprWorklist)];
+		if (mon == nullptr)
+			mon = new OptExprWorklist(module);
+		return dynamic_cast<OptExprWorklist*>(mon);
+	}
+
+	// Stops keeping track of the changes to the module.
+	static void remove(RTLIL::Module *module)
+	{
+		auto it = module->owned_monitors.find(ID(OptExprWorklist));
+		if (it != module->owned_monitors.end()) {
+			delete it->second;
+			module->owned_monitors.erase(it);
+		}
+	}
+
+	// Returns true if the type or the parameters of the cell changed since
+	// the cell was last checked.
+	bool signature_changed(RTLIL::Cell *cell)
+	{
+		auto signature = std::make_pair(cell->type, cell->parameters.hash());
+		auto it = signatures.find(cell);
+		if (it != signatures.end() && it->second == signature)
+			return false;
+		signatures[cell] = signature;
+		return true;
+	}
+
+	// Returns true if the cell needs to be visited in this round of
+	// replace_const_cells(), `changed' are the mapped changed_bits.
+	bool needs_visit(RTLIL::Cell *cell, SigMap &assign_map, const pool<RTLIL::SigBit> &changed, bool consume_x)
+	{
+		if (signature_changed(cell) || full || dirty_cells.count(cell))
+			return true;
+		// the consume_x round also revisits all cells of the preceding rounds
+		if (consume_x && visited.count(cell))
+			return true;
+		if (!changed.empty())
+			for (auto &conn : cell->connections()) {
+				if (cell->output(conn.first))
+					continue;
+				for (auto bit : conn.second)
+					if (bit.wire != nullptr && changed.count(assign_map(bit)))
+						return true;
+			}
+		return false;
+	}
+};
 
 void replace_undriven(RTLIL::Module *module, const CellTypes &ct)
 {
@@ -393,7 +528,8 @@ int get_highest_hot_index(RTLIL::SigSpec signal)
 	return -1;
 }
 
-void replace_const_cells(RTLIL::Design *design, RTLIL::Module *module, bool consume_x, bool mux_undef, bool mux_bool, bool do_fine, bool keepdc, bool noclkinv)
+void replace_const_cells(RTLIL::Design *design, RTLIL::Module *module, bool consume_x, bool mux_undef, bool mux_bool, bool do_fine, bool keepdc, bool noclkinv,
+		OptExprWorklist *worklist)
 {
 	CellTypes ct_combinational;
 	ct_combinational.setup_internals();
@@ -406,6 +542,14 @@ void replace_const_cells(RTLIL::Design *design, RTLIL::Module *module, bool cons
 	dict<RTLIL::Cell*, std::set<RTLIL::SigBit>> cell_to_inbit;
 	dict<RTLIL::SigBit, std::set<RTLIL::Cell*>> outbit_to_cell;
 
+	pool<RTLIL::SigBit> changed;
+	if (worklist != nullptr && !worklist->full)
+		for (auto &it : worklist->changed_bits) {
+			RTLIL::Wire *wire = module->wire(it.first);
+			if (wire != nullptr && it.second < wire->width)
+				changed.insert(assign_map(RTLIL::SigBit(wire, it.second)));
+		}
+
 	for (auto cell : module->cells())
 		if (design->selected(module, cell) && cell->type[0] == '$') {
 			if (cell->type.in(ID($_NOT_), ID($not), ID($logic_not)) &&
@@ -414,6 +558,8 @@ void replace_const_cells(RTLIL::Design *design, RTLIL::Module *module, bool cons
 			if (cell->type.in(ID($mux), ID($_MUX_)) &&
 					cell->getPort(ID::A) == SigSpec(State::S1) && cell->getPort(ID::B) == SigSpec(State::S0))
 				invert_map[assign_map(cell->getPort(ID::Y))] = assign_map(cell->getPort(ID::S));
+			if (worklist != nullptr && !worklist->needs_visit(cell, assign_map, changed, consume_x))
+				continue;
 			if (ct_combinational.cell_known(cell->type))
 				for (auto &conn : cell->connections()) {
 					RTLIL::SigSpec sig = assign_map(conn.second);
@@ -434,8 +580,21 @@ void replace_const_cells(RTLIL::Design *design, RTLIL::Module *module, bool cons
 
 	cells.sort();
 
+	// changes made from here on are for the next round
+	if (worklist != nullptr) {
+		worklist->dirty_cells.clear();
+		worklist->changed_bits.clear();
+	}
+
 	for (auto cell : cells.sorted)
 	{
+		// in-place changes to the type or parameters are not notified to the
+		// worklist, so cells changed by this loop are marked explicitly
+		bool did_something_before = did_something;
+		did_something = false;
+		if (worklist != nullptr)
+			worklist->visited.insert(cell);
+
 #define ACTION_DO(_p_, _s_) do { cover("opt.opt_expr.action_" S__LINE__); replace_cell(assign_map, module, cell, input.as_string(), _p_, _s_); goto next_cell; } while (0)
 #define ACTION_DO_Y(_v_) ACTION_DO(ID::Y, RTLIL::SigSpec(RTLIL::State::S ## _v_))
 
@@ -2183,7 +2342,10 @@ skip_alu_split:
 			}
 		}
 
-	next_cell:;
+	next_cell:
+		if (did_something && worklist != nullptr)
+			worklist->dirty_cells.insert(cell);
+		did_something |= did_something_before;
 #undef ACTION_DO
 #undef ACTION_DO_Y
 #undef FOLD_1ARG_CELL
@@ -2191,10 +2353,12 @@ skip_alu_split:
 	}
 }
 
-void replace_const_connections(RTLIL::Module *module) {
+void replace_const_connections(RTLIL::Module *module, OptExprWorklist *worklist) {
 	SigMap assign_map(module);
 	for (auto cell : module->selected_cells())
 	{
+		if (worklist != nullptr && !worklist->full && !worklist->visited.count(cell))
+			continue;
 		std::vector<std::pair<RTLIL::IdString, SigSpec>> changes;
 		for (auto &conn : cell->connections()) {
 			SigSpec mapped = assign_map(conn.second);
@@ -2209,7 +2373,7 @@ void replace_const_connections(RTLIL::Module *module) {
 }
 
 struct OptExprPass : public Pass {
-	OptExprPass() : Pass("opt_expr", "perform const folding and simple expression rewriting") { }
+	OptExprPass() : Pass("opt_expr", "perform const folding and simple expression rewriting") { module_parallel(); notifies_monitors(); }
 	void help() override
 	{
 		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
@@ -2243,6 +2407,17 @@ struct OptExprPass : public Pass {
 		log("        all result bits to be set to x. this behavior changes when 'a+0' is\n");
 		log("        replaced by 'a'. the -keepdc option disables all such optimizations.\n");
 		log("\n");
+		log("    -incremental\n");
+		log("        keep track of the changes to each module until the next call with\n");
+		log("        this option, which then only revisits the changed cells and the cells\n");
+		log("        reading a changed signal. the first call visits all cells, and so\n");
+		log("        does the first call after a pass that changed the module without\n");
+		log("        notifying monitors. 'opt -incremental' uses this between iterations.\n");
+		log("\n");
+		log("    -incremental_done\n");
+		log("        stop keeping track of the changes for -incremental, and do nothing\n");
+		log("        else.\n");
+		log("\n");
 	}
 	void execute(std::vector<std::string> args, RTLIL::Design *design) override
 	{
@@ -2252,6 +2427,13 @@ struct OptExprPass : public Pass {
 		bool noclkinv = false;
 		bool do_fine = false;
 		bool keepdc = false;
+		bool incremental = false;
+
+		if (args.size() == 2 && args[1] == "-incremental_done") {
+			for (auto module : design->modules())
+				OptExprWorklist::remove(module);
+			return;
+		}
 
 		log_header(design, "Executing OPT_EXPR pass (perform const folding).\n");
 		log_push();
@@ -2289,42 +2471,62 @@ struct OptExprPass : public Pass {
 				keepdc = true;
 				continue;
 			}
+			if (args[argidx] == "-incremental") {
+				incremental = true;
+				continue;
+			}
 			break;
 		}
 		extra_args(args, argidx, design);
 
 		CellTypes ct(design);
-		for (auto module : design->selected_modules())
+		std::atomic<bool> design_did_something(false);
+
+		for_each_module(design, design->selected_modules(), [&](RTLIL::Module *module)
 		{
 			log("Optimizing module %s.\n", log_id(module));
 
+			OptExprWorklist *worklist = nullptr;
+			if (incremental) {
+				worklist = OptExprWorklist::get(module);
+				worklist->visited.clear();
+			}
+
 			if (undriven) {
 				did_something = false;
 				replace_undriven(module, ct);
 				if (did_something)
-					design->scratchpad_set_bool("opt.did_something", true);
+					design_did_something = true;
 			}
 
 			do {
 				do {
 					did_something = false;
-					replace_const_cells(design, module, false /* consume_x */, mux_undef, mux_bool, do_fine, keepdc, noclkinv);
+					replace_const_cells(design, module, false /* consume_x */, mux_undef, mux_bool, do_fine, keepdc, noclkinv, worklist);
 					if (did_something)
-						design->scratchpad_set_bool("opt.did_something", true);
+						design_did_something = true;
 				} while (did_something);
 				if (!keepdc)
-					replace_const_cells(design, module, true /* consume_x */, mux_undef, mux_bool, do_fine, keepdc, noclkinv);
+					replace_const_cells(design, module, true /* consume_x */, mux_undef, mux_bool, do_fine, keepdc, noclkinv, worklist);
 				if (did_something)
-					design->scratchpad_set_bool("opt.did_something", true);
+					design_did_something = true;
 			} while (did_something);
 
 			did_something = false;
-			replace_const_connections(module);
+			replace_const_connections(module, worklist);
 			if (did_something)
-				design->scratchpad_set_bool("opt.did_something", true);
+				design_did_something = true;
+
+			if (worklist != nullptr) {
+				worklist->full = false;
+				worklist->visited.clear();
+			}
 
 			log_suppressed();
-		}
+		});
+
+		if (design_did_something)
+			design->scratchpad_set_bool("opt.did_something", true);
 
 		log_pop();
 	}
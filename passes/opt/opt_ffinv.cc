@@ -30,7 +30,7 @@ struct OptFfInvWorker
 {
 	int count = 0;
 	RTLIL::Module *module;
-	ModIndex index;
+	ModIndex &index;
 	FfInitVals initvals;
 
 	// Case 1:
@@ -200,7 +200,7 @@ struct OptFfInvWorker
 	}
 
 	OptFfInvWorker(RTLIL::Module *module) :
-		module(module), index(module), initvals(&index.sigmap, module)
+		module(module), index(ModIndex::get(module)), initvals(&index.sigmap, module)
 	{
 		log("Discovering LUTs.\n");
 
@@ -231,7 +231,7 @@ struct OptFfInvWorker
 };
 
 struct OptFfInvPass : public Pass {
-	OptFfInvPass() : Pass("opt_ffinv", "push inverters through FFs") { }
+	OptFfInvPass() : Pass("opt_ffinv", "push inverters through FFs") { notifies_monitors(); }
 	void help() override
 	{
 		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
@@ -34,7 +34,7 @@ struct OptLutWorker
 {
 	const std::vector<dlogic_t> &dlogic;
 	RTLIL::Module *module;
-	ModIndex index;
+	ModIndex &index;
 	SigMap sigmap;
 
 	pool<RTLIL::Cell*> luts;
@@ -100,7 +100,7 @@ struct OptLutWorker
 	}
 
 	OptLutWorker(const std::vector<dlogic_t> &dlogic, RTLIL::Module *module, int limit) :
-		dlogic(dlogic), module(module), index(module), sigmap(module)
+		dlogic(dlogic), module(module), index(ModIndex::get(module)), sigmap(module)
 	{
 		log("Discovering LUTs.\n");
 		for (auto cell : module->selected_cells())
@@ -22,10 +22,10 @@
 #include "kernel/sigtools.h"
 #include "kernel/log.h"
 #include "kernel/celltypes.h"
-#include "libs/sha1/sha1.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <set>
+#include <atomic>
 
 
 USING_YOSYS_NAMESPACE
@@ -41,7 +41,6 @@ struct OptMergeWorker
 
 	CellTypes ct;
 	int total_count;
-	SHA1 checksum;
 
 	static void sort_pmux_conn(dict<RTLIL::IdString, RTLIL::SigSpec> &conn)
 	{
@@ -66,91 +65,78 @@ struct OptMergeWorker
 		}
 	}
 
-	std::string int_to_hash_string(unsigned int v)
+	static bool is_commutative(RTLIL::IdString type)
 	{
-		if (v == 0)
-			return "0";
-		std::string str = "";
-		while (v > 0) {
-			str += 'a' + (v & 15);
-			v = v >> 4;
-		}
-		return str;
+		return type.in(ID($and), ID($or), ID($xor), ID($xnor), ID($add), ID($mul),
+				ID($logic_and), ID($logic_or), ID($_AND_), ID($_OR_), ID($_XOR_));
 	}
 
-	std::string hash_cell_parameters_and_connections(const RTLIL::Cell *cell)
+	unsigned int hash_sig(const RTLIL::SigSpec &sig)
 	{
-		vector<string> hash_conn_strings;
-		std::string hash_string = cell->type.str() + "\n";
-
-		const dict<RTLIL::IdString, RTLIL::SigSpec> *conn = &cell->connections();
-		dict<RTLIL::IdString, RTLIL::SigSpec> alt_conn;
-
-		if (cell->type.in(ID($and), ID($or), ID($xor), ID($xnor), ID($add), ID($mul),
-				ID($logic_and), ID($logic_or), ID($_AND_), ID($_OR_), ID($_XOR_))) {
-			alt_conn = *conn;
-			if (assign_map(alt_conn.at(ID::A)) < assign_map(alt_conn.at(ID::B))) {
-				alt_conn[ID::A] = conn->at(ID::B);
-				alt_conn[ID::B] = conn->at(ID::A);
-			}
-			conn = &alt_conn;
-		} else
-		if (cell->type.in(ID($reduce_xor), ID($reduce_xnor))) {
-			alt_conn = *conn;
-			assign_map.apply(alt_conn.at(ID::A));
-			alt_conn.at(ID::A).sort();
-			conn = &alt_conn;
-		} else
-		if (cell->type.in(ID($reduce_and), ID($reduce_or), ID($reduce_bool))) {
-			alt_conn = *conn;
-			assign_map.apply(alt_conn.at(ID::A));
-			alt_conn.at(ID::A).sort_and_unify();
-			conn = &alt_conn;
-		} else
+		unsigned int h = mkhash_init;
+		for (auto bit : sig)
+			h = mkhash(h, assign_map(bit).hash());
+		return h;
+	}
+
+	// Structural hash of the cell type, parameters and inputs (after
+	// assign_map), consistent with compare_cell_parameters_and_connections().
+	// Parameters and ports are summed up, so that the result does not depend
+	// on their order in the cell's dicts.
+	unsigned int hash_cell_parameters_and_connections(const RTLIL::Cell *cell)
+	{
+		unsigned int h = 0;
+
+		for (auto &it : cell->parameters)
+			h += mkhash(it.first.hash(), it.second.hash());
+
+		dict<RTLIL::IdString, RTLIL::SigSpec> pmux_conn;
 		if (cell->type == ID($pmux)) {
-			alt_conn = *conn;
-			assign_map.apply(alt_conn.at(ID::A));
-			assign_map.apply(alt_conn.at(ID::B));
-			assign_map.apply(alt_conn.at(ID::S));
-			sort_pmux_conn(alt_conn);
-			conn = &alt_conn;
+			for (auto port : {ID::A, ID::B, ID::S})
+				pmux_conn[port] = assign_map(cell->getPort(port));
+			sort_pmux_conn(pmux_conn);
 		}
 
-		for (auto &it : *conn) {
-			RTLIL::SigSpec sig;
+		for (auto &it : cell->connections())
+		{
+			unsigned int port_hash;
 			if (cell->output(it.first)) {
 				if (it.first == ID::Q && RTLIL::builtin_ff_cell_types().count(cell->type)) {
 					// For the 'Q' output of state elements,
 					//   use its (* init *) attribute value
-					sig = initvals(it.second);
+					port_hash = initvals(it.second).hash();
 				}
 				else
 					continue;
 			}
-			else
-				sig = assign_map(it.second);
-			string s = "C " + it.first.str() + "=";
-			for (auto &chunk : sig.chunks()) {
-				if (chunk.wire)
-					s += "{" + chunk.wire->name.str() + " " +
-							int_to_hash_string(chunk.offset) + " " +
-							int_to_hash_string(chunk.width) + "}";
-				else
-					s += RTLIL::Const(chunk.data).as_string();
+			else if (is_commutative(cell->type) && it.first.in(ID::A, ID::B)) {
+				// hashed together below
+				continue;
+			}
+			else if (cell->type.in(ID($reduce_xor), ID($reduce_xnor)) && it.first == ID::A) {
+				port_hash = 0;
+				for (auto bit : it.second)
+					port_hash += assign_map(bit).hash();
 			}
-			hash_conn_strings.push_back(s + "\n");
+			else if (cell->type.in(ID($reduce_and), ID($reduce_or), ID($reduce_bool)) && it.first == ID::A) {
+				RTLIL::SigSpec sig = assign_map(it.second);
+				sig.sort_and_unify();
+				port_hash = hash_sig(sig);
+			}
+			else if (pmux_conn.count(it.first))
+				port_hash = hash_sig(pmux_conn.at(it.first));
+			else
+				port_hash = hash_sig(it.second);
+			h += mkhash(it.first.hash(), port_hash);
 		}
 
-		for (auto &it : cell->parameters)
-			hash_conn_strings.push_back("P " + it.first.str() + "=" + it.second.as_string() + "\n");
-
-		std::sort(hash_conn_strings.begin(), hash_conn_strings.end());
-
-		for (auto it : hash_conn_strings)
-			hash_string += it;
+		if (is_commutative(cell->type)) {
+			unsigned int hash_a = hash_sig(cell->getPort(ID::A));
+			unsigned int hash_b = hash_sig(cell->getPort(ID::B));
+			h += mkhash(std::min(hash_a, hash_b), std::max(hash_a, hash_b));
+		}
 
-		checksum.update(hash_string);
-		return checksum.final();
+		return mkhash(cell->type.hash(), h);
 	}
 
 	bool compare_cell_parameters_and_connections(const RTLIL::Cell *cell1, const RTLIL::Cell *cell2)
@@ -190,8 +176,7 @@ struct OptMergeWorker
 			}
 		}
 
-		if (cell1->type == ID($and) || cell1->type == ID($or) || cell1->type == ID($xor) || cell1->type == ID($xnor) || cell1->type == ID($add) || cell1->type == ID($mul) ||
-				cell1->type == ID($logic_and) || cell1->type == ID($logic_or) || cell1->type == ID($_AND_) || cell1->type == ID($_OR_) || cell1->type == ID($_XOR_)) {
+		if (is_commutative(cell1->type)) {
 			if (conn1.at(ID::A) < conn1.at(ID::B)) {
 				RTLIL::SigSpec tmp = conn1[ID::A];
 				conn1[ID::A] = conn1[ID::B];
@@ -253,56 +238,124 @@ struct OptMergeWorker
 
 		initvals.set(&assign_map, module);
 
-		bool did_something = true;
-		while (did_something)
+		std::vector<RTLIL::Cell*> cells;
+		cells.reserve(module->cells_.size());
+		for (auto &it : module->cells_) {
+			if (!design->selected(module, it.second))
+				continue;
+			if (mode_keepdc && has_dont_care_initval(it.second))
+				continue;
+			if (ct.cell_known(it.second->type) || (mode_share_all && it.second->known()))
+				cells.push_back(it.second);
+		}
+
+		// Cells are referred to by their index in `cells', merged cells are set
+		// to nullptr. The sharemap holds the cells that were not merged, in
+		// buckets by hash, and persists across iterations.
+		std::vector<unsigned int> cell_hash(cells.size());
+		std::vector<bool> in_sharemap(cells.size());
+		dict<unsigned int, std::vector<int>> sharemap;
+
+		std::vector<int> worklist(cells.size());
+		for (int i = 0; i < GetSize(cells); i++)
+			worklist[i] = i;
+
+		while (!worklist.empty())
 		{
-			std::vector<RTLIL::Cell*> cells;
-			cells.reserve(module->cells_.size());
-			for (auto &it : module->cells_) {
-				if (!design->selected(module, it.second))
-					continue;
-				if (mode_keepdc && has_dont_care_initval(it.second))
-					continue;
-				if (ct.cell_known(it.second->type) || (mode_share_all && it.second->known()))
-					cells.push_back(it.second);
-			}
+			// representatives of the signals driven by the kept cells
+			pool<RTLIL::SigBit> changed_bits;
 
-			did_something = false;
-			dict<std::string, RTLIL::Cell*> sharemap;
-			for (auto cell : cells)
+			for (int i : worklist)
 			{
+				RTLIL::Cell *cell = cells[i];
+				if (cell == nullptr)
+					continue;
 				if ((!mode_share_all && !ct.cell_known(cell->type)) || !cell->known())
 					continue;
 
-				auto hash = hash_cell_parameters_and_connections(cell);
-				auto r = sharemap.insert(std::make_pair(hash, cell));
-				if (!r.second) {
-					if (compare_cell_parameters_and_connections(cell, r.first->second)) {
-						if (cell->has_keep_attr()) {
-							if (r.first->second->has_keep_attr())
-								continue;
-							std::swap(r.first->second, cell);
-						}
+				if (in_sharemap[i]) {
+					auto &bucket = sharemap.at(cell_hash[i]);
+					bucket.erase(std::find(bucket.begin(), bucket.end(), i));
+					in_sharemap[i] = false;
+				}
+
+				cell_hash[i] = hash_cell_parameters_and_connections(cell);
+				auto &bucket = sharemap[cell_hash[i]];
+
+				int j = -1;
+				for (int k : bucket)
+					if (compare_cell_parameters_and_connections(cell, cells[k])) {
+						j = k;
+						break;
+					}
 
+				if (j < 0) {
+					bucket.push_back(i);
+					in_sharemap[i] = true;
+					continue;
+				}
+
+				if (cell->has_keep_attr()) {
+					if (cells[j]->has_keep_attr())
+						continue;
+					// keep this cell instead of the one in the sharemap
+					*std::find(bucket.begin(), bucket.end(), j) = i;
+					in_sharemap[i] = true;
+					in_sharemap[j] = false;
+					std::swap(i, j);
+					cell = cells[i];
+				}
+
+				RTLIL::Cell *other = cells[j];
+				log_debug("  Cell `%s' is identical to cell `%s'.\n", cell->name.c_str(), other->name.c_str());
+				for (auto &it : cell->connections()) {
+					if (cell->output(it.first)) {
+						RTLIL::SigSpec other_sig = other->getPort(it.first);
+						log_debug("    Redirecting output %s: %s = %s\n", it.first.c_str(),
+								log_signal(it.second), log_signal(other_sig));
+						Const init = initvals(other_sig);
+						initvals.remove_init(it.second);
+						initvals.remove_init(other_sig);
+						module->connect(RTLIL::SigSig(it.second, other_sig));
+						assign_map.add(it.second, other_sig);
+						initvals.set_init(other_sig, init);
+						for (auto bit : other_sig)
+							changed_bits.insert(assign_map(bit));
+					}
+				}
+				log_debug("    Removing %s cell `%s' from module `%s'.\n", cell->type.c_str(), cell->name.c_str(), module->name.c_str());
+				module->remove(cell);
+				cells[i] = nullptr;
+				total_count++;
+			}
+
+			// Only the cells reading a merged signal can have become identical
+			// to another cell, re-check those. The bits in changed_bits may
+			// have been merged further after they were inserted.
+			worklist.clear();
+			if (changed_bits.empty())
+				break;
 
-						did_something = true;
-						log_debug("  Cell `%s' is identical to cell `%s'.\n", cell->name.c_str(), r.first->second->name.c_str());
-						for (auto &it : cell->connections()) {
-							if (cell->output(it.first)) {
-								RTLIL::SigSpec other_sig = r.first->second->getPort(it.first);
-								log_debug("    Redirecting output %s: %s = %s\n", it.first.c_str(),
-										log_signal(it.second), log_signal(other_sig));
-								Const init = initvals(other_sig);
-								initvals.remove_init(it.second);
-								initvals.remove_init(other_sig);
-								module->connect(RTLIL::SigSig(it.second, other_sig));
-								assign_map.add(it.second, other_sig);
-								initvals.set_init(other_sig, init);
-							}
+			pool<RTLIL::SigBit> changed;
+			for (auto bit : changed_bits)
+				changed.insert(assign_map(bit));
+
+			for (int i = 0; i < GetSize(cells); i++) {
+				RTLIL::Cell *cell = cells[i];
+				if (cell == nullptr)
+					continue;
+				for (auto &it : cell->connections()) {
+					if (cell->output(it.first))
+						continue;
+					bool found = false;
+					for (auto bit : it.second)
+						if (changed.count(assign_map(bit))) {
+							found = true;
+							break;
 						}
-						log_debug("    Removing %s cell `%s' from module `%s'.\n", cell->type.c_str(), cell->name.c_str(), module->name.c_str());
-						module->remove(cell);
-						total_count++;
+					if (found) {
+						worklist.push_back(i);
+						break;
 					}
 				}
 			}
@@ -313,7 +366,7 @@ struct OptMergeWorker
 };
 
 struct OptMergePass : public Pass {
-	OptMergePass() : Pass("opt_merge", "consolidate identical cells") { }
+	OptMergePass() : Pass("opt_merge", "consolidate identical cells") { module_parallel(); notifies_monitors(); }
 	void help() override
 	{
 		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
@@ -360,15 +413,15 @@ struct OptMergePass : public Pass {
 		}
 		extra_args(args, argidx, design);
 
-		int total_count = 0;
-		for (auto module : design->selected_modules()) {
+		std::atomic<int> total_count(0);
+		for_each_module(design, design->selected_modules(), [&](RTLIL::Module *module) {
 			OptMergeWorker worker(design, module, mode_nomux, mode_share_all, mode_keepdc);
 			total_count += worker.total_count;
-		}
+		});
 
 		if (total_count)
 			design->scratchpad_set_bool("opt.did_something", true);
-		log("Removed a total of %d cells.\n", total_count);
+		log("Removed a total of %d cells.\n", int(total_count));
 	}
 } OptMergePass;
 
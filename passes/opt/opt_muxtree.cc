@@ -471,7 +471,7 @@ struct OptMuxtreeWorker
 };
 
 struct OptMuxtreePass : public Pass {
-	OptMuxtreePass() : Pass("opt_muxtree", "eliminate dead trees in multiplexer trees") { }
+	OptMuxtreePass() : Pass("opt_muxtree", "eliminate dead trees in multiplexer trees") { notifies_monitors(); }
 	void help() override
 	{
 		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
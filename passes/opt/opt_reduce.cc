@@ -606,7 +606,7 @@ struct OptReduceWorker
 };
 
 struct OptReducePass : public Pass {
-	OptReducePass() : Pass("opt_reduce", "simplify large MUXes and AND/OR gates") { }
+	OptReducePass() : Pass("opt_reduce", "simplify large MUXes and AND/OR gates") { notifies_monitors(); }
 	void help() override
 	{
 		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
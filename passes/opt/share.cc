@@ -1072,7 +1072,7 @@ struct ShareWorker
 		ct.setup_internals();
 		ct.setup_stdcells();
 
-		ModIndex mi(module);
+		ModIndex &mi = ModIndex::get(module);
 
 		pool<RTLIL::Cell*> queue, covered;
 		queue.insert(cell);
@@ -25,6 +25,7 @@
 #include "kernel/ff.h"
 #include "kernel/yw.h"
 #include "kernel/json.h"
+#include "kernel/threading.h"
 
 #include <ctime>
 
@@ -73,20 +74,477 @@ struct OutputWriter
 	OutputWriter(SimWorker *w) { worker = w;};
 	virtual ~OutputWriter() {};
 	virtual void write(std::map<int, bool> &use_signal) = 0;
+	// Writers that can stream the trace get the header when the first step
+	// is recorded and then the steps one by one, on the thread of the
+	// TraceWriterThread.
+	virtual bool can_stream() { return false; }
+	virtual void write_header(std::map<int, bool> &) { }
+	virtual void write_time(int) { }
+	virtual void write_value(int, const Const &) { }
 	SimWorker *worker;
 };
 
+#ifndef YOSYS_DISABLE_THREADS
+// Formats and compresses the trace on a thread of its own. The simulation
+// appends the values that changed in each step to a lock-free queue of
+// fixed size and only waits for the thread when the queue is full (see
+// "sim -trace_buffer"). A step is the time, the number of values, and per
+// value the id, the width and one byte per bit.
+struct TraceWriterThread
+{
+	ByteQueue queue;
+	std::vector<OutputWriter*> writers;
+	std::vector<char> step;
+	int step_values = 0;
+	std::thread thread;
+	std::exception_ptr error;
+
+	TraceWriterThread(size_t queue_size, std::vector<OutputWriter*> writers) :
+			queue(queue_size), writers(writers)
+	{
+		thread = std::thread([this]() { run(); });
+	}
+
+	~TraceWriterThread()
+	{
+		join();
+	}
+
+	template<typename T> void append(const T &data)
+	{
+		const char *p = (const char *)&data;
+		step.insert(step.end(), p, p + sizeof(T));
+	}
+
+	void begin_step(int time)
+	{
+		step.clear();
+		append(time);
+		append(0);
+		step_values = 0;
+	}
+
+	void add_value(int id, const Const &value)
+	{
+		append(id);
+		append(GetSize(value));
+		const char *p = (const char *)value.bits.data();
+		step.insert(step.end(), p, p + GetSize(value));
+		step_values++;
+	}
+
+	void end_step()
+	{
+		memcpy(step.data() + sizeof(int), &step_values, sizeof(int));
+		queue.write(step.data(), step.size());
+	}
+
+	void run()
+	{
+		std::vector<std::pair<int, Const>> values;
+		int time, count;
+		while (queue.read(&time, sizeof(int)) && queue.read(&count, sizeof(int)))
+		{
+			values.resize(count);
+			for (auto &it : values) {
+				int width;
+				queue.read(&it.first, sizeof(int));
+				queue.read(&width, sizeof(int));
+				it.second.bits.resize(width);
+				queue.read(it.second.bits.data(), width);
+			}
+			// the same order as the values of output_data
+			std::sort(values.begin(), values.end(), [](const std::pair<int, Const> &a, const std::pair<int, Const> &b) {
+				return a.first < b.first;
+			});
+			if (error)
+				continue;
+			try {
+				for (auto writer : writers) {
+					writer->write_time(time);
+					for (auto &it : values)
+						writer->write_value(it.first, it.second);
+				}
+			} catch (...) {
+				// keep reading, so that the simulation does not wait forever
+				error = std::current_exception();
+			}
+		}
+	}
+
+	void join()
+	{
+		if (!thread.joinable())
+			return;
+		queue.close();
+		thread.join();
+	}
+};
+#endif
+
 struct SimInstance;
 struct TriggeredAssertion {
 	int step;
 	SimInstance *instance;
 	Cell *cell;
+	int witness; // index into SimShared::witness_files, or -1
 
-	TriggeredAssertion(int step, SimInstance *instance, Cell *cell) :
-		step(step), instance(instance), cell(cell)
+	TriggeredAssertion(int step, SimInstance *instance, Cell *cell, int witness = -1) :
+		step(step), instance(instance), cell(cell), witness(witness)
 	{ }
 };
 
+// The evaluation kernel of "sim -compiled". Every net bit of the simulated
+// hierarchy gets a dense index into two bit planes: a net is S1 if its bit
+// is set in `value`, undefined if it is set in `undef` and Sz if it is set in
+// both. The combinational cells, memory read ports and port connections of
+// all instances are compiled into one list of operations that is levelised
+// once and then evaluated front to back on every update, reading and writing
+// the planes 64 nets at a time. The flip-flops of all instances are updated
+// on the planes as well, memory writes and assertions are still handled by
+// each SimInstance.
+//
+// When several Yosys witness files are replayed at once, the planes are
+// used in lane mode instead: every net gets one word of its own and bit `l`
+// of that word holds the net in the independent simulation of lane `l`, so
+// that every operation advances up to 64 witnesses at a time.
+struct CompiledSim
+{
+	// A signal as a list of ranges of consecutive nets, LSB first.
+	struct NetSig
+	{
+		int width = 0;
+		std::vector<std::pair<int, int>> ranges; // first net, width
+
+		void append(int net)
+		{
+			if (!ranges.empty() && ranges.back().first + ranges.back().second == net)
+				ranges.back().second++;
+			else
+				ranges.emplace_back(net, 1);
+			width++;
+		}
+
+		void append(const NetSig &other)
+		{
+			for (auto &range : other.ranges)
+				for (int i = 0; i < range.second; i++)
+					append(range.first + i);
+		}
+	};
+
+	enum OpType {
+		OP_BUF, OP_NOT, OP_GATE_NOT,
+		OP_AND, OP_OR, OP_XOR, OP_XNOR, OP_NAND, OP_NOR, OP_ANDNOT, OP_ORNOT,
+		OP_MUX,
+		OP_REDUCE_AND, OP_REDUCE_OR, OP_REDUCE_XOR, OP_REDUCE_XNOR,
+		OP_LOGIC_NOT, OP_LOGIC_AND, OP_LOGIC_OR,
+		OP_EQ, OP_NE, OP_LT, OP_LE, OP_GT, OP_GE,
+		OP_ADD, OP_SUB, OP_NEG,
+		OP_CELL,   // any other evaluable cell, using CellTypes::eval()
+		OP_MEMORY  // the read ports of a memory, using SimInstance::update_memory()
+	};
+
+	struct Op
+	{
+		OpType type;
+		NetSig a, b, s, y;
+		bool a_signed = false, b_signed = false;
+		bool three_args = false;
+		bool active = false;
+		uint64_t active_lanes = 0; // lane mode: the lanes in which `active` is set
+		SimInstance *instance = nullptr;
+		Cell *cell = nullptr;
+		IdString memid;
+	};
+
+	// A flip-flop of any instance, with its past_* state kept in nets of
+	// its own (see SimInstance::ff_state_t).
+	struct FlipFlop
+	{
+		const FfData *data;
+		NetSig q, d, clk, ce, srst, aload, ad, arst, clr, set;
+		NetSig val_srst, val_arst;
+		NetSig past_d, past_ad;
+		int past_clk = -1, past_ce = -1, past_srst = -1;
+	};
+
+	std::vector<uint64_t> value, undef;
+	int num_nets = 0;
+
+	// Lane mode (see above) with this many lanes if not 0, must be set before
+	// the first net is added. get() and set() access the net in lane `lane`,
+	// or read lane 0 and write all lanes if it is -1.
+	int num_lanes = 0;
+	int lane = -1;
+	std::vector<Op> ops;
+	std::vector<FlipFlop> ffs;
+
+	// Like the default engine, an operation is only evaluated once one of
+	// its inputs has left its initial Sx state or is in initial_events, the
+	// nets that the default engine marks as changed before the first update
+	// (constants and output ports).
+	std::vector<bool> initial_events;
+	// lane mode: the nets as levelize() found them, see restart()
+	std::vector<uint64_t> initial_value, initial_undef;
+	int num_levels = 0;
+	bool found_loops = false;
+	int loop_start = 0;
+
+	// scratch words for the operands and the result of one operation
+	std::vector<uint64_t> a_value, a_undef, b_value, b_undef, y_value, y_undef;
+
+	static int num_words(int width) { return (width + 63) / 64; }
+
+	// the number of scratch words that hold `width` bits
+	int words(int width) const { return num_lanes ? width : num_words(width); }
+
+	int add_nets(int count)
+	{
+		int first = num_nets;
+		num_nets += count;
+		if (num_lanes) {
+			value.resize(num_nets);
+			undef.resize(num_nets, ~uint64_t(0));
+			return first;
+		}
+		value.resize(num_words(num_nets));
+		undef.resize(num_words(num_nets));
+		for (int i = first; i < num_nets; i++)
+			undef[i / 64] |= uint64_t(1) << (i % 64);
+		return first;
+	}
+
+	int add_const(State state)
+	{
+		int net = add_nets(1);
+		set(net, state);
+		add_initial_event(net);
+		return net;
+	}
+
+	void add_initial_event(int net)
+	{
+		if (GetSize(initial_events) <= net)
+			initial_events.resize(net + 1);
+		initial_events[net] = true;
+	}
+
+	bool all_undef(const NetSig &sig) const
+	{
+		for (auto &range : sig.ranges)
+			for (int i = 0; i < range.second; i++)
+				if (get(range.first + i) != State::Sx)
+					return false;
+		return true;
+	}
+
+	State get(int net) const
+	{
+		int index = num_lanes ? net : net / 64, shift = num_lanes ? std::max(lane, 0) : net % 64;
+		bool v = (value[index] >> shift) & 1;
+		bool u = (undef[index] >> shift) & 1;
+		return u ? (v ? State::Sz : State::Sx) : (v ? State::S1 : State::S0);
+	}
+
+	bool set(int net, State state)
+	{
+		bool new_v = state == State::S1 || state == State::Sz;
+		bool new_u = state != State::S0 && state != State::S1;
+		if (num_lanes && lane < 0) {
+			uint64_t lanes_v = new_v ? ~uint64_t(0) : 0, lanes_u = new_u ? ~uint64_t(0) : 0;
+			if (value[net] == lanes_v && undef[net] == lanes_u)
+				return false;
+			value[net] = lanes_v, undef[net] = lanes_u;
+			return true;
+		}
+		int index = num_lanes ? net : net / 64, shift = num_lanes ? lane : net % 64;
+		uint64_t bit = uint64_t(1) << shift;
+		uint64_t &v = value[index], &u = undef[index];
+		if (bool(v & bit) == new_v && bool(u & bit) == new_u)
+			return false;
+		v = new_v ? v | bit : v & ~bit;
+		u = new_u ? u | bit : u & ~bit;
+		return true;
+	}
+
+	static uint64_t extract_bits(const uint64_t *words, int offset, int width)
+	{
+		int index = offset / 64, shift = offset % 64;
+		uint64_t bits = words[index] >> shift;
+		if (shift != 0 && shift + width > 64)
+			bits |= words[index + 1] << (64 - shift);
+		return width == 64 ? bits : bits & ((uint64_t(1) << width) - 1);
+	}
+
+	static void insert_bits(uint64_t *words, int offset, int width, uint64_t bits)
+	{
+		int index = offset / 64, shift = offset % 64;
+		uint64_t mask = width == 64 ? ~uint64_t(0) : (uint64_t(1) << width) - 1;
+		words[index] = (words[index] & ~(mask << shift)) | (bits << shift);
+		if (shift != 0 && shift + width > 64)
+			words[index + 1] = (words[index + 1] & ~(mask >> (64 - shift))) | (bits >> (64 - shift));
+	}
+
+	// Reads `sig` into `width` bits of the given words, padded with its MSB
+	// (is_signed) or with S0 like extend_u0() in calc.cc. In lane mode bit `i`
+	// goes to word `i`.
+	void read(const NetSig &sig, int width, bool is_signed, uint64_t *v, uint64_t *u) const
+	{
+		if (num_lanes) {
+			int pos = 0;
+			for (auto &range : sig.ranges)
+				for (int i = 0; i < range.second && pos < width; i++, pos++)
+					v[pos] = value[range.first + i], u[pos] = undef[range.first + i];
+			uint64_t ext_v = is_signed && pos > 0 ? v[pos - 1] : 0, ext_u = is_signed && pos > 0 ? u[pos - 1] : 0;
+			for (; pos < width; pos++)
+				v[pos] = ext_v, u[pos] = ext_u;
+			return;
+		}
+
+		int words = num_words(width);
+		for (int i = 0; i < words; i++)
+			v[i] = u[i] = 0;
+
+		int pos = 0;
+		for (auto &range : sig.ranges)
+			for (int i = 0; i < range.second && pos < width; ) {
+				int n = std::min(std::min(64, range.second - i), width - pos);
+				insert_bits(v, pos, n, extract_bits(value.data(), range.first + i, n));
+				insert_bits(u, pos, n, extract_bits(undef.data(), range.first + i, n));
+				i += n, pos += n;
+			}
+
+		if (pos < width && is_signed && pos > 0) {
+			bool msb_v = (v[(pos - 1) / 64] >> ((pos - 1) % 64)) & 1;
+			bool msb_u = (u[(pos - 1) / 64] >> ((pos - 1) % 64)) & 1;
+			for (; pos < width; pos++) {
+				if (msb_v)
+					v[pos / 64] |= uint64_t(1) << (pos % 64);
+				if (msb_u)
+					u[pos / 64] |= uint64_t(1) << (pos % 64);
+			}
+		}
+	}
+
+	// Writes the first sig.width bits of the given words to `sig` and
+	// returns true if any net changed. In lane mode only the given lanes are
+	// written.
+	bool write(const NetSig &sig, const uint64_t *v, const uint64_t *u, uint64_t lanes = ~uint64_t(0))
+	{
+		bool changed = false;
+		int pos = 0;
+		if (num_lanes) {
+			for (auto &range : sig.ranges)
+				for (int i = 0; i < range.second; i++, pos++) {
+					uint64_t &net_v = value[range.first + i], &net_u = undef[range.first + i];
+					uint64_t new_v = (v[pos] & lanes) | (net_v & ~lanes), new_u = (u[pos] & lanes) | (net_u & ~lanes);
+					if (net_v != new_v || net_u != new_u) {
+						net_v = new_v, net_u = new_u;
+						changed = true;
+					}
+				}
+			return changed;
+		}
+		for (auto &range : sig.ranges)
+			for (int i = 0; i < range.second; ) {
+				int n = std::min(64, range.second - i);
+				uint64_t new_v = extract_bits(v, pos, n), new_u = extract_bits(u, pos, n);
+				if (extract_bits(value.data(), range.first + i, n) != new_v || extract_bits(undef.data(), range.first + i, n) != new_u) {
+					insert_bits(value.data(), range.first + i, n, new_v);
+					insert_bits(undef.data(), range.first + i, n, new_u);
+					changed = true;
+				}
+				i += n, pos += n;
+			}
+		return changed;
+	}
+
+	Const read_const(const NetSig &sig) const
+	{
+		Const result;
+		result.bits.reserve(sig.width);
+		for (auto &range : sig.ranges)
+			for (int i = 0; i < range.second; i++)
+				result.bits.push_back(get(range.first + i));
+		return result;
+	}
+
+	// Like SimInstance::set_state(), Sa bits of `data` are not written.
+	bool write_const(const NetSig &sig, const Const &data)
+	{
+		log_assert(sig.width <= GetSize(data));
+		bool changed = false;
+		int pos = 0;
+		for (auto &range : sig.ranges)
+			for (int i = 0; i < range.second; i++, pos++)
+				if (data.bits[pos] != State::Sa)
+					changed |= set(range.first + i, data.bits[pos]);
+		return changed;
+	}
+
+	// Lane mode: the lanes in which `net` is `state` (S0 or S1).
+	uint64_t lanes_with(int net, State state) const
+	{
+		return ~undef[net] & (state == State::S1 ? value[net] : ~value[net]);
+	}
+
+	void copy_net(int to, int from)
+	{
+		if (num_lanes)
+			value[to] = value[from], undef[to] = undef[from];
+		else
+			set(to, get(from));
+	}
+
+	// Lane mode: the lanes in which `op` starts out active. Lanes that are
+	// not in use are never waited for.
+	uint64_t initial_lanes(const Op &op) const
+	{
+		return op.active ? ~uint64_t(0) : num_lanes % 64 != 0 ? ~uint64_t(0) << num_lanes : 0;
+	}
+
+	// Lane mode: puts all lanes back into their state before the first update.
+	void restart()
+	{
+		value = initial_value;
+		undef = initial_undef;
+		for (auto &op : ops)
+			op.active_lanes = initial_lanes(op);
+	}
+
+	void set_result(State state, int width)
+	{
+		for (int i = 0; i < num_words(width); i++)
+			y_value[i] = y_undef[i] = 0;
+		if (width > 0) {
+			y_value[0] = state == State::S1;
+			y_undef[0] = state == State::Sx;
+		}
+	}
+
+	// Lane mode: sets bit 0 of the result to `v` and `u` and clears the rest.
+	void set_result_lanes(uint64_t v, uint64_t u, int width)
+	{
+		for (int i = 0; i < width; i++)
+			y_value[i] = y_undef[i] = 0;
+		if (width > 0)
+			y_value[0] = v, y_undef[0] = u;
+	}
+
+	void levelize();
+	void reduce(const NetSig &sig, bool &any_one, bool &any_zero, bool &any_undef, bool &parity);
+	void reduce_lanes(const NetSig &sig, uint64_t &any_one, uint64_t &any_zero, uint64_t &any_undef, uint64_t &parity);
+	State reduce_bool(const NetSig &sig);
+	void eval_bitwise(OpType type, int words);
+	bool eval_op(Op &op);
+	bool eval_op_lanes(Op &op);
+	void eval();
+	bool update_ffs(bool gclk, bool stable_past_update);
+	bool update_ffs_lanes(bool gclk, bool stable_past_update);
+	void update_past();
+};
+
 struct SimShared
 {
 	bool debug = false;
@@ -103,12 +561,29 @@ struct SimShared
 	bool cycles_set = false;
 	std::vector<std::unique_ptr<OutputWriter>> outputfiles;
 	std::vector<std::pair<int,std::map<int,Const>>> output_data;
+	// the queue size in KiB of the trace writer thread, 0 to write the
+	// output files at the end
+	int trace_buffer = 4096;
+#ifndef YOSYS_DISABLE_THREADS
+	std::unique_ptr<TraceWriterThread> trace_writer;
+#endif
 	bool ignore_x = false;
 	bool date = false;
 	bool multiclock = false;
 	int next_output_id = 0;
 	int step = 0;
 	std::vector<TriggeredAssertion> triggered_assertions;
+	bool compiled = false;
+	std::unique_ptr<CompiledSim> compiled_sim;
+	// "sim -j": sibling instances are updated on this many threads, 0 for
+	// the sequential scheduler
+	int num_threads = 0;
+	// replaying several Yosys witness files at once: the lanes of the
+	// compiled engine, and for each lane the index of its witness file and
+	// the step after which its assertions are no longer checked
+	int num_lanes = 0;
+	std::vector<std::string> witness_files;
+	std::vector<int> lane_witness, lane_end_step;
 };
 
 void zinit(State &v)
@@ -136,6 +611,8 @@ struct SimInstance
 
 	SigMap sigmap;
 	dict<SigBit, State> state_nets;
+	dict<SigBit, int> net_index;
+	dict<Wire*, std::vector<int>> wire_nets;
 	dict<SigBit, pool<Cell*>> upd_cells;
 	dict<SigBit, pool<Wire*>> upd_outports;
 
@@ -147,6 +624,15 @@ struct SimInstance
 	pool<IdString> dirty_memories;
 	pool<SimInstance*, hash_ptr_ops> dirty_children;
 
+	// With "sim -j", an instance can be updated at the same time as its
+	// siblings. Changes to the state of the parent are then queued until all
+	// siblings are done (see update_children()), changes to the shared trace
+	// data until the end of the step (see register_queued()).
+	std::vector<SimInstance*> child_list;
+	std::vector<std::pair<SigSpec, Const>> queued_outports;
+	std::vector<std::pair<IdString, int>> queued_memory_addrs;
+	std::vector<TriggeredAssertion> queued_assertions;
+
 	struct ff_state_t
 	{
 		Const past_d;
@@ -195,18 +681,38 @@ struct SimInstance
 		if (parent) {
 			log_assert(parent->children.count(instance) == 0);
 			parent->children[instance] = this;
+		} else if (shared->compiled) {
+			shared->compiled_sim.reset(new CompiledSim);
+			shared->compiled_sim->num_lanes = shared->num_lanes;
 		}
 
 		for (auto wire : module->wires())
 		{
 			SigSpec sig = sigmap(wire);
 
-			for (int i = 0; i < GetSize(sig); i++) {
-				if (state_nets.count(sig[i]) == 0)
-					state_nets[sig[i]] = State::Sx;
-				if (wire->port_output) {
-					upd_outports[sig[i]].insert(wire);
-					dirty_bits.insert(sig[i]);
+			if (shared->compiled_sim) {
+				auto &nets = wire_nets[wire];
+				for (auto bit : sig) {
+					if (bit.wire == nullptr) {
+						nets.push_back(shared->compiled_sim->add_const(bit.data));
+						continue;
+					}
+					auto it = net_index.find(bit);
+					if (it == net_index.end())
+						it = net_index.emplace(bit, shared->compiled_sim->add_nets(1)).first;
+					nets.push_back(it->second);
+				}
+				if (wire->port_output)
+					for (int net : nets)
+						shared->compiled_sim->add_initial_event(net);
+			} else {
+				for (int i = 0; i < GetSize(sig); i++) {
+					if (state_nets.count(sig[i]) == 0)
+						state_nets[sig[i]] = State::Sx;
+					if (wire->port_output) {
+						upd_outports[sig[i]].insert(wire);
+						dirty_bits.insert(sig[i]);
+					}
 				}
 			}
 
@@ -221,6 +727,10 @@ struct SimInstance
 				Const initval = wire->attributes.at(ID::init);
 				for (int i = 0; i < GetSize(sig) && i < GetSize(initval); i++)
 					if (initval[i] == State::S0 || initval[i] == State::S1) {
+						if (shared->compiled_sim) {
+							shared->compiled_sim->set(wire_nets.at(wire)[i], initval[i]);
+							continue;
+						}
 						state_nets[sig[i]] = initval[i];
 						dirty_bits.insert(sig[i]);
 					}
@@ -256,7 +766,7 @@ struct SimInstance
 			}
 
 			for (auto &port : cell->connections()) {
-				if (cell->input(port.first))
+				if (cell->input(port.first) && !shared->compiled_sim)
 					for (auto bit : sigmap(port.second)) {
 						upd_cells[bit].insert(cell);
 						// Make sure cell inputs connected to constants are updated in the first cycle
@@ -317,6 +827,24 @@ struct SimInstance
 				zinit(mem.data);
 			}
 		}
+
+		for (auto &it : children)
+			child_list.push_back(it.second);
+
+		// Reading a SigSpec can convert it between its packed and unpacked
+		// form, which must not happen on the cells of a module that is shared
+		// by instances updated in parallel.
+		if (shared->num_threads > 1)
+			for (auto cell : module->cells())
+				for (auto &conn : cell->connections()) {
+					conn.second.bits();
+					conn.second.chunks();
+				}
+
+		if (parent == nullptr && shared->compiled_sim) {
+			compile_ops();
+			shared->compiled_sim->levelize();
+		}
 	}
 
 	~SimInstance()
@@ -359,13 +887,26 @@ struct SimInstance
 	{
 		Const value;
 
-		for (auto bit : sigmap(sig))
-			if (bit.wire == nullptr)
-				value.bits.push_back(bit.data);
-			else if (state_nets.count(bit))
-				value.bits.push_back(state_nets.at(bit));
-			else
-				value.bits.push_back(State::Sz);
+		if (shared->compiled_sim) {
+			// wire_nets already has the nets of the sigmapped bits
+			for (auto &chunk : sig.chunks()) {
+				if (chunk.wire == nullptr) {
+					value.bits.insert(value.bits.end(), chunk.data.begin(), chunk.data.end());
+					continue;
+				}
+				auto &nets = wire_nets.at(chunk.wire);
+				for (int i = 0; i < chunk.width; i++)
+					value.bits.push_back(shared->compiled_sim->get(nets[chunk.offset + i]));
+			}
+		} else {
+			for (auto bit : sigmap(sig))
+				if (bit.wire == nullptr)
+					value.bits.push_back(bit.data);
+				else if (state_nets.count(bit))
+					value.bits.push_back(state_nets.at(bit));
+				else
+					value.bits.push_back(State::Sz);
+		}
 
 		if (shared->debug)
 			log("[%s] get %s: %s\n", hiername().c_str(), log_signal(sig), log_signal(value));
@@ -376,15 +917,30 @@ struct SimInstance
 	{
 		bool did_something = false;
 
-		sig = sigmap(sig);
-		log_assert(GetSize(sig) <= GetSize(value));
-
-		for (int i = 0; i < GetSize(sig); i++)
-			if (value[i] != State::Sa && state_nets.at(sig[i]) != value[i]) {
-				state_nets.at(sig[i]) = value[i];
-				dirty_bits.insert(sig[i]);
-				did_something = true;
+		if (shared->compiled_sim) {
+			log_assert(GetSize(sig) <= GetSize(value));
+			int i = 0;
+			for (auto &chunk : sig.chunks()) {
+				if (chunk.wire == nullptr) {
+					i += chunk.width;
+					continue;
+				}
+				auto &nets = wire_nets.at(chunk.wire);
+				for (int j = 0; j < chunk.width; j++, i++)
+					if (value[i] != State::Sa && shared->compiled_sim->set(nets[chunk.offset + j], value[i]))
+						did_something = true;
 			}
+		} else {
+			sig = sigmap(sig);
+			log_assert(GetSize(sig) <= GetSize(value));
+
+			for (int i = 0; i < GetSize(sig); i++)
+				if (value[i] != State::Sa && state_nets.at(sig[i]) != value[i]) {
+					state_nets.at(sig[i]) = value[i];
+					dirty_bits.insert(sig[i]);
+					did_something = true;
+				}
+		}
 
 		if (shared->debug)
 			log("[%s] set %s: %s\n", hiername().c_str(), log_signal(sig), log_signal(value));
@@ -522,9 +1078,10 @@ struct SimInstance
 		log_error("Unsupported cell type: %s (%s.%s)\n", log_id(cell->type), log_id(module), log_id(cell));
 	}
 
-	void update_memory(IdString id) {
+	bool update_memory(IdString id) {
 		auto &mdb = mem_database[id];
 		auto &mem = *mdb.mem;
+		bool did_something = false;
 
 		for (int port_idx = 0; port_idx < GetSize(mem.rd_ports); port_idx++)
 		{
@@ -542,16 +1099,223 @@ struct SimInstance
 					data = mdb.data.extract(index*mem.width, mem.width << port.wide_log2);
 
 				for (int offset = 0; offset < 1 << port.wide_log2; offset++) {
-					register_memory_addr(id, addr_int + offset);
+					queue_memory_addr(id, addr_int + offset);
+				}
+			}
+
+			did_something |= set_state(port.data, data);
+		}
+
+		return did_something;
+	}
+
+	CompiledSim::NetSig compile_sig(const SigSpec &sig)
+	{
+		CompiledSim::NetSig result;
+		for (auto bit : sigmap(sig))
+			result.append(bit.wire ? net_index.at(bit) : shared->compiled_sim->add_const(bit.data));
+		return result;
+	}
+
+	void compile_cell(Cell *cell)
+	{
+		CompiledSim::Op op;
+		op.instance = this;
+		op.cell = cell;
+
+		bool has_a = cell->hasPort(ID::A), has_b = cell->hasPort(ID::B), has_c = cell->hasPort(ID::C);
+		bool has_d = cell->hasPort(ID::D), has_s = cell->hasPort(ID::S), has_y = cell->hasPort(ID::Y);
+
+		if (has_a) op.a = compile_sig(cell->getPort(ID::A));
+		if (has_b) op.b = compile_sig(cell->getPort(ID::B));
+		if (has_y) op.y = compile_sig(cell->getPort(ID::Y));
+
+		op.a_signed = cell->hasParam(ID::A_SIGNED) && cell->getParam(ID::A_SIGNED).as_bool();
+		op.b_signed = cell->hasParam(ID::B_SIGNED) && cell->getParam(ID::B_SIGNED).as_bool();
+		if (!cell->type.in(ID($pos), ID($neg), ID($not)) && !(op.a_signed && op.b_signed))
+			op.a_signed = op.b_signed = false;
+
+		static const dict<IdString, CompiledSim::OpType> native_ops = {
+			{ID($pos), CompiledSim::OP_BUF}, {ID($_BUF_), CompiledSim::OP_BUF},
+			{ID($not), CompiledSim::OP_NOT}, {ID($_NOT_), CompiledSim::OP_GATE_NOT},
+			{ID($and), CompiledSim::OP_AND}, {ID($_AND_), CompiledSim::OP_AND},
+			{ID($or), CompiledSim::OP_OR}, {ID($_OR_), CompiledSim::OP_OR},
+			{ID($xor), CompiledSim::OP_XOR}, {ID($_XOR_), CompiledSim::OP_XOR},
+			{ID($xnor), CompiledSim::OP_XNOR}, {ID($_XNOR_), CompiledSim::OP_XNOR},
+			{ID($_NAND_), CompiledSim::OP_NAND}, {ID($_NOR_), CompiledSim::OP_NOR},
+			{ID($_ANDNOT_), CompiledSim::OP_ANDNOT}, {ID($_ORNOT_), CompiledSim::OP_ORNOT},
+			{ID($mux), CompiledSim::OP_MUX}, {ID($_MUX_), CompiledSim::OP_MUX},
+			{ID($reduce_and), CompiledSim::OP_REDUCE_AND}, {ID($reduce_or), CompiledSim::OP_REDUCE_OR},
+			{ID($reduce_bool), CompiledSim::OP_REDUCE_OR}, {ID($reduce_xor), CompiledSim::OP_REDUCE_XOR},
+			{ID($reduce_xnor), CompiledSim::OP_REDUCE_XNOR},
+			{ID($logic_not), CompiledSim::OP_LOGIC_NOT}, {ID($logic_and), CompiledSim::OP_LOGIC_AND},
+			{ID($logic_or), CompiledSim::OP_LOGIC_OR},
+			{ID($eq), CompiledSim::OP_EQ}, {ID($ne), CompiledSim::OP_NE},
+			{ID($lt), CompiledSim::OP_LT}, {ID($le), CompiledSim::OP_LE},
+			{ID($gt), CompiledSim::OP_GT}, {ID($ge), CompiledSim::OP_GE},
+			{ID($add), CompiledSim::OP_ADD}, {ID($sub), CompiledSim::OP_SUB}, {ID($neg), CompiledSim::OP_NEG},
+		};
+
+		auto it = native_ops.find(cell->type);
+		if (it != native_ops.end() && has_y) {
+			op.type = it->second;
+			if (op.type == CompiledSim::OP_MUX)
+				op.s = compile_sig(cell->getPort(ID::S));
+			shared->compiled_sim->ops.push_back(std::move(op));
+			return;
+		}
+
+		// same port patterns as in update_cell()
+		op.type = CompiledSim::OP_CELL;
+		if (has_a && !has_c && !has_d && !has_s && has_y) {
+			// (A -> Y) and (A,B -> Y) cells
+		} else if (has_a && has_b && has_c && !has_d && !has_s && has_y) {
+			op.s = compile_sig(cell->getPort(ID::C));
+			op.three_args = true;
+		} else if (has_a && !has_b && !has_c && !has_d && has_s && has_y) {
+			op.b = compile_sig(cell->getPort(ID::S));
+		} else if (has_a && has_b && !has_c && !has_d && has_s && has_y) {
+			op.s = compile_sig(cell->getPort(ID::S));
+			op.three_args = true;
+		} else {
+			log_warning("Unsupported evaluable cell type: %s (%s.%s)\n", log_id(cell->type), log_id(module), log_id(cell));
+			return;
+		}
+		shared->compiled_sim->ops.push_back(std::move(op));
+	}
+
+	// Allocates the nets holding the past value of a flip-flop input.
+	CompiledSim::NetSig compile_past(const Const &value)
+	{
+		CompiledSim::NetSig result;
+		int first = shared->compiled_sim->add_nets(GetSize(value));
+		for (int i = 0; i < GetSize(value); i++)
+			result.append(first + i);
+		shared->compiled_sim->write_const(result, value);
+		return result;
+	}
+
+	// Adds the operations for the combinational cells, memory read ports and
+	// child instance ports, and the flip-flops of this instance and its
+	// children to the compiled engine.
+	void compile_ops()
+	{
+		auto &ops = shared->compiled_sim->ops;
+
+		for (auto cell : module->cells())
+		{
+			if (ff_database.count(cell) || formal_database.count(cell) || mem_cells.count(cell))
+				continue;
+
+			if (children.count(cell))
+			{
+				auto child = children.at(cell);
+				for (auto &conn : cell->connections()) {
+					Wire *wire = child->module->wire(conn.first);
+					if (wire == nullptr || !wire->port_id)
+						continue;
+					int width = std::min(GetSize(wire), GetSize(conn.second));
+					if (width == 0)
+						continue;
+					if (wire->port_input) {
+						CompiledSim::Op op;
+						op.type = CompiledSim::OP_BUF;
+						op.a = compile_sig(conn.second.extract(0, width));
+						op.y = child->compile_sig(SigSpec(wire).extract(0, width));
+						ops.push_back(std::move(op));
+					}
+					if (wire->port_output) {
+						CompiledSim::Op op;
+						op.type = CompiledSim::OP_BUF;
+						op.a = child->compile_sig(SigSpec(wire).extract(0, width));
+						op.y = compile_sig(conn.second.extract(0, width));
+						ops.push_back(std::move(op));
+					}
 				}
+				continue;
 			}
 
-			set_state(port.data, data);
+			bool has_inputs = false;
+			for (auto &conn : cell->connections())
+				if (cell->input(conn.first) && GetSize(conn.second))
+					has_inputs = true;
+			if (!has_inputs)
+				continue;
+
+			if (!yosys_celltypes.cell_evaluable(cell->type))
+				log_error("Unsupported cell type: %s (%s.%s)\n", log_id(cell->type), log_id(module), log_id(cell));
+
+			compile_cell(cell);
 		}
+
+		for (auto &it : ff_database)
+		{
+			const FfData &ff_data = it.second.data;
+			CompiledSim::FlipFlop ff;
+			ff.data = &ff_data;
+			ff.q = compile_sig(ff_data.sig_q);
+			if (ff_data.has_clk || ff_data.has_gclk) {
+				ff.d = compile_sig(ff_data.sig_d);
+				ff.past_d = compile_past(it.second.past_d);
+			}
+			if (ff_data.has_clk) {
+				ff.clk = compile_sig(ff_data.sig_clk);
+				ff.past_clk = compile_past(it.second.past_clk).ranges[0].first;
+			}
+			if (ff_data.has_ce) {
+				ff.ce = compile_sig(ff_data.sig_ce);
+				ff.past_ce = compile_past(it.second.past_ce).ranges[0].first;
+			}
+			if (ff_data.has_srst) {
+				ff.srst = compile_sig(ff_data.sig_srst);
+				ff.val_srst = compile_sig(ff_data.val_srst);
+				ff.past_srst = compile_past(it.second.past_srst).ranges[0].first;
+			}
+			if (ff_data.has_aload) {
+				ff.aload = compile_sig(ff_data.sig_aload);
+				ff.ad = compile_sig(ff_data.sig_ad);
+				ff.past_ad = compile_past(it.second.past_ad);
+			}
+			if (ff_data.has_arst) {
+				ff.arst = compile_sig(ff_data.sig_arst);
+				ff.val_arst = compile_sig(ff_data.val_arst);
+			}
+			if (ff_data.has_sr) {
+				ff.clr = compile_sig(ff_data.sig_clr);
+				ff.set = compile_sig(ff_data.sig_set);
+			}
+			shared->compiled_sim->ffs.push_back(std::move(ff));
+		}
+
+		if (shared->num_lanes && !memories.empty())
+			log_error("Memories are not supported when replaying several witness files at once, run memory_map on module %s first.\n", log_id(module));
+
+		for (auto &mem : memories)
+		{
+			if (mem.rd_ports.empty())
+				continue;
+			CompiledSim::Op op;
+			op.type = CompiledSim::OP_MEMORY;
+			op.instance = this;
+			op.memid = mem.memid;
+			for (auto &port : mem.rd_ports) {
+				op.a.append(compile_sig(port.addr));
+				op.y.append(compile_sig(port.data));
+			}
+			ops.push_back(std::move(op));
+		}
+
+		for (auto &it : children)
+			it.second->compile_ops();
 	}
 
 	void update_ph1()
 	{
+		if (shared->compiled_sim) {
+			shared->compiled_sim->eval();
+			return;
+		}
+
 		pool<Cell*> queue_cells;
 		pool<Wire*> queue_outports;
 
@@ -588,15 +1352,17 @@ struct SimInstance
 			for (auto wire : queue_outports)
 				if (instance->hasPort(wire->name)) {
 					Const value = get_state(wire);
-					parent->set_state(instance->getPort(wire->name), value);
+					if (shared->num_threads > 0)
+						queued_outports.emplace_back(instance->getPort(wire->name), value);
+					else
+						parent->set_state(instance->getPort(wire->name), value);
 				}
 
 			queue_outports.clear();
 
-			for (auto child : dirty_children)
-				child->update_ph1();
-
+			std::vector<SimInstance*> update_list(dirty_children.begin(), dirty_children.end());
 			dirty_children.clear();
+			update_children(update_list, [&](int i) { update_list[i]->update_ph1(); });
 
 			if (dirty_bits.empty())
 				break;
@@ -607,65 +1373,71 @@ struct SimInstance
 	{
 		bool did_something = false;
 
-		for (auto &it : ff_database)
-		{
-			ff_state_t &ff = it.second;
-			FfData &ff_data = ff.data;
-
-			Const current_q = get_state(ff.data.sig_q);
-
-			if (ff_data.has_clk && !stable_past_update) {
-				// flip-flops
-				State current_clk = get_state(ff_data.sig_clk)[0];
-				if (ff_data.pol_clk ? (ff.past_clk == State::S0 && current_clk != State::S0) :
-							(ff.past_clk == State::S1 && current_clk != State::S1)) {
-					bool ce = ff.past_ce == (ff_data.pol_ce ? State::S1 : State::S0);
-					// set if no ce, or ce is enabled
-					if (!ff_data.has_ce || (ff_data.has_ce && ce)) {
-						current_q = ff.past_d;
-					}
-					// override if sync reset
-					if ((ff_data.has_srst) && (ff.past_srst == (ff_data.pol_srst ? State::S1 : State::S0)) &&
-						((!ff_data.ce_over_srst) || (ff_data.ce_over_srst && ce))) {
-						current_q = ff_data.val_srst;
+		// the flip-flops of all instances are in the compiled engine
+		if (shared->compiled_sim) {
+			if (parent == nullptr && shared->compiled_sim->update_ffs(gclk, stable_past_update))
+				did_something = true;
+		} else {
+			for (auto &it : ff_database)
+			{
+				ff_state_t &ff = it.second;
+				FfData &ff_data = ff.data;
+
+				Const current_q = get_state(ff.data.sig_q);
+
+				if (ff_data.has_clk && !stable_past_update) {
+					// flip-flops
+					State current_clk = get_state(ff_data.sig_clk)[0];
+					if (ff_data.pol_clk ? (ff.past_clk == State::S0 && current_clk != State::S0) :
+								(ff.past_clk == State::S1 && current_clk != State::S1)) {
+						bool ce = ff.past_ce == (ff_data.pol_ce ? State::S1 : State::S0);
+						// set if no ce, or ce is enabled
+						if (!ff_data.has_ce || (ff_data.has_ce && ce)) {
+							current_q = ff.past_d;
+						}
+						// override if sync reset
+						if ((ff_data.has_srst) && (ff.past_srst == (ff_data.pol_srst ? State::S1 : State::S0)) &&
+							((!ff_data.ce_over_srst) || (ff_data.ce_over_srst && ce))) {
+							current_q = ff_data.val_srst;
+						}
 					}
 				}
-			}
-			// async load
-			if (ff_data.has_aload) {
-				State current_aload = get_state(ff_data.sig_aload)[0];
-				if (current_aload == (ff_data.pol_aload ? State::S1 : State::S0)) {
-					current_q = ff_data.has_clk && !stable_past_update ? ff.past_ad : get_state(ff.data.sig_ad);
-				}
-			}
-			// async reset
-			if (ff_data.has_arst) {
-				State current_arst = get_state(ff_data.sig_arst)[0];
-				if (current_arst == (ff_data.pol_arst ? State::S1 : State::S0)) {
-					current_q = ff_data.val_arst;
+				// async load
+				if (ff_data.has_aload) {
+					State current_aload = get_state(ff_data.sig_aload)[0];
+					if (current_aload == (ff_data.pol_aload ? State::S1 : State::S0)) {
+						current_q = ff_data.has_clk && !stable_past_update ? ff.past_ad : get_state(ff.data.sig_ad);
+					}
 				}
-			}
-			// handle set/reset
-			if (ff.data.has_sr) {
-				Const current_clr = get_state(ff.data.sig_clr);
-				Const current_set = get_state(ff.data.sig_set);
-
-				for(int i=0;i<ff.past_d.size();i++) {
-					if (current_clr[i] == (ff_data.pol_clr ? State::S1 : State::S0)) {
-						current_q[i] = State::S0;
+				// async reset
+				if (ff_data.has_arst) {
+					State current_arst = get_state(ff_data.sig_arst)[0];
+					if (current_arst == (ff_data.pol_arst ? State::S1 : State::S0)) {
+						current_q = ff_data.val_arst;
 					}
-					else if (current_set[i] == (ff_data.pol_set ? State::S1 : State::S0)) {
-						current_q[i] = State::S1;
+				}
+				// handle set/reset
+				if (ff.data.has_sr) {
+					Const current_clr = get_state(ff.data.sig_clr);
+					Const current_set = get_state(ff.data.sig_set);
+
+					for(int i=0;i<ff.past_d.size();i++) {
+						if (current_clr[i] == (ff_data.pol_clr ? State::S1 : State::S0)) {
+							current_q[i] = State::S0;
+						}
+						else if (current_set[i] == (ff_data.pol_set ? State::S1 : State::S0)) {
+							current_q[i] = State::S1;
+						}
 					}
 				}
+				if (ff_data.has_gclk) {
+					// $ff
+					if (gclk)
+						current_q = ff.past_d;
+				}
+				if (set_state(ff_data.sig_q, current_q))
+					did_something = true;
 			}
-			if (ff_data.has_gclk) {
-				// $ff
-				if (gclk)
-					current_q = ff.past_d;
-			}
-			if (set_state(ff_data.sig_q, current_q))
-				did_something = true;
 		}
 
 		for (auto &it : mem_database)
@@ -711,14 +1483,18 @@ struct SimInstance
 							}
 
 					for (int i = 0; i < 1 << port.wide_log2; i++)
-						register_memory_addr(it.first, addr_int + i);
+						queue_memory_addr(it.first, addr_int + i);
 				}
 			}
 		}
 
-		for (auto it : children)
-			if (it.second->update_ph2(gclk, stable_past_update)) {
-				dirty_children.insert(it.second);
+		std::vector<char> child_changed(GetSize(child_list));
+		update_children(child_list, [&](int i) {
+			child_changed[i] = child_list[i]->update_ph2(gclk, stable_past_update);
+		});
+		for (int i = 0; i < GetSize(child_list); i++)
+			if (child_changed[i]) {
+				dirty_children.insert(child_list[i]);
 				did_something = true;
 			}
 
@@ -727,24 +1503,29 @@ struct SimInstance
 
 	void update_ph3(bool check_assertions)
 	{
-		for (auto &it : ff_database)
-		{
-			ff_state_t &ff = it.second;
+		if (shared->compiled_sim) {
+			if (parent == nullptr)
+				shared->compiled_sim->update_past();
+		} else {
+			for (auto &it : ff_database)
+			{
+				ff_state_t &ff = it.second;
 
-			if (ff.data.has_aload)
-				ff.past_ad = get_state(ff.data.sig_ad);
+				if (ff.data.has_aload)
+					ff.past_ad = get_state(ff.data.sig_ad);
 
-			if (ff.data.has_clk || ff.data.has_gclk)
-				ff.past_d = get_state(ff.data.sig_d);
+				if (ff.data.has_clk || ff.data.has_gclk)
+					ff.past_d = get_state(ff.data.sig_d);
 
-			if (ff.data.has_clk)
-				ff.past_clk = get_state(ff.data.sig_clk)[0];
+				if (ff.data.has_clk)
+					ff.past_clk = get_state(ff.data.sig_clk)[0];
 
-			if (ff.data.has_ce)
-				ff.past_ce = get_state(ff.data.sig_ce)[0];
+				if (ff.data.has_ce)
+					ff.past_ce = get_state(ff.data.sig_ce)[0];
 
-			if (ff.data.has_srst)
-				ff.past_srst = get_state(ff.data.sig_srst)[0];
+				if (ff.data.has_srst)
+					ff.past_srst = get_state(ff.data.sig_srst)[0];
+			}
 		}
 
 		for (auto &it : mem_database)
@@ -764,30 +1545,90 @@ struct SimInstance
 		{
 			for (auto cell : formal_database)
 			{
-				string label = log_id(cell);
-				if (cell->attributes.count(ID::src))
-					label = cell->attributes.at(ID::src).decode_string();
+				if (shared->num_lanes == 0) {
+					check_formal_cell(cell, -1);
+					continue;
+				}
+				// each lane that still replays its witness file
+				auto &compiled_sim = *shared->compiled_sim;
+				for (compiled_sim.lane = 0; compiled_sim.lane < GetSize(shared->lane_end_step); compiled_sim.lane++)
+					if (shared->step < shared->lane_end_step[compiled_sim.lane])
+						check_formal_cell(cell, shared->lane_witness[compiled_sim.lane]);
+				compiled_sim.lane = -1;
+			}
+		}
 
-				State a = get_state(cell->getPort(ID::A))[0];
-				State en = get_state(cell->getPort(ID::EN))[0];
+		update_children(child_list, [&](int i) { child_list[i]->update_ph3(check_assertions); });
+	}
 
-				if (en == State::S1 && (cell->type == ID($cover) ? a == State::S1 : a != State::S1)) {
-					shared->triggered_assertions.emplace_back(shared->step, this, cell);
-				}
+	void check_formal_cell(Cell *cell, int witness)
+	{
+		string label = log_id(cell);
+		if (cell->attributes.count(ID::src))
+			label = cell->attributes.at(ID::src).decode_string();
+		string where = witness < 0 ? "" : stringf(" in `%s`", shared->witness_files[witness].c_str());
 
-				if (cell->type == ID($cover) && en == State::S1 && a == State::S1)
-					log("Cover %s.%s (%s) reached.\n", hiername().c_str(), log_id(cell), label.c_str());
+		State a = get_state(cell->getPort(ID::A))[0];
+		State en = get_state(cell->getPort(ID::EN))[0];
 
-				if (cell->type == ID($assume) && en == State::S1 && a != State::S1)
-					log("Assumption %s.%s (%s) failed.\n", hiername().c_str(), log_id(cell), label.c_str());
+		if (en == State::S1 && (cell->type == ID($cover) ? a == State::S1 : a != State::S1)) {
+			if (shared->num_threads > 0)
+				queued_assertions.emplace_back(shared->step, this, cell, witness);
+			else
+				shared->triggered_assertions.emplace_back(shared->step, this, cell, witness);
+		}
 
-				if (cell->type == ID($assert) && en == State::S1 && a != State::S1)
-					log_warning("Assert %s.%s (%s) failed.\n", hiername().c_str(), log_id(cell), label.c_str());
-			}
+		if (cell->type == ID($cover) && en == State::S1 && a == State::S1)
+			log("Cover %s.%s (%s) reached%s.\n", hiername().c_str(), log_id(cell), label.c_str(), where.c_str());
+
+		if (cell->type == ID($assume) && en == State::S1 && a != State::S1)
+			log("Assumption %s.%s (%s) failed%s.\n", hiername().c_str(), log_id(cell), label.c_str(), where.c_str());
+
+		if (cell->type == ID($assert) && en == State::S1 && a != State::S1)
+			log_warning("Assert %s.%s (%s) failed%s.\n", hiername().c_str(), log_id(cell), label.c_str(), where.c_str());
+	}
+
+	// Calls update(i) for each instance in the given list of children, in
+	// parallel with "sim -j", and then applies the port values that they
+	// queued in list order.
+	void update_children(const std::vector<SimInstance*> &list, const std::function<void(int)> &update)
+	{
+		// the compiled engine keeps the state of all instances in one array
+		if (shared->num_threads > 1 && GetSize(list) > 1 && !shared->compiled_sim)
+			parallel_for_unnamed(GetSize(list), update, shared->num_threads);
+		else
+			for (int i = 0; i < GetSize(list); i++)
+				update(i);
+
+		for (auto child : list) {
+			for (auto &it : child->queued_outports)
+				set_state(it.first, it.second);
+			child->queued_outports.clear();
 		}
+	}
 
-		for (auto it : children)
-			it.second->update_ph3(check_assertions);
+	void queue_memory_addr(IdString memid, int addr)
+	{
+		if (shared->num_threads > 0)
+			queued_memory_addrs.emplace_back(memid, addr);
+		else
+			register_memory_addr(memid, addr);
+	}
+
+	// Registers the memory addresses and assertions queued with "sim -j", in
+	// the order of the instance tree.
+	void register_queued()
+	{
+		for (auto &it : queued_memory_addrs)
+			register_memory_addr(it.first, it.second);
+		queued_memory_addrs.clear();
+
+		for (auto &it : queued_assertions)
+			shared->triggered_assertions.push_back(it);
+		queued_assertions.clear();
+
+		for (auto child : child_list)
+			child->register_queued();
 	}
 
 	void set_initstate_outputs(State state)
@@ -961,11 +1802,25 @@ struct SimInstance
 
 	}
 
-	void register_output_step_values(std::map<int,Const> *data)
+	// Calls emit(id, value) for the traced signals and memory words that
+	// changed since the last call.
+	void register_output_step_values(const std::function<void(int, const Const &)> &emit)
 	{
 		for (auto &it : signal_database)
 		{
 			Wire *wire = it.first;
+
+			if (shared->compiled_sim) {
+				// compare in place to avoid building a Const for unchanged wires
+				auto &nets = wire_nets.at(wire);
+				auto &last = it.second.second.bits;
+				bool changed = GetSize(last) != GetSize(nets);
+				for (int i = 0; !changed && i < GetSize(nets); i++)
+					changed = last[i] != shared->compiled_sim->get(nets[i]);
+				if (!changed)
+					continue;
+			}
+
 			Const value = get_state(wire);
 			int id = it.second.first;
 
@@ -973,7 +1828,7 @@ struct SimInstance
 				continue;
 
 			it.second.second = value;
-			data->emplace(id, value);
+			emit(id, value);
 		}
 
 		for (auto &trace_mem : trace_mem_database)
@@ -992,12 +1847,12 @@ struct SimInstance
 					continue;
 
 				trace_index.second.second = value;
-				data->emplace(output_id, value);
+				emit(output_id, value);
 			}
 		}
 
 		for (auto child : children)
-			child.second->register_output_step_values(data);
+			child.second->register_output_step_values(emit);
 	}
 
 	bool setInitState()
@@ -1005,8 +1860,7 @@ struct SimInstance
 		bool did_something = false;
 		for(auto &item : fst_handles) {
 			if (item.second==0) continue; // Ignore signals not found
-			std::string v = shared->fst->valueOf(item.second);
-			did_something |= set_state(item.first, Const::from_string(v));
+			did_something |= set_state(item.first, shared->fst->constValueOf(item.second));
 		}
 		for (auto cell : module->cells())
 		{
@@ -1014,123 +1868,837 @@ struct SimInstance
 				std::string memid = cell->parameters.at(ID::MEMID).decode_string();
 				for (auto &data : fst_memories[memid]) 
 				{
-					std::string v = shared->fst->valueOf(data.second);
-					set_memory_state(memid, Const(data.first), Const::from_string(v));
+					set_memory_state(memid, Const(data.first), shared->fst->constValueOf(data.second));
+				}
+			}
+		}
+
+		for (auto child : children)
+			did_something |= child.second->setInitState();
+		return did_something;
+	}
+
+	void addAdditionalInputs()
+	{
+		for (auto cell : module->cells())
+		{
+			if (cell->type.in(ID($anyseq))) {
+				SigSpec sig_y = sigmap(cell->getPort(ID::Y));
+				if (sig_y.is_wire()) {
+					bool found = false;
+					for(auto &item : fst_handles) {
+						if (item.second==0) continue; // Ignore signals not found
+						if (sig_y == sigmap(item.first)) {
+							fst_inputs[sig_y.as_wire()] = item.second;
+							found = true;
+							break;
+						}
+					}
+					if (!found)
+						log_error("Unable to find required '%s' signal in file\n",(scope + "." + RTLIL::unescape_id(sig_y.as_wire()->name)).c_str());
 				}
 			}
 		}
+		for (auto child : children)
+			child.second->addAdditionalInputs();
+	}
+
+	bool setInputs()
+	{
+		bool did_something = false;
+		for(auto &item : fst_inputs) {
+			did_something |= set_state(item.first, shared->fst->constValueOf(item.second));
+		}
+
+		for (auto child : children)
+			did_something |= child.second->setInputs();
+
+		return did_something;
+	}
+
+	void setState(dict<int, std::pair<SigBit,bool>> bits, std::string values)
+	{
+		for(auto bit : bits) {
+			if (bit.first >= GetSize(values))
+				log_error("Too few input data bits in file.\n");
+			switch(values.at(bit.first)) {
+				case '0': set_state(bit.second.first, bit.second.second ? State::S1 : State::S0); break;
+				case '1': set_state(bit.second.first, bit.second.second ? State::S0 : State::S1); break;
+				default: set_state(bit.second.first, State::Sx); break;
+			}
+		}
+	}
+
+	void setMemState(dict<int, std::pair<std::string,int>> bits, std::string values)
+	{
+		for(auto bit : bits) {
+			if (bit.first >= GetSize(values))
+				log_error("Too few input data bits in file.\n");
+			switch(values.at(bit.first)) {
+				case '0': set_memory_state_bit(bit.second.first, bit.second.second, State::S0); break;
+				case '1': set_memory_state_bit(bit.second.first, bit.second.second, State::S1); break;
+				default: set_memory_state_bit(bit.second.first, bit.second.second, State::Sx); break;
+			}
+		}
+	}
+
+	bool checkSignals()
+	{
+		bool retVal = false;
+		for(auto &item : fst_handles) {
+			if (item.second==0) continue; // Ignore signals not found
+			Const fst_val = shared->fst->constValueOf(item.second);
+			Const sim_val = get_state(item.first);
+			if (sim_val.size()!=fst_val.size()) {
+				log_warning("Signal '%s.%s' size is different in gold and gate.\n", scope.c_str(), log_id(item.first));
+				continue;
+			}
+			if (shared->sim_mode == SimulationMode::sim) {
+				// No checks performed when using stimulus
+			} else if (shared->sim_mode == SimulationMode::gate && !fst_val.is_fully_def()) { // FST data contains X
+				for(int i=0;i<fst_val.size();i++) {
+					if (fst_val[i]!=State::Sx && fst_val[i]!=sim_val[i]) {
+						log_warning("Signal '%s.%s' in file %s in simulation %s\n", scope.c_str(), log_id(item.first), log_signal(fst_val), log_signal(sim_val));
+						retVal = true;
+						break;
+					}
+				}
+			} else if (shared->sim_mode == SimulationMode::gold && !sim_val.is_fully_def()) { // sim data contains X
+				for(int i=0;i<sim_val.size();i++) {
+					if (sim_val[i]!=State::Sx && fst_val[i]!=sim_val[i]) {
+						log_warning("Signal '%s.%s' in file %s in simulation %s\n", scope.c_str(), log_id(item.first), log_signal(fst_val), log_signal(sim_val));
+						retVal = true;
+						break;
+					}
+				}
+			} else {
+				if (fst_val!=sim_val) {
+					log_warning("Signal '%s.%s' in file %s in simulation '%s'\n", scope.c_str(), log_id(item.first), log_signal(fst_val), log_signal(sim_val));
+					retVal = true;
+				}
+			}
+		}
+		for (auto child : children)
+			retVal |= child.second->checkSignals();
+		return retVal;
+	}
+};
+
+void CompiledSim::levelize()
+{
+	int num_ops = GetSize(ops);
+
+	std::vector<int> driver(num_nets, -1);
+	for (int i = 0; i < num_ops; i++)
+		for (auto &range : ops[i].y.ranges)
+			for (int j = 0; j < range.second; j++)
+				driver[range.first + j] = i;
+
+	std::vector<std::vector<int>> fanout(num_ops);
+	std::vector<int> pending(num_ops), seen(num_ops, -1);
+	for (int i = 0; i < num_ops; i++)
+		for (auto sig : {&ops[i].a, &ops[i].b, &ops[i].s})
+			for (auto &range : sig->ranges)
+				for (int j = 0; j < range.second; j++) {
+					int d = driver[range.first + j];
+					if (d < 0 || seen[d] == i)
+						continue;
+					seen[d] = i;
+					fanout[d].push_back(i);
+					pending[i]++;
+				}
+
+	std::vector<int> level(num_ops), order;
+	order.reserve(num_ops);
+	for (int i = 0; i < num_ops; i++)
+		if (pending[i] == 0)
+			order.push_back(i);
+	for (int k = 0; k < GetSize(order); k++)
+		for (int j : fanout[order[k]]) {
+			level[j] = std::max(level[j], level[order[k]] + 1);
+			if (--pending[j] == 0)
+				order.push_back(j);
+		}
+
+	num_levels = 0;
+	for (int i : order)
+		num_levels = std::max(num_levels, level[i] + 1);
+
+	// Operations in combinational loops, and everything that depends on
+	// them, go into a last level that eval() repeats until it is stable.
+	found_loops = GetSize(order) < num_ops;
+	if (found_loops) {
+		for (int i = 0; i < num_ops; i++)
+			if (pending[i] > 0)
+				level[i] = num_levels;
+		num_levels++;
+	}
+
+	std::vector<int> level_start(num_levels + 1);
+	for (int i = 0; i < num_ops; i++)
+		level_start[level[i] + 1]++;
+	for (int i = 0; i < num_levels; i++)
+		level_start[i + 1] += level_start[i];
+	loop_start = found_loops ? level_start[num_levels - 1] : num_ops;
+
+	std::vector<Op> sorted(num_ops);
+	for (int i = 0; i < num_ops; i++)
+		sorted[level_start[level[i]]++] = std::move(ops[i]);
+	ops.swap(sorted);
+
+	initial_events.resize(num_nets);
+	for (auto &op : ops) {
+		op.active = op.type == OP_MEMORY;
+		for (auto sig : {&op.a, &op.b, &op.s})
+			for (auto &range : sig->ranges)
+				for (int j = 0; j < range.second; j++)
+					if (initial_events[range.first + j])
+						op.active = true;
+		op.active_lanes = initial_lanes(op);
+	}
+	std::vector<bool>().swap(initial_events);
+
+	if (num_lanes)
+		initial_value = value, initial_undef = undef;
+
+	int max_width = 1;
+	for (auto &op : ops)
+		max_width = std::max(max_width, std::max(op.y.width, std::max(op.a.width, op.b.width)) + 1);
+	for (auto &ff : ffs)
+		max_width = std::max(max_width, ff.q.width + 1);
+	for (auto buffer : {&a_value, &a_undef, &b_value, &b_undef, &y_value, &y_undef})
+		buffer->resize(words(max_width));
+
+	log("Compiled %d operations on %d nets into %d levels%s.\n", num_ops, num_nets, num_levels,
+			found_loops ? " (with combinational loops)" : "");
+}
+
+void CompiledSim::reduce(const NetSig &sig, bool &any_one, bool &any_zero, bool &any_undef, bool &parity)
+{
+	read(sig, sig.width, false, a_value.data(), a_undef.data());
+
+	uint64_t ones = 0, zeros = 0, undefs = 0, odd = 0;
+	for (int i = 0; i < num_words(sig.width); i++) {
+		uint64_t mask = i == num_words(sig.width) - 1 && sig.width % 64 != 0 ? (uint64_t(1) << (sig.width % 64)) - 1 : ~uint64_t(0);
+		uint64_t v = a_value[i] & ~a_undef[i];
+		ones |= v;
+		zeros |= ~a_value[i] & ~a_undef[i] & mask;
+		undefs |= a_undef[i];
+		odd ^= v;
+	}
+	for (int shift = 32; shift > 0; shift >>= 1)
+		odd ^= odd >> shift;
+
+	any_one = ones != 0;
+	any_zero = zeros != 0;
+	any_undef = undefs != 0;
+	parity = odd & 1;
+}
+
+// Like reduce(), with one bit per lane.
+void CompiledSim::reduce_lanes(const NetSig &sig, uint64_t &any_one, uint64_t &any_zero, uint64_t &any_undef, uint64_t &parity)
+{
+	any_one = any_zero = any_undef = parity = 0;
+	for (auto &range : sig.ranges)
+		for (int i = 0; i < range.second; i++) {
+			uint64_t v = value[range.first + i], u = undef[range.first + i];
+			any_one |= v & ~u;
+			any_zero |= ~v & ~u;
+			any_undef |= u;
+			parity ^= v & ~u;
+		}
+}
+
+// The value of `sig` as a condition, like const2big() in calc.cc sees it.
+State CompiledSim::reduce_bool(const NetSig &sig)
+{
+	bool any_one, any_zero, any_undef, parity;
+	reduce(sig, any_one, any_zero, any_undef, parity);
+	return any_one ? State::S1 : any_undef ? State::Sx : State::S0;
+}
+
+static State invert_state(State state)
+{
+	return state == State::S0 ? State::S1 : state == State::S1 ? State::S0 : state;
+}
+
+// The bitwise gates, from the operand scratch words to the result words.
+void CompiledSim::eval_bitwise(OpType type, int words)
+{
+	uint64_t *av = a_value.data(), *au = a_undef.data();
+	uint64_t *bv = b_value.data(), *bu = b_undef.data();
+	uint64_t *yv = y_value.data(), *yu = y_undef.data();
+
+	for (int i = 0; i < words; i++) {
+		uint64_t b = bv[i];
+		if (type == OP_ANDNOT || type == OP_ORNOT)
+			b ^= ~bu[i];
+		uint64_t a = av[i] & ~au[i];
+		b &= ~bu[i];
+		switch (type) {
+		case OP_AND:
+		case OP_NAND:
+		case OP_ANDNOT:
+			yv[i] = a & b;
+			yu[i] = (a | au[i]) & (b | bu[i]) & ~yv[i];
+			break;
+		case OP_OR:
+		case OP_NOR:
+		case OP_ORNOT:
+			yv[i] = a | b;
+			yu[i] = (au[i] | bu[i]) & ~yv[i];
+			break;
+		case OP_XOR:
+			yu[i] = au[i] | bu[i];
+			yv[i] = (a ^ b) & ~yu[i];
+			break;
+		default:
+			yu[i] = au[i] | bu[i];
+			yv[i] = ~(a ^ b) & ~yu[i];
+			break;
+		}
+		if (type == OP_NAND || type == OP_NOR)
+			yv[i] = ~yv[i] & ~yu[i];
+	}
+}
+
+bool CompiledSim::eval_op(Op &op)
+{
+	if (num_lanes)
+		return eval_op_lanes(op);
+
+	int width = op.y.width;
+	int words = num_words(width);
+	uint64_t *av = a_value.data(), *au = a_undef.data();
+	uint64_t *bv = b_value.data(), *bu = b_undef.data();
+	uint64_t *yv = y_value.data(), *yu = y_undef.data();
+
+	if (!op.active) {
+		if (all_undef(op.a) && all_undef(op.b) && all_undef(op.s))
+			return false;
+		op.active = true;
+	}
+
+	switch (op.type)
+	{
+	case OP_BUF:
+		read(op.a, width, op.a_signed, yv, yu);
+		break;
+
+	case OP_NOT:
+		read(op.a, width, op.a_signed, yv, yu);
+		for (int i = 0; i < words; i++)
+			yv[i] = ~yv[i] & ~yu[i];
+		break;
+
+	case OP_GATE_NOT:
+		// like CellTypes::eval_not(), undefined bits (incl. Sz) are kept
+		read(op.a, width, false, yv, yu);
+		for (int i = 0; i < words; i++)
+			yv[i] ^= ~yu[i];
+		break;
+
+	case OP_AND:
+	case OP_OR:
+	case OP_XOR:
+	case OP_XNOR:
+	case OP_NAND:
+	case OP_NOR:
+	case OP_ANDNOT:
+	case OP_ORNOT:
+		read(op.a, width, op.a_signed, av, au);
+		read(op.b, width, op.b_signed, bv, bu);
+		eval_bitwise(op.type, words);
+		break;
+
+	case OP_MUX: {
+		// like const_mux(), bits that differ become Sx for an undefined select
+		State sel = get(op.s.ranges.front().first);
+		if (sel == State::S0) {
+			read(op.a, width, false, yv, yu);
+		} else if (sel == State::S1) {
+			read(op.b, width, false, yv, yu);
+		} else {
+			read(op.a, width, false, yv, yu);
+			read(op.b, width, false, bv, bu);
+			for (int i = 0; i < words; i++) {
+				uint64_t diff = (yv[i] ^ bv[i]) | (yu[i] ^ bu[i]);
+				yv[i] &= ~diff;
+				yu[i] |= diff;
+			}
+		}
+		break;
+	}
+
+	case OP_REDUCE_AND:
+	case OP_REDUCE_OR:
+	case OP_REDUCE_XOR:
+	case OP_REDUCE_XNOR: {
+		bool any_one, any_zero, any_undef, parity;
+		reduce(op.a, any_one, any_zero, any_undef, parity);
+		State state;
+		if (op.type == OP_REDUCE_AND)
+			state = any_zero ? State::S0 : any_undef ? State::Sx : State::S1;
+		else if (op.type == OP_REDUCE_OR)
+			state = any_one ? State::S1 : any_undef ? State::Sx : State::S0;
+		else
+			state = any_undef ? State::Sx : parity != (op.type == OP_REDUCE_XNOR) ? State::S1 : State::S0;
+		set_result(state, width);
+		break;
+	}
+
+	case OP_LOGIC_NOT:
+		set_result(invert_state(reduce_bool(op.a)), width);
+		break;
+
+	case OP_LOGIC_AND:
+	case OP_LOGIC_OR: {
+		State a = reduce_bool(op.a), b = reduce_bool(op.b);
+		State dominant = op.type == OP_LOGIC_AND ? State::S0 : State::S1;
+		set_result(a == dominant || b == dominant ? dominant : a == State::Sx || b == State::Sx ? State::Sx : invert_state(dominant), width);
+		break;
+	}
+
+	case OP_EQ:
+	case OP_NE: {
+		int cmp_width = std::max(op.a.width, op.b.width);
+		read(op.a, cmp_width, op.a_signed, av, au);
+		read(op.b, cmp_width, op.b_signed, bv, bu);
+		bool mismatch = false, any_undef = false;
+		for (int i = 0; i < num_words(cmp_width); i++) {
+			mismatch |= ((av[i] ^ bv[i]) & ~au[i] & ~bu[i]) != 0;
+			any_undef |= (au[i] | bu[i]) != 0;
+		}
+		State state = mismatch ? State::S0 : any_undef ? State::Sx : State::S1;
+		set_result(op.type == OP_NE ? invert_state(state) : state, width);
+		break;
+	}
+
+	case OP_LT:
+	case OP_LE:
+	case OP_GT:
+	case OP_GE: {
+		// one extra bit, so that unsigned values are never negative
+		int cmp_width = std::max(op.a.width, op.b.width) + 1;
+		read(op.a, cmp_width, op.a_signed, av, au);
+		read(op.b, cmp_width, op.b_signed, bv, bu);
+		bool any_undef = false;
+		for (int i = 0; i < num_words(cmp_width); i++)
+			any_undef |= (au[i] | bu[i]) != 0;
+		if (any_undef) {
+			set_result(State::Sx, width);
+			break;
+		}
+		int top = cmp_width - 1, cmp = 0;
+		bool a_neg = (av[top / 64] >> (top % 64)) & 1, b_neg = (bv[top / 64] >> (top % 64)) & 1;
+		if (a_neg != b_neg)
+			cmp = a_neg ? -1 : 1;
+		else
+			for (int i = num_words(cmp_width) - 1; i >= 0 && cmp == 0; i--)
+				if (av[i] != bv[i])
+					cmp = av[i] < bv[i] ? -1 : 1;
+		bool result = op.type == OP_LT ? cmp < 0 : op.type == OP_LE ? cmp <= 0 : op.type == OP_GT ? cmp > 0 : cmp >= 0;
+		set_result(result ? State::S1 : State::S0, width);
+		break;
+	}
+
+	case OP_ADD:
+	case OP_SUB:
+	case OP_NEG: {
+		// like const_add_worker(), an undefined input bit makes the whole
+		// result undefined
+		int add_width = std::max(width, std::max(op.a.width, op.b.width));
+		if (op.type == OP_NEG) {
+			for (int i = 0; i < num_words(add_width); i++)
+				av[i] = au[i] = 0;
+			read(op.a, add_width, op.a_signed, bv, bu);
+		} else {
+			read(op.a, add_width, op.a_signed, av, au);
+			read(op.b, add_width, op.b_signed, bv, bu);
+		}
+		bool any_undef = false;
+		for (int i = 0; i < num_words(add_width); i++)
+			any_undef |= (au[i] | bu[i]) != 0;
+		bool subtract = op.type != OP_ADD;
+		uint64_t carry = subtract ? 1 : 0;
+		for (int i = 0; i < words; i++) {
+			if (any_undef) {
+				yv[i] = 0, yu[i] = ~uint64_t(0);
+				continue;
+			}
+			uint64_t b = subtract ? ~bv[i] : bv[i];
+			uint64_t sum = av[i] + b;
+			uint64_t carry_out = sum < b;
+			sum += carry;
+			carry_out |= sum < carry;
+			yv[i] = sum, yu[i] = 0;
+			carry = carry_out;
+		}
+		break;
+	}
+
+	case OP_CELL: {
+		Const a = read_const(op.a), b = read_const(op.b);
+		Const y = op.three_args ? CellTypes::eval(op.cell, a, b, read_const(op.s)) : CellTypes::eval(op.cell, a, b);
+		return write_const(op.y, y);
+	}
+
+	case OP_MEMORY:
+		return op.instance->update_memory(op.memid);
+	}
+
+	return write(op.y, yv, yu);
+}
+
+// Same as eval_op() in lane mode, where every scratch word holds one bit of
+// the operands in all lanes.
+bool CompiledSim::eval_op_lanes(Op &op)
+{
+	int width = op.y.width;
+	uint64_t *av = a_value.data(), *au = a_undef.data();
+	uint64_t *bv = b_value.data(), *bu = b_undef.data();
+	uint64_t *yv = y_value.data(), *yu = y_undef.data();
+
+	if (op.active_lanes != ~uint64_t(0)) {
+		for (auto sig : {&op.a, &op.b, &op.s})
+			for (auto &range : sig->ranges)
+				for (int i = 0; i < range.second; i++)
+					op.active_lanes |= value[range.first + i] | ~undef[range.first + i];
+		if (op.active_lanes == 0)
+			return false;
+	}
+
+	switch (op.type)
+	{
+	case OP_BUF:
+		read(op.a, width, op.a_signed, yv, yu);
+		break;
+
+	case OP_NOT:
+		read(op.a, width, op.a_signed, yv, yu);
+		for (int i = 0; i < width; i++)
+			yv[i] = ~yv[i] & ~yu[i];
+		break;
+
+	case OP_GATE_NOT:
+		read(op.a, width, false, yv, yu);
+		for (int i = 0; i < width; i++)
+			yv[i] ^= ~yu[i];
+		break;
+
+	case OP_AND:
+	case OP_OR:
+	case OP_XOR:
+	case OP_XNOR:
+	case OP_NAND:
+	case OP_NOR:
+	case OP_ANDNOT:
+	case OP_ORNOT:
+		read(op.a, width, op.a_signed, av, au);
+		read(op.b, width, op.b_signed, bv, bu);
+		eval_bitwise(op.type, width);
+		break;
+
+	case OP_MUX: {
+		int sel = op.s.ranges.front().first;
+		uint64_t sel_a = lanes_with(sel, State::S0), sel_b = lanes_with(sel, State::S1), sel_x = undef[sel];
+		read(op.a, width, false, av, au);
+		read(op.b, width, false, bv, bu);
+		for (int i = 0; i < width; i++) {
+			uint64_t diff = (av[i] ^ bv[i]) | (au[i] ^ bu[i]);
+			yv[i] = (av[i] & sel_a) | (bv[i] & sel_b) | (av[i] & ~diff & sel_x);
+			yu[i] = (au[i] & sel_a) | (bu[i] & sel_b) | ((au[i] | diff) & sel_x);
+		}
+		break;
+	}
+
+	case OP_REDUCE_AND:
+	case OP_REDUCE_OR:
+	case OP_REDUCE_XOR:
+	case OP_REDUCE_XNOR: {
+		uint64_t any_one, any_zero, any_undef, parity;
+		reduce_lanes(op.a, any_one, any_zero, any_undef, parity);
+		if (op.type == OP_REDUCE_AND)
+			set_result_lanes(~any_zero & ~any_undef, ~any_zero & any_undef, width);
+		else if (op.type == OP_REDUCE_OR)
+			set_result_lanes(any_one, ~any_one & any_undef, width);
+		else
+			set_result_lanes((op.type == OP_REDUCE_XNOR ? ~parity : parity) & ~any_undef, any_undef, width);
+		break;
+	}
+
+	case OP_LOGIC_NOT:
+	case OP_LOGIC_AND:
+	case OP_LOGIC_OR: {
+		// the operands as conditions, see reduce_bool()
+		uint64_t a_one, b_one, a_undef, b_undef, any_zero, parity;
+		reduce_lanes(op.a, a_one, any_zero, a_undef, parity);
+		a_undef &= ~a_one;
+		if (op.type == OP_LOGIC_NOT) {
+			set_result_lanes(~a_one & ~a_undef, a_undef, width);
+			break;
+		}
+		reduce_lanes(op.b, b_one, any_zero, b_undef, parity);
+		b_undef &= ~b_one;
+		uint64_t dominant = op.type == OP_LOGIC_AND ? (~a_one & ~a_undef) | (~b_one & ~b_undef) : a_one | b_one;
+		uint64_t result_undef = ~dominant & (a_undef | b_undef);
+		set_result_lanes(op.type == OP_LOGIC_AND ? ~dominant & ~result_undef : dominant, result_undef, width);
+		break;
+	}
 
-		for (auto child : children)
-			did_something |= child.second->setInitState();
-		return did_something;
+	case OP_EQ:
+	case OP_NE: {
+		int cmp_width = std::max(op.a.width, op.b.width);
+		read(op.a, cmp_width, op.a_signed, av, au);
+		read(op.b, cmp_width, op.b_signed, bv, bu);
+		uint64_t mismatch = 0, any_undef = 0;
+		for (int i = 0; i < cmp_width; i++) {
+			mismatch |= (av[i] ^ bv[i]) & ~au[i] & ~bu[i];
+			any_undef |= au[i] | bu[i];
+		}
+		if (op.type == OP_EQ)
+			set_result_lanes(~mismatch & ~any_undef, ~mismatch & any_undef, width);
+		else
+			set_result_lanes(mismatch, ~mismatch & any_undef, width);
+		break;
 	}
 
-	void addAdditionalInputs()
-	{
-		for (auto cell : module->cells())
-		{
-			if (cell->type.in(ID($anyseq))) {
-				SigSpec sig_y = sigmap(cell->getPort(ID::Y));
-				if (sig_y.is_wire()) {
-					bool found = false;
-					for(auto &item : fst_handles) {
-						if (item.second==0) continue; // Ignore signals not found
-						if (sig_y == sigmap(item.first)) {
-							fst_inputs[sig_y.as_wire()] = item.second;
-							found = true;
-							break;
-						}
-					}
-					if (!found)
-						log_error("Unable to find required '%s' signal in file\n",(scope + "." + RTLIL::unescape_id(sig_y.as_wire()->name)).c_str());
-				}
-			}
+	case OP_LT:
+	case OP_LE:
+	case OP_GT:
+	case OP_GE: {
+		// one extra bit, so that unsigned values are never negative
+		int cmp_width = std::max(op.a.width, op.b.width) + 1;
+		read(op.a, cmp_width, op.a_signed, av, au);
+		read(op.b, cmp_width, op.b_signed, bv, bu);
+		uint64_t any_undef = 0;
+		for (int i = 0; i < cmp_width; i++)
+			any_undef |= au[i] | bu[i];
+		// compare MSB first, with the sign bit inverted
+		int top = cmp_width - 1;
+		uint64_t less = av[top] & ~bv[top], greater = ~av[top] & bv[top];
+		for (int i = top - 1; i >= 0; i--) {
+			uint64_t equal = ~(less | greater);
+			less |= equal & ~av[i] & bv[i];
+			greater |= equal & av[i] & ~bv[i];
 		}
-		for (auto child : children)
-			child.second->addAdditionalInputs();
+		uint64_t result = op.type == OP_LT ? less : op.type == OP_LE ? ~greater : op.type == OP_GT ? greater : ~less;
+		set_result_lanes(result & ~any_undef, any_undef, width);
+		break;
 	}
 
-	bool setInputs()
-	{
-		bool did_something = false;
-		for(auto &item : fst_inputs) {
-			std::string v = shared->fst->valueOf(item.second);
-			did_something |= set_state(item.first, Const::from_string(v));
+	case OP_ADD:
+	case OP_SUB:
+	case OP_NEG: {
+		// an undefined input bit makes the whole result undefined, see eval_op()
+		int add_width = std::max(width, std::max(op.a.width, op.b.width));
+		if (op.type == OP_NEG) {
+			for (int i = 0; i < add_width; i++)
+				av[i] = au[i] = 0;
+			read(op.a, add_width, op.a_signed, bv, bu);
+		} else {
+			read(op.a, add_width, op.a_signed, av, au);
+			read(op.b, add_width, op.b_signed, bv, bu);
 		}
+		uint64_t any_undef = 0;
+		for (int i = 0; i < add_width; i++)
+			any_undef |= au[i] | bu[i];
+		bool subtract = op.type != OP_ADD;
+		uint64_t carry = subtract ? ~uint64_t(0) : 0;
+		for (int i = 0; i < width; i++) {
+			uint64_t b = subtract ? ~bv[i] : bv[i];
+			uint64_t half = av[i] ^ b;
+			yv[i] = (half ^ carry) & ~any_undef;
+			yu[i] = any_undef;
+			carry = (av[i] & b) | (carry & half);
+		}
+		break;
+	}
 
-		for (auto child : children)
-			did_something |= child.second->setInputs();
+	case OP_CELL: {
+		// one lane at a time
+		bool changed = false;
+		for (lane = 0; lane < num_lanes; lane++) {
+			if (((op.active_lanes >> lane) & 1) == 0)
+				continue;
+			Const a = read_const(op.a), b = read_const(op.b);
+			Const y = op.three_args ? CellTypes::eval(op.cell, a, b, read_const(op.s)) : CellTypes::eval(op.cell, a, b);
+			changed |= write_const(op.y, y);
+		}
+		lane = -1;
+		return changed;
+	}
 
-		return did_something;
+	case OP_MEMORY:
+		log_abort();
 	}
 
-	void setState(dict<int, std::pair<SigBit,bool>> bits, std::string values)
+	return write(op.y, yv, yu, op.active_lanes);
+}
+
+void CompiledSim::eval()
+{
+	for (int i = 0; i < loop_start; i++)
+		eval_op(ops[i]);
+
+	bool changed = true;
+	while (changed) {
+		changed = false;
+		for (int i = loop_start; i < GetSize(ops); i++)
+			changed |= eval_op(ops[i]);
+	}
+}
+
+// Same as the flip-flop part of SimInstance::update_ph2(), on whole words.
+bool CompiledSim::update_ffs(bool gclk, bool stable_past_update)
+{
+	if (num_lanes)
+		return update_ffs_lanes(gclk, stable_past_update);
+
+	bool did_something = false;
+
+	for (auto &ff : ffs)
 	{
-		for(auto bit : bits) {
-			if (bit.first >= GetSize(values))
-				log_error("Too few input data bits in file.\n");
-			switch(values.at(bit.first)) {
-				case '0': set_state(bit.second.first, bit.second.second ? State::S1 : State::S0); break;
-				case '1': set_state(bit.second.first, bit.second.second ? State::S0 : State::S1); break;
-				default: set_state(bit.second.first, State::Sx); break;
+		const FfData &ff_data = *ff.data;
+		int width = ff.q.width;
+		read(ff.q, width, false, y_value.data(), y_undef.data());
+
+		if (ff_data.has_clk && !stable_past_update) {
+			// flip-flops
+			State past_clk = get(ff.past_clk), current_clk = get(ff.clk.ranges[0].first);
+			if (ff_data.pol_clk ? (past_clk == State::S0 && current_clk != State::S0) :
+						(past_clk == State::S1 && current_clk != State::S1)) {
+				bool ce = ff_data.has_ce && get(ff.past_ce) == (ff_data.pol_ce ? State::S1 : State::S0);
+				// set if no ce, or ce is enabled
+				if (!ff_data.has_ce || ce)
+					read(ff.past_d, width, false, y_value.data(), y_undef.data());
+				// override if sync reset
+				if (ff_data.has_srst && get(ff.past_srst) == (ff_data.pol_srst ? State::S1 : State::S0) &&
+						(!ff_data.ce_over_srst || ce))
+					read(ff.val_srst, width, false, y_value.data(), y_undef.data());
+			}
+		}
+		// async load
+		if (ff_data.has_aload && get(ff.aload.ranges[0].first) == (ff_data.pol_aload ? State::S1 : State::S0))
+			read(ff_data.has_clk && !stable_past_update ? ff.past_ad : ff.ad, width, false, y_value.data(), y_undef.data());
+		// async reset
+		if (ff_data.has_arst && get(ff.arst.ranges[0].first) == (ff_data.pol_arst ? State::S1 : State::S0))
+			read(ff.val_arst, width, false, y_value.data(), y_undef.data());
+		// handle set/reset, clear has priority
+		if (ff_data.has_sr) {
+			read(ff.clr, width, false, a_value.data(), a_undef.data());
+			read(ff.set, width, false, b_value.data(), b_undef.data());
+			for (int i = 0; i < num_words(width); i++) {
+				uint64_t clr = ~a_undef[i] & (ff_data.pol_clr ? a_value[i] : ~a_value[i]);
+				uint64_t set = ~b_undef[i] & (ff_data.pol_set ? b_value[i] : ~b_value[i]) & ~clr;
+				y_value[i] = (y_value[i] & ~clr) | set;
+				y_undef[i] &= ~(clr | set);
 			}
 		}
+		if (ff_data.has_gclk) {
+			// $ff
+			if (gclk)
+				read(ff.past_d, width, false, y_value.data(), y_undef.data());
+		}
+		if (write(ff.q, y_value.data(), y_undef.data()))
+			did_something = true;
 	}
 
-	void setMemState(dict<int, std::pair<std::string,int>> bits, std::string values)
+	return did_something;
+}
+
+// Same as update_ffs() in lane mode, where each of the conditions selects
+// the lanes in which the flip-flop loads a new value.
+bool CompiledSim::update_ffs_lanes(bool gclk, bool stable_past_update)
+{
+	bool did_something = false;
+
+	for (auto &ff : ffs)
 	{
-		for(auto bit : bits) {
-			if (bit.first >= GetSize(values))
-				log_error("Too few input data bits in file.\n");
-			switch(values.at(bit.first)) {
-				case '0': set_memory_state_bit(bit.second.first, bit.second.second, State::S0); break;
-				case '1': set_memory_state_bit(bit.second.first, bit.second.second, State::S1); break;
-				default: set_memory_state_bit(bit.second.first, bit.second.second, State::Sx); break;
+		const FfData &ff_data = *ff.data;
+		int width = ff.q.width;
+		read(ff.q, width, false, y_value.data(), y_undef.data());
+
+		auto load = [&](const NetSig &sig, uint64_t lanes) {
+			if (lanes == 0)
+				return;
+			read(sig, width, false, b_value.data(), b_undef.data());
+			for (int i = 0; i < width; i++) {
+				y_value[i] = (b_value[i] & lanes) | (y_value[i] & ~lanes);
+				y_undef[i] = (b_undef[i] & lanes) | (y_undef[i] & ~lanes);
 			}
+		};
+
+		if (ff_data.has_clk && !stable_past_update) {
+			// flip-flops
+			int clk = ff.clk.ranges[0].first;
+			uint64_t edge = ff_data.pol_clk ? lanes_with(ff.past_clk, State::S0) & ~lanes_with(clk, State::S0) :
+					lanes_with(ff.past_clk, State::S1) & ~lanes_with(clk, State::S1);
+			uint64_t ce = ff_data.has_ce ? lanes_with(ff.past_ce, ff_data.pol_ce ? State::S1 : State::S0) : 0;
+			// set if no ce, or ce is enabled
+			load(ff.past_d, ff_data.has_ce ? edge & ce : edge);
+			// override if sync reset
+			if (ff_data.has_srst)
+				load(ff.val_srst, edge & lanes_with(ff.past_srst, ff_data.pol_srst ? State::S1 : State::S0) &
+						(ff_data.ce_over_srst ? ce : ~uint64_t(0)));
 		}
+		// async load
+		if (ff_data.has_aload)
+			load(ff_data.has_clk && !stable_past_update ? ff.past_ad : ff.ad,
+					lanes_with(ff.aload.ranges[0].first, ff_data.pol_aload ? State::S1 : State::S0));
+		// async reset
+		if (ff_data.has_arst)
+			load(ff.val_arst, lanes_with(ff.arst.ranges[0].first, ff_data.pol_arst ? State::S1 : State::S0));
+		// handle set/reset, clear has priority
+		if (ff_data.has_sr) {
+			read(ff.clr, width, false, a_value.data(), a_undef.data());
+			read(ff.set, width, false, b_value.data(), b_undef.data());
+			for (int i = 0; i < width; i++) {
+				uint64_t clr = ~a_undef[i] & (ff_data.pol_clr ? a_value[i] : ~a_value[i]);
+				uint64_t set = ~b_undef[i] & (ff_data.pol_set ? b_value[i] : ~b_value[i]) & ~clr;
+				y_value[i] = (y_value[i] & ~clr) | set;
+				y_undef[i] &= ~(clr | set);
+			}
+		}
+		if (ff_data.has_gclk) {
+			// $ff
+			if (gclk)
+				load(ff.past_d, ~uint64_t(0));
+		}
+		if (write(ff.q, y_value.data(), y_undef.data()))
+			did_something = true;
 	}
 
-	bool checkSignals()
+	return did_something;
+}
+
+// Same as the flip-flop part of SimInstance::update_ph3().
+void CompiledSim::update_past()
+{
+	for (auto &ff : ffs)
 	{
-		bool retVal = false;
-		for(auto &item : fst_handles) {
-			if (item.second==0) continue; // Ignore signals not found
-			Const fst_val = Const::from_string(shared->fst->valueOf(item.second));
-			Const sim_val = get_state(item.first);
-			if (sim_val.size()!=fst_val.size()) {
-				log_warning("Signal '%s.%s' size is different in gold and gate.\n", scope.c_str(), log_id(item.first));
-				continue;
-			}
-			if (shared->sim_mode == SimulationMode::sim) {
-				// No checks performed when using stimulus
-			} else if (shared->sim_mode == SimulationMode::gate && !fst_val.is_fully_def()) { // FST data contains X
-				for(int i=0;i<fst_val.size();i++) {
-					if (fst_val[i]!=State::Sx && fst_val[i]!=sim_val[i]) {
-						log_warning("Signal '%s.%s' in file %s in simulation %s\n", scope.c_str(), log_id(item.first), log_signal(fst_val), log_signal(sim_val));
-						retVal = true;
-						break;
-					}
-				}
-			} else if (shared->sim_mode == SimulationMode::gold && !sim_val.is_fully_def()) { // sim data contains X
-				for(int i=0;i<sim_val.size();i++) {
-					if (sim_val[i]!=State::Sx && fst_val[i]!=sim_val[i]) {
-						log_warning("Signal '%s.%s' in file %s in simulation %s\n", scope.c_str(), log_id(item.first), log_signal(fst_val), log_signal(sim_val));
-						retVal = true;
-						break;
-					}
-				}
-			} else {
-				if (fst_val!=sim_val) {
-					log_warning("Signal '%s.%s' in file %s in simulation '%s'\n", scope.c_str(), log_id(item.first), log_signal(fst_val), log_signal(sim_val));
-					retVal = true;
-				}
-			}
+		const FfData &ff_data = *ff.data;
+
+		if (ff_data.has_aload) {
+			read(ff.ad, ff.ad.width, false, y_value.data(), y_undef.data());
+			write(ff.past_ad, y_value.data(), y_undef.data());
 		}
-		for (auto child : children)
-			retVal |= child.second->checkSignals();
-		return retVal;
+
+		if (ff_data.has_clk || ff_data.has_gclk) {
+			read(ff.d, ff.d.width, false, y_value.data(), y_undef.data());
+			write(ff.past_d, y_value.data(), y_undef.data());
+		}
+
+		if (ff_data.has_clk)
+			copy_net(ff.past_clk, ff.clk.ranges[0].first);
+
+		if (ff_data.has_ce)
+			copy_net(ff.past_ce, ff.ce.ranges[0].first);
+
+		if (ff_data.has_srst)
+			copy_net(ff.past_srst, ff.srst.ranges[0].first);
 	}
-};
+}
 
 struct SimWorker : SimShared
 {
@@ -1144,6 +2712,9 @@ struct SimWorker : SimShared
 
 	~SimWorker()
 	{
+#ifndef YOSYS_DISABLE_THREADS
+		trace_writer.reset();
+#endif
 		outputfiles.clear();
 		delete top;
 	}
@@ -1154,14 +2725,84 @@ struct SimWorker : SimShared
 		top->register_signals(top->shared->next_output_id);
 	}
 
+	static bool has_memories(SimInstance *instance)
+	{
+		if (!instance->mem_database.empty())
+			return true;
+		for (auto child : instance->children)
+			if (has_memories(child.second))
+				return true;
+		return false;
+	}
+
+	// The trace can be streamed if the header is known after the first
+	// step: all signals of the first step are used (no -x) and no
+	// memory words are added to it later on.
+	bool can_stream_trace()
+	{
+		if (trace_buffer <= 0 || outputfiles.empty() || ignore_x || has_memories(top))
+			return false;
+		for (auto &writer : outputfiles)
+			if (!writer->can_stream())
+				return false;
+		return true;
+	}
+
 	void register_output_step(int t)
 	{
+#ifndef YOSYS_DISABLE_THREADS
+		if (trace_writer) {
+			trace_writer->begin_step(t);
+			top->register_output_step_values([this](int id, const Const &value) { trace_writer->add_value(id, value); });
+			trace_writer->end_step();
+			return;
+		}
+#endif
 		std::map<int,Const> data;
-		top->register_output_step_values(&data);
+		top->register_output_step_values([&](int id, const Const &value) { data.emplace(id, value); });
+#ifndef YOSYS_DISABLE_THREADS
+		if (output_data.empty() && can_stream_trace()) {
+			std::map<int, bool> use_signal;
+			std::vector<OutputWriter*> writers;
+			for (auto &it : data)
+				use_signal[it.first] = true;
+			for (auto &writer : outputfiles) {
+				writer->write_header(use_signal);
+				writers.push_back(writer.get());
+			}
+			trace_writer.reset(new TraceWriterThread(size_t(trace_buffer) << 10, writers));
+			trace_writer->begin_step(t);
+			for (auto &it : data)
+				trace_writer->add_value(it.first, it.second);
+			trace_writer->end_step();
+			return;
+		}
+#endif
 		output_data.emplace_back(t, data);
 	}
 
 	void write_output_files()
+	{
+#ifndef YOSYS_DISABLE_THREADS
+		if (trace_writer) {
+			trace_writer->join();
+			if (trace_writer->queue.stalls())
+				log_debug("The simulation waited %d times for the trace writer thread.\n", trace_writer->queue.stalls());
+			std::exception_ptr error = trace_writer->error;
+			trace_writer.reset();
+			if (error)
+				std::rethrow_exception(error);
+		} else
+#endif
+			write_recorded_output();
+
+		if (writeback) {
+			pool<Module*> wbmods;
+			top->writeback(wbmods);
+		}
+	}
+
+	void write_recorded_output()
 	{
 		std::map<int, bool> use_signal;
 		bool first = ignore_x;
@@ -1179,11 +2820,6 @@ struct SimWorker : SimShared
 		}
 		for(auto& writer : outputfiles)
 			writer->write(use_signal);
-		
-		if (writeback) {
-			pool<Module*> wbmods;
-			top->writeback(wbmods);
-		}
 	}
 
 	void update(bool gclk)
@@ -1209,6 +2845,9 @@ struct SimWorker : SimShared
 			log("\n-- ph3 --\n");
 
 		top->update_ph3(gclk);
+
+		if (num_threads > 0)
+			top->register_queued();
 	}
 
 	void initialize_stable_past()
@@ -1231,6 +2870,9 @@ struct SimWorker : SimShared
 		if (debug)
 			log("\n-- ph3 (initialize) --\n");
 		top->update_ph3(true);
+
+		if (num_threads > 0)
+			top->register_queued();
 	}
 
 	void set_inports(pool<IdString> ports, State value)
@@ -1899,6 +3541,99 @@ struct SimWorker : SimShared
 		write_output_files();
 	}
 
+	// Replays all of witness_files like run_cosim_yw_witness(), in batches of
+	// up to 64 that are simulated on the lanes of the compiled engine, and
+	// only keeps the assertion results.
+	void run_cosim_yw_batch(Module *topmod, int append)
+	{
+		if (!clock.empty())
+			log_cmd_error("The -clock option is not required nor supported when reading a Yosys witness file.\n");
+		if (!reset.empty())
+			log_cmd_error("The -reset option is not required nor supported when reading a Yosys witness file.\n");
+		if (multiclock)
+			log_warning("The -multiclock option is not required and ignored when reading a Yosys witness file.\n");
+		if (!outputfiles.empty() || writeback)
+			log_cmd_error("Writing traces or the final state is not supported when replaying several witness files at once.\n");
+
+		compiled = true;
+		num_lanes = std::min(GetSize(witness_files), 64);
+		top = new SimInstance(this, scope, topmod);
+
+		int max_step = 0;
+		for (int first = 0; first < GetSize(witness_files); first += num_lanes)
+		{
+			std::vector<std::unique_ptr<ReadWitness>> yws;
+			lane_witness.clear();
+			lane_end_step.clear();
+			for (int i = first; i < std::min(first + num_lanes, GetSize(witness_files)); i++) {
+				std::unique_ptr<ReadWitness> yw(new ReadWitness(witness_files[i]));
+				if (yw->steps.empty()) {
+					log_warning("Yosys witness file `%s` contains no time steps\n", yw->filename.c_str());
+					continue;
+				}
+				lane_witness.push_back(i);
+				lane_end_step.push_back(GetSize(yw->steps) + append);
+				yws.push_back(std::move(yw));
+			}
+			if (yws.empty())
+				continue;
+
+			log("Replaying %d witness files on %d lanes.\n", GetSize(yws), num_lanes);
+			std::vector<YwHierarchy> hierarchies;
+			bool any_clocks = false;
+			for (auto &yw : yws) {
+				hierarchies.push_back(prepare_yw_hierarchy(*yw));
+				any_clocks |= !yw->clocks.empty();
+			}
+
+			auto for_each_lane = [&](const std::function<void(int)> &f) {
+				for (compiled_sim->lane = 0; compiled_sim->lane < GetSize(yws); compiled_sim->lane++)
+					f(compiled_sim->lane);
+				compiled_sim->lane = -1;
+			};
+
+			compiled_sim->restart();
+			step = 0;
+			top->set_initstate_outputs(State::S1);
+			for_each_lane([&](int l) {
+				set_yw_state(*yws[l], hierarchies[l], 0);
+				set_yw_clocks(*yws[l], hierarchies[l], true);
+			});
+			initialize_stable_past();
+
+			if (any_clocks) {
+				if (debug)
+					log("Simulating non-active clock edge.\n");
+				for_each_lane([&](int l) { set_yw_clocks(*yws[l], hierarchies[l], false); });
+				update(false);
+			}
+			top->set_initstate_outputs(State::S0);
+
+			int end_step = *std::max_element(lane_end_step.begin(), lane_end_step.end());
+			for (int cycle = 1; cycle < end_step; cycle++)
+			{
+				if (verbose)
+					log("Simulating cycle %d.\n", cycle);
+				for_each_lane([&](int l) {
+					if (cycle < GetSize(yws[l]->steps))
+						set_yw_state(*yws[l], hierarchies[l], cycle);
+					set_yw_clocks(*yws[l], hierarchies[l], true);
+				});
+				update(true);
+
+				if (any_clocks) {
+					if (debug)
+						log("Simulating non-active clock edge.\n");
+					for_each_lane([&](int l) { set_yw_clocks(*yws[l], hierarchies[l], false); });
+					update(false);
+				}
+			}
+			max_step = std::max(max_step, step);
+		}
+
+		step = max_step;
+	}
+
 	void write_summary()
 	{
 		if (summary_filename.empty())
@@ -1924,6 +3659,8 @@ struct SimWorker : SimShared
 			if (!src.empty()) {
 				json.entry("src", src);
 			}
+			if (assertion.witness >= 0)
+				json.entry("witness", witness_files[assertion.witness]);
 			json.end_object();
 		}
 		json.end_array();
@@ -2156,6 +3893,24 @@ struct VCDWriter : public OutputWriter
 	}
 
 	void write(std::map<int, bool> &use_signal) override
+	{
+		if (!vcdfile.is_open()) return;
+		write_header(use_signal);
+
+		for(auto& d : worker->output_data)
+		{
+			write_time(d.first);
+			for (auto &data : d.second)
+			{
+				if (!use_signal.at(data.first)) continue;
+				write_value(data.first, data.second);
+			}
+		}
+	}
+
+	bool can_stream() override { return true; }
+
+	void write_header(std::map<int, bool> &use_signal) override
 	{
 		if (!vcdfile.is_open()) return;
 		vcdfile << stringf("$version %s $end\n", worker->date ? yosys_version_str : "Yosys");
@@ -2188,29 +3943,33 @@ struct VCDWriter : public OutputWriter
 		);
 
 		vcdfile << stringf("$enddefinitions $end\n");
+	}
 
-		for(auto& d : worker->output_data)
-		{
-			vcdfile << stringf("#%d\n", d.first);
-			for (auto &data : d.second)
-			{
-				if (!use_signal.at(data.first)) continue;
-				Const value = data.second;
-				vcdfile << "b";
-				for (int i = GetSize(value)-1; i >= 0; i--) {
-					switch (value[i]) {
-						case State::S0: vcdfile << "0"; break;
-						case State::S1: vcdfile << "1"; break;
-						case State::Sx: vcdfile << "x"; break;
-						default: vcdfile << "z";
-					}
-				}
-				vcdfile << stringf(" n%d\n", data.first);
+	void write_time(int time) override
+	{
+		if (!vcdfile.is_open()) return;
+		line = "#" + std::to_string(time) + "\n";
+		vcdfile.write(line.data(), line.size());
+	}
+
+	void write_value(int id, const Const &value) override
+	{
+		if (!vcdfile.is_open()) return;
+		line = "b";
+		for (int i = GetSize(value)-1; i >= 0; i--) {
+			switch (value[i]) {
+				case State::S0: line += '0'; break;
+				case State::S1: line += '1'; break;
+				case State::Sx: line += 'x'; break;
+				default: line += 'z';
 			}
 		}
+		line += " n" + std::to_string(id) + "\n";
+		vcdfile.write(line.data(), line.size());
 	}
 
 	std::ofstream vcdfile;
+	std::string line;
 };
 
 struct FSTWriter : public OutputWriter
@@ -2225,6 +3984,24 @@ struct FSTWriter : public OutputWriter
 	}
 
 	void write(std::map<int, bool> &use_signal) override
+	{
+		if (!fstfile) return;
+		write_header(use_signal);
+
+		for(auto& d : worker->output_data)
+		{
+			write_time(d.first);
+			for (auto &data : d.second)
+			{
+				if (!use_signal.at(data.first)) continue;
+				write_value(data.first, data.second);
+			}
+		}
+	}
+
+	bool can_stream() override { return true; }
+
+	void write_header(std::map<int, bool> &use_signal) override
 	{
 		if (!fstfile) return;
 		std::time_t t = std::time(nullptr);
@@ -2249,30 +4026,32 @@ struct FSTWriter : public OutputWriter
 				mapping.emplace(id, fst_id);
 			}
 		);
+	}
 
-		for(auto& d : worker->output_data)
-		{
-			fstWriterEmitTimeChange(fstfile, d.first);
-			for (auto &data : d.second)
-			{
-				if (!use_signal.at(data.first)) continue;
-				Const value = data.second;
-				std::stringstream ss;
-				for (int i = GetSize(value)-1; i >= 0; i--) {
-					switch (value[i]) {
-						case State::S0: ss << "0"; break;
-						case State::S1: ss << "1"; break;
-						case State::Sx: ss << "x"; break;
-						default: ss << "z";
-					}
-				}
-				fstWriterEmitValueChange(fstfile, mapping[data.first], ss.str().c_str());
+	void write_time(int time) override
+	{
+		if (!fstfile) return;
+		fstWriterEmitTimeChange(fstfile, time);
+	}
+
+	void write_value(int id, const Const &value) override
+	{
+		if (!fstfile) return;
+		str.clear();
+		for (int i = GetSize(value)-1; i >= 0; i--) {
+			switch (value[i]) {
+				case State::S0: str += '0'; break;
+				case State::S1: str += '1'; break;
+				case State::Sx: str += 'x'; break;
+				default: str += 'z';
 			}
 		}
+		fstWriterEmitValueChange(fstfile, mapping[id], str.c_str());
 	}
 
 	struct fstContext *fstfile = nullptr;
 	std::map<int,fstHandle> mapping;
+	std::string str;
 };
 
 struct AIWWriter : public OutputWriter
@@ -2463,6 +4242,12 @@ struct SimPass : public Pass {
 		log("        read simulation or formal results file\n");
 		log("            File formats supported: FST, VCD, AIW, WIT and .yw\n");
 		log("            VCD support requires vcd2fst external tool to be present\n");
+		log("        this option can be given more than once to replay several .yw\n");
+		log("        files against the same design. they are then simulated 64 at a\n");
+		log("        time with the compiled engine (see -compiled), one per bit of each\n");
+		log("        machine word, and only the assertion results are reported, see\n");
+		log("        -summary. this mode does not support memories (see memory_map)\n");
+		log("        and cannot write VCD/FST files or use -w.\n");
 		log("\n");
 		log("    -append <integer>\n");
 		log("        number of extra clock cycles to simulate for a Yosys witness input\n");
@@ -2497,6 +4282,25 @@ struct SimPass : public Pass {
 		log("    -sim-gate\n");
 		log("        co-simulation, x in FST can match any value in simulation\n");
 		log("\n");
+		log("    -compiled\n");
+		log("        levelise the design once and evaluate all combinational cells in\n");
+		log("        topological order on a flat array of packed net values, instead of\n");
+		log("        propagating changes through each instance. Cell types without a\n");
+		log("        word-level implementation are evaluated like in the default engine.\n");
+		log("\n");
+		log("    -j <threads>\n");
+		log("        update the child instances of an instance on up to this many threads,\n");
+		log("        with a barrier after each phase of an update. The output does not\n");
+		log("        depend on the number of threads, but traced memory words can be\n");
+		log("        numbered in a different order than without -j. Not used with\n");
+		log("        -compiled, which evaluates all instances at once.\n");
+		log("\n");
+		log("    -trace_buffer <kbytes>\n");
+		log("        size of the queue between the simulation and the thread that writes\n");
+		log("        the VCD and FST files (default 4096). The simulation waits while the\n");
+		log("        queue is full. With 0, or with -x, -aiw or traced memories, the files\n");
+		log("        are written after the simulation.\n");
+		log("\n");
 		log("    -q\n");
 		log("        disable per-cycle/sample log message\n");
 		log("\n");
@@ -2597,6 +4401,7 @@ struct SimPass : public Pass {
 				std::string sim_filename = args[++argidx];
 				rewrite_filename(sim_filename);
 				worker.sim_filename = sim_filename;
+				worker.witness_files.push_back(sim_filename);
 				continue;
 			}
 			if (args[argidx] == "-append" && argidx+1 < args.size()) {
@@ -2663,6 +4468,22 @@ struct SimPass : public Pass {
 				worker.multiclock = true;
 				continue;
 			}
+			if (args[argidx] == "-compiled") {
+				worker.compiled = true;
+				continue;
+			}
+			if (args[argidx] == "-j" && argidx+1 < args.size()) {
+				worker.num_threads = atoi(args[++argidx].c_str());
+				if (worker.num_threads < 1)
+					log_cmd_error("Invalid number of threads: %d\n", worker.num_threads);
+				continue;
+			}
+			if (args[argidx] == "-trace_buffer" && argidx+1 < args.size()) {
+				worker.trace_buffer = atoi(args[++argidx].c_str());
+				if (worker.trace_buffer < 0)
+					log_cmd_error("Invalid trace buffer size: %d\n", worker.trace_buffer);
+				continue;
+			}
 			break;
 		}
 		extra_args(args, argidx, design);
@@ -2685,7 +4506,14 @@ struct SimPass : public Pass {
 			top_mod = mods.front();
 		}
 
-		if (worker.sim_filename.empty())
+		if (GetSize(worker.witness_files) > 1) {
+			for (auto &filename : worker.witness_files) {
+				std::string filename_trim = file_base_name(filename);
+				if (filename_trim.size() <= 3 || filename_trim.compare(filename_trim.size()-3, std::string::npos, ".yw") != 0)
+					log_cmd_error("Only Yosys witness files (.yw) can be replayed together, `%s` is not one.\n", filename.c_str());
+			}
+			worker.run_cosim_yw_batch(top_mod, append);
+		} else if (worker.sim_filename.empty())
 			worker.run(top_mod, numcycles);
 		else {
 			std::string filename_trim = file_base_name(worker.sim_filename);
@@ -48,6 +48,7 @@
 #include "kernel/ff.h"
 #include "kernel/cost.h"
 #include "kernel/log.h"
+#include "kernel/threading.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -56,12 +57,20 @@
 #include <sstream>
 #include <climits>
 #include <vector>
+#include <chrono>
 
 #ifndef _WIN32
 #  include <unistd.h>
 #  include <dirent.h>
 #endif
 
+#if !defined(_WIN32) && !defined(__wasm) && !defined(YOSYS_LINK_ABC)
+#  define ABC_PIPE_TRANSPORT
+#  include <fcntl.h>
+#  include <poll.h>
+#  include <sys/wait.h>
+#endif
+
 #include "frontends/blif/blifparse.h"
 
 #ifdef YOSYS_LINK_ABC
@@ -113,465 +122,19 @@ bool map_mux8;
 bool map_mux16;
 
 bool markgroups;
-int map_autoidx;
-SigMap assign_map;
-RTLIL::Module *module;
-std::vector<gate_t> signal_list;
-dict<RTLIL::SigBit, int> signal_map;
-FfInitVals initvals;
 pool<std::string> enabled_gates;
 bool cmos_cost;
-bool had_init;
-
-bool clk_polarity, en_polarity, arst_polarity, srst_polarity;
-RTLIL::SigSpec clk_sig, en_sig, arst_sig, srst_sig;
-dict<int, std::string> pi_map, po_map;
-
-int map_signal(RTLIL::SigBit bit, gate_type_t gate_type = G(NONE), int in1 = -1, int in2 = -1, int in3 = -1, int in4 = -1)
-{
-	assign_map.apply(bit);
-
-	if (signal_map.count(bit) == 0) {
-		gate_t gate;
-		gate.id = signal_list.size();
-		gate.type = G(NONE);
-		gate.in1 = -1;
-		gate.in2 = -1;
-		gate.in3 = -1;
-		gate.in4 = -1;
-		gate.is_port = false;
-		gate.bit = bit;
-		gate.init = initvals(bit);
-		signal_list.push_back(gate);
-		signal_map[bit] = gate.id;
-	}
-
-	gate_t &gate = signal_list[signal_map[bit]];
-
-	if (gate_type != G(NONE))
-		gate.type = gate_type;
-	if (in1 >= 0)
-		gate.in1 = in1;
-	if (in2 >= 0)
-		gate.in2 = in2;
-	if (in3 >= 0)
-		gate.in3 = in3;
-	if (in4 >= 0)
-		gate.in4 = in4;
-
-	return gate.id;
-}
-
-void mark_port(RTLIL::SigSpec sig)
-{
-	for (auto &bit : assign_map(sig))
-		if (bit.wire != nullptr && signal_map.count(bit) > 0)
-			signal_list[signal_map[bit]].is_port = true;
-}
-
-void extract_cell(RTLIL::Cell *cell, bool keepff)
-{
-	if (RTLIL::builtin_ff_cell_types().count(cell->type)) {
-		FfData ff(&initvals, cell);
-		gate_type_t type = G(FF);
-		if (!ff.has_clk)
-			return;
-		if (ff.has_gclk)
-			return;
-		if (ff.has_aload)
-			return;
-		if (ff.has_sr)
-			return;
-		if (!ff.is_fine)
-			return;
-		if (clk_polarity != ff.pol_clk)
-			return;
-		if (clk_sig != assign_map(ff.sig_clk))
-			return;
-		if (ff.has_ce) {
-			if (en_polarity != ff.pol_ce)
-				return;
-			if (en_sig != assign_map(ff.sig_ce))
-				return;
-		} else {
-			if (GetSize(en_sig) != 0)
-				return;
-		}
-		if (ff.val_init == State::S1) {
-			type = G(FF1);
-			had_init = true;
-		} else if (ff.val_init == State::S0) {
-			type = G(FF0);
-			had_init = true;
-		}
-		if (ff.has_arst) {
-			if (arst_polarity != ff.pol_arst)
-				return;
-			if (arst_sig != assign_map(ff.sig_arst))
-				return;
-			if (ff.val_arst == State::S1) {
-				if (type == G(FF0))
-					return;
-				type = G(FF1);
-			} else if (ff.val_arst == State::S0) {
-				if (type == G(FF1))
-					return;
-				type = G(FF0);
-			}
-		} else {
-			if (GetSize(arst_sig) != 0)
-				return;
-		}
-		if (ff.has_srst) {
-			if (srst_polarity != ff.pol_srst)
-				return;
-			if (srst_sig != assign_map(ff.sig_srst))
-				return;
-			if (ff.val_srst == State::S1) {
-				if (type == G(FF0))
-					return;
-				type = G(FF1);
-			} else if (ff.val_srst == State::S0) {
-				if (type == G(FF1))
-					return;
-				type = G(FF0);
-			}
-		} else {
-			if (GetSize(srst_sig) != 0)
-				return;
-		}
-
-		if (keepff)
-			for (auto &c : ff.sig_q.chunks())
-				if (c.wire != nullptr)
-					c.wire->attributes[ID::keep] = 1;
-
-		map_signal(ff.sig_q, type, map_signal(ff.sig_d));
-
-		ff.remove();
-		return;
-	}
-
-	if (cell->type.in(ID($_BUF_), ID($_NOT_)))
-	{
-		RTLIL::SigSpec sig_a = cell->getPort(ID::A);
-		RTLIL::SigSpec sig_y = cell->getPort(ID::Y);
-
-		assign_map.apply(sig_a);
-		assign_map.apply(sig_y);
-
-		map_signal(sig_y, cell->type == ID($_BUF_) ? G(BUF) : G(NOT), map_signal(sig_a));
-
-		module->remove(cell);
-		return;
-	}
-
-	if (cell->type.in(ID($_AND_), ID($_NAND_), ID($_OR_), ID($_NOR_), ID($_XOR_), ID($_XNOR_), ID($_ANDNOT_), ID($_ORNOT_)))
-	{
-		RTLIL::SigSpec sig_a = cell->getPort(ID::A);
-		RTLIL::SigSpec sig_b = cell->getPort(ID::B);
-		RTLIL::SigSpec sig_y = cell->getPort(ID::Y);
-
-		assign_map.apply(sig_a);
-		assign_map.apply(sig_b);
-		assign_map.apply(sig_y);
-
-		int mapped_a = map_signal(sig_a);
-		int mapped_b = map_signal(sig_b);
-
-		if (cell->type == ID($_AND_))
-			map_signal(sig_y, G(AND), mapped_a, mapped_b);
-		else if (cell->type == ID($_NAND_))
-			map_signal(sig_y, G(NAND), mapped_a, mapped_b);
-		else if (cell->type == ID($_OR_))
-			map_signal(sig_y, G(OR), mapped_a, mapped_b);
-		else if (cell->type == ID($_NOR_))
-			map_signal(sig_y, G(NOR), mapped_a, mapped_b);
-		else if (cell->type == ID($_XOR_))
-			map_signal(sig_y, G(XOR), mapped_a, mapped_b);
-		else if (cell->type == ID($_XNOR_))
-			map_signal(sig_y, G(XNOR), mapped_a, mapped_b);
-		else if (cell->type == ID($_ANDNOT_))
-			map_signal(sig_y, G(ANDNOT), mapped_a, mapped_b);
-		else if (cell->type == ID($_ORNOT_))
-			map_signal(sig_y, G(ORNOT), mapped_a, mapped_b);
-		else
-			log_abort();
-
-		module->remove(cell);
-		return;
-	}
-
-	if (cell->type.in(ID($_MUX_), ID($_NMUX_)))
-	{
-		RTLIL::SigSpec sig_a = cell->getPort(ID::A);
-		RTLIL::SigSpec sig_b = cell->getPort(ID::B);
-		RTLIL::SigSpec sig_s = cell->getPort(ID::S);
-		RTLIL::SigSpec sig_y = cell->getPort(ID::Y);
-
-		assign_map.apply(sig_a);
-		assign_map.apply(sig_b);
-		assign_map.apply(sig_s);
-		assign_map.apply(sig_y);
-
-		int mapped_a = map_signal(sig_a);
-		int mapped_b = map_signal(sig_b);
-		int mapped_s = map_signal(sig_s);
-
-		map_signal(sig_y, cell->type == ID($_MUX_) ? G(MUX) : G(NMUX), mapped_a, mapped_b, mapped_s);
-
-		module->remove(cell);
-		return;
-	}
-
-	if (cell->type.in(ID($_AOI3_), ID($_OAI3_)))
-	{
-		RTLIL::SigSpec sig_a = cell->getPort(ID::A);
-		RTLIL::SigSpec sig_b = cell->getPort(ID::B);
-		RTLIL::SigSpec sig_c = cell->getPort(ID::C);
-		RTLIL::SigSpec sig_y = cell->getPort(ID::Y);
-
-		assign_map.apply(sig_a);
-		assign_map.apply(sig_b);
-		assign_map.apply(sig_c);
-		assign_map.apply(sig_y);
-
-		int mapped_a = map_signal(sig_a);
-		int mapped_b = map_signal(sig_b);
-		int mapped_c = map_signal(sig_c);
 
-		map_signal(sig_y, cell->type == ID($_AOI3_) ? G(AOI3) : G(OAI3), mapped_a, mapped_b, mapped_c);
-
-		module->remove(cell);
-		return;
-	}
-
-	if (cell->type.in(ID($_AOI4_), ID($_OAI4_)))
-	{
-		RTLIL::SigSpec sig_a = cell->getPort(ID::A);
-		RTLIL::SigSpec sig_b = cell->getPort(ID::B);
-		RTLIL::SigSpec sig_c = cell->getPort(ID::C);
-		RTLIL::SigSpec sig_d = cell->getPort(ID::D);
-		RTLIL::SigSpec sig_y = cell->getPort(ID::Y);
-
-		assign_map.apply(sig_a);
-		assign_map.apply(sig_b);
-		assign_map.apply(sig_c);
-		assign_map.apply(sig_d);
-		assign_map.apply(sig_y);
-
-		int mapped_a = map_signal(sig_a);
-		int mapped_b = map_signal(sig_b);
-		int mapped_c = map_signal(sig_c);
-		int mapped_d = map_signal(sig_d);
-
-		map_signal(sig_y, cell->type == ID($_AOI4_) ? G(AOI4) : G(OAI4), mapped_a, mapped_b, mapped_c, mapped_d);
-
-		module->remove(cell);
-		return;
-	}
-}
-
-std::string remap_name(RTLIL::IdString abc_name, RTLIL::Wire **orig_wire = nullptr)
-{
-	std::string abc_sname = abc_name.substr(1);
-	bool isnew = false;
-	if (abc_sname.compare(0, 4, "new_") == 0)
-	{
-		abc_sname.erase(0, 4);
-		isnew = true;
-	}
-	if (abc_sname.compare(0, 5, "ys__n") == 0)
-	{
-		abc_sname.erase(0, 5);
-		if (std::isdigit(abc_sname.at(0)))
-		{
-			int sid = std::atoi(abc_sname.c_str());
-			size_t postfix_start = abc_sname.find_first_not_of("0123456789");
-			std::string postfix = postfix_start != std::string::npos ? abc_sname.substr(postfix_start) : "";
-
-			if (sid < GetSize(signal_list))
-			{
-				auto sig = signal_list.at(sid);
-				if (sig.bit.wire != nullptr)
-				{
-					std::string s = stringf("$abc$%d$%s", map_autoidx, sig.bit.wire->name.c_str()+1);
-					if (sig.bit.wire->width != 1)
-						s += stringf("[%d]", sig.bit.offset);
-					if (isnew)
-						s += "_new";
-					s += postfix;
-					if (orig_wire != nullptr)
-						*orig_wire = sig.bit.wire;
-					return s;
-				}
-			}
-		}
-	}
-	return stringf("$abc$%d$%s", map_autoidx, abc_name.c_str()+1);
-}
-
-void dump_loop_graph(FILE *f, int &nr, dict<int, pool<int>> &edges, pool<int> &workpool, std::vector<int> &in_counts)
-{
-	if (f == nullptr)
-		return;
-
-	log("Dumping loop state graph to slide %d.\n", ++nr);
-
-	fprintf(f, "digraph \"slide%d\" {\n", nr);
-	fprintf(f, "  label=\"slide%d\";\n", nr);
-	fprintf(f, "  rankdir=\"TD\";\n");
-
-	pool<int> nodes;
-	for (auto &e : edges) {
-		nodes.insert(e.first);
-		for (auto n : e.second)
-			nodes.insert(n);
-	}
-
-	for (auto n : nodes)
-		fprintf(f, "  ys__n%d [label=\"%s\\nid=%d, count=%d\"%s];\n", n, log_signal(signal_list[n].bit),
-				n, in_counts[n], workpool.count(n) ? ", shape=box" : "");
-
-	for (auto &e : edges)
-	for (auto n : e.second)
-		fprintf(f, "  ys__n%d -> ys__n%d;\n", e.first, n);
-
-	fprintf(f, "}\n");
-}
-
-void handle_loops()
+// The options of the pass that are passed on to the ABC invocations.
+struct AbcConfig
 {
-	// http://en.wikipedia.org/wiki/Topological_sorting
-	// (Kahn, Arthur B. (1962), "Topological sorting of large networks")
-
-	dict<int, pool<int>> edges;
-	std::vector<int> in_edges_count(signal_list.size());
-	pool<int> workpool;
-
-	FILE *dot_f = nullptr;
-	int dot_nr = 0;
-
-	// uncomment for troubleshooting the loop detection code
-	// dot_f = fopen("test.dot", "w");
-
-	for (auto &g : signal_list) {
-		if (g.type == G(NONE) || g.type == G(FF) || g.type == G(FF0) || g.type == G(FF1)) {
-			workpool.insert(g.id);
-		} else {
-			if (g.in1 >= 0) {
-				edges[g.in1].insert(g.id);
-				in_edges_count[g.id]++;
-			}
-			if (g.in2 >= 0 && g.in2 != g.in1) {
-				edges[g.in2].insert(g.id);
-				in_edges_count[g.id]++;
-			}
-			if (g.in3 >= 0 && g.in3 != g.in2 && g.in3 != g.in1) {
-				edges[g.in3].insert(g.id);
-				in_edges_count[g.id]++;
-			}
-			if (g.in4 >= 0 && g.in4 != g.in3 && g.in4 != g.in2 && g.in4 != g.in1) {
-				edges[g.in4].insert(g.id);
-				in_edges_count[g.id]++;
-			}
-		}
-	}
-
-	dump_loop_graph(dot_f, dot_nr, edges, workpool, in_edges_count);
-
-	while (workpool.size() > 0)
-	{
-		int id = *workpool.begin();
-		workpool.erase(id);
-
-		// log("Removing non-loop node %d from graph: %s\n", id, log_signal(signal_list[id].bit));
-
-		for (int id2 : edges[id]) {
-			log_assert(in_edges_count[id2] > 0);
-			if (--in_edges_count[id2] == 0)
-				workpool.insert(id2);
-		}
-		edges.erase(id);
-
-		dump_loop_graph(dot_f, dot_nr, edges, workpool, in_edges_count);
-
-		while (workpool.size() == 0)
-		{
-			if (edges.size() == 0)
-				break;
-
-			int id1 = edges.begin()->first;
-
-			for (auto &edge_it : edges) {
-				int id2 = edge_it.first;
-				RTLIL::Wire *w1 = signal_list[id1].bit.wire;
-				RTLIL::Wire *w2 = signal_list[id2].bit.wire;
-				if (w1 == nullptr)
-					id1 = id2;
-				else if (w2 == nullptr)
-					continue;
-				else if (w1->name[0] == '$' && w2->name[0] == '\\')
-					id1 = id2;
-				else if (w1->name[0] == '\\' && w2->name[0] == '$')
-					continue;
-				else if (edges[id1].size() < edges[id2].size())
-					id1 = id2;
-				else if (edges[id1].size() > edges[id2].size())
-					continue;
-				else if (w2->name.str() < w1->name.str())
-					id1 = id2;
-			}
-
-			if (edges[id1].size() == 0) {
-				edges.erase(id1);
-				continue;
-			}
-
-			log_assert(signal_list[id1].bit.wire != nullptr);
-
-			std::stringstream sstr;
-			sstr << "$abcloop$" << (autoidx++);
-			RTLIL::Wire *wire = module->addWire(sstr.str());
-
-			bool first_line = true;
-			for (int id2 : edges[id1]) {
-				if (first_line)
-					log("Breaking loop using new signal %s: %s -> %s\n", log_signal(RTLIL::SigSpec(wire)),
-							log_signal(signal_list[id1].bit), log_signal(signal_list[id2].bit));
-				else
-					log("                               %*s  %s -> %s\n", int(strlen(log_signal(RTLIL::SigSpec(wire)))), "",
-							log_signal(signal_list[id1].bit), log_signal(signal_list[id2].bit));
-				first_line = false;
-			}
-
-			int id3 = map_signal(RTLIL::SigSpec(wire));
-			signal_list[id1].is_port = true;
-			signal_list[id3].is_port = true;
-			log_assert(id3 == int(in_edges_count.size()));
-			in_edges_count.push_back(0);
-			workpool.insert(id3);
-
-			for (int id2 : edges[id1]) {
-				if (signal_list[id2].in1 == id1)
-					signal_list[id2].in1 = id3;
-				if (signal_list[id2].in2 == id1)
-					signal_list[id2].in2 = id3;
-				if (signal_list[id2].in3 == id1)
-					signal_list[id2].in3 = id3;
-				if (signal_list[id2].in4 == id1)
-					signal_list[id2].in4 = id3;
-			}
-			edges[id1].swap(edges[id3]);
-
-			module->connect(RTLIL::SigSig(signal_list[id3].bit, signal_list[id1].bit));
-			dump_loop_graph(dot_f, dot_nr, edges, workpool, in_edges_count);
-		}
-	}
-
-	if (dot_f != nullptr)
-		fclose(dot_f);
-}
+	std::string script_file, exe_file, constr_file;
+	std::vector<std::string> liberty_files, genlib_files;
+	std::string delay_target, sop_inputs, sop_products, lutin_shared = "-S 1";
+	vector<int> lut_costs;
+	bool cleanup = true, keepff = false, fast_mode = false;
+	bool show_tempdir = false, sop_mode = false, abc_dress = false, pipe_mode = false;
+};
 
 std::string add_echos_to_abc_cmd(std::string str)
 {
@@ -646,8 +209,10 @@ struct abc_output_filter
 	std::string linebuf;
 	std::string tempdir_name;
 	bool show_tempdir;
+	const dict<int, std::string> &pi_map, &po_map;
 
-	abc_output_filter(std::string tempdir_name, bool show_tempdir) : tempdir_name(tempdir_name), show_tempdir(show_tempdir)
+	abc_output_filter(std::string tempdir_name, bool show_tempdir, const dict<int, std::string> &pi_map, const dict<int, std::string> &po_map) :
+			tempdir_name(tempdir_name), show_tempdir(show_tempdir), pi_map(pi_map), po_map(po_map)
 	{
 		got_cr = false;
 		escape_seq_state = 0;
@@ -693,407 +258,984 @@ struct abc_output_filter
 			return;
 		}
 
-		for (char ch : line)
-			next_char(ch);
-	}
-};
+		for (char ch : line)
+			next_char(ch);
+	}
+};
+
+#ifdef ABC_PIPE_TRANSPORT
+// Creates a pipe that is not inherited by other child processes, such as the
+// ABC processes of concurrent jobs (abc -j).
+int cloexec_pipe(int fds[2])
+{
+#ifdef __linux__
+	return pipe2(fds, O_CLOEXEC);
+#else
+	if (pipe(fds) != 0)
+		return -1;
+	fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+	fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+	return 0;
+#endif
+}
+
+// Like run_command(), but everything the command writes to file descriptor 3
+// is collected in fd3_data. Both outputs are read as they are produced, so
+// that the command never blocks on a full pipe.
+int run_command_fd3(const std::string &command, std::function<void(const std::string&)> process_line, std::string &fd3_data)
+{
+	int out_pipe[2], fd3_pipe[2];
+	if (cloexec_pipe(out_pipe) != 0)
+		return -1;
+	if (cloexec_pipe(fd3_pipe) != 0) {
+		close(out_pipe[0]);
+		close(out_pipe[1]);
+		return -1;
+	}
+
+	pid_t pid = fork();
+	if (pid == 0) {
+		// dup2() clears FD_CLOEXEC on the new descriptors
+		dup2(out_pipe[1], 1);
+		dup2(out_pipe[1], 2);
+		dup2(fd3_pipe[1], 3);
+		execl("/bin/sh", "sh", "-c", command.c_str(), (char*)nullptr);
+		_exit(127);
+	}
+
+	close(out_pipe[1]);
+	close(fd3_pipe[1]);
+	if (pid < 0) {
+		close(out_pipe[0]);
+		close(fd3_pipe[0]);
+		return -1;
+	}
+
+	struct pollfd fds[2] = {{out_pipe[0], POLLIN, 0}, {fd3_pipe[0], POLLIN, 0}};
+	int open_fds = 2;
+	std::string line;
+	char buffer[4096];
+	while (open_fds > 0)
+	{
+		if (poll(fds, 2, -1) < 0) {
+			if (errno == EINTR)
+				continue;
+			break;
+		}
+		for (int i = 0; i < 2; i++) {
+			if (fds[i].fd < 0 || fds[i].revents == 0)
+				continue;
+			ssize_t n = read(fds[i].fd, buffer, sizeof(buffer));
+			if (n < 0 && errno == EINTR)
+				continue;
+			if (n <= 0) {
+				close(fds[i].fd);
+				fds[i].fd = -1;
+				open_fds--;
+				continue;
+			}
+			if (i == 1) {
+				fd3_data.append(buffer, n);
+				continue;
+			}
+			for (ssize_t k = 0; k < n; k++) {
+				line += buffer[k];
+				if (buffer[k] == '\n')
+					process_line(line), line.clear();
+			}
+		}
+	}
+	if (!line.empty())
+		process_line(line);
+	for (auto &pfd : fds)
+		if (pfd.fd >= 0)
+			close(pfd.fd);
+
+	int status;
+	while (waitpid(pid, &status, 0) < 0)
+		if (errno != EINTR)
+			return -1;
+	return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+#endif
+
+// One invocation of ABC, for the selected cells of a module or for one of its
+// clock domains (-dff). extract() replaces the cells by a BLIF netlist in a
+// temp directory, run_abc() runs ABC on it and reintegrate() adds the mapped
+// netlist back to the module. run_abc() does not access the design, so that
+// the ABC processes of several jobs can run in parallel (-j).
+struct AbcModuleState
+{
+	const AbcConfig &config;
+	RTLIL::Module *module;
+	int map_autoidx;
+	SigMap assign_map;
+	FfInitVals initvals;
+	std::vector<gate_t> signal_list;
+	dict<RTLIL::SigBit, int> signal_map;
+	bool had_init;
+
+	bool clk_polarity = true, en_polarity = true, arst_polarity = true, srst_polarity = true;
+	RTLIL::SigSpec clk_sig, en_sig, arst_sig, srst_sig;
+	dict<int, std::string> pi_map, po_map;
+
+	std::string tempdir_name;
+	std::string mapped_blif;
+	int count_output = 0;
+	double runtime = 0;
+
+	AbcModuleState(const AbcConfig &config, RTLIL::Module *module, const SigMap &assign_map) :
+			config(config), module(module), assign_map(assign_map)
+	{
+		initvals.set(&this->assign_map, module);
+	}
+
+	// with -pipe, ABC writes the mapped netlist to a pipe instead of output.blif
+	bool use_pipe() const
+	{
+#ifdef ABC_PIPE_TRANSPORT
+		return config.pipe_mode;
+#else
+		return false;
+#endif
+	}
+
+	int map_signal(RTLIL::SigBit bit, gate_type_t gate_type = G(NONE), int in1 = -1, int in2 = -1, int in3 = -1, int in4 = -1)
+	{
+		assign_map.apply(bit);
+
+		if (signal_map.count(bit) == 0) {
+			gate_t gate;
+			gate.id = signal_list.size();
+			gate.type = G(NONE);
+			gate.in1 = -1;
+			gate.in2 = -1;
+			gate.in3 = -1;
+			gate.in4 = -1;
+			gate.is_port = false;
+			gate.bit = bit;
+			gate.init = initvals(bit);
+			signal_list.push_back(gate);
+			signal_map[bit] = gate.id;
+		}
+
+		gate_t &gate = signal_list[signal_map[bit]];
+
+		if (gate_type != G(NONE))
+			gate.type = gate_type;
+		if (in1 >= 0)
+			gate.in1 = in1;
+		if (in2 >= 0)
+			gate.in2 = in2;
+		if (in3 >= 0)
+			gate.in3 = in3;
+		if (in4 >= 0)
+			gate.in4 = in4;
+
+		return gate.id;
+	}
+
+	void mark_port(RTLIL::SigSpec sig)
+	{
+		for (auto &bit : assign_map(sig))
+			if (bit.wire != nullptr && signal_map.count(bit) > 0)
+				signal_list[signal_map[bit]].is_port = true;
+	}
+
+	void extract_cell(RTLIL::Cell *cell, bool keepff)
+	{
+		if (RTLIL::builtin_ff_cell_types().count(cell->type)) {
+			FfData ff(&initvals, cell);
+			gate_type_t type = G(FF);
+			if (!ff.has_clk)
+				return;
+			if (ff.has_gclk)
+				return;
+			if (ff.has_aload)
+				return;
+			if (ff.has_sr)
+				return;
+			if (!ff.is_fine)
+				return;
+			if (clk_polarity != ff.pol_clk)
+				return;
+			if (clk_sig != assign_map(ff.sig_clk))
+				return;
+			if (ff.has_ce) {
+				if (en_polarity != ff.pol_ce)
+					return;
+				if (en_sig != assign_map(ff.sig_ce))
+					return;
+			} else {
+				if (GetSize(en_sig) != 0)
+					return;
+			}
+			if (ff.val_init == State::S1) {
+				type = G(FF1);
+				had_init = true;
+			} else if (ff.val_init == State::S0) {
+				type = G(FF0);
+				had_init = true;
+			}
+			if (ff.has_arst) {
+				if (arst_polarity != ff.pol_arst)
+					return;
+				if (arst_sig != assign_map(ff.sig_arst))
+					return;
+				if (ff.val_arst == State::S1) {
+					if (type == G(FF0))
+						return;
+					type = G(FF1);
+				} else if (ff.val_arst == State::S0) {
+					if (type == G(FF1))
+						return;
+					type = G(FF0);
+				}
+			} else {
+				if (GetSize(arst_sig) != 0)
+					return;
+			}
+			if (ff.has_srst) {
+				if (srst_polarity != ff.pol_srst)
+					return;
+				if (srst_sig != assign_map(ff.sig_srst))
+					return;
+				if (ff.val_srst == State::S1) {
+					if (type == G(FF0))
+						return;
+					type = G(FF1);
+				} else if (ff.val_srst == State::S0) {
+					if (type == G(FF1))
+						return;
+					type = G(FF0);
+				}
+			} else {
+				if (GetSize(srst_sig) != 0)
+					return;
+			}
+
+			if (keepff)
+				for (auto &c : ff.sig_q.chunks())
+					if (c.wire != nullptr)
+						c.wire->attributes[ID::keep] = 1;
+
+			map_signal(ff.sig_q, type, map_signal(ff.sig_d));
+
+			ff.remove();
+			return;
+		}
+
+		if (cell->type.in(ID($_BUF_), ID($_NOT_)))
+		{
+			RTLIL::SigSpec sig_a = cell->getPort(ID::A);
+			RTLIL::SigSpec sig_y = cell->getPort(ID::Y);
+
+			assign_map.apply(sig_a);
+			assign_map.apply(sig_y);
+
+			map_signal(sig_y, cell->type == ID($_BUF_) ? G(BUF) : G(NOT), map_signal(sig_a));
+
+			module->remove(cell);
+			return;
+		}
+
+		if (cell->type.in(ID($_AND_), ID($_NAND_), ID($_OR_), ID($_NOR_), ID($_XOR_), ID($_XNOR_), ID($_ANDNOT_), ID($_ORNOT_)))
+		{
+			RTLIL::SigSpec sig_a = cell->getPort(ID::A);
+			RTLIL::SigSpec sig_b = cell->getPort(ID::B);
+			RTLIL::SigSpec sig_y = cell->getPort(ID::Y);
+
+			assign_map.apply(sig_a);
+			assign_map.apply(sig_b);
+			assign_map.apply(sig_y);
+
+			int mapped_a = map_signal(sig_a);
+			int mapped_b = map_signal(sig_b);
+
+			if (cell->type == ID($_AND_))
+				map_signal(sig_y, G(AND), mapped_a, mapped_b);
+			else if (cell->type == ID($_NAND_))
+				map_signal(sig_y, G(NAND), mapped_a, mapped_b);
+			else if (cell->type == ID($_OR_))
+				map_signal(sig_y, G(OR), mapped_a, mapped_b);
+			else if (cell->type == ID($_NOR_))
+				map_signal(sig_y, G(NOR), mapped_a, mapped_b);
+			else if (cell->type == ID($_XOR_))
+				map_signal(sig_y, G(XOR), mapped_a, mapped_b);
+			else if (cell->type == ID($_XNOR_))
+				map_signal(sig_y, G(XNOR), mapped_a, mapped_b);
+			else if (cell->type == ID($_ANDNOT_))
+				map_signal(sig_y, G(ANDNOT), mapped_a, mapped_b);
+			else if (cell->type == ID($_ORNOT_))
+				map_signal(sig_y, G(ORNOT), mapped_a, mapped_b);
+			else
+				log_abort();
+
+			module->remove(cell);
+			return;
+		}
+
+		if (cell->type.in(ID($_MUX_), ID($_NMUX_)))
+		{
+			RTLIL::SigSpec sig_a = cell->getPort(ID::A);
+			RTLIL::SigSpec sig_b = cell->getPort(ID::B);
+			RTLIL::SigSpec sig_s = cell->getPort(ID::S);
+			RTLIL::SigSpec sig_y = cell->getPort(ID::Y);
+
+			assign_map.apply(sig_a);
+			assign_map.apply(sig_b);
+			assign_map.apply(sig_s);
+			assign_map.apply(sig_y);
+
+			int mapped_a = map_signal(sig_a);
+			int mapped_b = map_signal(sig_b);
+			int mapped_s = map_signal(sig_s);
+
+			map_signal(sig_y, cell->type == ID($_MUX_) ? G(MUX) : G(NMUX), mapped_a, mapped_b, mapped_s);
+
+			module->remove(cell);
+			return;
+		}
+
+		if (cell->type.in(ID($_AOI3_), ID($_OAI3_)))
+		{
+			RTLIL::SigSpec sig_a = cell->getPort(ID::A);
+			RTLIL::SigSpec sig_b = cell->getPort(ID::B);
+			RTLIL::SigSpec sig_c = cell->getPort(ID::C);
+			RTLIL::SigSpec sig_y = cell->getPort(ID::Y);
+
+			assign_map.apply(sig_a);
+			assign_map.apply(sig_b);
+			assign_map.apply(sig_c);
+			assign_map.apply(sig_y);
+
+			int mapped_a = map_signal(sig_a);
+			int mapped_b = map_signal(sig_b);
+			int mapped_c = map_signal(sig_c);
+
+			map_signal(sig_y, cell->type == ID($_AOI3_) ? G(AOI3) : G(OAI3), mapped_a, mapped_b, mapped_c);
+
+			module->remove(cell);
+			return;
+		}
+
+		if (cell->type.in(ID($_AOI4_), ID($_OAI4_)))
+		{
+			RTLIL::SigSpec sig_a = cell->getPort(ID::A);
+			RTLIL::SigSpec sig_b = cell->getPort(ID::B);
+			RTLIL::SigSpec sig_c = cell->getPort(ID::C);
+			RTLIL::SigSpec sig_d = cell->getPort(ID::D);
+			RTLIL::SigSpec sig_y = cell->getPort(ID::Y);
+
+			assign_map.apply(sig_a);
+			assign_map.apply(sig_b);
+			assign_map.apply(sig_c);
+			assign_map.apply(sig_d);
+			assign_map.apply(sig_y);
+
+			int mapped_a = map_signal(sig_a);
+			int mapped_b = map_signal(sig_b);
+			int mapped_c = map_signal(sig_c);
+			int mapped_d = map_signal(sig_d);
+
+			map_signal(sig_y, cell->type == ID($_AOI4_) ? G(AOI4) : G(OAI4), mapped_a, mapped_b, mapped_c, mapped_d);
+
+			module->remove(cell);
+			return;
+		}
+	}
+
+	std::string remap_name(RTLIL::IdString abc_name, RTLIL::Wire **orig_wire = nullptr)
+	{
+		std::string abc_sname = abc_name.substr(1);
+		bool isnew = false;
+		if (abc_sname.compare(0, 4, "new_") == 0)
+		{
+			abc_sname.erase(0, 4);
+			isnew = true;
+		}
+		if (abc_sname.compare(0, 5, "ys__n") == 0)
+		{
+			abc_sname.erase(0, 5);
+			if (std::isdigit(abc_sname.at(0)))
+			{
+				int sid = std::atoi(abc_sname.c_str());
+				size_t postfix_start = abc_sname.find_first_not_of("0123456789");
+				std::string postfix = postfix_start != std::string::npos ? abc_sname.substr(postfix_start) : "";
+
+				if (sid < GetSize(signal_list))
+				{
+					auto sig = signal_list.at(sid);
+					if (sig.bit.wire != nullptr)
+					{
+						std::string s = stringf("$abc$%d$%s", map_autoidx, sig.bit.wire->name.c_str()+1);
+						if (sig.bit.wire->width != 1)
+							s += stringf("[%d]", sig.bit.offset);
+						if (isnew)
+							s += "_new";
+						s += postfix;
+						if (orig_wire != nullptr)
+							*orig_wire = sig.bit.wire;
+						return s;
+					}
+				}
+			}
+		}
+		return stringf("$abc$%d$%s", map_autoidx, abc_name.c_str()+1);
+	}
+
+	void dump_loop_graph(FILE *f, int &nr, dict<int, pool<int>> &edges, pool<int> &workpool, std::vector<int> &in_counts)
+	{
+		if (f == nullptr)
+			return;
+
+		log("Dumping loop state graph to slide %d.\n", ++nr);
+
+		fprintf(f, "digraph \"slide%d\" {\n", nr);
+		fprintf(f, "  label=\"slide%d\";\n", nr);
+		fprintf(f, "  rankdir=\"TD\";\n");
+
+		pool<int> nodes;
+		for (auto &e : edges) {
+			nodes.insert(e.first);
+			for (auto n : e.second)
+				nodes.insert(n);
+		}
+
+		for (auto n : nodes)
+			fprintf(f, "  ys__n%d [label=\"%s\\nid=%d, count=%d\"%s];\n", n, log_signal(signal_list[n].bit),
+					n, in_counts[n], workpool.count(n) ? ", shape=box" : "");
 
-void abc_module(RTLIL::Design *design, RTLIL::Module *current_module, std::string script_file, std::string exe_file,
-		std::vector<std::string> &liberty_files, std::vector<std::string> &genlib_files, std::string constr_file,
-		bool cleanup, vector<int> lut_costs, bool dff_mode, std::string clk_str, bool keepff, std::string delay_target,
-		std::string sop_inputs, std::string sop_products, std::string lutin_shared, bool fast_mode,
-		const std::vector<RTLIL::Cell*> &cells, bool show_tempdir, bool sop_mode, bool abc_dress)
-{
-	module = current_module;
-	map_autoidx = autoidx++;
+		for (auto &e : edges)
+		for (auto n : e.second)
+			fprintf(f, "  ys__n%d -> ys__n%d;\n", e.first, n);
 
-	signal_map.clear();
-	signal_list.clear();
-	pi_map.clear();
-	po_map.clear();
+		fprintf(f, "}\n");
+	}
 
-	if (clk_str != "$")
+	void handle_loops()
 	{
-		clk_polarity = true;
-		clk_sig = RTLIL::SigSpec();
+		// http://en.wikipedia.org/wiki/Topological_sorting
+		// (Kahn, Arthur B. (1962), "Topological sorting of large networks")
 
-		en_polarity = true;
-		en_sig = RTLIL::SigSpec();
+		dict<int, pool<int>> edges;
+		std::vector<int> in_edges_count(signal_list.size());
+		pool<int> workpool;
 
-		arst_polarity = true;
-		arst_sig = RTLIL::SigSpec();
+		FILE *dot_f = nullptr;
+		int dot_nr = 0;
 
-		srst_polarity = true;
-		srst_sig = RTLIL::SigSpec();
-	}
+		// uncomment for troubleshooting the loop detection code
+		// dot_f = fopen("test.dot", "w");
 
-	if (!clk_str.empty() && clk_str != "$")
-	{
-		std::string en_str;
-		std::string arst_str;
-		std::string srst_str;
-		if (clk_str.find(',') != std::string::npos) {
-			int pos = clk_str.find(',');
-			en_str = clk_str.substr(pos+1);
-			clk_str = clk_str.substr(0, pos);
-		}
-		if (en_str.find(',') != std::string::npos) {
-			int pos = en_str.find(',');
-			arst_str = en_str.substr(pos+1);
-			arst_str = en_str.substr(0, pos);
-		}
-		if (arst_str.find(',') != std::string::npos) {
-			int pos = arst_str.find(',');
-			srst_str = arst_str.substr(pos+1);
-			srst_str = arst_str.substr(0, pos);
-		}
-		if (clk_str[0] == '!') {
-			clk_polarity = false;
-			clk_str = clk_str.substr(1);
-		}
-		if (module->wire(RTLIL::escape_id(clk_str)) != nullptr)
-			clk_sig = assign_map(module->wire(RTLIL::escape_id(clk_str)));
-		if (en_str != "") {
-			if (en_str[0] == '!') {
-				en_polarity = false;
-				en_str = en_str.substr(1);
+		for (auto &g : signal_list) {
+			if (g.type == G(NONE) || g.type == G(FF) || g.type == G(FF0) || g.type == G(FF1)) {
+				workpool.insert(g.id);
+			} else {
+				if (g.in1 >= 0) {
+					edges[g.in1].insert(g.id);
+					in_edges_count[g.id]++;
+				}
+				if (g.in2 >= 0 && g.in2 != g.in1) {
+					edges[g.in2].insert(g.id);
+					in_edges_count[g.id]++;
+				}
+				if (g.in3 >= 0 && g.in3 != g.in2 && g.in3 != g.in1) {
+					edges[g.in3].insert(g.id);
+					in_edges_count[g.id]++;
+				}
+				if (g.in4 >= 0 && g.in4 != g.in3 && g.in4 != g.in2 && g.in4 != g.in1) {
+					edges[g.in4].insert(g.id);
+					in_edges_count[g.id]++;
+				}
 			}
-			if (module->wire(RTLIL::escape_id(en_str)) != nullptr)
-				en_sig = assign_map(module->wire(RTLIL::escape_id(en_str)));
 		}
-		if (arst_str != "") {
-			if (arst_str[0] == '!') {
-				arst_polarity = false;
-				arst_str = arst_str.substr(1);
+
+		dump_loop_graph(dot_f, dot_nr, edges, workpool, in_edges_count);
+
+		while (workpool.size() > 0)
+		{
+			int id = *workpool.begin();
+			workpool.erase(id);
+
+			// log("Removing non-loop node %d from graph: %s\n", id, log_signal(signal_list[id].bit));
+
+			for (int id2 : edges[id]) {
+				log_assert(in_edges_count[id2] > 0);
+				if (--in_edges_count[id2] == 0)
+					workpool.insert(id2);
 			}
-			if (module->wire(RTLIL::escape_id(arst_str)) != nullptr)
-				arst_sig = assign_map(module->wire(RTLIL::escape_id(arst_str)));
-		}
-		if (srst_str != "") {
-			if (srst_str[0] == '!') {
-				srst_polarity = false;
-				srst_str = srst_str.substr(1);
+			edges.erase(id);
+
+			dump_loop_graph(dot_f, dot_nr, edges, workpool, in_edges_count);
+
+			while (workpool.size() == 0)
+			{
+				if (edges.size() == 0)
+					break;
+
+				int id1 = edges.begin()->first;
+
+				for (auto &edge_it : edges) {
+					int id2 = edge_it.first;
+					RTLIL::Wire *w1 = signal_list[id1].bit.wire;
+					RTLIL::Wire *w2 = signal_list[id2].bit.wire;
+					if (w1 == nullptr)
+						id1 = id2;
+					else if (w2 == nullptr)
+						continue;
+					else if (w1->name[0] == '$' && w2->name[0] == '\\')
+						id1 = id2;
+					else if (w1->name[0] == '\\' && w2->name[0] == '$')
+						continue;
+					else if (edges[id1].size() < edges[id2].size())
+						id1 = id2;
+					else if (edges[id1].size() > edges[id2].size())
+						continue;
+					else if (w2->name.str() < w1->name.str())
+						id1 = id2;
+				}
+
+				if (edges[id1].size() == 0) {
+					edges.erase(id1);
+					continue;
+				}
+
+				log_assert(signal_list[id1].bit.wire != nullptr);
+
+				std::stringstream sstr;
+				sstr << "$abcloop$" << (autoidx++);
+				RTLIL::Wire *wire = module->addWire(sstr.str());
+
+				bool first_line = true;
+				for (int id2 : edges[id1]) {
+					if (first_line)
+						log("Breaking loop using new signal %s: %s -> %s\n", log_signal(RTLIL::SigSpec(wire)),
+								log_signal(signal_list[id1].bit), log_signal(signal_list[id2].bit));
+					else
+						log("                               %*s  %s -> %s\n", int(strlen(log_signal(RTLIL::SigSpec(wire)))), "",
+								log_signal(signal_list[id1].bit), log_signal(signal_list[id2].bit));
+					first_line = false;
+				}
+
+				int id3 = map_signal(RTLIL::SigSpec(wire));
+				signal_list[id1].is_port = true;
+				signal_list[id3].is_port = true;
+				log_assert(id3 == int(in_edges_count.size()));
+				in_edges_count.push_back(0);
+				workpool.insert(id3);
+
+				for (int id2 : edges[id1]) {
+					if (signal_list[id2].in1 == id1)
+						signal_list[id2].in1 = id3;
+					if (signal_list[id2].in2 == id1)
+						signal_list[id2].in2 = id3;
+					if (signal_list[id2].in3 == id1)
+						signal_list[id2].in3 = id3;
+					if (signal_list[id2].in4 == id1)
+						signal_list[id2].in4 = id3;
+				}
+				edges[id1].swap(edges[id3]);
+
+				module->connect(RTLIL::SigSig(signal_list[id3].bit, signal_list[id1].bit));
+				dump_loop_graph(dot_f, dot_nr, edges, workpool, in_edges_count);
 			}
-			if (module->wire(RTLIL::escape_id(srst_str)) != nullptr)
-				srst_sig = assign_map(module->wire(RTLIL::escape_id(srst_str)));
 		}
-	}
 
-	if (dff_mode && clk_sig.empty())
-		log_cmd_error("Clock domain %s not found.\n", clk_str.c_str());
+		if (dot_f != nullptr)
+			fclose(dot_f);
+	}
 
-	std::string tempdir_name;
-	if (cleanup) 
-		tempdir_name = get_base_tmpdir() + "/";
-	else
-		tempdir_name = "_tmp_";
-	tempdir_name += proc_program_prefix() + "yosys-abc-XXXXXX";
-	tempdir_name = make_temp_dir(tempdir_name);
-	log_header(design, "Extracting gate netlist of module `%s' to `%s/input.blif'..\n",
-			module->name.c_str(), replace_tempdir(tempdir_name, tempdir_name, show_tempdir).c_str());
-
-	std::string abc_script = stringf("read_blif \"%s/input.blif\"; ", tempdir_name.c_str());
-
-	if (!liberty_files.empty() || !genlib_files.empty()) {
-		for (std::string liberty_file : liberty_files)
-			abc_script += stringf("read_lib -w \"%s\"; ", liberty_file.c_str());
-		for (std::string liberty_file : genlib_files)
-			abc_script += stringf("read_library \"%s\"; ", liberty_file.c_str());
-		if (!constr_file.empty())
-			abc_script += stringf("read_constr -v \"%s\"; ", constr_file.c_str());
-	} else
-	if (!lut_costs.empty())
-		abc_script += stringf("read_lut %s/lutdefs.txt; ", tempdir_name.c_str());
-	else
-		abc_script += stringf("read_library %s/stdcells.genlib; ", tempdir_name.c_str());
-
-	if (!script_file.empty()) {
-		if (script_file[0] == '+') {
-			for (size_t i = 1; i < script_file.size(); i++)
-				if (script_file[i] == '\'')
-					abc_script += "'\\''";
-				else if (script_file[i] == ',')
-					abc_script += " ";
-				else
-					abc_script += script_file[i];
-		} else
-			abc_script += stringf("source %s", script_file.c_str());
-	} else if (!lut_costs.empty()) {
-		bool all_luts_cost_same = true;
-		for (int this_cost : lut_costs)
-			if (this_cost != lut_costs.front())
-				all_luts_cost_same = false;
-		abc_script += fast_mode ? ABC_FAST_COMMAND_LUT : ABC_COMMAND_LUT;
-		if (all_luts_cost_same && !fast_mode)
-			abc_script += "; lutpack {S}";
-	} else if (!liberty_files.empty() || !genlib_files.empty())
-		abc_script += constr_file.empty() ? (fast_mode ? ABC_FAST_COMMAND_LIB : ABC_COMMAND_LIB) : (fast_mode ? ABC_FAST_COMMAND_CTR : ABC_COMMAND_CTR);
-	else if (sop_mode)
-		abc_script += fast_mode ? ABC_FAST_COMMAND_SOP : ABC_COMMAND_SOP;
-	else
-		abc_script += fast_mode ? ABC_FAST_COMMAND_DFL : ABC_COMMAND_DFL;
-
-	if (script_file.empty() && !delay_target.empty())
-		for (size_t pos = abc_script.find("dretime;"); pos != std::string::npos; pos = abc_script.find("dretime;", pos+1))
-			abc_script = abc_script.substr(0, pos) + "dretime; retime -o {D};" + abc_script.substr(pos+8);
-
-	for (size_t pos = abc_script.find("{D}"); pos != std::string::npos; pos = abc_script.find("{D}", pos))
-		abc_script = abc_script.substr(0, pos) + delay_target + abc_script.substr(pos+3);
-
-	for (size_t pos = abc_script.find("{I}"); pos != std::string::npos; pos = abc_script.find("{I}", pos))
-		abc_script = abc_script.substr(0, pos) + sop_inputs + abc_script.substr(pos+3);
-
-	for (size_t pos = abc_script.find("{P}"); pos != std::string::npos; pos = abc_script.find("{P}", pos))
-		abc_script = abc_script.substr(0, pos) + sop_products + abc_script.substr(pos+3);
-
-	for (size_t pos = abc_script.find("{S}"); pos != std::string::npos; pos = abc_script.find("{S}", pos))
-		abc_script = abc_script.substr(0, pos) + lutin_shared + abc_script.substr(pos+3);
-	if (abc_dress)
-		abc_script += stringf("; dress \"%s/input.blif\"", tempdir_name.c_str());
-	abc_script += stringf("; write_blif %s/output.blif", tempdir_name.c_str());
-	abc_script = add_echos_to_abc_cmd(abc_script);
-
-	for (size_t i = 0; i+1 < abc_script.size(); i++)
-		if (abc_script[i] == ';' && abc_script[i+1] == ' ')
-			abc_script[i+1] = '\n';
-
-	std::string buffer = stringf("%s/abc.script", tempdir_name.c_str());
-	FILE *f = fopen(buffer.c_str(), "wt");
-	if (f == nullptr)
-		log_error("Opening %s for writing failed: %s\n", buffer.c_str(), strerror(errno));
-	fprintf(f, "%s\n", abc_script.c_str());
-	fclose(f);
-
-	if (dff_mode || !clk_str.empty())
+	void extract(RTLIL::Design *design, bool dff_mode, std::string clk_str, const std::vector<RTLIL::Cell*> &cells,
+			const pool<RTLIL::SigBit> *extracted_bits)
 	{
-		if (clk_sig.size() == 0)
-			log("No%s clock domain found. Not extracting any FF cells.\n", clk_str.empty() ? "" : " matching");
-		else {
-			log("Found%s %s clock domain: %s", clk_str.empty() ? "" : " matching", clk_polarity ? "posedge" : "negedge", log_signal(clk_sig));
-			if (en_sig.size() != 0)
-				log(", enabled by %s%s", en_polarity ? "" : "!", log_signal(en_sig));
-			if (arst_sig.size() != 0)
-				log(", asynchronously reset by %s%s", arst_polarity ? "" : "!", log_signal(arst_sig));
-			if (srst_sig.size() != 0)
-				log(", synchronously reset by %s%s", srst_polarity ? "" : "!", log_signal(srst_sig));
-			log("\n");
+		map_autoidx = autoidx++;
+
+		if (!clk_str.empty() && clk_str != "$")
+		{
+			std::string en_str;
+			std::string arst_str;
+			std::string srst_str;
+			if (clk_str.find(',') != std::string::npos) {
+				int pos = clk_str.find(',');
+				en_str = clk_str.substr(pos+1);
+				clk_str = clk_str.substr(0, pos);
+			}
+			if (en_str.find(',') != std::string::npos) {
+				int pos = en_str.find(',');
+				arst_str = en_str.substr(pos+1);
+				arst_str = en_str.substr(0, pos);
+			}
+			if (arst_str.find(',') != std::string::npos) {
+				int pos = arst_str.find(',');
+				srst_str = arst_str.substr(pos+1);
+				srst_str = arst_str.substr(0, pos);
+			}
+			if (clk_str[0] == '!') {
+				clk_polarity = false;
+				clk_str = clk_str.substr(1);
+			}
+			if (module->wire(RTLIL::escape_id(clk_str)) != nullptr)
+				clk_sig = assign_map(module->wire(RTLIL::escape_id(clk_str)));
+			if (en_str != "") {
+				if (en_str[0] == '!') {
+					en_polarity = false;
+					en_str = en_str.substr(1);
+				}
+				if (module->wire(RTLIL::escape_id(en_str)) != nullptr)
+					en_sig = assign_map(module->wire(RTLIL::escape_id(en_str)));
+			}
+			if (arst_str != "") {
+				if (arst_str[0] == '!') {
+					arst_polarity = false;
+					arst_str = arst_str.substr(1);
+				}
+				if (module->wire(RTLIL::escape_id(arst_str)) != nullptr)
+					arst_sig = assign_map(module->wire(RTLIL::escape_id(arst_str)));
+			}
+			if (srst_str != "") {
+				if (srst_str[0] == '!') {
+					srst_polarity = false;
+					srst_str = srst_str.substr(1);
+				}
+				if (module->wire(RTLIL::escape_id(srst_str)) != nullptr)
+					srst_sig = assign_map(module->wire(RTLIL::escape_id(srst_str)));
+			}
 		}
-	}
 
-	had_init = false;
-	for (auto c : cells)
-		extract_cell(c, keepff);
+		if (dff_mode && clk_sig.empty())
+			log_cmd_error("Clock domain %s not found.\n", clk_str.c_str());
 
-	for (auto wire : module->wires()) {
-		if (wire->port_id > 0 || wire->get_bool_attribute(ID::keep))
-			mark_port(wire);
-	}
+		if (config.cleanup)
+			tempdir_name = (config.pipe_mode ? get_mem_tmpdir() : get_base_tmpdir()) + "/";
+		else
+			tempdir_name = "_tmp_";
+		tempdir_name += proc_program_prefix() + "yosys-abc-XXXXXX";
+		tempdir_name = make_temp_dir(tempdir_name);
+		log_header(design, "Extracting gate netlist of module `%s' to `%s/input.blif'..\n",
+				module->name.c_str(), replace_tempdir(tempdir_name, tempdir_name, config.show_tempdir).c_str());
+
+		std::string abc_script = stringf("read_blif \"%s/input.blif\"; ", tempdir_name.c_str());
+
+		if (!config.liberty_files.empty() || !config.genlib_files.empty()) {
+			for (std::string liberty_file : config.liberty_files)
+				abc_script += stringf("read_lib -w \"%s\"; ", liberty_file.c_str());
+			for (std::string liberty_file : config.genlib_files)
+				abc_script += stringf("read_library \"%s\"; ", liberty_file.c_str());
+			if (!config.constr_file.empty())
+				abc_script += stringf("read_constr -v \"%s\"; ", config.constr_file.c_str());
+		} else
+		if (!config.lut_costs.empty())
+			abc_script += stringf("read_lut %s/lutdefs.txt; ", tempdir_name.c_str());
+		else
+			abc_script += stringf("read_library %s/stdcells.genlib; ", tempdir_name.c_str());
+
+		if (!config.script_file.empty()) {
+			if (config.script_file[0] == '+') {
+				for (size_t i = 1; i < config.script_file.size(); i++)
+					if (config.script_file[i] == '\'')
+						abc_script += "'\\''";
+					else if (config.script_file[i] == ',')
+						abc_script += " ";
+					else
+						abc_script += config.script_file[i];
+			} else
+				abc_script += stringf("source %s", config.script_file.c_str());
+		} else if (!config.lut_costs.empty()) {
+			bool all_luts_cost_same = true;
+			for (int this_cost : config.lut_costs)
+				if (this_cost != config.lut_costs.front())
+					all_luts_cost_same = false;
+			abc_script += config.fast_mode ? ABC_FAST_COMMAND_LUT : ABC_COMMAND_LUT;
+			if (all_luts_cost_same && !config.fast_mode)
+				abc_script += "; lutpack {S}";
+		} else if (!config.liberty_files.empty() || !config.genlib_files.empty())
+			abc_script += config.constr_file.empty() ? (config.fast_mode ? ABC_FAST_COMMAND_LIB : ABC_COMMAND_LIB) : (config.fast_mode ? ABC_FAST_COMMAND_CTR : ABC_COMMAND_CTR);
+		else if (config.sop_mode)
+			abc_script += config.fast_mode ? ABC_FAST_COMMAND_SOP : ABC_COMMAND_SOP;
+		else
+			abc_script += config.fast_mode ? ABC_FAST_COMMAND_DFL : ABC_COMMAND_DFL;
 
-	for (auto cell : module->cells())
-	for (auto &port_it : cell->connections())
-		mark_port(port_it.second);
+		if (config.script_file.empty() && !config.delay_target.empty())
+			for (size_t pos = abc_script.find("dretime;"); pos != std::string::npos; pos = abc_script.find("dretime;", pos+1))
+				abc_script = abc_script.substr(0, pos) + "dretime; retime -o {D};" + abc_script.substr(pos+8);
 
-	if (clk_sig.size() != 0)
-		mark_port(clk_sig);
+		for (size_t pos = abc_script.find("{D}"); pos != std::string::npos; pos = abc_script.find("{D}", pos))
+			abc_script = abc_script.substr(0, pos) + config.delay_target + abc_script.substr(pos+3);
 
-	if (en_sig.size() != 0)
-		mark_port(en_sig);
+		for (size_t pos = abc_script.find("{I}"); pos != std::string::npos; pos = abc_script.find("{I}", pos))
+			abc_script = abc_script.substr(0, pos) + config.sop_inputs + abc_script.substr(pos+3);
 
-	if (arst_sig.size() != 0)
-		mark_port(arst_sig);
+		for (size_t pos = abc_script.find("{P}"); pos != std::string::npos; pos = abc_script.find("{P}", pos))
+			abc_script = abc_script.substr(0, pos) + config.sop_products + abc_script.substr(pos+3);
 
-	if (srst_sig.size() != 0)
-		mark_port(srst_sig);
+		for (size_t pos = abc_script.find("{S}"); pos != std::string::npos; pos = abc_script.find("{S}", pos))
+			abc_script = abc_script.substr(0, pos) + config.lutin_shared + abc_script.substr(pos+3);
+		if (config.abc_dress)
+			abc_script += stringf("; dress \"%s/input.blif\"", tempdir_name.c_str());
+		if (use_pipe())
+			abc_script += "; write_blif /dev/fd/3";
+		else
+			abc_script += stringf("; write_blif %s/output.blif", tempdir_name.c_str());
+		abc_script = add_echos_to_abc_cmd(abc_script);
 
-	handle_loops();
+		for (size_t i = 0; i+1 < abc_script.size(); i++)
+			if (abc_script[i] == ';' && abc_script[i+1] == ' ')
+				abc_script[i+1] = '\n';
 
-	buffer = stringf("%s/input.blif", tempdir_name.c_str());
-	f = fopen(buffer.c_str(), "wt");
-	if (f == nullptr)
-		log_error("Opening %s for writing failed: %s\n", buffer.c_str(), strerror(errno));
+		std::string buffer = stringf("%s/abc.script", tempdir_name.c_str());
+		FILE *f = fopen(buffer.c_str(), "wt");
+		if (f == nullptr)
+			log_error("Opening %s for writing failed: %s\n", buffer.c_str(), strerror(errno));
+		fprintf(f, "%s\n", abc_script.c_str());
+		fclose(f);
 
-	fprintf(f, ".model netlist\n");
+		if (dff_mode || !clk_str.empty())
+		{
+			if (clk_sig.size() == 0)
+				log("No%s clock domain found. Not extracting any FF cells.\n", clk_str.empty() ? "" : " matching");
+			else {
+				log("Found%s %s clock domain: %s", clk_str.empty() ? "" : " matching", clk_polarity ? "posedge" : "negedge", log_signal(clk_sig));
+				if (en_sig.size() != 0)
+					log(", enabled by %s%s", en_polarity ? "" : "!", log_signal(en_sig));
+				if (arst_sig.size() != 0)
+					log(", asynchronously reset by %s%s", arst_polarity ? "" : "!", log_signal(arst_sig));
+				if (srst_sig.size() != 0)
+					log(", synchronously reset by %s%s", srst_polarity ? "" : "!", log_signal(srst_sig));
+				log("\n");
+			}
+		}
 
-	int count_input = 0;
-	fprintf(f, ".inputs");
-	for (auto &si : signal_list) {
-		if (!si.is_port || si.type != G(NONE))
-			continue;
-		fprintf(f, " ys__n%d", si.id);
-		pi_map[count_input++] = log_signal(si.bit);
-	}
-	if (count_input == 0)
-		fprintf(f, " dummy_input\n");
-	fprintf(f, "\n");
+		had_init = false;
+		for (auto c : cells)
+			extract_cell(c, config.keepff);
 
-	int count_output = 0;
-	fprintf(f, ".outputs");
-	for (auto &si : signal_list) {
-		if (!si.is_port || si.type == G(NONE))
-			continue;
-		fprintf(f, " ys__n%d", si.id);
-		po_map[count_output++] = log_signal(si.bit);
-	}
-	fprintf(f, "\n");
+		for (auto wire : module->wires()) {
+			if (wire->port_id > 0 || wire->get_bool_attribute(ID::keep))
+				mark_port(wire);
+		}
 
-	for (auto &si : signal_list)
-		fprintf(f, "# ys__n%-5d %s\n", si.id, log_signal(si.bit));
+		for (auto cell : module->cells())
+		for (auto &port_it : cell->connections())
+			mark_port(port_it.second);
 
-	for (auto &si : signal_list) {
-		if (si.bit.wire == nullptr) {
-			fprintf(f, ".names ys__n%d\n", si.id);
-			if (si.bit == RTLIL::State::S1)
-				fprintf(f, "1\n");
-		}
-	}
+		if (clk_sig.size() != 0)
+			mark_port(clk_sig);
 
-	int count_gates = 0;
-	for (auto &si : signal_list) {
-		if (si.type == G(BUF)) {
-			fprintf(f, ".names ys__n%d ys__n%d\n", si.in1, si.id);
-			fprintf(f, "1 1\n");
-		} else if (si.type == G(NOT)) {
-			fprintf(f, ".names ys__n%d ys__n%d\n", si.in1, si.id);
-			fprintf(f, "0 1\n");
-		} else if (si.type == G(AND)) {
-			fprintf(f, ".names ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.id);
-			fprintf(f, "11 1\n");
-		} else if (si.type == G(NAND)) {
-			fprintf(f, ".names ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.id);
-			fprintf(f, "0- 1\n");
-			fprintf(f, "-0 1\n");
-		} else if (si.type == G(OR)) {
-			fprintf(f, ".names ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.id);
-			fprintf(f, "-1 1\n");
-			fprintf(f, "1- 1\n");
-		} else if (si.type == G(NOR)) {
-			fprintf(f, ".names ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.id);
-			fprintf(f, "00 1\n");
-		} else if (si.type == G(XOR)) {
-			fprintf(f, ".names ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.id);
-			fprintf(f, "01 1\n");
-			fprintf(f, "10 1\n");
-		} else if (si.type == G(XNOR)) {
-			fprintf(f, ".names ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.id);
-			fprintf(f, "00 1\n");
-			fprintf(f, "11 1\n");
-		} else if (si.type == G(ANDNOT)) {
-			fprintf(f, ".names ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.id);
-			fprintf(f, "10 1\n");
-		} else if (si.type == G(ORNOT)) {
-			fprintf(f, ".names ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.id);
-			fprintf(f, "1- 1\n");
-			fprintf(f, "-0 1\n");
-		} else if (si.type == G(MUX)) {
-			fprintf(f, ".names ys__n%d ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.in3, si.id);
-			fprintf(f, "1-0 1\n");
-			fprintf(f, "-11 1\n");
-		} else if (si.type == G(NMUX)) {
-			fprintf(f, ".names ys__n%d ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.in3, si.id);
-			fprintf(f, "0-0 1\n");
-			fprintf(f, "-01 1\n");
-		} else if (si.type == G(AOI3)) {
-			fprintf(f, ".names ys__n%d ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.in3, si.id);
-			fprintf(f, "-00 1\n");
-			fprintf(f, "0-0 1\n");
-		} else if (si.type == G(OAI3)) {
-			fprintf(f, ".names ys__n%d ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.in3, si.id);
-			fprintf(f, "00- 1\n");
-			fprintf(f, "--0 1\n");
-		} else if (si.type == G(AOI4)) {
-			fprintf(f, ".names ys__n%d ys__n%d ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.in3, si.in4, si.id);
-			fprintf(f, "-0-0 1\n");
-			fprintf(f, "-00- 1\n");
-			fprintf(f, "0--0 1\n");
-			fprintf(f, "0-0- 1\n");
-		} else if (si.type == G(OAI4)) {
-			fprintf(f, ".names ys__n%d ys__n%d ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.in3, si.in4, si.id);
-			fprintf(f, "00-- 1\n");
-			fprintf(f, "--00 1\n");
-		} else if (si.type == G(FF)) {
-			fprintf(f, ".latch ys__n%d ys__n%d 2\n", si.in1, si.id);
-		} else if (si.type == G(FF0)) {
-			fprintf(f, ".latch ys__n%d ys__n%d 0\n", si.in1, si.id);
-		} else if (si.type == G(FF1)) {
-			fprintf(f, ".latch ys__n%d ys__n%d 1\n", si.in1, si.id);
-		} else if (si.type != G(NONE))
-			log_abort();
-		if (si.type != G(NONE))
-			count_gates++;
-	}
+		if (en_sig.size() != 0)
+			mark_port(en_sig);
 
-	fprintf(f, ".end\n");
-	fclose(f);
+		if (arst_sig.size() != 0)
+			mark_port(arst_sig);
 
-	log("Extracted %d gates and %d wires to a netlist network with %d inputs and %d outputs.\n",
-			count_gates, GetSize(signal_list), count_input, count_output);
-	log_push();
-	if (count_output > 0)
-	{
-		log_header(design, "Executing ABC.\n");
+		if (srst_sig.size() != 0)
+			mark_port(srst_sig);
+
+		// bits of cells in other clock domains of this module that have already
+		// been extracted, but not yet re-integrated (-j)
+		if (extracted_bits != nullptr)
+			for (auto &si : signal_list)
+				if (si.bit.wire != nullptr && extracted_bits->count(si.bit))
+					si.is_port = true;
 
-		auto &cell_cost = cmos_cost ? CellCosts::cmos_gate_cost() : CellCosts::default_gate_cost();
+		handle_loops();
 
-		buffer = stringf("%s/stdcells.genlib", tempdir_name.c_str());
+		buffer = stringf("%s/input.blif", tempdir_name.c_str());
 		f = fopen(buffer.c_str(), "wt");
 		if (f == nullptr)
 			log_error("Opening %s for writing failed: %s\n", buffer.c_str(), strerror(errno));
-		fprintf(f, "GATE ZERO    1 Y=CONST0;\n");
-		fprintf(f, "GATE ONE     1 Y=CONST1;\n");
-		fprintf(f, "GATE BUF    %d Y=A;                  PIN * NONINV  1 999 1 0 1 0\n", cell_cost.at(ID($_BUF_)));
-		fprintf(f, "GATE NOT    %d Y=!A;                 PIN * INV     1 999 1 0 1 0\n", cell_cost.at(ID($_NOT_)));
-		if (enabled_gates.count("AND"))
-			fprintf(f, "GATE AND    %d Y=A*B;                PIN * NONINV  1 999 1 0 1 0\n", cell_cost.at(ID($_AND_)));
-		if (enabled_gates.count("NAND"))
-			fprintf(f, "GATE NAND   %d Y=!(A*B);             PIN * INV     1 999 1 0 1 0\n", cell_cost.at(ID($_NAND_)));
-		if (enabled_gates.count("OR"))
-			fprintf(f, "GATE OR     %d Y=A+B;                PIN * NONINV  1 999 1 0 1 0\n", cell_cost.at(ID($_OR_)));
-		if (enabled_gates.count("NOR"))
-			fprintf(f, "GATE NOR    %d Y=!(A+B);             PIN * INV     1 999 1 0 1 0\n", cell_cost.at(ID($_NOR_)));
-		if (enabled_gates.count("XOR"))
-			fprintf(f, "GATE XOR    %d Y=(A*!B)+(!A*B);      PIN * UNKNOWN 1 999 1 0 1 0\n", cell_cost.at(ID($_XOR_)));
-		if (enabled_gates.count("XNOR"))
-			fprintf(f, "GATE XNOR   %d Y=(A*B)+(!A*!B);      PIN * UNKNOWN 1 999 1 0 1 0\n", cell_cost.at(ID($_XNOR_)));
-		if (enabled_gates.count("ANDNOT"))
-			fprintf(f, "GATE ANDNOT %d Y=A*!B;               PIN * UNKNOWN 1 999 1 0 1 0\n", cell_cost.at(ID($_ANDNOT_)));
-		if (enabled_gates.count("ORNOT"))
-			fprintf(f, "GATE ORNOT  %d Y=A+!B;               PIN * UNKNOWN 1 999 1 0 1 0\n", cell_cost.at(ID($_ORNOT_)));
-		if (enabled_gates.count("AOI3"))
-			fprintf(f, "GATE AOI3   %d Y=!((A*B)+C);         PIN * INV     1 999 1 0 1 0\n", cell_cost.at(ID($_AOI3_)));
-		if (enabled_gates.count("OAI3"))
-			fprintf(f, "GATE OAI3   %d Y=!((A+B)*C);         PIN * INV     1 999 1 0 1 0\n", cell_cost.at(ID($_OAI3_)));
-		if (enabled_gates.count("AOI4"))
-			fprintf(f, "GATE AOI4   %d Y=!((A*B)+(C*D));     PIN * INV     1 999 1 0 1 0\n", cell_cost.at(ID($_AOI4_)));
-		if (enabled_gates.count("OAI4"))
-			fprintf(f, "GATE OAI4   %d Y=!((A+B)*(C+D));     PIN * INV     1 999 1 0 1 0\n", cell_cost.at(ID($_OAI4_)));
-		if (enabled_gates.count("MUX"))
-			fprintf(f, "GATE MUX    %d Y=(A*B)+(S*B)+(!S*A); PIN * UNKNOWN 1 999 1 0 1 0\n", cell_cost.at(ID($_MUX_)));
-		if (enabled_gates.count("NMUX"))
-			fprintf(f, "GATE NMUX   %d Y=!((A*B)+(S*B)+(!S*A)); PIN * UNKNOWN 1 999 1 0 1 0\n", cell_cost.at(ID($_NMUX_)));
-		if (map_mux4)
-			fprintf(f, "GATE MUX4   %d Y=(!S*!T*A)+(S*!T*B)+(!S*T*C)+(S*T*D); PIN * UNKNOWN 1 999 1 0 1 0\n", 2*cell_cost.at(ID($_MUX_)));
-		if (map_mux8)
-			fprintf(f, "GATE MUX8   %d Y=(!S*!T*!U*A)+(S*!T*!U*B)+(!S*T*!U*C)+(S*T*!U*D)+(!S*!T*U*E)+(S*!T*U*F)+(!S*T*U*G)+(S*T*U*H); PIN * UNKNOWN 1 999 1 0 1 0\n", 4*cell_cost.at(ID($_MUX_)));
-		if (map_mux16)
-			fprintf(f, "GATE MUX16  %d Y=(!S*!T*!U*!V*A)+(S*!T*!U*!V*B)+(!S*T*!U*!V*C)+(S*T*!U*!V*D)+(!S*!T*U*!V*E)+(S*!T*U*!V*F)+(!S*T*U*!V*G)+(S*T*U*!V*H)+(!S*!T*!U*V*I)+(S*!T*!U*V*J)+(!S*T*!U*V*K)+(S*T*!U*V*L)+(!S*!T*U*V*M)+(S*!T*U*V*N)+(!S*T*U*V*O)+(S*T*U*V*P); PIN * UNKNOWN 1 999 1 0 1 0\n", 8*cell_cost.at(ID($_MUX_)));
+
+		fprintf(f, ".model netlist\n");
+
+		int count_input = 0;
+		fprintf(f, ".inputs");
+		for (auto &si : signal_list) {
+			if (!si.is_port || si.type != G(NONE))
+				continue;
+			fprintf(f, " ys__n%d", si.id);
+			pi_map[count_input++] = log_signal(si.bit);
+		}
+		if (count_input == 0)
+			fprintf(f, " dummy_input\n");
+		fprintf(f, "\n");
+
+		count_output = 0;
+		fprintf(f, ".outputs");
+		for (auto &si : signal_list) {
+			if (!si.is_port || si.type == G(NONE))
+				continue;
+			fprintf(f, " ys__n%d", si.id);
+			po_map[count_output++] = log_signal(si.bit);
+		}
+		fprintf(f, "\n");
+
+		for (auto &si : signal_list)
+			fprintf(f, "# ys__n%-5d %s\n", si.id, log_signal(si.bit));
+
+		for (auto &si : signal_list) {
+			if (si.bit.wire == nullptr) {
+				fprintf(f, ".names ys__n%d\n", si.id);
+				if (si.bit == RTLIL::State::S1)
+					fprintf(f, "1\n");
+			}
+		}
+
+		int count_gates = 0;
+		for (auto &si : signal_list) {
+			if (si.type == G(BUF)) {
+				fprintf(f, ".names ys__n%d ys__n%d\n", si.in1, si.id);
+				fprintf(f, "1 1\n");
+			} else if (si.type == G(NOT)) {
+				fprintf(f, ".names ys__n%d ys__n%d\n", si.in1, si.id);
+				fprintf(f, "0 1\n");
+			} else if (si.type == G(AND)) {
+				fprintf(f, ".names ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.id);
+				fprintf(f, "11 1\n");
+			} else if (si.type == G(NAND)) {
+				fprintf(f, ".names ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.id);
+				fprintf(f, "0- 1\n");
+				fprintf(f, "-0 1\n");
+			} else if (si.type == G(OR)) {
+				fprintf(f, ".names ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.id);
+				fprintf(f, "-1 1\n");
+				fprintf(f, "1- 1\n");
+			} else if (si.type == G(NOR)) {
+				fprintf(f, ".names ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.id);
+				fprintf(f, "00 1\n");
+			} else if (si.type == G(XOR)) {
+				fprintf(f, ".names ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.id);
+				fprintf(f, "01 1\n");
+				fprintf(f, "10 1\n");
+			} else if (si.type == G(XNOR)) {
+				fprintf(f, ".names ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.id);
+				fprintf(f, "00 1\n");
+				fprintf(f, "11 1\n");
+			} else if (si.type == G(ANDNOT)) {
+				fprintf(f, ".names ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.id);
+				fprintf(f, "10 1\n");
+			} else if (si.type == G(ORNOT)) {
+				fprintf(f, ".names ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.id);
+				fprintf(f, "1- 1\n");
+				fprintf(f, "-0 1\n");
+			} else if (si.type == G(MUX)) {
+				fprintf(f, ".names ys__n%d ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.in3, si.id);
+				fprintf(f, "1-0 1\n");
+				fprintf(f, "-11 1\n");
+			} else if (si.type == G(NMUX)) {
+				fprintf(f, ".names ys__n%d ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.in3, si.id);
+				fprintf(f, "0-0 1\n");
+				fprintf(f, "-01 1\n");
+			} else if (si.type == G(AOI3)) {
+				fprintf(f, ".names ys__n%d ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.in3, si.id);
+				fprintf(f, "-00 1\n");
+				fprintf(f, "0-0 1\n");
+			} else if (si.type == G(OAI3)) {
+				fprintf(f, ".names ys__n%d ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.in3, si.id);
+				fprintf(f, "00- 1\n");
+				fprintf(f, "--0 1\n");
+			} else if (si.type == G(AOI4)) {
+				fprintf(f, ".names ys__n%d ys__n%d ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.in3, si.in4, si.id);
+				fprintf(f, "-0-0 1\n");
+				fprintf(f, "-00- 1\n");
+				fprintf(f, "0--0 1\n");
+				fprintf(f, "0-0- 1\n");
+			} else if (si.type == G(OAI4)) {
+				fprintf(f, ".names ys__n%d ys__n%d ys__n%d ys__n%d ys__n%d\n", si.in1, si.in2, si.in3, si.in4, si.id);
+				fprintf(f, "00-- 1\n");
+				fprintf(f, "--00 1\n");
+			} else if (si.type == G(FF)) {
+				fprintf(f, ".latch ys__n%d ys__n%d 2\n", si.in1, si.id);
+			} else if (si.type == G(FF0)) {
+				fprintf(f, ".latch ys__n%d ys__n%d 0\n", si.in1, si.id);
+			} else if (si.type == G(FF1)) {
+				fprintf(f, ".latch ys__n%d ys__n%d 1\n", si.in1, si.id);
+			} else if (si.type != G(NONE))
+				log_abort();
+			if (si.type != G(NONE))
+				count_gates++;
+		}
+
+		fprintf(f, ".end\n");
 		fclose(f);
 
-		if (!lut_costs.empty()) {
-			buffer = stringf("%s/lutdefs.txt", tempdir_name.c_str());
+		log("Extracted %d gates and %d wires to a netlist network with %d inputs and %d outputs.\n",
+				count_gates, GetSize(signal_list), count_input, count_output);
+
+		if (count_output > 0)
+		{
+			auto &cell_cost = cmos_cost ? CellCosts::cmos_gate_cost() : CellCosts::default_gate_cost();
+
+			buffer = stringf("%s/stdcells.genlib", tempdir_name.c_str());
 			f = fopen(buffer.c_str(), "wt");
 			if (f == nullptr)
 				log_error("Opening %s for writing failed: %s\n", buffer.c_str(), strerror(errno));
-			for (int i = 0; i < GetSize(lut_costs); i++)
-				fprintf(f, "%d %d.00 1.00\n", i+1, lut_costs.at(i));
+			fprintf(f, "GATE ZERO    1 Y=CONST0;\n");
+			fprintf(f, "GATE ONE     1 Y=CONST1;\n");
+			fprintf(f, "GATE BUF    %d Y=A;                  PIN * NONINV  1 999 1 0 1 0\n", cell_cost.at(ID($_BUF_)));
+			fprintf(f, "GATE NOT    %d Y=!A;                 PIN * INV     1 999 1 0 1 0\n", cell_cost.at(ID($_NOT_)));
+			if (enabled_gates.count("AND"))
+				fprintf(f, "GATE AND    %d Y=A*B;                PIN * NONINV  1 999 1 0 1 0\n", cell_cost.at(ID($_AND_)));
+			if (enabled_gates.count("NAND"))
+				fprintf(f, "GATE NAND   %d Y=!(A*B);             PIN * INV     1 999 1 0 1 0\n", cell_cost.at(ID($_NAND_)));
+			if (enabled_gates.count("OR"))
+				fprintf(f, "GATE OR     %d Y=A+B;                PIN * NONINV  1 999 1 0 1 0\n", cell_cost.at(ID($_OR_)));
+			if (enabled_gates.count("NOR"))
+				fprintf(f, "GATE NOR    %d Y=!(A+B);             PIN * INV     1 999 1 0 1 0\n", cell_cost.at(ID($_NOR_)));
+			if (enabled_gates.count("XOR"))
+				fprintf(f, "GATE XOR    %d Y=(A*!B)+(!A*B);      PIN * UNKNOWN 1 999 1 0 1 0\n", cell_cost.at(ID($_XOR_)));
+			if (enabled_gates.count("XNOR"))
+				fprintf(f, "GATE XNOR   %d Y=(A*B)+(!A*!B);      PIN * UNKNOWN 1 999 1 0 1 0\n", cell_cost.at(ID($_XNOR_)));
+			if (enabled_gates.count("ANDNOT"))
+				fprintf(f, "GATE ANDNOT %d Y=A*!B;               PIN * UNKNOWN 1 999 1 0 1 0\n", cell_cost.at(ID($_ANDNOT_)));
+			if (enabled_gates.count("ORNOT"))
+				fprintf(f, "GATE ORNOT  %d Y=A+!B;               PIN * UNKNOWN 1 999 1 0 1 0\n", cell_cost.at(ID($_ORNOT_)));
+			if (enabled_gates.count("AOI3"))
+				fprintf(f, "GATE AOI3   %d Y=!((A*B)+C);         PIN * INV     1 999 1 0 1 0\n", cell_cost.at(ID($_AOI3_)));
+			if (enabled_gates.count("OAI3"))
+				fprintf(f, "GATE OAI3   %d Y=!((A+B)*C);         PIN * INV     1 999 1 0 1 0\n", cell_cost.at(ID($_OAI3_)));
+			if (enabled_gates.count("AOI4"))
+				fprintf(f, "GATE AOI4   %d Y=!((A*B)+(C*D));     PIN * INV     1 999 1 0 1 0\n", cell_cost.at(ID($_AOI4_)));
+			if (enabled_gates.count("OAI4"))
+				fprintf(f, "GATE OAI4   %d Y=!((A+B)*(C+D));     PIN * INV     1 999 1 0 1 0\n", cell_cost.at(ID($_OAI4_)));
+			if (enabled_gates.count("MUX"))
+				fprintf(f, "GATE MUX    %d Y=(A*B)+(S*B)+(!S*A); PIN * UNKNOWN 1 999 1 0 1 0\n", cell_cost.at(ID($_MUX_)));
+			if (enabled_gates.count("NMUX"))
+				fprintf(f, "GATE NMUX   %d Y=!((A*B)+(S*B)+(!S*A)); PIN * UNKNOWN 1 999 1 0 1 0\n", cell_cost.at(ID($_NMUX_)));
+			if (map_mux4)
+				fprintf(f, "GATE MUX4   %d Y=(!S*!T*A)+(S*!T*B)+(!S*T*C)+(S*T*D); PIN * UNKNOWN 1 999 1 0 1 0\n", 2*cell_cost.at(ID($_MUX_)));
+			if (map_mux8)
+				fprintf(f, "GATE MUX8   %d Y=(!S*!T*!U*A)+(S*!T*!U*B)+(!S*T*!U*C)+(S*T*!U*D)+(!S*!T*U*E)+(S*!T*U*F)+(!S*T*U*G)+(S*T*U*H); PIN * UNKNOWN 1 999 1 0 1 0\n", 4*cell_cost.at(ID($_MUX_)));
+			if (map_mux16)
+				fprintf(f, "GATE MUX16  %d Y=(!S*!T*!U*!V*A)+(S*!T*!U*!V*B)+(!S*T*!U*!V*C)+(S*T*!U*!V*D)+(!S*!T*U*!V*E)+(S*!T*U*!V*F)+(!S*T*U*!V*G)+(S*T*U*!V*H)+(!S*!T*!U*V*I)+(S*!T*!U*V*J)+(!S*T*!U*V*K)+(S*T*!U*V*L)+(!S*!T*U*V*M)+(S*!T*U*V*N)+(!S*T*U*V*O)+(S*T*U*V*P); PIN * UNKNOWN 1 999 1 0 1 0\n", 8*cell_cost.at(ID($_MUX_)));
 			fclose(f);
+
+			if (!config.lut_costs.empty()) {
+				buffer = stringf("%s/lutdefs.txt", tempdir_name.c_str());
+				f = fopen(buffer.c_str(), "wt");
+				if (f == nullptr)
+					log_error("Opening %s for writing failed: %s\n", buffer.c_str(), strerror(errno));
+				for (int i = 0; i < GetSize(config.lut_costs); i++)
+					fprintf(f, "%d %d.00 1.00\n", i+1, config.lut_costs.at(i));
+				fclose(f);
+			}
 		}
+	}
 
-		buffer = stringf("\"%s\" -s -f %s/abc.script 2>&1", exe_file.c_str(), tempdir_name.c_str());
-		log("Running ABC command: %s\n", replace_tempdir(buffer, tempdir_name, show_tempdir).c_str());
+	void run_abc()
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		std::string buffer = stringf("\"%s\" -s -f %s/abc.script 2>&1", config.exe_file.c_str(), tempdir_name.c_str());
+		log("Running ABC command: %s\n", replace_tempdir(buffer, tempdir_name, config.show_tempdir).c_str());
 
 #ifndef YOSYS_LINK_ABC
-		abc_output_filter filt(tempdir_name, show_tempdir);
+		abc_output_filter filt(tempdir_name, config.show_tempdir, pi_map, po_map);
+#  ifdef ABC_PIPE_TRANSPORT
+		int ret = use_pipe() ? run_command_fd3(buffer, std::bind(&abc_output_filter::next_line, filt, std::placeholders::_1), mapped_blif) :
+				run_command(buffer, std::bind(&abc_output_filter::next_line, filt, std::placeholders::_1));
+#  else
 		int ret = run_command(buffer, std::bind(&abc_output_filter::next_line, filt, std::placeholders::_1));
+#  endif
 #else
 		string temp_stdouterr_name = stringf("%s/stdouterr.txt", tempdir_name.c_str());
 		FILE *temp_stdouterr_w = fopen(temp_stdouterr_name.c_str(), "w");
@@ -1116,7 +1258,7 @@ void abc_module(RTLIL::Design *design, RTLIL::Module *current_module, std::strin
 		// These needs to be mutable, supposedly due to getopt
 		char *abc_argv[5];
 		string tmp_script_name = stringf("%s/abc.script", tempdir_name.c_str());
-		abc_argv[0] = strdup(exe_file.c_str());
+		abc_argv[0] = strdup(config.exe_file.c_str());
 		abc_argv[1] = strdup("-s");
 		abc_argv[2] = strdup("-f");
 		abc_argv[3] = strdup(tmp_script_name.c_str());
@@ -1133,7 +1275,7 @@ void abc_module(RTLIL::Design *design, RTLIL::Module *current_module, std::strin
 		fclose(old_stdout);
 		fclose(old_stderr);
 		std::ifstream temp_stdouterr_r(temp_stdouterr_name);
-		abc_output_filter filt(tempdir_name, show_tempdir);
+		abc_output_filter filt(tempdir_name, config.show_tempdir, pi_map, po_map);
 		for (std::string line; std::getline(temp_stdouterr_r, line); )
 			filt.next_line(line + "\n");
 		temp_stdouterr_r.close();
@@ -1141,139 +1283,204 @@ void abc_module(RTLIL::Design *design, RTLIL::Module *current_module, std::strin
 		if (ret != 0)
 			log_error("ABC: execution of command \"%s\" failed: return code %d.\n", buffer.c_str(), ret);
 
-		buffer = stringf("%s/%s", tempdir_name.c_str(), "output.blif");
-		std::ifstream ifs;
-		ifs.open(buffer);
-		if (ifs.fail())
-			log_error("Can't open ABC output file `%s'.\n", buffer.c_str());
-
-		bool builtin_lib = liberty_files.empty() && genlib_files.empty();
-		RTLIL::Design *mapped_design = new RTLIL::Design;
-		parse_blif(mapped_design, ifs, builtin_lib ? ID(DFF) : ID(_dff_), false, sop_mode);
-
-		ifs.close();
-
-		log_header(design, "Re-integrating ABC results.\n");
-		RTLIL::Module *mapped_mod = mapped_design->module(ID(netlist));
-		if (mapped_mod == nullptr)
-			log_error("ABC output file does not contain a module `netlist'.\n");
-		for (auto w : mapped_mod->wires()) {
-			RTLIL::Wire *orig_wire = nullptr;
-			RTLIL::Wire *wire = module->addWire(remap_name(w->name, &orig_wire));
-			if (orig_wire != nullptr && orig_wire->attributes.count(ID::src))
-				wire->attributes[ID::src] = orig_wire->attributes[ID::src];
-			if (markgroups) wire->attributes[ID::abcgroup] = map_autoidx;
-			design->select(module, wire);
-		}
-
-		SigMap mapped_sigmap(mapped_mod);
-		FfInitVals mapped_initvals(&mapped_sigmap, mapped_mod);
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		runtime = elapsed.count();
+	}
 
-		dict<std::string, int> cell_stats;
-		for (auto c : mapped_mod->cells())
+	void reintegrate(RTLIL::Design *design)
+	{
+		if (count_output > 0)
 		{
-			if (builtin_lib)
+			bool builtin_lib = config.liberty_files.empty() && config.genlib_files.empty();
+			RTLIL::Design *mapped_design = new RTLIL::Design;
+
+			if (use_pipe()) {
+				std::istringstream iss(mapped_blif);
+				parse_blif(mapped_design, iss, builtin_lib ? ID(DFF) : ID(_dff_), false, config.sop_mode);
+				mapped_blif = std::string();
+			} else {
+				std::string buffer = stringf("%s/%s", tempdir_name.c_str(), "output.blif");
+				std::ifstream ifs;
+				ifs.open(buffer);
+				if (ifs.fail())
+					log_error("Can't open ABC output file `%s'.\n", buffer.c_str());
+				parse_blif(mapped_design, ifs, builtin_lib ? ID(DFF) : ID(_dff_), false, config.sop_mode);
+				ifs.close();
+			}
+
+			log_header(design, "Re-integrating ABC results.\n");
+			RTLIL::Module *mapped_mod = mapped_design->module(ID(netlist));
+			if (mapped_mod == nullptr)
+				log_error("ABC output file does not contain a module `netlist'.\n");
+			for (auto w : mapped_mod->wires()) {
+				RTLIL::Wire *orig_wire = nullptr;
+				RTLIL::Wire *wire = module->addWire(remap_name(w->name, &orig_wire));
+				if (orig_wire != nullptr && orig_wire->attributes.count(ID::src))
+					wire->attributes[ID::src] = orig_wire->attributes[ID::src];
+				if (markgroups) wire->attributes[ID::abcgroup] = map_autoidx;
+				design->select(module, wire);
+			}
+
+			SigMap mapped_sigmap(mapped_mod);
+			FfInitVals mapped_initvals(&mapped_sigmap, mapped_mod);
+
+			dict<std::string, int> cell_stats;
+			for (auto c : mapped_mod->cells())
 			{
-				cell_stats[RTLIL::unescape_id(c->type)]++;
-				if (c->type.in(ID(ZERO), ID(ONE))) {
-					RTLIL::SigSig conn;
-					RTLIL::IdString name_y = remap_name(c->getPort(ID::Y).as_wire()->name);
-					conn.first = module->wire(name_y);
-					conn.second = RTLIL::SigSpec(c->type == ID(ZERO) ? 0 : 1, 1);
-					module->connect(conn);
-					continue;
-				}
-				if (c->type == ID(BUF)) {
-					RTLIL::SigSig conn;
-					RTLIL::IdString name_y = remap_name(c->getPort(ID::Y).as_wire()->name);
-					RTLIL::IdString name_a = remap_name(c->getPort(ID::A).as_wire()->name);
-					conn.first = module->wire(name_y);
-					conn.second = module->wire(name_a);
-					module->connect(conn);
-					continue;
-				}
-				if (c->type == ID(NOT)) {
-					RTLIL::Cell *cell = module->addCell(remap_name(c->name), ID($_NOT_));
-					if (markgroups) cell->attributes[ID::abcgroup] = map_autoidx;
-					for (auto name : {ID::A, ID::Y}) {
-						RTLIL::IdString remapped_name = remap_name(c->getPort(name).as_wire()->name);
-						cell->setPort(name, module->wire(remapped_name));
+				if (builtin_lib)
+				{
+					cell_stats[RTLIL::unescape_id(c->type)]++;
+					if (c->type.in(ID(ZERO), ID(ONE))) {
+						RTLIL::SigSig conn;
+						RTLIL::IdString name_y = remap_name(c->getPort(ID::Y).as_wire()->name);
+						conn.first = module->wire(name_y);
+						conn.second = RTLIL::SigSpec(c->type == ID(ZERO) ? 0 : 1, 1);
+						module->connect(conn);
+						continue;
 					}
-					design->select(module, cell);
-					continue;
-				}
-				if (c->type.in(ID(AND), ID(OR), ID(XOR), ID(NAND), ID(NOR), ID(XNOR), ID(ANDNOT), ID(ORNOT))) {
-					RTLIL::Cell *cell = module->addCell(remap_name(c->name), stringf("$_%s_", c->type.c_str()+1));
-					if (markgroups) cell->attributes[ID::abcgroup] = map_autoidx;
-					for (auto name : {ID::A, ID::B, ID::Y}) {
-						RTLIL::IdString remapped_name = remap_name(c->getPort(name).as_wire()->name);
-						cell->setPort(name, module->wire(remapped_name));
+					if (c->type == ID(BUF)) {
+						RTLIL::SigSig conn;
+						RTLIL::IdString name_y = remap_name(c->getPort(ID::Y).as_wire()->name);
+						RTLIL::IdString name_a = remap_name(c->getPort(ID::A).as_wire()->name);
+						conn.first = module->wire(name_y);
+						conn.second = module->wire(name_a);
+						module->connect(conn);
+						continue;
 					}
-					design->select(module, cell);
-					continue;
-				}
-				if (c->type.in(ID(MUX), ID(NMUX))) {
-					RTLIL::Cell *cell = module->addCell(remap_name(c->name), stringf("$_%s_", c->type.c_str()+1));
-					if (markgroups) cell->attributes[ID::abcgroup] = map_autoidx;
-					for (auto name : {ID::A, ID::B, ID::S, ID::Y}) {
-						RTLIL::IdString remapped_name = remap_name(c->getPort(name).as_wire()->name);
-						cell->setPort(name, module->wire(remapped_name));
+					if (c->type == ID(NOT)) {
+						RTLIL::Cell *cell = module->addCell(remap_name(c->name), ID($_NOT_));
+						if (markgroups) cell->attributes[ID::abcgroup] = map_autoidx;
+						for (auto name : {ID::A, ID::Y}) {
+							RTLIL::IdString remapped_name = remap_name(c->getPort(name).as_wire()->name);
+							cell->setPort(name, module->wire(remapped_name));
+						}
+						design->select(module, cell);
+						continue;
 					}
-					design->select(module, cell);
-					continue;
-				}
-				if (c->type == ID(MUX4)) {
-					RTLIL::Cell *cell = module->addCell(remap_name(c->name), ID($_MUX4_));
-					if (markgroups) cell->attributes[ID::abcgroup] = map_autoidx;
-					for (auto name : {ID::A, ID::B, ID::C, ID::D, ID::S, ID::T, ID::Y}) {
-						RTLIL::IdString remapped_name = remap_name(c->getPort(name).as_wire()->name);
-						cell->setPort(name, module->wire(remapped_name));
+					if (c->type.in(ID(AND), ID(OR), ID(XOR), ID(NAND), ID(NOR), ID(XNOR), ID(ANDNOT), ID(ORNOT))) {
+						RTLIL::Cell *cell = module->addCell(remap_name(c->name), stringf("$_%s_", c->type.c_str()+1));
+						if (markgroups) cell->attributes[ID::abcgroup] = map_autoidx;
+						for (auto name : {ID::A, ID::B, ID::Y}) {
+							RTLIL::IdString remapped_name = remap_name(c->getPort(name).as_wire()->name);
+							cell->setPort(name, module->wire(remapped_name));
+						}
+						design->select(module, cell);
+						continue;
 					}
-					design->select(module, cell);
-					continue;
-				}
-				if (c->type == ID(MUX8)) {
-					RTLIL::Cell *cell = module->addCell(remap_name(c->name), ID($_MUX8_));
-					if (markgroups) cell->attributes[ID::abcgroup] = map_autoidx;
-					for (auto name : {ID::A, ID::B, ID::C, ID::D, ID::E, ID::F, ID::G, ID::H, ID::S, ID::T, ID::U, ID::Y}) {
-						RTLIL::IdString remapped_name = remap_name(c->getPort(name).as_wire()->name);
-						cell->setPort(name, module->wire(remapped_name));
+					if (c->type.in(ID(MUX), ID(NMUX))) {
+						RTLIL::Cell *cell = module->addCell(remap_name(c->name), stringf("$_%s_", c->type.c_str()+1));
+						if (markgroups) cell->attributes[ID::abcgroup] = map_autoidx;
+						for (auto name : {ID::A, ID::B, ID::S, ID::Y}) {
+							RTLIL::IdString remapped_name = remap_name(c->getPort(name).as_wire()->name);
+							cell->setPort(name, module->wire(remapped_name));
+						}
+						design->select(module, cell);
+						continue;
 					}
-					design->select(module, cell);
-					continue;
-				}
-				if (c->type == ID(MUX16)) {
-					RTLIL::Cell *cell = module->addCell(remap_name(c->name), ID($_MUX16_));
-					if (markgroups) cell->attributes[ID::abcgroup] = map_autoidx;
-					for (auto name : {ID::A, ID::B, ID::C, ID::D, ID::E, ID::F, ID::G, ID::H, ID::I, ID::J, ID::K,
-							ID::L, ID::M, ID::N, ID::O, ID::P, ID::S, ID::T, ID::U, ID::V, ID::Y}) {
-						RTLIL::IdString remapped_name = remap_name(c->getPort(name).as_wire()->name);
-						cell->setPort(name, module->wire(remapped_name));
+					if (c->type == ID(MUX4)) {
+						RTLIL::Cell *cell = module->addCell(remap_name(c->name), ID($_MUX4_));
+						if (markgroups) cell->attributes[ID::abcgroup] = map_autoidx;
+						for (auto name : {ID::A, ID::B, ID::C, ID::D, ID::S, ID::T, ID::Y}) {
+							RTLIL::IdString remapped_name = remap_name(c->getPort(name).as_wire()->name);
+							cell->setPort(name, module->wire(remapped_name));
+						}
+						design->select(module, cell);
+						continue;
 					}
-					design->select(module, cell);
-					continue;
-				}
-				if (c->type.in(ID(AOI3), ID(OAI3))) {
-					RTLIL::Cell *cell = module->addCell(remap_name(c->name), stringf("$_%s_", c->type.c_str()+1));
-					if (markgroups) cell->attributes[ID::abcgroup] = map_autoidx;
-					for (auto name : {ID::A, ID::B, ID::C, ID::Y}) {
-						RTLIL::IdString remapped_name = remap_name(c->getPort(name).as_wire()->name);
-						cell->setPort(name, module->wire(remapped_name));
+					if (c->type == ID(MUX8)) {
+						RTLIL::Cell *cell = module->addCell(remap_name(c->name), ID($_MUX8_));
+						if (markgroups) cell->attributes[ID::abcgroup] = map_autoidx;
+						for (auto name : {ID::A, ID::B, ID::C, ID::D, ID::E, ID::F, ID::G, ID::H, ID::S, ID::T, ID::U, ID::Y}) {
+							RTLIL::IdString remapped_name = remap_name(c->getPort(name).as_wire()->name);
+							cell->setPort(name, module->wire(remapped_name));
+						}
+						design->select(module, cell);
+						continue;
 					}
-					design->select(module, cell);
-					continue;
-				}
-				if (c->type.in(ID(AOI4), ID(OAI4))) {
-					RTLIL::Cell *cell = module->addCell(remap_name(c->name), stringf("$_%s_", c->type.c_str()+1));
-					if (markgroups) cell->attributes[ID::abcgroup] = map_autoidx;
-					for (auto name : {ID::A, ID::B, ID::C, ID::D, ID::Y}) {
-						RTLIL::IdString remapped_name = remap_name(c->getPort(name).as_wire()->name);
-						cell->setPort(name, module->wire(remapped_name));
+					if (c->type == ID(MUX16)) {
+						RTLIL::Cell *cell = module->addCell(remap_name(c->name), ID($_MUX16_));
+						if (markgroups) cell->attributes[ID::abcgroup] = map_autoidx;
+						for (auto name : {ID::A, ID::B, ID::C, ID::D, ID::E, ID::F, ID::G, ID::H, ID::I, ID::J, ID::K,
+								ID::L, ID::M, ID::N, ID::O, ID::P, ID::S, ID::T, ID::U, ID::V, ID::Y}) {
+							RTLIL::IdString remapped_name = remap_name(c->getPort(name).as_wire()->name);
+							cell->setPort(name, module->wire(remapped_name));
+						}
+						design->select(module, cell);
+						continue;
 					}
-					design->select(module, cell);
+					if (c->type.in(ID(AOI3), ID(OAI3))) {
+						RTLIL::Cell *cell = module->addCell(remap_name(c->name), stringf("$_%s_", c->type.c_str()+1));
+						if (markgroups) cell->attributes[ID::abcgroup] = map_autoidx;
+						for (auto name : {ID::A, ID::B, ID::C, ID::Y}) {
+							RTLIL::IdString remapped_name = remap_name(c->getPort(name).as_wire()->name);
+							cell->setPort(name, module->wire(remapped_name));
+						}
+						design->select(module, cell);
+						continue;
+					}
+					if (c->type.in(ID(AOI4), ID(OAI4))) {
+						RTLIL::Cell *cell = module->addCell(remap_name(c->name), stringf("$_%s_", c->type.c_str()+1));
+						if (markgroups) cell->attributes[ID::abcgroup] = map_autoidx;
+						for (auto name : {ID::A, ID::B, ID::C, ID::D, ID::Y}) {
+							RTLIL::IdString remapped_name = remap_name(c->getPort(name).as_wire()->name);
+							cell->setPort(name, module->wire(remapped_name));
+						}
+						design->select(module, cell);
+						continue;
+					}
+					if (c->type == ID(DFF)) {
+						log_assert(clk_sig.size() == 1);
+						FfData ff(module, &initvals, remap_name(c->name));
+						ff.width = 1;
+						ff.is_fine = true;
+						ff.has_clk = true;
+						ff.pol_clk = clk_polarity;
+						ff.sig_clk = clk_sig;
+						if (en_sig.size() != 0) {
+							log_assert(en_sig.size() == 1);
+							ff.has_ce = true;
+							ff.pol_ce = en_polarity;
+							ff.sig_ce = en_sig;
+						}
+						RTLIL::Const init = mapped_initvals(c->getPort(ID::Q));
+						if (had_init)
+							ff.val_init = init;
+						else
+							ff.val_init = State::Sx;
+						if (arst_sig.size() != 0) {
+							log_assert(arst_sig.size() == 1);
+							ff.has_arst = true;
+							ff.pol_arst = arst_polarity;
+							ff.sig_arst = arst_sig;
+							ff.val_arst = init;
+						}
+						if (srst_sig.size() != 0) {
+							log_assert(srst_sig.size() == 1);
+							ff.has_srst = true;
+							ff.pol_srst = srst_polarity;
+							ff.sig_srst = srst_sig;
+							ff.val_srst = init;
+						}
+						ff.sig_d = module->wire(remap_name(c->getPort(ID::D).as_wire()->name));
+						ff.sig_q = module->wire(remap_name(c->getPort(ID::Q).as_wire()->name));
+						RTLIL::Cell *cell = ff.emit();
+						if (markgroups) cell->attributes[ID::abcgroup] = map_autoidx;
+						design->select(module, cell);
+						continue;
+					}
+				}
+				else
+					cell_stats[RTLIL::unescape_id(c->type)]++;
+
+				if (c->type.in(ID(_const0_), ID(_const1_))) {
+					RTLIL::SigSig conn;
+					conn.first = module->wire(remap_name(c->connections().begin()->second.as_wire()->name));
+					conn.second = RTLIL::SigSpec(c->type == ID(_const0_) ? 0 : 1, 1);
+					module->connect(conn);
 					continue;
 				}
-				if (c->type == ID(DFF)) {
+
+				if (c->type == ID(_dff_)) {
 					log_assert(clk_sig.size() == 1);
 					FfData ff(module, &initvals, remap_name(c->name));
 					ff.width = 1;
@@ -1283,7 +1490,6 @@ void abc_module(RTLIL::Design *design, RTLIL::Module *current_module, std::strin
 					ff.sig_clk = clk_sig;
 					if (en_sig.size() != 0) {
 						log_assert(en_sig.size() == 1);
-						ff.has_ce = true;
 						ff.pol_ce = en_polarity;
 						ff.sig_ce = en_sig;
 					}
@@ -1294,14 +1500,12 @@ void abc_module(RTLIL::Design *design, RTLIL::Module *current_module, std::strin
 						ff.val_init = State::Sx;
 					if (arst_sig.size() != 0) {
 						log_assert(arst_sig.size() == 1);
-						ff.has_arst = true;
 						ff.pol_arst = arst_polarity;
 						ff.sig_arst = arst_sig;
 						ff.val_arst = init;
 					}
 					if (srst_sig.size() != 0) {
 						log_assert(srst_sig.size() == 1);
-						ff.has_srst = true;
 						ff.pol_srst = srst_polarity;
 						ff.sig_srst = srst_sig;
 						ff.val_srst = init;
@@ -1313,125 +1517,87 @@ void abc_module(RTLIL::Design *design, RTLIL::Module *current_module, std::strin
 					design->select(module, cell);
 					continue;
 				}
-			}
-			else
-				cell_stats[RTLIL::unescape_id(c->type)]++;
-
-			if (c->type.in(ID(_const0_), ID(_const1_))) {
-				RTLIL::SigSig conn;
-				conn.first = module->wire(remap_name(c->connections().begin()->second.as_wire()->name));
-				conn.second = RTLIL::SigSpec(c->type == ID(_const0_) ? 0 : 1, 1);
-				module->connect(conn);
-				continue;
-			}
 
-			if (c->type == ID(_dff_)) {
-				log_assert(clk_sig.size() == 1);
-				FfData ff(module, &initvals, remap_name(c->name));
-				ff.width = 1;
-				ff.is_fine = true;
-				ff.has_clk = true;
-				ff.pol_clk = clk_polarity;
-				ff.sig_clk = clk_sig;
-				if (en_sig.size() != 0) {
-					log_assert(en_sig.size() == 1);
-					ff.pol_ce = en_polarity;
-					ff.sig_ce = en_sig;
-				}
-				RTLIL::Const init = mapped_initvals(c->getPort(ID::Q));
-				if (had_init)
-					ff.val_init = init;
-				else
-					ff.val_init = State::Sx;
-				if (arst_sig.size() != 0) {
-					log_assert(arst_sig.size() == 1);
-					ff.pol_arst = arst_polarity;
-					ff.sig_arst = arst_sig;
-					ff.val_arst = init;
-				}
-				if (srst_sig.size() != 0) {
-					log_assert(srst_sig.size() == 1);
-					ff.pol_srst = srst_polarity;
-					ff.sig_srst = srst_sig;
-					ff.val_srst = init;
+				if (c->type == ID($lut) && GetSize(c->getPort(ID::A)) == 1 && c->getParam(ID::LUT).as_int() == 2) {
+					SigSpec my_a = module->wire(remap_name(c->getPort(ID::A).as_wire()->name));
+					SigSpec my_y = module->wire(remap_name(c->getPort(ID::Y).as_wire()->name));
+					module->connect(my_y, my_a);
+					continue;
 				}
-				ff.sig_d = module->wire(remap_name(c->getPort(ID::D).as_wire()->name));
-				ff.sig_q = module->wire(remap_name(c->getPort(ID::Q).as_wire()->name));
-				RTLIL::Cell *cell = ff.emit();
+
+				RTLIL::Cell *cell = module->addCell(remap_name(c->name), c->type);
 				if (markgroups) cell->attributes[ID::abcgroup] = map_autoidx;
+				cell->parameters = c->parameters;
+				for (auto &conn : c->connections()) {
+					RTLIL::SigSpec newsig;
+					for (auto &c : conn.second.chunks()) {
+						if (c.width == 0)
+							continue;
+						log_assert(c.width == 1);
+						newsig.append(module->wire(remap_name(c.wire->name)));
+					}
+					cell->setPort(conn.first, newsig);
+				}
 				design->select(module, cell);
-				continue;
 			}
 
-			if (c->type == ID($lut) && GetSize(c->getPort(ID::A)) == 1 && c->getParam(ID::LUT).as_int() == 2) {
-				SigSpec my_a = module->wire(remap_name(c->getPort(ID::A).as_wire()->name));
-				SigSpec my_y = module->wire(remap_name(c->getPort(ID::Y).as_wire()->name));
-				module->connect(my_y, my_a);
-				continue;
+			for (auto conn : mapped_mod->connections()) {
+				if (!conn.first.is_fully_const())
+					conn.first = module->wire(remap_name(conn.first.as_wire()->name));
+				if (!conn.second.is_fully_const())
+					conn.second = module->wire(remap_name(conn.second.as_wire()->name));
+				module->connect(conn);
 			}
 
-			RTLIL::Cell *cell = module->addCell(remap_name(c->name), c->type);
-			if (markgroups) cell->attributes[ID::abcgroup] = map_autoidx;
-			cell->parameters = c->parameters;
-			for (auto &conn : c->connections()) {
-				RTLIL::SigSpec newsig;
-				for (auto &c : conn.second.chunks()) {
-					if (c.width == 0)
-						continue;
-					log_assert(c.width == 1);
-					newsig.append(module->wire(remap_name(c.wire->name)));
+			for (auto &it : cell_stats)
+				log("ABC RESULTS:   %15s cells: %8d\n", it.first.c_str(), it.second);
+			int in_wires = 0, out_wires = 0;
+			for (auto &si : signal_list)
+				if (si.is_port) {
+					char buffer[100];
+					snprintf(buffer, 100, "\\ys__n%d", si.id);
+					RTLIL::SigSig conn;
+					if (si.type != G(NONE)) {
+						conn.first = si.bit;
+						conn.second = module->wire(remap_name(buffer));
+						out_wires++;
+					} else {
+						conn.first = module->wire(remap_name(buffer));
+						conn.second = si.bit;
+						in_wires++;
+					}
+					module->connect(conn);
 				}
-				cell->setPort(conn.first, newsig);
-			}
-			design->select(module, cell);
-		}
+			log("ABC RESULTS:        internal signals: %8d\n", int(signal_list.size()) - in_wires - out_wires);
+			log("ABC RESULTS:           input signals: %8d\n", in_wires);
+			log("ABC RESULTS:          output signals: %8d\n", out_wires);
 
-		for (auto conn : mapped_mod->connections()) {
-			if (!conn.first.is_fully_const())
-				conn.first = module->wire(remap_name(conn.first.as_wire()->name));
-			if (!conn.second.is_fully_const())
-				conn.second = module->wire(remap_name(conn.second.as_wire()->name));
-			module->connect(conn);
+			delete mapped_design;
+		}
+		else
+		{
+			log("Don't call ABC as there is nothing to map.\n");
 		}
 
-		for (auto &it : cell_stats)
-			log("ABC RESULTS:   %15s cells: %8d\n", it.first.c_str(), it.second);
-		int in_wires = 0, out_wires = 0;
-		for (auto &si : signal_list)
-			if (si.is_port) {
-				char buffer[100];
-				snprintf(buffer, 100, "\\ys__n%d", si.id);
-				RTLIL::SigSig conn;
-				if (si.type != G(NONE)) {
-					conn.first = si.bit;
-					conn.second = module->wire(remap_name(buffer));
-					out_wires++;
-				} else {
-					conn.first = module->wire(remap_name(buffer));
-					conn.second = si.bit;
-					in_wires++;
-				}
-				module->connect(conn);
-			}
-		log("ABC RESULTS:        internal signals: %8d\n", int(signal_list.size()) - in_wires - out_wires);
-		log("ABC RESULTS:           input signals: %8d\n", in_wires);
-		log("ABC RESULTS:          output signals: %8d\n", out_wires);
-
-		delete mapped_design;
-	}
-	else
-	{
-		log("Don't call ABC as there is nothing to map.\n");
+		if (config.cleanup)
+		{
+			log("Removing temp directory.\n");
+			remove_directory(tempdir_name);
+		}
 	}
 
-	if (cleanup)
+	// Runs ABC and re-integrates its result right away (without -j).
+	void run_and_reintegrate(RTLIL::Design *design)
 	{
-		log("Removing temp directory.\n");
-		remove_directory(tempdir_name);
+		log_push();
+		if (count_output > 0) {
+			log_header(design, "Executing ABC.\n");
+			run_abc();
+		}
+		reintegrate(design);
+		log_pop();
 	}
-
-	log_pop();
-}
+};
 
 struct AbcPass : public Pass {
 	AbcPass() : Pass("abc", "use ABC for technology mapping") { }
@@ -1612,6 +1778,21 @@ struct AbcPass : public Pass {
 		log("        preserve naming by an equivalence check between the original and\n");
 		log("        post-ABC netlists (experimental).\n");
 		log("\n");
+		log("    -pipe\n");
+		log("        read the mapped netlist from a pipe instead of a temp file, and put\n");
+		log("        the remaining temp files (the extracted netlist, which ABC can only\n");
+		log("        read from a regular file, and the script) in /dev/shm if available\n");
+		log("        and $TMPDIR is not set. The linked-in ABC (if Yosys is built with it)\n");
+		log("        is already called without starting a new process, but still uses\n");
+		log("        temp files.\n");
+		log("\n");
+		log("    -j <N>\n");
+		log("        run up to N ABC processes in parallel. The netlists of all selected\n");
+		log("        modules (and of all clock domains with -dff) are extracted first, the\n");
+		log("        ABC results are re-integrated in the same order once all processes\n");
+		log("        have finished. The result does not depend on N, but can differ from\n");
+		log("        the result without -j in the names of the generated objects.\n");
+		log("\n");
 		log("When no target cell library is specified the Yosys standard cell library is\n");
 		log("loaded into ABC before the ABC script is executed.\n");
 		log("\n");
@@ -1630,21 +1811,12 @@ struct AbcPass : public Pass {
 		log_header(design, "Executing ABC pass (technology mapping using ABC).\n");
 		log_push();
 
-		assign_map.clear();
-		signal_list.clear();
-		signal_map.clear();
-		initvals.clear();
-		pi_map.clear();
-		po_map.clear();
-
-		std::string exe_file = yosys_abc_executable;
-		std::string script_file, default_liberty_file, constr_file, clk_str;
-		std::vector<std::string> liberty_files, genlib_files;
-		std::string delay_target, sop_inputs, sop_products, lutin_shared = "-S 1";
-		bool fast_mode = false, dff_mode = false, keepff = false, cleanup = true;
-		bool show_tempdir = false, sop_mode = false;
-		bool abc_dress = false;
-		vector<int> lut_costs;
+		AbcConfig config;
+		config.exe_file = yosys_abc_executable;
+
+		std::string default_liberty_file, clk_str;
+		bool dff_mode = false;
+		int num_threads = 0;
 		markgroups = false;
 
 		map_mux4 = false;
@@ -1655,46 +1827,47 @@ struct AbcPass : public Pass {
 
 		// get arguments from scratchpad first, then override by command arguments
 		std::string lut_arg, luts_arg, g_arg;
-		exe_file = design->scratchpad_get_string("abc.exe", exe_file /* inherit default value if not set */);
-		script_file = design->scratchpad_get_string("abc.script", script_file);
+		config.exe_file = design->scratchpad_get_string("abc.exe", config.exe_file /* inherit default value if not set */);
+		config.script_file = design->scratchpad_get_string("abc.script", config.script_file);
 		default_liberty_file = design->scratchpad_get_string("abc.liberty", default_liberty_file);
-		constr_file = design->scratchpad_get_string("abc.constr", constr_file);
+		config.constr_file = design->scratchpad_get_string("abc.constr", config.constr_file);
 		if (design->scratchpad.count("abc.D")) {
-			delay_target = "-D " + design->scratchpad_get_string("abc.D");
+			config.delay_target = "-D " + design->scratchpad_get_string("abc.D");
 		}
 		if (design->scratchpad.count("abc.I")) {
-			sop_inputs = "-I " + design->scratchpad_get_string("abc.I");
+			config.sop_inputs = "-I " + design->scratchpad_get_string("abc.I");
 		}
 		if (design->scratchpad.count("abc.P")) {
-			sop_products = "-P " + design->scratchpad_get_string("abc.P");
+			config.sop_products = "-P " + design->scratchpad_get_string("abc.P");
 		}
 		if (design->scratchpad.count("abc.S")) {
-			lutin_shared = "-S " + design->scratchpad_get_string("abc.S");
+			config.lutin_shared = "-S " + design->scratchpad_get_string("abc.S");
 		}
 		lut_arg = design->scratchpad_get_string("abc.lut", lut_arg);
 		luts_arg = design->scratchpad_get_string("abc.luts", luts_arg);
-		sop_mode = design->scratchpad_get_bool("abc.sop", sop_mode);
+		config.sop_mode = design->scratchpad_get_bool("abc.sop", config.sop_mode);
 		map_mux4 = design->scratchpad_get_bool("abc.mux4", map_mux4);
 		map_mux8 = design->scratchpad_get_bool("abc.mux8", map_mux8);
 		map_mux16 = design->scratchpad_get_bool("abc.mux16", map_mux16);
-		abc_dress = design->scratchpad_get_bool("abc.dress", abc_dress);
+		config.abc_dress = design->scratchpad_get_bool("abc.dress", config.abc_dress);
 		g_arg = design->scratchpad_get_string("abc.g", g_arg);
 
-		fast_mode = design->scratchpad_get_bool("abc.fast", fast_mode);
+		config.fast_mode = design->scratchpad_get_bool("abc.fast", config.fast_mode);
 		dff_mode = design->scratchpad_get_bool("abc.dff", dff_mode);
 		if (design->scratchpad.count("abc.clk")) {
 			clk_str = design->scratchpad_get_string("abc.clk");
 			dff_mode = true;
 		}
-		keepff = design->scratchpad_get_bool("abc.keepff", keepff);
-		cleanup = !design->scratchpad_get_bool("abc.nocleanup", !cleanup);
-		keepff = design->scratchpad_get_bool("abc.keepff", keepff);
-		show_tempdir = design->scratchpad_get_bool("abc.showtmp", show_tempdir);
+		config.keepff = design->scratchpad_get_bool("abc.keepff", config.keepff);
+		config.cleanup = !design->scratchpad_get_bool("abc.nocleanup", !config.cleanup);
+		config.keepff = design->scratchpad_get_bool("abc.keepff", config.keepff);
+		config.show_tempdir = design->scratchpad_get_bool("abc.showtmp", config.show_tempdir);
+		config.pipe_mode = design->scratchpad_get_bool("abc.pipe", config.pipe_mode);
 		markgroups = design->scratchpad_get_bool("abc.markgroups", markgroups);
 
 		if (design->scratchpad_get_bool("abc.debug")) {
-			cleanup = false;
-			show_tempdir = true;
+			config.cleanup = false;
+			config.show_tempdir = true;
 		}
 
 		size_t argidx, g_argidx;
@@ -1711,39 +1884,39 @@ struct AbcPass : public Pass {
 		for (argidx = 1; argidx < args.size(); argidx++) {
 			std::string arg = args[argidx];
 			if (arg == "-exe" && argidx+1 < args.size()) {
-				exe_file = args[++argidx];
+				config.exe_file = args[++argidx];
 				continue;
 			}
 			if (arg == "-script" && argidx+1 < args.size()) {
-				script_file = args[++argidx];
+				config.script_file = args[++argidx];
 				continue;
 			}
 			if (arg == "-liberty" && argidx+1 < args.size()) {
-				liberty_files.push_back(args[++argidx]);
+				config.liberty_files.push_back(args[++argidx]);
 				continue;
 			}
 			if (arg == "-genlib" && argidx+1 < args.size()) {
-				genlib_files.push_back(args[++argidx]);
+				config.genlib_files.push_back(args[++argidx]);
 				continue;
 			}
 			if (arg == "-constr" && argidx+1 < args.size()) {
-				constr_file = args[++argidx];
+				config.constr_file = args[++argidx];
 				continue;
 			}
 			if (arg == "-D" && argidx+1 < args.size()) {
-				delay_target = "-D " + args[++argidx];
+				config.delay_target = "-D " + args[++argidx];
 				continue;
 			}
 			if (arg == "-I" && argidx+1 < args.size()) {
-				sop_inputs = "-I " + args[++argidx];
+				config.sop_inputs = "-I " + args[++argidx];
 				continue;
 			}
 			if (arg == "-P" && argidx+1 < args.size()) {
-				sop_products = "-P " + args[++argidx];
+				config.sop_products = "-P " + args[++argidx];
 				continue;
 			}
 			if (arg == "-S" && argidx+1 < args.size()) {
-				lutin_shared = "-S " + args[++argidx];
+				config.lutin_shared = "-S " + args[++argidx];
 				continue;
 			}
 			if (arg == "-lut" && argidx+1 < args.size()) {
@@ -1755,7 +1928,7 @@ struct AbcPass : public Pass {
 				continue;
 			}
 			if (arg == "-sop") {
-				sop_mode = true;
+				config.sop_mode = true;
 				continue;
 			}
 			if (arg == "-mux4") {
@@ -1771,7 +1944,7 @@ struct AbcPass : public Pass {
 				continue;
 			}
 			if (arg == "-dress") {
-				abc_dress = true;
+				config.abc_dress = true;
 				continue;
 			}
 			if (arg == "-g" && argidx+1 < args.size()) {
@@ -1783,7 +1956,7 @@ struct AbcPass : public Pass {
 				continue;
 			}
 			if (arg == "-fast") {
-				fast_mode = true;
+				config.fast_mode = true;
 				continue;
 			}
 			if (arg == "-dff") {
@@ -1795,45 +1968,55 @@ struct AbcPass : public Pass {
 				dff_mode = true;
 				continue;
 			}
-			if (arg == "-keepff") {
-				keepff = true;
+			if (arg == "-config.keepff") {
+				config.keepff = true;
 				continue;
 			}
 			if (arg == "-nocleanup") {
-				cleanup = false;
+				config.cleanup = false;
 				continue;
 			}
 			if (arg == "-showtmp") {
-				show_tempdir = true;
+				config.show_tempdir = true;
 				continue;
 			}
 			if (arg == "-markgroups") {
 				markgroups = true;
 				continue;
 			}
+			if (arg == "-pipe") {
+				config.pipe_mode = true;
+				continue;
+			}
+			if (arg == "-j" && argidx+1 < args.size()) {
+				num_threads = atoi(args[++argidx].c_str());
+				if (num_threads < 1)
+					log_cmd_error("Invalid number of ABC processes: %d\n", num_threads);
+				continue;
+			}
 			break;
 		}
 		extra_args(args, argidx, design);
 
-		if (genlib_files.empty() && liberty_files.empty() && !default_liberty_file.empty())
-			liberty_files.push_back(default_liberty_file);
+		if (config.genlib_files.empty() && config.liberty_files.empty() && !default_liberty_file.empty())
+			config.liberty_files.push_back(default_liberty_file);
 
-		rewrite_filename(script_file);
-		if (!script_file.empty() && !is_absolute_path(script_file) && script_file[0] != '+')
-			script_file = std::string(pwd) + "/" + script_file;
-		for (int i = 0; i < GetSize(liberty_files); i++) {
-			rewrite_filename(liberty_files[i]);
-			if (!liberty_files[i].empty() && !is_absolute_path(liberty_files[i]))
-				liberty_files[i] = std::string(pwd) + "/" + liberty_files[i];
+		rewrite_filename(config.script_file);
+		if (!config.script_file.empty() && !is_absolute_path(config.script_file) && config.script_file[0] != '+')
+			config.script_file = std::string(pwd) + "/" + config.script_file;
+		for (int i = 0; i < GetSize(config.liberty_files); i++) {
+			rewrite_filename(config.liberty_files[i]);
+			if (!config.liberty_files[i].empty() && !is_absolute_path(config.liberty_files[i]))
+				config.liberty_files[i] = std::string(pwd) + "/" + config.liberty_files[i];
 		}
-		for (int i = 0; i < GetSize(genlib_files); i++) {
-			rewrite_filename(genlib_files[i]);
-			if (!genlib_files[i].empty() && !is_absolute_path(genlib_files[i]))
-				genlib_files[i] = std::string(pwd) + "/" + genlib_files[i];
+		for (int i = 0; i < GetSize(config.genlib_files); i++) {
+			rewrite_filename(config.genlib_files[i]);
+			if (!config.genlib_files[i].empty() && !is_absolute_path(config.genlib_files[i]))
+				config.genlib_files[i] = std::string(pwd) + "/" + config.genlib_files[i];
 		}
-		rewrite_filename(constr_file);
-		if (!constr_file.empty() && !is_absolute_path(constr_file))
-			constr_file = std::string(pwd) + "/" + constr_file;
+		rewrite_filename(config.constr_file);
+		if (!config.constr_file.empty() && !is_absolute_path(config.constr_file))
+			config.constr_file = std::string(pwd) + "/" + config.constr_file;
 
 		// handle -lut argument
 		if (!lut_arg.empty()) {
@@ -1846,24 +2029,24 @@ struct AbcPass : public Pass {
 				lut_mode = atoi(lut_arg.c_str());
 				lut_mode2 = lut_mode;
 			}
-			lut_costs.clear();
+			config.lut_costs.clear();
 			for (int i = 0; i < lut_mode; i++)
-				lut_costs.push_back(1);
+				config.lut_costs.push_back(1);
 			for (int i = lut_mode; i < lut_mode2; i++)
-				lut_costs.push_back(2 << (i - lut_mode));
+				config.lut_costs.push_back(2 << (i - lut_mode));
 		}
 		//handle -luts argument
 		if (!luts_arg.empty()){
-			lut_costs.clear();
+			config.lut_costs.clear();
 			for (auto &tok : split_tokens(luts_arg, ",")) {
 				auto parts = split_tokens(tok, ":");
-				if (GetSize(parts) == 0 && !lut_costs.empty())
-					lut_costs.push_back(lut_costs.back());
+				if (GetSize(parts) == 0 && !config.lut_costs.empty())
+					config.lut_costs.push_back(config.lut_costs.back());
 				else if (GetSize(parts) == 1)
-					lut_costs.push_back(atoi(parts.at(0).c_str()));
+					config.lut_costs.push_back(atoi(parts.at(0).c_str()));
 				else if (GetSize(parts) == 2)
-					while (GetSize(lut_costs) < std::atoi(parts.at(0).c_str()))
-						lut_costs.push_back(atoi(parts.at(1).c_str()));
+					while (GetSize(config.lut_costs) < std::atoi(parts.at(0).c_str()))
+						config.lut_costs.push_back(atoi(parts.at(1).c_str()));
 				else
 					log_cmd_error("Invalid -luts syntax.\n");
 			}
@@ -1994,9 +2177,9 @@ struct AbcPass : public Pass {
 			}
 		}
 
-		if (!lut_costs.empty() && !(liberty_files.empty() && genlib_files.empty()))
+		if (!config.lut_costs.empty() && !(config.liberty_files.empty() && config.genlib_files.empty()))
 			log_cmd_error("Got -lut and -liberty/-genlib! These two options are exclusive.\n");
-		if (!constr_file.empty() && (liberty_files.empty() && genlib_files.empty()))
+		if (!config.constr_file.empty() && (config.liberty_files.empty() && config.genlib_files.empty()))
 			log_cmd_error("Got -constr but no -liberty/-genlib!\n");
 
 		if (enabled_gates.empty()) {
@@ -2016,6 +2199,8 @@ struct AbcPass : public Pass {
 			// enabled_gates.insert("NMUX");
 		}
 
+		std::vector<std::unique_ptr<AbcModuleState>> jobs;
+
 		for (auto mod : design->selected_modules())
 		{
 			if (mod->processes.size() > 0) {
@@ -2023,15 +2208,22 @@ struct AbcPass : public Pass {
 				continue;
 			}
 
-			assign_map.set(mod);
-			initvals.set(&assign_map, mod);
+			SigMap assign_map(mod);
 
 			if (!dff_mode || !clk_str.empty()) {
-				abc_module(design, mod, script_file, exe_file, liberty_files, genlib_files, constr_file, cleanup, lut_costs, dff_mode, clk_str, keepff,
-						delay_target, sop_inputs, sop_products, lutin_shared, fast_mode, mod->selected_cells(), show_tempdir, sop_mode, abc_dress);
+				AbcModuleState *job = new AbcModuleState(config, mod, assign_map);
+				job->extract(design, dff_mode, clk_str, mod->selected_cells(), nullptr);
+				if (num_threads > 0) {
+					jobs.emplace_back(job);
+				} else {
+					job->run_and_reintegrate(design);
+					delete job;
+				}
 				continue;
 			}
 
+			FfInitVals initvals(&assign_map, mod);
+
 			CellTypes ct(design);
 
 			std::vector<RTLIL::Cell*> all_cells = mod->selected_cells();
@@ -2180,27 +2372,62 @@ struct AbcPass : public Pass {
 						std::get<4>(it.first) ? "" : "!", log_signal(std::get<5>(it.first)),
 						std::get<6>(it.first) ? "" : "!", log_signal(std::get<7>(it.first)));
 
+			pool<RTLIL::SigBit> extracted_bits;
 			for (auto &it : assigned_cells) {
-				clk_polarity = std::get<0>(it.first);
-				clk_sig = assign_map(std::get<1>(it.first));
-				en_polarity = std::get<2>(it.first);
-				en_sig = assign_map(std::get<3>(it.first));
-				arst_polarity = std::get<4>(it.first);
-				arst_sig = assign_map(std::get<5>(it.first));
-				srst_polarity = std::get<6>(it.first);
-				srst_sig = assign_map(std::get<7>(it.first));
-				abc_module(design, mod, script_file, exe_file, liberty_files, genlib_files, constr_file, cleanup, lut_costs, !clk_sig.empty(), "$",
-						keepff, delay_target, sop_inputs, sop_products, lutin_shared, fast_mode, it.second, show_tempdir, sop_mode, abc_dress);
-				assign_map.set(mod);
+				AbcModuleState *job = new AbcModuleState(config, mod, assign_map);
+				job->clk_polarity = std::get<0>(it.first);
+				job->clk_sig = assign_map(std::get<1>(it.first));
+				job->en_polarity = std::get<2>(it.first);
+				job->en_sig = assign_map(std::get<3>(it.first));
+				job->arst_polarity = std::get<4>(it.first);
+				job->arst_sig = assign_map(std::get<5>(it.first));
+				job->srst_polarity = std::get<6>(it.first);
+				job->srst_sig = assign_map(std::get<7>(it.first));
+				if (num_threads > 0) {
+					job->extract(design, !job->clk_sig.empty(), "$", it.second, &extracted_bits);
+					for (auto &si : job->signal_list)
+						extracted_bits.insert(si.bit);
+					jobs.emplace_back(job);
+				} else {
+					job->extract(design, !job->clk_sig.empty(), "$", it.second, nullptr);
+					job->run_and_reintegrate(design);
+					delete job;
+					assign_map.set(mod);
+				}
 			}
 		}
 
-		assign_map.clear();
-		signal_list.clear();
-		signal_map.clear();
-		initvals.clear();
-		pi_map.clear();
-		po_map.clear();
+		if (!jobs.empty())
+		{
+#ifdef YOSYS_LINK_ABC
+			// the linked ABC is not reentrant
+			num_threads = 1;
+#endif
+			log_header(design, "Executing ABC (%d jobs, up to %d in parallel).\n", GetSize(jobs), num_threads);
+
+			auto start = std::chrono::steady_clock::now();
+			parallel_for(GetSize(jobs), [&](int i) {
+				if (jobs[i]->count_output > 0) {
+					log("Job %d (module %s):\n", i, log_id(jobs[i]->module));
+					jobs[i]->run_abc();
+				}
+			}, num_threads);
+			std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+			double total_runtime = 0;
+			log("\n");
+			for (int i = 0; i < GetSize(jobs); i++) {
+				log("Job %4d: %8.3f sec, %6d outputs, module %s\n", i, jobs[i]->runtime, jobs[i]->count_output, log_id(jobs[i]->module));
+				total_runtime += jobs[i]->runtime;
+			}
+			log("Ran %d jobs in %.3f sec (%.3f sec in total).\n", GetSize(jobs), elapsed.count(), total_runtime);
+
+			for (auto &job : jobs) {
+				log_push();
+				job->reintegrate(design);
+				log_pop();
+			}
+		}
 
 		log_pop();
 	}
@@ -26,6 +26,15 @@
 #include <iostream>
 #include <sstream>
 
+#include <sys/stat.h>
+
+#if !defined(_WIN32) && !defined(__wasm)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <unistd.h>
+#  define YOSYS_LIBPARSE_MMAP
+#endif
+
 #ifndef FILTERLIB
 #include "kernel/log.h"
 #endif
@@ -83,26 +92,176 @@ void LibertyAst::dump(FILE *f, std::string indent, std::string path, bool path_o
 		fprintf(f, " ;\n");
 }
 
+LibertyParser::LibertyParser(std::istream &f, bool index_cells) : mapped(nullptr), index_cells(index_cells)
+{
+	std::stringstream ss;
+	ss << f.rdbuf();
+	buffer = ss.str();
+	data = buffer.data();
+	size = buffer.size();
+	init();
+}
+
+LibertyParser::LibertyParser(const std::string &filename, bool index_cells) : mapped(nullptr), index_cells(index_cells)
+{
+#ifdef YOSYS_LIBPARSE_MMAP
+	int fd = open(filename.c_str(), O_RDONLY);
+	struct stat st;
+	if (fd >= 0 && fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+		mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (mapped == MAP_FAILED) {
+			mapped = nullptr;
+		} else {
+			data = (const char*)mapped;
+			size = st.st_size;
+		}
+	}
+	if (fd >= 0)
+		close(fd);
+	if (mapped != nullptr) {
+		init();
+		return;
+	}
+#endif
+	std::ifstream f(filename.c_str(), std::ios::binary);
+	std::stringstream ss;
+	ss << f.rdbuf();
+	buffer = ss.str();
+	data = buffer.data();
+	size = buffer.size();
+	init();
+}
+
+LibertyParser::~LibertyParser()
+{
+	if (ast)
+		delete ast;
+#ifdef YOSYS_LIBPARSE_MMAP
+	if (mapped != nullptr)
+		munmap(mapped, size);
+#endif
+}
+
+void LibertyParser::init()
+{
+	pos = 0;
+	line = 1;
+	depth = 0;
+	ast = parse();
+}
+
+LibertyAst *LibertyParser::cell(const std::string &name)
+{
+	auto it = cell_index.find(name);
+	if (it == cell_index.end()) {
+		if (!index_cells && ast != NULL)
+			for (auto child : ast->children)
+				if (child->id == "cell" && child->args.size() == 1 && child->args[0] == name)
+					return child;
+		return NULL;
+	}
+	CellLocation &loc = cells[it->second];
+	if (!loc.parsed)
+		parse_cell(loc);
+	return loc.ast;
+}
+
+void LibertyParser::parse_all_cells()
+{
+	for (auto &loc : cells)
+		if (!loc.parsed)
+			parse_cell(loc);
+}
+
+void LibertyParser::parse_cell(CellLocation &loc)
+{
+	size_t saved_pos = pos;
+	int saved_line = line, saved_depth = depth;
+
+	pos = loc.pos;
+	line = loc.line;
+	depth = 2;
+	while (1) {
+		LibertyAst *child = parse();
+		if (child == NULL)
+			break;
+		loc.ast->children.push_back(child);
+	}
+	loc.parsed = true;
+
+	pos = saved_pos;
+	line = saved_line;
+	depth = saved_depth;
+}
+
+// Skips the body of a group up to its closing '}', following the lexer's
+// rules for strings and comments so that braces in them are not counted.
+void LibertyParser::skip_group()
+{
+	int level = 1;
+	while (level > 0) {
+		int c = get();
+		switch (c) {
+		case EOF:
+			return;
+		case '\n':
+			line++;
+			break;
+		case '{':
+			level++;
+			break;
+		case '}':
+			level--;
+			break;
+		case '"':
+			while ((c = get()) != '"') {
+				if (c == EOF)
+					error("Unexpected end of file in string.");
+				if (c == '\n')
+					line++;
+			}
+			break;
+		case '/':
+			c = get();
+			if (c == '*') {
+				int last_c = 0;
+				while (c > 0 && (last_c != '*' || c != '/')) {
+					last_c = c;
+					c = get();
+					if (c == '\n')
+						line++;
+				}
+			} else if (c == '/') {
+				while (c > 0 && c != '\n')
+					c = get();
+				line++;
+			} else
+				unget();
+			break;
+		}
+	}
+}
+
 int LibertyParser::lexer(std::string &str)
 {
 	int c;
 
 	// eat whitespace
 	do {
-		c = f.get();
+		c = get();
 	} while (c == ' ' || c == '\t' || c == '\r');
 
 	// search for identifiers, numbers, plus or minus.
 	if (('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || ('0' <= c && c <= '9') || c == '_' || c == '-' || c == '+' || c == '.') {
 		str = static_cast<char>(c);
 		while (1) {
-			c = f.get();
+			c = get();
 			if (('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || ('0' <= c && c <= '9') || c == '_' || c == '-' || c == '+' || c == '.')
 				str += c;
 			else
 				break;
 		}
-		f.unget();
+		unget();
 		if (str == "+" || str == "-") {
 			/* Single operator is not an identifier */
 			// fprintf(stderr, "LEX: char >>%s<<\n", str.c_str());
@@ -119,7 +278,9 @@ int LibertyParser::lexer(std::string &str)
 	if (c == '"') {
 		str = "";
 		while (1) {
-			c = f.get();
+			c = get();
+			if (c == EOF)
+				error("Unexpected end of file in string.");
 			if (c == '\n')
 				line++;
 			if (c == '"')
@@ -132,37 +293,37 @@ int LibertyParser::lexer(std::string &str)
 
 	// if it wasn't a string, perhaps it's a comment or a forward slash?
 	if (c == '/') {
-		c = f.get();
+		c = get();
 		if (c == '*') {         // start of '/*' block comment
 			int last_c = 0;
 			while (c > 0 && (last_c != '*' || c != '/')) {
 				last_c = c;
-				c = f.get();
+				c = get();
 				if (c == '\n')
 					line++;
 			}
 			return lexer(str);
 		} else if (c == '/') {  // start of '//' line comment
 			while (c > 0 && c != '\n')
-				c = f.get();
+				c = get();
 			line++;
 			return lexer(str);
 		}
-		f.unget();
+		unget();
 		// fprintf(stderr, "LEX: char >>/<<\n");
 		return '/';             // a single '/' charater.
 	}
 
 	// check for a backslash
 	if (c == '\\') {
-		c = f.get();		
+		c = get();		
 		if (c == '\r')
-			c = f.get();
+			c = get();
 		if (c == '\n') {
 			line++;
 			return lexer(str);
 		}
-		f.unget();
+		unget();
 		return '\\';
 	}
 
@@ -336,12 +497,20 @@ LibertyAst *LibertyParser::parse()
 		}
 
 		if (tok == '{') {
+			if (index_cells && depth == 1 && ast->id == "cell" && ast->args.size() == 1) {
+				cell_index.emplace(ast->args[0], cells.size());
+				cells.push_back(CellLocation{ast, pos, line, false});
+				skip_group();
+				break;
+			}
+			depth++;
 			while (1) {
 				LibertyAst *child = parse();
 				if (child == NULL)
 					break;
 				ast->children.push_back(child);
 			}
+			depth--;
 			break;
 		}
 
@@ -353,6 +522,31 @@ LibertyAst *LibertyParser::parse()
 
 #ifndef FILTERLIB
 
+std::shared_ptr<LibertyParser> LibertyParser::load(const std::string &filename)
+{
+	static std::map<std::string, std::pair<std::string, std::shared_ptr<LibertyParser>>> cache;
+
+	struct stat st;
+	if (stat(filename.c_str(), &st) != 0)
+		log_cmd_error("Can't open liberty file `%s': %s\n", filename.c_str(), strerror(errno));
+	std::string stamp = stringf("%lld:%lld", (long long)st.st_size, (long long)st.st_mtime);
+
+	auto it = cache.find(filename);
+	if (it != cache.end() && it->second.first == stamp) {
+		log("Using already parsed liberty file `%s'.\n", filename.c_str());
+		return it->second.second;
+	}
+
+	std::ifstream f(filename.c_str());
+	if (f.fail())
+		log_cmd_error("Can't open liberty file `%s': %s\n", filename.c_str(), strerror(errno));
+	f.close();
+
+	auto parser = std::make_shared<LibertyParser>(filename, true);
+	cache[filename] = std::make_pair(stamp, parser);
+	return parser;
+}
+
 void LibertyParser::error()
 {
 	log_error("Syntax error in liberty file on line %d.\n", line);
@@ -24,6 +24,9 @@
 #include <string>
 #include <vector>
 #include <set>
+#include <map>
+#include <memory>
+#include <istream>
 
 namespace Yosys
 {
@@ -41,12 +44,47 @@ namespace Yosys
 
 	struct LibertyParser
 	{
-		std::istream &f;
+		// The whole liberty file, either memory-mapped or read into buffer.
+		// The lexer works on this directly instead of reading an istream
+		// character by character.
+		const char *data;
+		size_t size, pos;
+		std::string buffer;
+		void *mapped;
+
 		int line;
 		LibertyAst *ast;
-		LibertyParser(std::istream &f) : f(f), line(1), ast(parse()) {}
-		~LibertyParser() { if (ast) delete ast; }
-        
+
+		// With index_cells the bodies of the cell groups of the library are
+		// only skipped over when the file is parsed: such a cell is a node
+		// with id "cell", its name as the only arg and no children until it
+		// is parsed with cell() or parse_all_cells(). This way a caller that
+		// needs only a few cells of a large library doesn't pay for the rest.
+		bool index_cells;
+		struct CellLocation {
+			LibertyAst *ast;
+			size_t pos;
+			int line;
+			bool parsed;
+		};
+		std::vector<CellLocation> cells;
+		std::map<std::string, size_t> cell_index;
+
+		LibertyParser(std::istream &f, bool index_cells = false);
+		LibertyParser(const std::string &filename, bool index_cells = false);
+		~LibertyParser();
+
+		// returns the (parsed) cell group with the given name, or NULL
+		LibertyAst *cell(const std::string &name);
+		void parse_all_cells();
+
+#ifndef FILTERLIB
+		// Returns the parser for a liberty file, with indexed cells. The
+		// parsers are kept for the rest of the session, a file is only parsed
+		// again if its size or modification time changed.
+		static std::shared_ptr<LibertyParser> load(const std::string &filename);
+#endif
+
         /* lexer return values:
            'v': identifier, string, array range [...] -> str holds the token string
            'n': newline
@@ -57,6 +95,20 @@ namespace Yosys
         LibertyAst *parse();
 		void error();
         void error(const std::string &str);
+
+	private:
+		int depth;
+
+		int get() {
+			return pos++ < size ? (unsigned char)data[pos-1] : EOF;
+		}
+		void unget() {
+			pos--;
+		}
+
+		void init();
+		void skip_group();
+		void parse_cell(CellLocation &loc);
 	};
 }
 
@@ -0,0 +1,135 @@
+/*
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ */
+
+#include "kernel/yosys.h"
+#include "kernel/packedconst.h"
+
+#include <chrono>
+
+USING_YOSYS_NAMESPACE
+PRIVATE_NAMESPACE_BEGIN
+
+static uint32_t xorshift32_state = 123456789;
+
+static uint32_t xorshift32()
+{
+	xorshift32_state ^= xorshift32_state << 13;
+	xorshift32_state ^= xorshift32_state >> 17;
+	xorshift32_state ^= xorshift32_state << 5;
+	return xorshift32_state;
+}
+
+static RTLIL::Const random_const(int width, int undef_permille)
+{
+	RTLIL::Const c(RTLIL::State::S0, width);
+	for (int i = 0; i < width; i++) {
+		if (undef_permille && int(xorshift32() % 1000) < undef_permille)
+			c.bits[i] = RTLIL::State::Sx;
+		else if (xorshift32() & 1)
+			c.bits[i] = RTLIL::State::S1;
+	}
+	return c;
+}
+
+struct BenchConstPass : public Pass {
+	BenchConstPass() : Pass("bench_const", "benchmark the const_* functions on wide constants") { }
+	void help() override
+	{
+		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
+		log("\n");
+		log("    bench_const [options]\n");
+		log("\n");
+		log("Measure the throughput of the constant folding functions (const_and(), etc.)\n");
+		log("and of some RTLIL::Const methods on random constants of the given width.\n");
+		log("\n");
+		log("    -w {integer}\n");
+		log("        width of the constants (default = 4194304).\n");
+		log("\n");
+		log("    -r {integer}\n");
+		log("        number of repetitions of each operation (default = 10).\n");
+		log("\n");
+		log("    -x {integer}\n");
+		log("        number of undefined bits per 1000 bits (default = 0).\n");
+		log("\n");
+	}
+	void execute(std::vector<std::string> args, RTLIL::Design*) override
+	{
+		int width = 4194304;
+		int rounds = 10;
+		int undef_permille = 0;
+
+		log_header(nullptr, "Executing BENCH_CONST pass.\n");
+
+		size_t argidx;
+		for (argidx = 1; argidx < args.size(); argidx++)
+		{
+			if (args[argidx] == "-w" && argidx+1 < args.size()) {
+				width = atoi(args[++argidx].c_str());
+				continue;
+			}
+			if (args[argidx] == "-r" && argidx+1 < args.size()) {
+				rounds = atoi(args[++argidx].c_str());
+				continue;
+			}
+			if (args[argidx] == "-x" && argidx+1 < args.size()) {
+				undef_permille = atoi(args[++argidx].c_str());
+				continue;
+			}
+			break;
+		}
+		extra_args(args, argidx, nullptr, false);
+
+		if (width < 1 || rounds < 1)
+			log_cmd_error("Invalid width or number of rounds.\n");
+
+		RTLIL::Const a = random_const(width, undef_permille);
+		RTLIL::Const b = random_const(width, undef_permille);
+		RTLIL::Const shift(17, 32);
+		RTLIL::Const none;
+
+		log("Using %d bit constants, %d rounds, %d undefined bits per 1000.\n", width, rounds, undef_permille);
+
+		auto bench = [&](const char *name, std::function<void()> func) {
+			auto start = std::chrono::steady_clock::now();
+			for (int i = 0; i < rounds; i++)
+				func();
+			std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+			log("  %-12s %10.3f ms/op %10.1f Mbit/s\n", name, 1e3 * elapsed.count() / rounds,
+					double(width) * rounds / elapsed.count() / 1e6);
+		};
+
+		bench("pack", [&]() { PackedConst p(a); });
+		bench("unpack", [&]() { PackedConst(a).as_const(); });
+		bench("const_not", [&]() { const_not(a, none, false, false, width); });
+		bench("const_and", [&]() { const_and(a, b, false, false, width); });
+		bench("const_or", [&]() { const_or(a, b, false, false, width); });
+		bench("const_xor", [&]() { const_xor(a, b, false, false, width); });
+		bench("const_add", [&]() { const_add(a, b, false, false, width); });
+		bench("const_sub", [&]() { const_sub(a, b, false, false, width); });
+		bench("const_shl", [&]() { const_shl(a, shift, false, false, width); });
+		bench("const_shr", [&]() { const_shr(a, shift, false, false, width); });
+		bench("const_eq", [&]() { const_eq(a, b, false, false, 1); });
+		bench("const_lt", [&]() { const_lt(a, b, false, false, 1); });
+		bench("reduce_xor", [&]() { const_reduce_xor(a, none, false, false, 1); });
+		bench("as_string", [&]() { a.as_string(); });
+		bench("extract", [&]() { a.extract(width / 4, width / 2); });
+	}
+} BenchConstPass;
+
+PRIVATE_NAMESPACE_END
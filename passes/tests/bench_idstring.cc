@@ -0,0 +1,145 @@
+/*
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ */
+
+#include "kernel/yosys.h"
+#include "kernel/threading.h"
+
+#include <chrono>
+
+USING_YOSYS_NAMESPACE
+PRIVATE_NAMESPACE_BEGIN
+
+struct BenchIdStringWorker
+{
+	int num_names, num_rounds, num_tasks;
+	std::vector<std::string> strings;
+	std::vector<RTLIL::IdString> ids;
+
+	BenchIdStringWorker(int num_names, int num_rounds, int num_tasks) :
+			num_names(num_names), num_rounds(num_rounds), num_tasks(num_tasks)
+	{
+		for (int i = 0; i < num_names; i++)
+			strings.push_back(stringf("\\bench_idstring_%d", i));
+		ids.resize(num_names);
+	}
+
+	// Runs worker(begin, end) on num_tasks slices of the names and logs the
+	// throughput in million operations per second.
+	void run(const char *name, int num_ops, std::function<void(int, int)> worker)
+	{
+		auto start = std::chrono::steady_clock::now();
+		parallel_for(num_tasks, [&](int i) {
+			worker(int(int64_t(num_names) * i / num_tasks), int(int64_t(num_names) * (i+1) / num_tasks));
+		});
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		log("  %-8s %12d ops %10.3f sec %10.2f Mops/s\n", name, num_ops,
+				elapsed.count(), num_ops / elapsed.count() / 1e6);
+	}
+
+	void bench()
+	{
+		run("insert", num_names, [&](int begin, int end) {
+			for (int i = begin; i < end; i++)
+				ids[i] = strings[i];
+		});
+
+		run("lookup", num_names * num_rounds, [&](int begin, int end) {
+			for (int k = 0; k < num_rounds; k++)
+				for (int i = begin; i < end; i++) {
+					RTLIL::IdString id = strings[i];
+					log_assert(id == ids[i]);
+				}
+		});
+
+		run("copy", num_names * num_rounds, [&](int begin, int end) {
+			for (int k = 0; k < num_rounds; k++)
+				for (int i = begin; i < end; i++) {
+					RTLIL::IdString id = ids[i];
+					log_assert(id.index_ != 0);
+				}
+		});
+
+		run("release", num_names, [&](int begin, int end) {
+			for (int i = begin; i < end; i++)
+				ids[i] = RTLIL::IdString();
+		});
+	}
+};
+
+struct BenchIdStringPass : public Pass {
+	BenchIdStringPass() : Pass("bench_idstring", "benchmark the IdString interning table") { }
+	void help() override
+	{
+		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
+		log("\n");
+		log("    bench_idstring [options]\n");
+		log("\n");
+		log("Measure the throughput of creating new IdStrings (insert), of looking up\n");
+		log("existing names (lookup), of copying IdStrings (copy) and of dropping the last\n");
+		log("reference to a name (release). The work is split into tasks that are run\n");
+		log("with the number of threads given by 'yosys -j'.\n");
+		log("\n");
+		log("    -n {integer}\n");
+		log("        number of distinct names (default = 1000000).\n");
+		log("\n");
+		log("    -r {integer}\n");
+		log("        number of rounds for lookup and copy (default = 10).\n");
+		log("\n");
+		log("    -t {integer}\n");
+		log("        number of tasks (default = 4 times the number of threads).\n");
+		log("\n");
+	}
+	void execute(std::vector<std::string> args, RTLIL::Design*) override
+	{
+		int num_names = 1000000;
+		int num_rounds = 10;
+		int num_tasks = 4 * yosys_threads;
+
+		log_header(nullptr, "Executing BENCH_IDSTRING pass.\n");
+
+		size_t argidx;
+		for (argidx = 1; argidx < args.size(); argidx++)
+		{
+			if (args[argidx] == "-n" && argidx+1 < args.size()) {
+				num_names = atoi(args[++argidx].c_str());
+				continue;
+			}
+			if (args[argidx] == "-r" && argidx+1 < args.size()) {
+				num_rounds = atoi(args[++argidx].c_str());
+				continue;
+			}
+			if (args[argidx] == "-t" && argidx+1 < args.size()) {
+				num_tasks = atoi(args[++argidx].c_str());
+				continue;
+			}
+			break;
+		}
+		extra_args(args, argidx, nullptr, false);
+
+		if (num_names < 1 || num_rounds < 1 || num_tasks < 1)
+			log_cmd_error("Invalid number of names, rounds or tasks.\n");
+
+		log("Using %d names, %d rounds, %d tasks on %d threads.\n", num_names, num_rounds, num_tasks, yosys_threads);
+
+		BenchIdStringWorker worker(num_names, num_rounds, num_tasks);
+		worker.bench();
+	}
+} BenchIdStringPass;
+
+PRIVATE_NAMESPACE_END
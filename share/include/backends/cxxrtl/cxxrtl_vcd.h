@@ -0,0 +1,450 @@
+/*
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2020  whitequark <whitequark@whitequark.org>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ */
+
+#ifndef CXXRTL_VCD_H
+#define CXXRTL_VCD_H
+
+#include <cstring>
+#include <ostream>
+#include <backends/cxxrtl/cxxrtl.h>
+
+// The writer thread of `vcd_writer::start_writer()` is opt-in, so that the header can still be used without
+// linking to a threads library. Define `CXXRTL_VCD_WRITER_THREAD` before including it to enable it.
+#if defined(CXXRTL_VCD_WRITER_THREAD)
+#include <atomic>
+#include <chrono>
+#include <thread>
+#endif
+
+namespace cxxrtl {
+
+class vcd_writer {
+	struct variable {
+		size_t ident;
+		size_t width;
+		chunk_t *curr;
+		size_t cache_offset;
+		debug_outline *outline;
+		bool *outline_warm;
+	};
+
+	std::vector<std::string> current_scope;
+	std::map<debug_outline*, bool> outlines;
+	std::vector<variable> variables;
+	std::vector<chunk_t> cache;
+	std::map<chunk_t*, size_t> aliases;
+	bool streaming = false;
+
+#if defined(CXXRTL_VCD_WRITER_THREAD)
+	// A queue of chunks from the simulation thread to the writer thread, see `start_writer()`. `head` and
+	// `tail` count the chunks written and read so far; the simulation waits while the queue is full.
+	struct chunk_queue {
+		std::vector<chunk_t> ring;
+		size_t mask = 0;
+		std::atomic<size_t> head{0};
+		std::atomic<size_t> tail{0};
+		std::atomic<bool> closed{false};
+
+		// Yields for a while and then sleeps, so that waiting for a slow peer doesn't keep a core busy.
+		static void wait_a_little(int &waited) {
+			if (waited++ < 100)
+				std::this_thread::yield();
+			else
+				std::this_thread::sleep_for(std::chrono::microseconds(50));
+		}
+
+		void write(const chunk_t *data, size_t size) {
+			size_t h = head.load(std::memory_order_relaxed);
+			int waited = 0;
+			while (size > 0) {
+				size_t free = ring.size() - (h - tail.load(std::memory_order_acquire));
+				if (free == 0) {
+					wait_a_little(waited);
+					continue;
+				}
+				size_t count = std::min({size, free, ring.size() - (h & mask)});
+				std::copy(data, data + count, &ring[h & mask]);
+				h += count;
+				data += count;
+				size -= count;
+				head.store(h, std::memory_order_release);
+			}
+		}
+
+		// Returns false if the queue was closed before `size` chunks arrived.
+		bool read(chunk_t *data, size_t size) {
+			size_t t = tail.load(std::memory_order_relaxed);
+			int waited = 0;
+			while (size > 0) {
+				bool was_closed = closed.load(std::memory_order_acquire);
+				size_t avail = head.load(std::memory_order_acquire) - t;
+				if (avail == 0) {
+					if (was_closed)
+						return false;
+					wait_a_little(waited);
+					continue;
+				}
+				size_t count = std::min({size, avail, ring.size() - (t & mask)});
+				std::copy(&ring[t & mask], &ring[t & mask] + count, data);
+				t += count;
+				data += count;
+				size -= count;
+				tail.store(t, std::memory_order_release);
+			}
+			return true;
+		}
+	};
+
+	std::ostream *writer_output = nullptr;
+	size_t writer_queue_size = 0;
+	std::unique_ptr<chunk_queue> queue;
+	std::thread writer;
+	std::vector<chunk_t> record;
+#endif
+
+	void emit_timescale(unsigned number, const std::string &unit) {
+		assert(!streaming);
+		assert(number == 1 || number == 10 || number == 100);
+		assert(unit == "s" || unit == "ms" || unit == "us" ||
+		       unit == "ns" || unit == "ps" || unit == "fs");
+		buffer += "$timescale " + std::to_string(number) + " " + unit + " $end\n";
+	}
+
+	void emit_scope(const std::vector<std::string> &scope) {
+		assert(!streaming);
+		while (current_scope.size() > scope.size() ||
+		       (current_scope.size() > 0 &&
+			current_scope[current_scope.size() - 1] != scope[current_scope.size() - 1])) {
+			buffer += "$upscope $end\n";
+			current_scope.pop_back();
+		}
+		while (current_scope.size() < scope.size()) {
+			buffer += "$scope module " + scope[current_scope.size()] + " $end\n";
+			current_scope.push_back(scope[current_scope.size()]);
+		}
+	}
+
+	static void emit_ident(std::string &buffer, size_t ident) {
+		do {
+			buffer += '!' + ident % 94; // "base94"
+			ident /= 94;
+		} while (ident != 0);
+	}
+
+	void emit_name(const std::string &name) {
+		for (char c : name) {
+			if (c == ':') {
+				// Due to a bug, GTKWave cannot parse a colon in the variable name, causing the VCD file
+				// to be unreadable. It cannot be escaped either, so replace it with the sideways colon.
+				buffer += "..";
+			} else {
+				buffer += c;
+			}
+		}
+	}
+
+	void emit_var(const variable &var, const std::string &type, const std::string &name,
+	              size_t lsb_at, bool multipart) {
+		assert(!streaming);
+		buffer += "$var " + type + " " + std::to_string(var.width) + " ";
+		emit_ident(buffer, var.ident);
+		buffer += " ";
+		emit_name(name);
+		if (multipart || name.back() == ']' || lsb_at != 0) {
+			if (var.width == 1)
+				buffer += " [" + std::to_string(lsb_at) + "]";
+			else
+				buffer += " [" + std::to_string(lsb_at + var.width - 1) + ":" + std::to_string(lsb_at) + "]";
+		}
+		buffer += " $end\n";
+	}
+
+	void emit_enddefinitions() {
+		assert(!streaming);
+		buffer += "$enddefinitions $end\n";
+		streaming = true;
+	}
+
+	// These are also used by the writer thread, with a buffer of its own and a copy of the value.
+	static void emit_time(std::string &buffer, uint64_t timestamp) {
+		buffer += "#" + std::to_string(timestamp) + "\n";
+	}
+
+	static void emit_scalar(std::string &buffer, const variable &var, const chunk_t *curr) {
+		assert(var.width == 1);
+		buffer += (*curr ? '1' : '0');
+		emit_ident(buffer, var.ident);
+		buffer += '\n';
+	}
+
+	static void emit_vector(std::string &buffer, const variable &var, const chunk_t *curr) {
+		buffer += 'b';
+		for (size_t bit = var.width - 1; bit != (size_t)-1; bit--) {
+			bool bit_curr = curr[bit / (8 * sizeof(chunk_t))] & (1 << (bit % (8 * sizeof(chunk_t))));
+			buffer += (bit_curr ? '1' : '0');
+		}
+		buffer += ' ';
+		emit_ident(buffer, var.ident);
+		buffer += '\n';
+	}
+
+	static void emit_value(std::string &buffer, const variable &var, const chunk_t *curr) {
+		if (var.width == 1)
+			emit_scalar(buffer, var, curr);
+		else
+			emit_vector(buffer, var, curr);
+	}
+
+	static size_t chunks_of(const variable &var) {
+		return (var.width + (sizeof(chunk_t) * 8 - 1)) / (sizeof(chunk_t) * 8);
+	}
+
+#if defined(CXXRTL_VCD_WRITER_THREAD)
+	// Each sample is a record of the timestamp (two chunks), the number of changed variables, and for each
+	// of them its index followed by its value.
+	void queue_sample(uint64_t timestamp) {
+		record.clear();
+		record.push_back((chunk_t)timestamp);
+		record.push_back((chunk_t)(timestamp >> 32));
+		record.push_back(0);
+		for (size_t index = 0; index < variables.size(); index++) {
+			const variable &var = variables[index];
+			if (test_variable(var)) {
+				record.push_back((chunk_t)index);
+				record.insert(record.end(), &var.curr[0], &var.curr[chunks_of(var)]);
+				record[2]++;
+			}
+		}
+		queue->write(record.data(), record.size());
+	}
+
+	void run_writer() {
+		std::string text;
+		std::vector<chunk_t> value;
+		chunk_t header[3];
+		while (queue->read(header, 3)) {
+			emit_time(text, (uint64_t)header[0] | ((uint64_t)header[1] << 32));
+			for (chunk_t count = 0; count < header[2]; count++) {
+				chunk_t index;
+				queue->read(&index, 1);
+				const variable &var = variables[index];
+				value.resize(chunks_of(var));
+				queue->read(value.data(), value.size());
+				emit_value(text, var, value.data());
+			}
+			if (text.size() >= 65536) {
+				writer_output->write(text.data(), text.size());
+				text.clear();
+			}
+		}
+		writer_output->write(text.data(), text.size());
+		writer_output->flush();
+	}
+#endif
+
+	void reset_outlines() {
+		for (auto &outline_it : outlines)
+			outline_it.second = /*warm=*/(outline_it.first == nullptr);
+	}
+
+	variable &register_variable(size_t width, chunk_t *curr, bool constant = false, debug_outline *outline = nullptr) {
+		if (aliases.count(curr)) {
+			return variables[aliases[curr]];
+		} else {
+			auto outline_it = outlines.emplace(outline, /*warm=*/(outline == nullptr)).first;
+			const size_t chunks = (width + (sizeof(chunk_t) * 8 - 1)) / (sizeof(chunk_t) * 8);
+			aliases[curr] = variables.size();
+			if (constant) {
+				variables.emplace_back(variable { variables.size(), width, curr, (size_t)-1, outline_it->first, &outline_it->second });
+			} else {
+				variables.emplace_back(variable { variables.size(), width, curr, cache.size(), outline_it->first, &outline_it->second });
+				cache.insert(cache.end(), &curr[0], &curr[chunks]);
+			}
+			return variables.back();
+		}
+	}
+
+	bool test_variable(const variable &var) {
+		if (var.cache_offset == (size_t)-1)
+			return false; // constant
+		if (!*var.outline_warm) {
+			var.outline->eval();
+			*var.outline_warm = true;
+		}
+		const size_t chunks = (var.width + (sizeof(chunk_t) * 8 - 1)) / (sizeof(chunk_t) * 8);
+		if (std::equal(&var.curr[0], &var.curr[chunks], &cache[var.cache_offset])) {
+			return false;
+		} else {
+			std::copy(&var.curr[0], &var.curr[chunks], &cache[var.cache_offset]);
+			return true;
+		}
+	}
+
+	static std::vector<std::string> split_hierarchy(const std::string &hier_name) {
+		std::vector<std::string> hierarchy;
+		size_t prev = 0;
+		while (true) {
+			size_t curr = hier_name.find_first_of(' ', prev);
+			if (curr == std::string::npos) {
+				hierarchy.push_back(hier_name.substr(prev));
+				break;
+			} else {
+				hierarchy.push_back(hier_name.substr(prev, curr - prev));
+				prev = curr + 1;
+			}
+		}
+		return hierarchy;
+	}
+
+public:
+	std::string buffer;
+
+#if defined(CXXRTL_VCD_WRITER_THREAD)
+	~vcd_writer() {
+		stop_writer();
+	}
+
+	// Formats the samples on a thread of its own and writes them to `output`, instead of to `buffer`. The
+	// values that changed are copied into a queue of `queue_size` bytes, and `sample()` only waits for the
+	// writer thread when the queue is full. The header and the first sample are still formatted into
+	// `buffer` and written to `output` by the first `sample()` call; any text already in `buffer` at that
+	// point is written first. No variables can be added after the first sample. Call `stop_writer()`
+	// (or destroy the writer) to wait for the thread and flush `output`.
+	void start_writer(std::ostream &output, size_t queue_size = 4 << 20) {
+		assert(writer_output == nullptr);
+		writer_output = &output;
+		writer_queue_size = queue_size;
+	}
+
+	void stop_writer() {
+		if (writer.joinable()) {
+			queue->closed.store(true, std::memory_order_release);
+			writer.join();
+			queue.reset();
+		} else if (writer_output != nullptr) {
+			writer_output->write(buffer.data(), buffer.size());
+			writer_output->flush();
+			buffer.clear();
+		}
+		writer_output = nullptr;
+	}
+#endif
+
+	void timescale(unsigned number, const std::string &unit) {
+		emit_timescale(number, unit);
+	}
+
+	void add(const std::string &hier_name, const debug_item &item, bool multipart = false) {
+		std::vector<std::string> scope = split_hierarchy(hier_name);
+		std::string name = scope.back();
+		scope.pop_back();
+
+		emit_scope(scope);
+		switch (item.type) {
+			// Not the best naming but oh well...
+			case debug_item::VALUE:
+				emit_var(register_variable(item.width, item.curr, /*constant=*/item.next == nullptr),
+				         "wire", name, item.lsb_at, multipart);
+				break;
+			case debug_item::WIRE:
+				emit_var(register_variable(item.width, item.curr),
+				         "reg", name, item.lsb_at, multipart);
+				break;
+			case debug_item::MEMORY: {
+				const size_t stride = (item.width + (sizeof(chunk_t) * 8 - 1)) / (sizeof(chunk_t) * 8);
+				for (size_t index = 0; index < item.depth; index++) {
+					chunk_t *nth_curr = &item.curr[stride * index];
+					std::string nth_name = name + '[' + std::to_string(index) + ']';
+					emit_var(register_variable(item.width, nth_curr),
+					         "reg", nth_name, item.lsb_at, multipart);
+				}
+				break;
+			}
+			case debug_item::ALIAS:
+				// Like VALUE, but, even though `item.next == nullptr` always holds, the underlying value
+				// can actually change, and must be tracked. In most cases the VCD identifier will be
+				// unified with the aliased reg, but we should handle the case where only the alias is
+				// added to the VCD writer, too.
+				emit_var(register_variable(item.width, item.curr),
+				         "wire", name, item.lsb_at, multipart);
+				break;
+			case debug_item::OUTLINE:
+				emit_var(register_variable(item.width, item.curr, /*constant=*/false, item.outline),
+				         "wire", name, item.lsb_at, multipart);
+				break;
+		}
+	}
+
+	template<class Filter>
+	void add(const debug_items &items, const Filter &filter) {
+		// `debug_items` is a map, so the items are already sorted in an order optimal for emitting
+		// VCD scope sections.
+		for (auto &it : items.table)
+			for (auto &part : it.second)
+				if (filter(it.first, part))
+					add(it.first, part, it.second.size() > 1);
+	}
+
+	void add(const debug_items &items) {
+		this->add(items, [](const std::string &, const debug_item &) {
+			return true;
+		});
+	}
+
+	void add_without_memories(const debug_items &items) {
+		this->add(items, [](const std::string &, const debug_item &item) {
+			return item.type != debug_item::MEMORY;
+		});
+	}
+
+	void sample(uint64_t timestamp) {
+		bool first_sample = !streaming;
+		if (first_sample) {
+			emit_scope({});
+			emit_enddefinitions();
+		}
+		reset_outlines();
+#if defined(CXXRTL_VCD_WRITER_THREAD)
+		if (writer.joinable()) {
+			queue_sample(timestamp);
+			return;
+		}
+#endif
+		emit_time(buffer, timestamp);
+		for (auto var : variables)
+			if (test_variable(var) || first_sample)
+				emit_value(buffer, var, var.curr);
+#if defined(CXXRTL_VCD_WRITER_THREAD)
+		if (writer_output != nullptr) {
+			writer_output->write(buffer.data(), buffer.size());
+			buffer.clear();
+			size_t size = 1024;
+			while (size < writer_queue_size / sizeof(chunk_t))
+				size *= 2;
+			queue.reset(new chunk_queue);
+			queue->ring.resize(size);
+			queue->mask = size - 1;
+			writer = std::thread([this] { run_writer(); });
+		}
+#endif
+	}
+};
+
+}
+
+#endif
@@ -0,0 +1,69 @@
+/* -*- c++ -*-
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ */
+
+#ifndef PACKEDCONST_H
+#define PACKEDCONST_H
+
+#include "kernel/yosys.h"
+
+YOSYS_NAMESPACE_BEGIN
+
+// A constant with two bits per state, packed into 64-bit words: bit i of the
+// constant is S1 if bit i%64 of value[i/64] is set, and undefined if the same
+// bit of undef is set. All undefined states (Sx, Sz, Sa, Sm) are represented
+// as Sx. This is the representation used by the word-parallel const_*
+// functions in calc.cc, RTLIL::Const itself keeps one State per bit.
+//
+// Bits above the width are always zero in both planes. Constants without
+// undefined bits have has_undef == false, which is what the arithmetic fast
+// paths check for.
+struct PackedConst
+{
+	int width;
+	bool has_undef;
+	std::vector<uint64_t> value, undef;
+
+	static int num_words(int width) { return (width + 63) / 64; }
+
+	PackedConst(int width = 0) : width(width), has_undef(false), value(num_words(width)), undef(num_words(width)) { }
+
+	// Packs the first `width` bits of `c`. If `c` is shorter than that, it is
+	// padded with its MSB (is_signed) or with S0, like extend_u0() in calc.cc.
+	PackedConst(const RTLIL::Const &c, int width, bool is_signed);
+	PackedConst(const RTLIL::Const &c) : PackedConst(c, GetSize(c), false) { }
+
+	RTLIL::Const as_const() const;
+
+	bool get_value(int i) const { return (value[i / 64] >> (i % 64)) & 1; }
+	bool get_undef(int i) const { return (undef[i / 64] >> (i % 64)) & 1; }
+
+	// Clears the bits above the width in the last word and recomputes
+	// has_undef. Needs to be called after operations that complement words.
+	void normalize();
+
+	bool is_fully_zero() const;
+
+	// true if any bit is S1 / S0
+	bool any_value() const;
+	bool any_zero() const;
+};
+
+YOSYS_NAMESPACE_END
+
+#endif
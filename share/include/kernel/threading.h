@@ -0,0 +1,141 @@
+/* -*- c++ -*-
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Claire Xenia Wolf <claire@yosyshq.com>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ */
+
+#ifndef THREADING_H
+#define THREADING_H
+
+#include "kernel/yosys.h"
+
+#include <exception>
+#ifndef YOSYS_DISABLE_THREADS
+#  include <atomic>
+#  include <chrono>
+#  include <condition_variable>
+#  include <thread>
+#endif
+
+YOSYS_NAMESPACE_BEGIN
+
+// Number of threads used by parallel_for() and thus by module-parallel passes
+// (see Pass::module_parallel()). Set with "yosys -j <N>", the default of 1
+// keeps everything on the main thread.
+extern int yosys_threads;
+
+// A task of parallel_for(). Everything a task does that would otherwise
+// depend on the global state of the process is derived from its index:
+//  - with threads, log output is captured and replayed in task order
+//    afterwards,
+//  - generated names (NEW_ID, next_autoidx()) use an autoidx value that is
+//    reserved for the task, with a task-local counter appended (-1 for the
+//    tasks of parallel_for_unnamed(), which must not generate names),
+//  - hash indices of RTLIL objects created by the task come from a
+//    task-local generator.
+// This makes the result of a parallel pass independent of the scheduling
+// and of the number of threads used.
+struct ParallelTask
+{
+	int index;
+	int autoidx, autoidx_sub;
+	unsigned int hashidx;
+	LogCapture log;
+	std::exception_ptr error;
+};
+
+// The task executed by the current thread, or nullptr.
+extern thread_local ParallelTask *parallel_task;
+
+#ifndef YOSYS_DISABLE_THREADS
+// A fixed set of worker threads. run() calls worker(i) for all i in [0, n),
+// using the calling thread as one of the workers, and returns once all calls
+// have completed. The worker must not throw.
+struct ThreadPool
+{
+	ThreadPool(int num_threads);
+	~ThreadPool();
+
+	int size() const { return GetSize(threads) + 1; }
+	void run(int n, const std::function<void(int)> &worker);
+
+private:
+	std::vector<std::thread> threads;
+	std::mutex mutex;
+	std::condition_variable work_cv, done_cv;
+	const std::function<void(int)> *job = nullptr;
+	int job_size = 0, pending = 0;
+	unsigned int generation = 0;
+	bool shutdown = false;
+	std::atomic<int> next_index;
+
+	void work();
+	void thread_main();
+};
+#endif
+
+#ifndef YOSYS_DISABLE_THREADS
+// A queue of bytes from one producer thread to one consumer thread, with a
+// fixed capacity and without locks. write() waits while the queue is full,
+// which is the back-pressure on the producer, read() waits for data until
+// the producer calls close(). Waiting spins for a while and then sleeps.
+struct ByteQueue
+{
+	// The capacity is rounded up to a power of two.
+	ByteQueue(size_t capacity);
+
+	void write(const void *data, size_t size);
+	void close();
+	// Returns false if the queue was closed before `size` bytes arrived.
+	bool read(void *data, size_t size);
+
+	size_t capacity() const { return mask + 1; }
+	// The number of times write() had to wait for free space.
+	int stalls() const { return num_stalls; }
+
+private:
+	std::vector<char> buffer;
+	size_t mask;
+	int num_stalls = 0;
+	// the number of bytes written and read so far, padded to keep them on
+	// cache lines of their own (alignas() would need an aligned new)
+	std::atomic<size_t> head;
+	char head_padding[64];
+	std::atomic<size_t> tail;
+	char tail_padding[64];
+	std::atomic<bool> closed;
+};
+#endif
+
+// Calls worker(i) for all i in [0, n), on up to num_threads threads. With
+// n > 1, each call runs as a ParallelTask with an autoidx value reserved for
+// it, also with num_threads == 1, where the tasks run one after the other
+// and log directly. With n == 1, or when called from within a task, this is
+// a plain loop. With threads, the first exception thrown by a task (in index
+// order) is re-thrown after all tasks have completed.
+void parallel_for(int n, const std::function<void(int)> &worker, int num_threads = yosys_threads);
+
+// Like parallel_for(), for workers that create no generated names (e.g. the
+// steps of a simulation). No autoidx values are reserved, so n may depend on
+// the number of threads, and with num_threads == 1 this is a plain loop.
+void parallel_for_unnamed(int n, const std::function<void(int)> &worker, int num_threads = yosys_threads);
+
+// Joins the worker threads (called from yosys_shutdown()).
+void parallel_shutdown();
+
+YOSYS_NAMESPACE_END
+
+#endif
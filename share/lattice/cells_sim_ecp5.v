@@ -0,0 +1,9 @@
+`include "common_sim.vh"
+`include "ccu2c_sim.vh"
+
+`ifndef NO_INCLUDES
+
+`include "cells_ff.vh"
+`include "cells_io.vh"
+
+`endif
@@ -0,0 +1,50 @@
+#!/usr/bin/env bash
+#
+# Compare the wall-clock time of synth_ice40 and synth_xilinx when "abc"
+# reads the mapped netlist from a temp file (default) and from a pipe
+# ("scratchpad -set abc.pipe 1", same as "abc -pipe"), on a generated design
+# with many small modules so that the per-call overhead of ABC dominates.
+#
+# Usage: bash abc_transport.sh [<num_modules>]
+# Set YOSYS to use a different binary than the one in the source tree, and
+# YOSYS_REF to also time a second binary (which must support "-pipe" too).
+
+source $(dirname $0)/common.sh
+
+num_modules=${1:-200}
+
+{
+	for ((i = 0; i < num_modules; i++)); do
+		echo "module m$i(input clk, input [15:0] a, b, input [3:0] s, output reg [15:0] q);"
+		echo "  wire [15:0] t0 = s[0] ? a + b : a - b;"
+		echo "  wire [15:0] t1 = s[1] ? t0 ^ {b[7:0], a[15:8]} : t0 & 16'd$i;"
+		echo "  wire [15:0] t2 = s[2] ? t1 << s[3:2] : t1 >> s[1:0];"
+		echo "  always @(posedge clk) q <= s[3] ? t2 : q + 16'd1;"
+		echo "endmodule"
+	done
+	echo "module top(input clk, input [15:0] a, b, input [3:0] s, output [15:0] q);"
+	echo "  wire [15:0] y [0:$num_modules];"
+	echo "  assign y[0] = a;"
+	for ((i = 0; i < num_modules; i++)); do
+		echo "  m$i u$i(clk, y[$i], b, s, y[$((i + 1))]);"
+	done
+	echo "  assign q = y[$num_modules];"
+	echo "endmodule"
+} > $workdir/design.v
+
+# run <binary> <script>: prints the time in seconds
+run() {
+	timed $1 -q -p "read_verilog $workdir/design.v; $2"
+}
+
+bench() {
+	local synth
+	echo "$1:"
+	for synth in "synth_ice40 -top top" "synth_xilinx -top top"; do
+		printf "  %-24s file %8.3f s   pipe %8.3f s\n" "$synth" \
+			$(run $1 "$synth") $(run $1 "scratchpad -set abc.pipe 1; $synth")
+	done
+}
+
+echo "modules: $num_modules"
+each_binary bench
@@ -0,0 +1,73 @@
+#!/usr/bin/env bash
+#
+# Measure the elaboration time and peak memory of the AST frontend on a
+# generate-heavy design: nested generate-for loops, a for loop unrolled in an
+# always block and a function that is inlined in every generate iteration,
+# derived for several parameter sets.
+#
+# Usage: bash ast_generate.sh [<size>]
+# The design has <size> x <size> generate iterations per derived module.
+# Set YOSYS to use a different binary than the one in the source tree, and
+# YOSYS_REF to also measure a second binary (e.g. a build from before a change).
+
+source $(dirname $0)/common.sh
+
+size=${1:-48}
+
+cat > $workdir/design.v <<EOT
+module gen #(parameter N = 8, parameter W = 8, parameter K = 1) (input clk, input [W-1:0] a, output reg [W-1:0] y);
+  function [W-1:0] mix;
+    input [W-1:0] x;
+    input [31:0] i, j;
+    integer k;
+    begin
+      mix = x;
+      for (k = 0; k < 4; k = k + 1)
+        mix = (mix << 1) ^ (mix >> 2) ^ (i * K + j + k);
+    end
+  endfunction
+
+  wire [W-1:0] t [0:N-1][0:N-1];
+  genvar i, j;
+  generate
+    for (i = 0; i < N; i = i + 1) begin : row
+      for (j = 0; j < N; j = j + 1) begin : col
+        if (i == 0 && j == 0) begin : first
+          assign t[i][j] = a;
+        end else if (j == 0) begin : left
+          assign t[i][j] = mix(t[i-1][N-1], i, j);
+        end else begin : inner
+          assign t[i][j] = mix(t[i][j-1], i, j) + (i ^ j);
+        end
+      end
+    end
+  endgenerate
+
+  integer m;
+  reg [W-1:0] acc;
+  always @(posedge clk) begin
+    acc = 0;
+    for (m = 0; m < N; m = m + 1)
+      acc = acc ^ t[m][N-1-m];
+    y <= acc;
+  end
+endmodule
+
+module top (input clk, input [15:0] a, output [15:0] y0, y1, y2, y3);
+  gen #(.N($size), .W(16), .K(1)) g0 (clk, a, y0);
+  gen #(.N($size), .W(16), .K(2)) g1 (clk, a, y1);
+  gen #(.N($size), .W(16), .K(3)) g2 (clk, a, y2);
+  gen #(.N($size), .W(16), .K(4)) g3 (clk, a, y3);
+endmodule
+EOT
+
+# run <binary>: prints the wall-clock time and the peak memory
+run() {
+	local t
+	t=$(timed $1 -q -l $workdir/log.txt -p "read_verilog $workdir/design.v; hierarchy -top top")
+	echo "$1:"
+	printf "  wall-clock %8.3f s   peak memory %8.1f MB\n" $t $(peak_mem $workdir/log.txt)
+}
+
+echo "generate iterations per module: $size x $size"
+each_binary run
@@ -0,0 +1,52 @@
+# Common part of the benchmark scripts in this directory, which source it
+# right after their usage comment.
+#
+# It sets "yosys" to $YOSYS or to the binary in the source tree, creates a
+# temporary "workdir" that is removed on exit, and has helpers for timing
+# commands and for running a benchmark on both $YOSYS and $YOSYS_REF.
+
+set -e
+
+yosys=${YOSYS:-$(dirname ${BASH_SOURCE[0]})/../../yosys}
+
+workdir=$(mktemp -d)
+trap "rm -rf $workdir" EXIT
+
+# timed <command> [<args> ..]: runs the command with its standard output
+# going to $workdir/stdout.txt, prints its wall-clock time in seconds and
+# returns its exit status
+timed() {
+	local start end status=0
+	start=$(date +%s.%N)
+	"$@" > $workdir/stdout.txt || status=$?
+	end=$(date +%s.%N)
+	echo "$end - $start" | bc
+	return $status
+}
+
+# peak_mem [<file>]: prints the peak memory in MB from the last "End of
+# script" line of a yosys log (default: the output of the last "timed")
+peak_mem() {
+	sed -n 's/.*MEM: \([0-9.]*\) MB peak.*/\1/p' ${1:-$workdir/stdout.txt} | tail -n 1
+}
+
+# calc <expression>: prints the value of the bc expression
+calc() {
+	echo "$*" | bc -l
+}
+
+# file_mb <file>: prints the size of the file in MB
+file_mb() {
+	calc "$(wc -c < $1) / 1048576"
+}
+
+# each_binary <function> [<args> ..]: calls the function with $yosys and
+# then, if it is set, with $YOSYS_REF as its first argument
+each_binary() {
+	local fn=$1
+	shift
+	$fn $yosys "$@"
+	if [ -n "$YOSYS_REF" ]; then
+		$fn $YOSYS_REF "$@"
+	fi
+}
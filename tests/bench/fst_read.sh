@@ -0,0 +1,53 @@
+#!/usr/bin/env bash
+#
+# Compare the wall-clock time of "sim -r" on a generated FST file with many
+# value change blocks for different "yosys -j" settings. The design only
+# uses a few of the signals, so that most of the time goes to decoding the
+# file. The traces must not depend on the number of threads.
+#
+# Usage: bash fst_read.sh [<num_signals> [<steps> [<threads> ..]]]
+# Set YOSYS to use a different binary than the one in the source tree, and
+# YOSYS_REF to compare against a second binary (e.g. a build of an older
+# commit).
+
+source $(dirname $0)/common.sh
+
+num_signals=${1:-1000}
+steps=${2:-20000}
+threads=${@:3}
+threads=${threads:-1 2 4 8}
+
+fst=$(dirname $0)/../../libs/fst
+${CXX:-c++} -O2 -o $workdir/fst_blocks -I$fst $(dirname $0)/../tools/fst_blocks.cc \
+	$fst/fstapi.cc $fst/fastlz.cc $fst/lz4.cc -lz
+# a block every 100 steps
+$workdir/fst_blocks $workdir/data.fst $num_signals $steps 100
+
+cat > $workdir/design.v <<EOT
+module top(input clk, input rst, input [3:0] d3, input [4:0] d4, output reg [7:0] acc);
+	always @(posedge clk)
+		if (rst) acc <= 0;
+		else acc <= {acc[6:0], acc[7]} ^ d3 ^ d4;
+endmodule
+EOT
+
+echo "signals: $num_signals  steps: $steps  file: $(($(wc -c < $workdir/data.fst) / 1024)) KiB"
+
+run() {
+	printf "%-12s threads: %3d  wall-clock: %8.3f s\n" $3 $2 \
+		$(timed $1 -q -j $2 -w "Unable to find wire" -p "read_verilog $workdir/design.v; proc; sim -r $workdir/data.fst -scope top -clock clk -vcd $workdir/$3.vcd")
+}
+
+if [ -n "$YOSYS_REF" ]; then
+	run $YOSYS_REF 1 ref
+fi
+for j in $threads; do
+	run $yosys $j j$j
+done
+
+for out in $workdir/*.vcd; do
+	if ! cmp -s $out $workdir/j${threads%% *}.vcd; then
+		echo "ERROR: trace $(basename $out) differs from -j ${threads%% *}"
+		exit 1
+	fi
+done
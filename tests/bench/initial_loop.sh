@@ -0,0 +1,62 @@
+#!/usr/bin/env bash
+#
+# Measure the elaboration time and peak memory of for loops in initial blocks:
+# a ROM that is initialised with a loop calling a function, and a CRC table
+# that is computed with nested loops.
+#
+# Usage: bash initial_loop.sh [<abits>]
+# The default of 16 address bits gives 64K iterations of each loop.
+# Set YOSYS to use a different binary than the one in the source tree, and
+# YOSYS_REF to also measure a second binary (e.g. a build from before a change).
+
+source $(dirname $0)/common.sh
+
+abits=${1:-16}
+depth=$((1 << abits))
+
+cat > $workdir/design.v <<EOT
+module top(input clk, input [$((abits-1)):0] addr, output reg [31:0] q, output reg [31:0] crc);
+  function [31:0] hash;
+    input [31:0] x;
+    begin
+      hash = x * 32'h9e3779b1;
+      hash = hash ^ (hash >> 15);
+    end
+  endfunction
+
+  reg [31:0] rom [0:$((depth-1))];
+  reg [31:0] table [0:$((depth-1))];
+  reg [31:0] c;
+  integer i, j;
+
+  initial begin
+    for (i = 0; i < $depth; i = i + 1)
+      rom[i] = hash(i);
+    for (i = 0; i < $depth; i = i + 1) begin
+      c = i;
+      for (j = 0; j < 8; j = j + 1)
+        if (c[0])
+          c = (c >> 1) ^ 32'hedb88320;
+        else
+          c = c >> 1;
+      table[i] = c;
+    end
+  end
+
+  always @(posedge clk) begin
+    q <= rom[addr];
+    crc <= table[~addr];
+  end
+endmodule
+EOT
+
+# run <binary>: prints the wall-clock time and the peak memory
+run() {
+	local t
+	t=$(timed $1 -q -l $workdir/log.txt -p "read_verilog $workdir/design.v; proc; memory -nomap")
+	echo "$1:"
+	printf "  wall-clock %8.3f s   peak memory %8.1f MB\n" $t $(peak_mem $workdir/log.txt)
+}
+
+echo "loop iterations: $depth"
+each_binary run
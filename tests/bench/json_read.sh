@@ -0,0 +1,55 @@
+#!/usr/bin/env bash
+#
+# Measure the time and the peak memory of "read_json" on a generated flat
+# netlist of <num_cells> cells in the format of write_json, and the size of
+# the JSON file.
+#
+# Usage: bash json_read.sh [<num_cells>]
+# Set YOSYS to use a different binary than the one in the source tree, and
+# YOSYS_REF to compare against a second binary. The start-up time and memory
+# of yosys are measured separately and subtracted.
+
+source $(dirname $0)/common.sh
+
+num_cells=${1:-500000}
+
+awk -v n=$num_cells 'BEGIN {
+	print "{\n  \"creator\": \"json_read.sh\",\n  \"modules\": {\n    \"top\": {";
+	print "      \"attributes\": {\n        \"top\": \"00000000000000000000000000000001\"\n      },";
+	printf "      \"ports\": {\n        \"a\": {\n          \"direction\": \"input\",\n          \"bits\": [";
+	for (i = 0; i < n; i++)
+		printf "%s %d", i ? "," : "", i + 2;
+	printf " ]\n        }\n      },\n      \"cells\": {\n";
+	for (i = 0; i < n; i++) {
+		printf "        \"$and$design.v:%d$%d\": {\n          \"hide_name\": 1,\n          \"type\": \"$_AND_\",\n", i + 10, i;
+		print "          \"parameters\": {\n          },";
+		printf "          \"attributes\": {\n            \"src\": \"design.v:%d.5-%d.20\"\n          },\n", i + 10, i + 10;
+		print "          \"port_directions\": {\n            \"A\": \"input\",\n            \"B\": \"input\",\n            \"Y\": \"output\"\n          },";
+		printf "          \"connections\": {\n            \"A\": [ %d ],\n            \"B\": [ %d ],\n            \"Y\": [ %d ]\n          }\n        }%s\n", i + 2, i ? n + i + 1 : 2, n + i + 2, i < n - 1 ? "," : "";
+	}
+	printf "      },\n      \"netnames\": {\n";
+	for (i = 0; i < n; i++) {
+		printf "        \"$n%d\": {\n          \"hide_name\": 1,\n          \"bits\": [ %d ],\n", i, n + i + 2;
+		printf "          \"attributes\": {\n            \"src\": \"design.v:%d.5-%d.20\"\n          }\n        },\n", i + 10, i + 10;
+	}
+	printf "        \"a\": {\n          \"hide_name\": 0,\n          \"bits\": [";
+	for (i = 0; i < n; i++)
+		printf "%s %d", i ? "," : "", i + 2;
+	print " ],\n          \"attributes\": {\n          }\n        }\n      }\n    }\n  }\n}";
+}' > $workdir/design.json
+
+# run <binary> <script>: prints the wall-clock time in seconds and the peak
+# memory in MB
+run() {
+	echo "$(timed $1 -p "$2") $(peak_mem)"
+}
+
+bench() {
+	local base t
+	base=($(run $1 ""))
+	t=($(run $1 "read_json $workdir/design.json"))
+	printf "  %-40s %8.3f s %8.1f MB\n" "$1" $(calc "${t[0]} - ${base[0]}") $(calc "${t[1]} - ${base[1]}")
+}
+
+printf "cells: %d, file size: %.1f MB\n" $num_cells $(file_mb $workdir/design.json)
+each_binary bench
@@ -0,0 +1,60 @@
+#!/usr/bin/env bash
+#
+# Measure the time of "write_json" on a generated netlist of <num_modules>
+# modules with <num_cells> cells each, for different "yosys -j" settings,
+# writing to a file and to a pipe with "write_json -fd".
+#
+# Usage: bash json_write.sh [<num_modules> [<num_cells> [<threads> ..]]]
+# Set YOSYS to use a different binary than the one in the source tree, and
+# YOSYS_REF to compare against a second binary (written to a file with one
+# thread only). The time to load the design is measured separately and
+# subtracted.
+
+source $(dirname $0)/common.sh
+
+num_modules=${1:-16}
+num_cells=${2:-50000}
+shift 2 || true
+threads=${@:-1 2 4 8}
+
+awk -v m=$num_modules -v n=$num_cells 'BEGIN {
+	for (k = 0; k < m; k++) {
+		printf "module \\m%d\n", k;
+		printf "  attribute \\src \"design.v:1.1-9.10\"\n  wire width %d input 1 \\a\n", n;
+		printf "  attribute \\src \"design.v:2.1-9.10\"\n  wire width %d output 2 \\y\n", n;
+		for (i = 0; i < n; i++) {
+			printf "  attribute \\src \"design.v:%d.5-%d.20\"\n  wire width 4 $n%d\n", i + 10, i + 10, i;
+			printf "  attribute \\src \"design.v:%d.5-%d.20\"\n  cell $add $add$design.v:%d$%d\n", i + 10, i + 10, i + 10, i;
+			print "    parameter \\A_SIGNED 0\n    parameter \\B_SIGNED 0\n    parameter \\A_WIDTH 2\n    parameter \\B_WIDTH 4\n    parameter \\Y_WIDTH 4";
+			printf "    connect \\A { \\a [%d] 1'\''1 }\n", i;
+			printf "    connect \\B %s\n", i ? sprintf("$n%d", i - 1) : "4'\''0101";
+			printf "    connect \\Y $n%d\n  end\n", i;
+			printf "  connect \\y [%d] $n%d [3]\n", i, i;
+		}
+		print "end";
+	}
+}' > $workdir/design.il
+
+# through_pipe <command> [<args> ..]: runs the command with fd 3 going to a pipe
+through_pipe() {
+	"$@" 3>&1 > /dev/null | cat > /dev/null
+}
+
+# run <binary> <threads> <script>: prints the wall-clock time in seconds
+run() {
+	timed through_pipe $1 -j $2 -q -p "$3"
+}
+
+load=$(run $yosys 1 "read_rtlil -fast $workdir/design.il")
+
+printf "modules: %d, cells: %d\n" $num_modules $((num_modules * num_cells))
+if [ -n "$YOSYS_REF" ]; then
+	t=$(calc "$(run $YOSYS_REF 1 "read_rtlil $workdir/design.il; write_json $workdir/out.json") - $(run $YOSYS_REF 1 "read_rtlil $workdir/design.il")")
+	printf "  %-28s %8.3f s\n" "$YOSYS_REF" $t
+fi
+for j in $threads; do
+	t=$(calc "$(run $yosys $j "read_rtlil -fast $workdir/design.il; write_json $workdir/out.json") - $load")
+	printf "  -j %-3d %-21s %8.3f s\n" $j "file" $t
+	t=$(calc "$(run $yosys $j "read_rtlil -fast $workdir/design.il; write_json -fd 3") - $load")
+	printf "  -j %-3d %-21s %8.3f s\n" $j "pipe (-fd 3)" $t
+done
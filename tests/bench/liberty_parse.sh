@@ -0,0 +1,68 @@
+#!/usr/bin/env bash
+#
+# Measure the time and the peak memory of commands that read the same
+# generated liberty file of <num_cells> cells with timing tables: "stat
+# -liberty" on a design that uses two of the cells, and "read_liberty",
+# "dfflibmap" and "stat" using the same file in one session.
+#
+# Usage: bash liberty_parse.sh [<num_cells>]
+# Set YOSYS to use a different binary than the one in the source tree, and
+# YOSYS_REF to compare against a second binary. The start-up time and memory
+# of yosys are measured separately and subtracted.
+
+source $(dirname $0)/common.sh
+
+num_cells=${1:-20000}
+
+awk -v n=$num_cells 'BEGIN {
+	print "library(bench) {";
+	for (i = 0; i < n; i++) {
+		printf "  cell(nand_%d) {\n    area : %d;\n", i, i % 7 + 1;
+		print "    pin(A) {\n      direction : input;\n      capacitance : 0.0021;\n    }";
+		print "    pin(B) {\n      direction : input;\n      capacitance : 0.0023;\n    }";
+		print "    pin(Y) {\n      direction : output;\n      function : \"(A B)\x27\";";
+		for (j = 0; j < 2; j++) {
+			printf "      timing() {\n        related_pin : \"%s\";\n", j ? "B" : "A";
+			print "        cell_rise(delay_template_5x5) {";
+			print "          index_1 (\"0.01, 0.02, 0.05, 0.1, 0.2\");";
+			print "          index_2 (\"0.001, 0.002, 0.005, 0.01, 0.02\");";
+			print "          values (\"0.010, 0.012, 0.015, 0.020, 0.030\", \\";
+			print "                  \"0.011, 0.013, 0.016, 0.021, 0.031\", \\";
+			print "                  \"0.012, 0.014, 0.017, 0.022, 0.032\", \\";
+			print "                  \"0.013, 0.015, 0.018, 0.023, 0.033\", \\";
+			print "                  \"0.014, 0.016, 0.019, 0.024, 0.034\");";
+			print "        }\n      }";
+		}
+		print "    }\n  }";
+	}
+	print "  cell(dff) {\n    area : 6;\n    ff(IQ, IQN) {\n      next_state : \"D\";\n      clocked_on : \"CLK\";\n    }";
+	print "    pin(D) {\n      direction : input;\n    }\n    pin(CLK) {\n      direction : input;\n    }";
+	print "    pin(Q) {\n      direction : output;\n      function : \"IQ\";\n    }\n  }";
+	print "}";
+}' > $workdir/cells.lib
+
+cat > $workdir/design.v <<EOT
+module top(input C, A, B, output reg Q);
+	always @(posedge C) Q <= A;
+	nand_1 g(.A(A), .B(B), .Y());
+endmodule
+EOT
+
+# run <binary> <script>: prints the wall-clock time in seconds and the peak
+# memory in MB
+run() {
+	echo "$(timed $1 -p "$2") $(peak_mem)"
+}
+
+bench() {
+	local base t
+	base=($(run $1 ""))
+	printf "  %s\n" "$1"
+	t=($(run $1 "read_verilog $workdir/design.v; proc; techmap; stat -liberty $workdir/cells.lib"))
+	printf "    %-38s %8.3f s %8.1f MB\n" "stat -liberty" $(calc "${t[0]} - ${base[0]}") $(calc "${t[1]} - ${base[1]}")
+	t=($(run $1 "read_liberty -lib $workdir/cells.lib; read_verilog $workdir/design.v; proc; techmap; dfflibmap -liberty $workdir/cells.lib; stat -liberty $workdir/cells.lib"))
+	printf "    %-38s %8.3f s %8.1f MB\n" "read_liberty, dfflibmap, stat" $(calc "${t[0]} - ${base[0]}") $(calc "${t[1]} - ${base[1]}")
+}
+
+printf "cells: %d, file size: %.1f MB\n" $num_cells $(file_mb $workdir/cells.lib)
+each_binary bench
@@ -0,0 +1,65 @@
+/*
+ * LD_PRELOAD library that counts the calls to malloc(), calloc() and
+ * realloc() and prints the number when the process exits. Used by
+ * sigspec.sh and by the "profile" command (through malloc_count_get()),
+ * build with: cc -shared -fPIC -O2 -o malloc_count.so malloc_count.c -ldl
+ */
+
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t nmemb, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+
+static unsigned long long malloc_count;
+
+void *malloc(size_t size)
+{
+	__atomic_add_fetch(&malloc_count, 1, __ATOMIC_RELAXED);
+	return __libc_malloc(size);
+}
+
+void *calloc(size_t nmemb, size_t size)
+{
+	__atomic_add_fetch(&malloc_count, 1, __ATOMIC_RELAXED);
+	return __libc_calloc(nmemb, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+	__atomic_add_fetch(&malloc_count, 1, __ATOMIC_RELAXED);
+	return __libc_realloc(ptr, size);
+}
+
+unsigned long long malloc_count_get(void)
+{
+	return __atomic_load_n(&malloc_count, __ATOMIC_RELAXED);
+}
+
+static void report(void)
+{
+	fprintf(stderr, "malloc calls: %llu\n", malloc_count);
+}
+
+__attribute__((destructor)) static void report_at_exit(void)
+{
+	report();
+}
+
+/* yosys leaves with _exit() to skip the destructors of the design */
+void _exit(int status)
+{
+	void (*real_exit)(int) = (void (*)(int))dlsym(RTLD_NEXT, "_exit");
+	report();
+	real_exit(status);
+	abort();
+}
+
+void _Exit(int status)
+{
+	_exit(status);
+}
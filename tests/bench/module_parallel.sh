@@ -0,0 +1,47 @@
+#!/usr/bin/env bash
+#
+# Compare the wall-clock time of the module-parallel passes (opt_expr,
+# opt_merge, opt_clean) for different "yosys -j" settings on a generated
+# design with many modules.
+#
+# Usage: bash module_parallel.sh [<num_modules> [<threads> ..]]
+# Set YOSYS to use a different binary than the one in the source tree.
+
+source $(dirname $0)/common.sh
+
+num_modules=${1:-2000}
+shift || true
+threads=${@:-1 2 4 8}
+
+{
+	for ((i = 0; i < num_modules; i++)); do
+		echo "module m$i(input clk, input [31:0] a, b, c, input [3:0] s, output reg [31:0] q);"
+		echo "  wire [31:0] t0 = (a & 32'hffff0000) | (b & 32'h0000ffff);"
+		echo "  wire [31:0] t1 = (a & 32'hffff0000) | (b & 32'h0000ffff);"
+		echo "  wire [31:0] t2 = s[0] ? t0 + c : t1 - c;"
+		echo "  wire [31:0] t3 = s[1] ? t2 ^ 32'd0 : t2 | 32'd$i;"
+		echo "  wire [31:0] t4 = (s[2] & 1'b0) ? t3 : t3 * 32'd1;"
+		echo "  always @(posedge clk) q <= s[3] ? t4 : {t0[15:0], t1[31:16]};"
+		echo "endmodule"
+	done
+	echo "module top(input clk, input [31:0] a, b, c, input [3:0] s, output [32*$num_modules-1:0] q);"
+	for ((i = 0; i < num_modules; i++)); do
+		echo "  m$i u$i(clk, a, b, c, s, q[32*$i +: 32]);"
+	done
+	echo "endmodule"
+} > $workdir/design.v
+
+$yosys -q -p "read_verilog $workdir/design.v; hierarchy -top top; proc; write_rtlil $workdir/design.il"
+
+echo "modules: $num_modules"
+for j in $threads; do
+	t=$(timed $yosys -q -j $j -p "read_rtlil $workdir/design.il; opt_expr -full; opt_merge; opt_clean; tee -q -o $workdir/stat_$j.txt stat")
+	printf "threads: %3d  wall-clock: %8.3f s\n" $j $t
+done
+
+for j in $threads; do
+	if ! cmp -s $workdir/stat_$j.txt $workdir/stat_${threads%% *}.txt; then
+		echo "ERROR: result of -j $j differs from -j ${threads%% *}"
+		exit 1
+	fi
+done
@@ -0,0 +1,39 @@
+#!/usr/bin/env bash
+#
+# Measure the time for a flow on a design whose ROM has a multi-megabit
+# initialisation value, which exercises the constant handling (const_*
+# folding, Const::extract(), Const::as_string() in write_rtlil).
+#
+# Usage: bash rom_init.sh [<abits> [<width>]]
+# The default of 16 address bits and 64 bit words is a 4 Mbit ROM.
+# Set YOSYS to use a different binary than the one in the source tree.
+
+source $(dirname $0)/common.sh
+
+abits=${1:-16}
+width=${2:-64}
+depth=$((1 << abits))
+
+awk -v depth=$depth -v digits=$(((width + 3) / 4)) 'BEGIN {
+	srand(1);
+	for (i = 0; i < depth; i++) {
+		s = "";
+		for (j = 0; j < digits; j++)
+			s = s sprintf("%x", int(rand() * 16));
+		print s;
+	}
+}' > $workdir/rom.hex
+
+cat > $workdir/rom.v <<EOT
+module top(input clk, input [$((abits-1)):0] addr, input [$((width-1)):0] mask, output reg [$((width-1)):0] q);
+  reg [$((width-1)):0] rom [0:$((depth-1))];
+  initial \$readmemh("$workdir/rom.hex", rom);
+  always @(posedge clk) q <= (rom[addr] & mask) ^ rom[~addr];
+endmodule
+EOT
+
+echo "ROM: $depth x $width bits"
+t=$(timed $yosys -q -p "read_verilog $workdir/rom.v; proc; opt; memory -nomap; opt -full; tee -q -o $workdir/stat.txt stat; write_rtlil $workdir/rom.il")
+printf "wall-clock: %8.3f s\n" $t
+
+$yosys -QT -p "bench_const -w $((depth * width)) -r 3"
@@ -0,0 +1,54 @@
+#!/usr/bin/env bash
+#
+# Measure the time to save and restore a design checkpoint with
+# "write_rtlil"/"read_rtlil" (text format) and "write_rtlil -binary"/
+# "read_rtlil -binary" on a generated netlist of <num_modules> modules with
+# <num_cells> cells each, and the file sizes of both formats.
+#
+# Usage: bash rtlil_binary.sh [<num_modules> [<num_cells>]]
+# Set YOSYS to use a different binary than the one in the source tree, and
+# THREADS to pass -j to yosys. The time to load the design from the text
+# file is measured separately and subtracted from the write times.
+
+source $(dirname $0)/common.sh
+
+threads=${THREADS:-1}
+num_modules=${1:-16}
+num_cells=${2:-20000}
+
+awk -v m=$num_modules -v n=$num_cells 'BEGIN {
+	print "autoidx 1000000";
+	for (k = 0; k < m; k++) {
+		printf "module \\m%d\n", k;
+		printf "  attribute \\src \"design.v:1.1-9.10\"\n  wire width %d input 1 \\a\n", n;
+		printf "  attribute \\src \"design.v:2.1-9.10\"\n  wire width %d output 2 \\y\n", n;
+		for (i = 0; i < n; i++) {
+			printf "  attribute \\src \"design.v:%d.5-%d.20\"\n  wire width 4 $n%d\n", i + 10, i + 10, i;
+			printf "  attribute \\src \"design.v:%d.5-%d.20\"\n  cell $add $add$design.v:%d$%d\n", i + 10, i + 10, i + 10, i;
+			print "    parameter \\A_SIGNED 0\n    parameter \\B_SIGNED 0\n    parameter \\A_WIDTH 2\n    parameter \\B_WIDTH 4\n    parameter \\Y_WIDTH 4";
+			printf "    connect \\A { \\a [%d] 1'\''1 }\n", i;
+			printf "    connect \\B %s\n", i ? sprintf("$n%d", i - 1) : "4'\''0101";
+			printf "    connect \\Y $n%d\n  end\n", i;
+			printf "  connect \\y [%d] $n%d [3]\n", i, i;
+		}
+		print "end";
+	}
+}' > $workdir/design.il
+
+# run <script>: prints the wall-clock time in seconds
+run() {
+	timed $yosys -j $threads -q -p "$1"
+}
+
+base=$(run "")
+load=$(calc "$(run "read_rtlil -fast $workdir/design.il") - $base")
+$yosys -q -p "read_rtlil -fast $workdir/design.il; write_rtlil -binary $workdir/design.rtlil"
+
+printf "modules: %d, cells: %d, threads: %d\n" $num_modules $((num_modules * num_cells)) $threads
+printf "  %-8s %10s %10s %10s\n" "format" "size (MB)" "write (s)" "read (s)"
+for format in text binary; do
+	if [ $format = text ]; then opt=""; file=$workdir/design.il; else opt="-binary"; file=$workdir/design.rtlil; fi
+	write=$(calc "$(run "read_rtlil -fast $workdir/design.il; write_rtlil $opt $workdir/out") - $base - $load")
+	read=$(calc "$(run "read_rtlil $opt $file") - $base")
+	printf "  %-8s %10.1f %10.3f %10.3f\n" $format $(file_mb $file) $write $read
+done
@@ -0,0 +1,53 @@
+#!/usr/bin/env bash
+#
+# Measure the throughput of "read_rtlil" (flex/bison parser) and
+# "read_rtlil -fast" (hand-written reader) in MB/s on a generated netlist
+# with src attributes on all wires and cells, similar to a checkpoint
+# written by write_rtlil after synthesis.
+#
+# Usage: bash rtlil_read.sh [<num_cells>]
+# Set YOSYS to use a different binary than the one in the source tree, and
+# YOSYS_REF to compare against a second binary. The start-up time of yosys
+# is measured separately and subtracted.
+
+source $(dirname $0)/common.sh
+
+num_cells=${1:-500000}
+
+awk -v n=$num_cells 'BEGIN {
+	print "autoidx 1000000";
+	print "attribute \\top 1";
+	print "module \\top";
+	printf "  attribute \\src \"design.v:1.1-9.10\"\n  wire width %d input 1 \\a\n", n;
+	printf "  attribute \\src \"design.v:2.1-9.10\"\n  wire width %d output 2 \\y\n", n;
+	for (i = 0; i < n; i++) {
+		printf "  attribute \\src \"design.v:%d.5-%d.20\"\n  wire width 4 $n%d\n", i + 10, i + 10, i;
+		printf "  attribute \\src \"design.v:%d.5-%d.20\"\n  cell $add $add$design.v:%d$%d\n", i + 10, i + 10, i + 10, i;
+		print "    parameter \\A_SIGNED 0\n    parameter \\B_SIGNED 0\n    parameter \\A_WIDTH 2\n    parameter \\B_WIDTH 4\n    parameter \\Y_WIDTH 4";
+		printf "    connect \\A { \\a [%d] 1'\''1 }\n", i;
+		printf "    connect \\B %s\n", i ? sprintf("$n%d", i - 1) : "4'\''0101";
+		printf "    connect \\Y $n%d\n  end\n", i;
+		printf "  connect \\y [%d] $n%d [3]\n", i, i;
+	}
+	print "end";
+}' > $workdir/design.il
+
+size_mb=$(file_mb $workdir/design.il)
+
+# run <binary> <script>: prints the wall-clock time in seconds
+run() {
+	timed $1 -q -p "$2"
+}
+
+bench() {
+	local base t cmd
+	base=$(run $1 "")
+	echo "$1:"
+	for cmd in "read_rtlil" "read_rtlil -fast"; do
+		t=$(calc "$(run $1 "$cmd $workdir/design.il") - $base")
+		printf "  %-18s %8.3f s %8.1f MB/s\n" "$cmd" $t $(calc "$size_mb / $t")
+	done
+}
+
+printf "cells: %d, file size: %.1f MB\n" $num_cells $size_mb
+each_binary bench
@@ -0,0 +1,66 @@
+#!/usr/bin/env bash
+#
+# Measure the time and the number of heap allocations of opt_expr and
+# opt_clean on a generated netlist with about 1M cells, which is dominated
+# by SigSpec handling (SigMap, chunks()/bits() conversions, hashing).
+#
+# Usage: bash sigspec.sh [<num_cells>]
+# Set YOSYS to use a different binary than the one in the source tree, and
+# YOSYS_REF to compare against a second binary (e.g. a build of an older
+# commit). The numbers reported for each pass are those of the complete run
+# minus those of a run that only reads the design.
+
+source $(dirname $0)/common.sh
+
+num_groups=$(((${1:-1000000} + 4) / 5))
+
+${CC:-cc} -shared -fPIC -O2 -o $workdir/malloc_count.so $(dirname $0)/malloc_count.c -ldl
+
+# Five cells per group: a constant AND that opt_expr removes, a chain of
+# XOR/OR/NOT gates and a dead XOR that opt_clean removes.
+awk -v n=$num_groups 'BEGIN {
+	print "module \\top";
+	printf "  wire width %d input 1 \\a\n", n;
+	printf "  wire width %d input 2 \\b\n", n;
+	printf "  wire width %d output 3 \\y\n", n;
+	for (i = 0; i < n; i++) {
+		for (j = 1; j <= 4; j++)
+			printf "  wire $t%d_%d\n", j, i;
+		printf "  cell $and $c1_%d\n", i;
+		print "    parameter \\A_SIGNED 0\n    parameter \\B_SIGNED 0\n    parameter \\A_WIDTH 1\n    parameter \\B_WIDTH 1\n    parameter \\Y_WIDTH 1";
+		printf "    connect \\A \\a [%d]\n    connect \\B 1'\''1\n    connect \\Y $t1_%d\n  end\n", i, i;
+		printf "  cell $xor $c2_%d\n", i;
+		print "    parameter \\A_SIGNED 0\n    parameter \\B_SIGNED 0\n    parameter \\A_WIDTH 1\n    parameter \\B_WIDTH 1\n    parameter \\Y_WIDTH 1";
+		printf "    connect \\A $t1_%d\n    connect \\B \\b [%d]\n    connect \\Y $t2_%d\n  end\n", i, i, i;
+		printf "  cell $or $c3_%d\n", i;
+		print "    parameter \\A_SIGNED 0\n    parameter \\B_SIGNED 0\n    parameter \\A_WIDTH 1\n    parameter \\B_WIDTH 1\n    parameter \\Y_WIDTH 1";
+		printf "    connect \\A $t2_%d\n    connect \\B \\a [%d]\n    connect \\Y $t3_%d\n  end\n", i, (i + 1) % n, i;
+		printf "  cell $not $c4_%d\n", i;
+		print "    parameter \\A_SIGNED 0\n    parameter \\A_WIDTH 1\n    parameter \\Y_WIDTH 1";
+		printf "    connect \\A $t3_%d\n    connect \\Y \\y [%d]\n  end\n", i, i;
+		printf "  cell $xor $c5_%d\n", i;
+		print "    parameter \\A_SIGNED 0\n    parameter \\B_SIGNED 0\n    parameter \\A_WIDTH 1\n    parameter \\B_WIDTH 1\n    parameter \\Y_WIDTH 1";
+		printf "    connect \\A $t2_%d\n    connect \\B \\b [%d]\n    connect \\Y $t4_%d\n  end\n", i, (i + 3) % n, i;
+	}
+	print "end";
+}' > $workdir/design.il
+
+# run <binary> <script>: prints "<seconds> <malloc calls>"
+run() {
+	echo "$(timed env LD_PRELOAD=$workdir/malloc_count.so $1 -q -p "read_rtlil $workdir/design.il; $2" 2> $workdir/stderr.txt)" \
+		"$(sed -n 's/^malloc calls: //p' $workdir/stderr.txt | tail -n 1)"
+}
+
+bench() {
+	local base r pass
+	base=($(run $1 ""))
+	echo "$1:"
+	for pass in opt_expr opt_clean; do
+		r=($(run $1 $pass))
+		printf "  %-10s %8.3f s %12d allocations\n" $pass \
+			$(calc "${r[0]} - ${base[0]}") $((r[1] - base[1]))
+	done
+}
+
+echo "cells: $((5 * num_groups))"
+each_binary bench
@@ -0,0 +1,83 @@
+#!/usr/bin/env bash
+#
+# Compare the wall-clock time of "sim" with the default and the compiled
+# (-compiled) engine on a generated design of identical tiles, once as a
+# hierarchical RTL design and once as a flat gate-level netlist. The traces
+# of both engines must be the same, apart from the VCD identifiers of memory
+# words, which are allocated in the order the words are first read.
+#
+# Usage: bash sim_compiled.sh [<num_tiles> [<cycles>]]
+# Set YOSYS to use a different binary than the one in the source tree.
+
+source $(dirname $0)/common.sh
+
+num_tiles=${1:-64}
+cycles=${2:-1000}
+
+{
+	cat <<EOT
+module lfsr(input clk, input rst, output reg [15:0] q);
+	always @(posedge clk)
+		if (rst) q <= 16'hace1;
+		else q <= {q[14:0], q[15] ^ q[13] ^ q[12] ^ q[10]};
+endmodule
+
+module alu(input [7:0] a, input [7:0] b, input [2:0] op, output reg [8:0] y, output z);
+	always @*
+		case (op)
+			0: y = a + b;
+			1: y = a - b;
+			2: y = {1'b0, a & b} | {8'b0, ^a};
+			3: y = \$signed(a) < \$signed(b);
+			4: y = a == b ? ~a : a >>> b[2:0];
+			5: y = -a;
+			6: y = {a[3:0], b[7:4]} ^ ~b;
+			default: y = a >= b ? {&a, |b, a[6:0]} : a * b[2:0];
+		endcase
+	assign z = !y && (a || b);
+endmodule
+
+module tile(input clk, input rst, output [7:0] o);
+	wire [15:0] r;
+	wire [8:0] y;
+	wire z;
+	reg [7:0] acc, rd;
+	reg [7:0] mem [0:15];
+	lfsr gen (.clk(clk), .rst(rst), .q(r));
+	alu u (.a(r[7:0]), .b(acc), .op(r[15:13]), .y(y), .z(z));
+	always @(posedge clk) begin
+		if (rst) acc <= 0;
+		else acc <= acc + y[7:0] + z;
+		mem[r[3:0]] <= y[7:0];
+		rd <= mem[acc[3:0]];
+	end
+	assign o = acc ^ rd;
+endmodule
+EOT
+	echo "module top(input clk, input rst, output [8*$num_tiles-1:0] o);"
+	for ((i = 0; i < num_tiles; i++)); do
+		echo "	tile t$i(clk, rst, o[8*$i +: 8]);"
+	done
+	echo "endmodule"
+} > $workdir/design.v
+
+$yosys -q -p "read_verilog $workdir/design.v; hierarchy -top top; proc; opt; memory -nomap -nordff; write_rtlil $workdir/rtl.il"
+$yosys -q -p "read_rtlil $workdir/rtl.il; synth -flatten -noabc; memory_map; opt; write_rtlil $workdir/gates.il"
+
+echo "tiles: $num_tiles  cycles: $cycles"
+for design in rtl gates; do
+	for mode in "" -compiled; do
+		t=$(timed $yosys -q -p "read_rtlil $workdir/$design.il; sim $mode -clock clk -reset rst -n $cycles -vcd $workdir/$design$mode.vcd")
+		printf "%-5s %-9s  wall-clock: %8.3f s\n" $design "${mode:--default}" $t
+		awk '/^\$scope/ { scope[++depth] = $3 }
+			/^\$upscope/ { depth-- }
+			/^\$var/ { name = ""; for (i = 1; i <= depth; i++) name = name scope[i] "."; names[$4] = name $5 }
+			/^#/ { time = substr($0, 2) }
+			/^b/ { print time, names[$2], $1 }
+			/^[01xz]/ { print time, names[substr($0, 2)], substr($0, 1, 1) }' $workdir/$design$mode.vcd | sort > $workdir/$design$mode.out
+	done
+	if ! cmp -s $workdir/$design.out $workdir/$design-compiled.out; then
+		echo "ERROR: traces of the $design design differ"
+		exit 1
+	fi
+done
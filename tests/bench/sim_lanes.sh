@@ -0,0 +1,122 @@
+#!/usr/bin/env bash
+#
+# Compare the wall-clock time of replaying many Yosys witness files against
+# one design: one "sim -r" process per file, one "sim -r" call per file in a
+# single process, and a single "sim" call that replays all files at once on
+# 64-bit lanes. All three must trigger the same assertions.
+#
+# Usage: bash sim_lanes.sh [<num_witnesses> [<steps> [<num_tiles>]]]
+# Set YOSYS to use a different binary than the one in the source tree.
+
+source $(dirname $0)/common.sh
+
+num_witnesses=${1:-256}
+steps=${2:-100}
+num_tiles=${3:-16}
+
+{
+	cat <<EOT
+module alu(input [7:0] a, input [7:0] b, input [2:0] op, output reg [8:0] y, output z);
+	always @*
+		case (op)
+			0: y = a + b;
+			1: y = a - b;
+			2: y = {1'b0, a & b} | {8'b0, ^a};
+			3: y = \$signed(a) < \$signed(b);
+			4: y = a == b ? ~a : a >>> b[2:0];
+			5: y = -a;
+			6: y = {a[3:0], b[7:4]} ^ ~b;
+			default: y = a >= b ? {&a, |b, a[6:0]} : {a[3:0], b[3:0]};
+		endcase
+	assign z = !y && (a || b);
+endmodule
+
+module tile(input clk, input rst, input [7:0] a, input [2:0] op, output reg [7:0] acc);
+	wire [8:0] y;
+	wire z;
+	reg [3:0] cnt;
+	alu u (.a(a), .b(acc), .op(op), .y(y), .z(z));
+	always @(posedge clk)
+		if (rst) begin
+			acc <= 0;
+			cnt <= 0;
+		end else begin
+			acc <= acc + y[7:0] + z;
+			cnt <= cnt + (y[8] | z);
+		end
+	always @* if (!rst) begin
+		assert (acc != 8'hff || cnt != 0);
+		cover (cnt == 4'd9);
+	end
+endmodule
+EOT
+	echo "module top(input clk, input rst, input [7:0] a, input [2:0] op, output [8*$num_tiles-1:0] o);"
+	for ((i = 0; i < num_tiles; i++)); do
+		echo "	tile t$i(clk, rst, a ^ 8'd$((i * 37 % 256)), op ^ 3'd$((i % 8)), o[8*$i +: 8]);"
+	done
+	echo "endmodule"
+} > $workdir/design.v
+
+$yosys -q -p "read_verilog -formal $workdir/design.v; hierarchy -top top; proc; opt; write_rtlil $workdir/design.il"
+
+files=""
+for ((i = 0; i < num_witnesses; i++)); do
+	awk -v seed=$i -v steps=$steps 'BEGIN {
+		s = seed * 7919 + 1
+		print "{\"format\": \"Yosys Witness Trace\","
+		print "\"clocks\": [{\"path\": [\"\\\\clk\"], \"edge\": \"posedge\", \"offset\": 0}],"
+		print "\"signals\": ["
+		print "{\"path\": [\"\\\\clk\"], \"width\": 1, \"offset\": 0, \"init_only\": false},"
+		print "{\"path\": [\"\\\\rst\"], \"width\": 1, \"offset\": 0, \"init_only\": false},"
+		print "{\"path\": [\"\\\\a\"], \"width\": 8, \"offset\": 0, \"init_only\": false},"
+		print "{\"path\": [\"\\\\op\"], \"width\": 3, \"offset\": 0, \"init_only\": false}],"
+		print "\"steps\": ["
+		for (t = 0; t < steps; t++) {
+			bits = ""
+			for (j = 0; j < 11; j++) {
+				s = (s * 1103515245 + 12345) % 2147483648
+				bits = bits int(s / 65536) % 2
+			}
+			printf "{\"bits\": \"%s%d0\"}%s\n", bits, t == 0, t < steps - 1 ? "," : ""
+		}
+		print "]}"
+	}' > $workdir/w$i.yw
+	files="$files -r $workdir/w$i.yw"
+done
+
+# one line per triggered assertion: witness file, step, type and path
+summary_lines() {
+	awk -v witness=$2 '/"step": / { line = $0 }
+		/"(type|path)": / { line = line $0 }
+		/"witness": / { witness = $2 }
+		/^ *}/ && line != "" { gsub(/[ ",]+/, " ", line); gsub(/[",]/, "", witness); print witness line; line = "" }' $1
+}
+
+# replay_each: replays each witness in a yosys process of its own
+replay_each() {
+	for ((i = 0; i < num_witnesses; i++)); do
+		$yosys -q -p "read_rtlil $workdir/design.il; sim -r $workdir/w$i.yw -summary $workdir/s$i.json" -w 'Assert .* failed'
+	done
+}
+
+echo "witnesses: $num_witnesses  steps: $steps  tiles: $num_tiles"
+
+printf "one process per witness  wall-clock: %8.3f s\n" $(timed replay_each)
+for ((i = 0; i < num_witnesses; i++)); do
+	summary_lines $workdir/s$i.json $workdir/w$i.yw
+done | sort > $workdir/single.out
+
+script="read_rtlil $workdir/design.il"
+for ((i = 0; i < num_witnesses; i++)); do
+	script="$script; sim -q -r $workdir/w$i.yw"
+done
+printf "one sim call per witness wall-clock: %8.3f s\n" $(timed $yosys -q -p "$script" -w 'Assert .* failed')
+
+printf "64-bit lanes             wall-clock: %8.3f s\n" \
+	$(timed $yosys -q -p "read_rtlil $workdir/design.il; sim -q $files -summary $workdir/batch.json" -w 'Assert .* failed')
+summary_lines $workdir/batch.json | sort > $workdir/batch.out
+
+if ! cmp -s $workdir/single.out $workdir/batch.out; then
+	echo "ERROR: assertion results of the lanes differ from the single replays"
+	exit 1
+fi
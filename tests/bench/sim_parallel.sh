@@ -0,0 +1,81 @@
+#!/usr/bin/env bash
+#
+# Compare the wall-clock time of "sim" for different "sim -j" settings on a
+# generated design of identical tiles, which are sibling instances of the
+# top module. The traces must not depend on the number of threads.
+#
+# Usage: bash sim_parallel.sh [<num_tiles> [<cycles> [<threads> ..]]]
+# Set YOSYS to use a different binary than the one in the source tree.
+
+source $(dirname $0)/common.sh
+
+num_tiles=${1:-256}
+cycles=${2:-200}
+threads=${@:3}
+threads=${threads:-1 2 4 8}
+
+{
+	cat <<EOT
+module lfsr(input clk, input rst, output reg [15:0] q);
+	always @(posedge clk)
+		if (rst) q <= 16'hace1;
+		else q <= {q[14:0], q[15] ^ q[13] ^ q[12] ^ q[10]};
+endmodule
+
+module alu(input [7:0] a, input [7:0] b, input [2:0] op, output reg [8:0] y, output z);
+	always @*
+		case (op)
+			0: y = a + b;
+			1: y = a - b;
+			2: y = {1'b0, a & b} | {8'b0, ^a};
+			3: y = \$signed(a) < \$signed(b);
+			4: y = a == b ? ~a : a >>> b[2:0];
+			5: y = -a;
+			6: y = {a[3:0], b[7:4]} ^ ~b;
+			default: y = a >= b ? {&a, |b, a[6:0]} : a * b[2:0];
+		endcase
+	assign z = !y && (a || b);
+endmodule
+
+module tile(input clk, input rst, output [7:0] o);
+	wire [15:0] r;
+	wire [8:0] y;
+	wire z;
+	reg [7:0] acc, rd;
+	reg [7:0] mem [0:15];
+	lfsr gen (.clk(clk), .rst(rst), .q(r));
+	alu u (.a(r[7:0]), .b(acc), .op(r[15:13]), .y(y), .z(z));
+	always @(posedge clk) begin
+		if (rst) acc <= 0;
+		else acc <= acc + y[7:0] + z;
+		mem[r[3:0]] <= y[7:0];
+		rd <= mem[acc[3:0]];
+	end
+	assign o = acc ^ rd;
+endmodule
+EOT
+	echo "module top(input clk, input rst, output [8*$num_tiles-1:0] o);"
+	for ((i = 0; i < num_tiles; i++)); do
+		echo "	tile t$i(clk, rst, o[8*$i +: 8]);"
+	done
+	echo "endmodule"
+} > $workdir/design.v
+
+$yosys -q -p "read_verilog $workdir/design.v; hierarchy -top top; proc; opt; memory -nomap -nordff; write_rtlil $workdir/design.il"
+
+echo "tiles: $num_tiles  cycles: $cycles"
+t=$(timed $yosys -q -p "read_rtlil $workdir/design.il; sim -clock clk -reset rst -n $cycles -vcd $workdir/seq.vcd")
+printf "sequential    wall-clock: %8.3f s\n" $t
+
+for j in $threads; do
+	t=$(timed $yosys -q -p "read_rtlil $workdir/design.il; sim -j $j -clock clk -reset rst -n $cycles -vcd $workdir/j$j.vcd")
+	printf "threads: %3d  wall-clock: %8.3f s\n" $j $t
+	grep -v '^\$date\|^ *[A-Z][a-z][a-z] ' $workdir/j$j.vcd > $workdir/j$j.out
+done
+
+for j in $threads; do
+	if ! cmp -s $workdir/j$j.out $workdir/j${threads%% *}.out; then
+		echo "ERROR: trace of -j $j differs from -j ${threads%% *}"
+		exit 1
+	fi
+done
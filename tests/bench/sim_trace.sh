@@ -0,0 +1,90 @@
+#!/usr/bin/env bash
+#
+# Compare the simulation throughput of "sim" without a trace, with a VCD
+# trace and with an FST trace, each written after the simulation
+# ("-trace_buffer 0") and streamed through the trace writer thread (the
+# default). The streamed traces must be identical to the ones written at the
+# end. The design is made of identical tiles without memories, traced
+# memories always disable streaming.
+#
+# Usage: bash sim_trace.sh [<num_tiles> [<cycles> [<trace_buffer>]]]
+# Set YOSYS to use a different binary than the one in the source tree.
+
+source $(dirname $0)/common.sh
+
+num_tiles=${1:-128}
+cycles=${2:-500}
+trace_buffer=${3:-4096}
+
+{
+	cat <<EOT
+module lfsr(input clk, input rst, output reg [15:0] q);
+	always @(posedge clk)
+		if (rst) q <= 16'hace1;
+		else q <= {q[14:0], q[15] ^ q[13] ^ q[12] ^ q[10]};
+endmodule
+
+module alu(input [7:0] a, input [7:0] b, input [2:0] op, output reg [8:0] y, output z);
+	always @*
+		case (op)
+			0: y = a + b;
+			1: y = a - b;
+			2: y = {1'b0, a & b} | {8'b0, ^a};
+			3: y = \$signed(a) < \$signed(b);
+			4: y = a == b ? ~a : a >>> b[2:0];
+			5: y = -a;
+			6: y = {a[3:0], b[7:4]} ^ ~b;
+			default: y = a >= b ? {&a, |b, a[6:0]} : a * b[2:0];
+		endcase
+	assign z = !y && (a || b);
+endmodule
+
+module tile(input clk, input rst, output [7:0] o);
+	wire [15:0] r;
+	wire [8:0] y;
+	wire z;
+	reg [7:0] acc, prev;
+	lfsr gen (.clk(clk), .rst(rst), .q(r));
+	alu u (.a(r[7:0]), .b(acc), .op(r[15:13]), .y(y), .z(z));
+	always @(posedge clk) begin
+		if (rst) acc <= 0;
+		else acc <= acc + y[7:0] + z;
+		prev <= acc;
+	end
+	assign o = acc ^ prev;
+endmodule
+EOT
+	echo "module top(input clk, input rst, output [8*$num_tiles-1:0] o);"
+	for ((i = 0; i < num_tiles; i++)); do
+		echo "	tile t$i(clk, rst, o[8*$i +: 8]);"
+	done
+	echo "endmodule"
+} > $workdir/design.v
+
+$yosys -q -p "read_verilog $workdir/design.v; hierarchy -top top; proc; opt; write_rtlil $workdir/design.il"
+
+run() {
+	local label=$1
+	shift
+	time=$(timed $yosys -q -p "read_rtlil $workdir/design.il; sim -compiled -clock clk -reset rst -n $cycles $*")
+	printf "%-18s wall-clock: %8.3f s  cycles/s: %8.1f\n" "$label" $time $(calc "$cycles / $time")
+}
+
+echo "tiles: $num_tiles  cycles: $cycles  trace buffer: $trace_buffer KiB"
+run "no trace"
+for format in vcd fst; do
+	run "-$format at end" -trace_buffer 0 -$format $workdir/end.$format
+	run "-$format streamed" -trace_buffer $trace_buffer -$format $workdir/stream.$format
+done
+
+if ! cmp -s $workdir/end.vcd $workdir/stream.vcd; then
+	echo "ERROR: the streamed VCD trace differs from the one written at the end"
+	exit 1
+fi
+for trace in end stream; do
+	$yosys -q -p "read_rtlil $workdir/design.il; sim -r $workdir/$trace.fst -scope top -n $cycles -vcd $workdir/$trace.fst.vcd"
+done
+if ! cmp -s $workdir/end.fst.vcd $workdir/stream.fst.vcd; then
+	echo "ERROR: the streamed FST trace differs from the one written at the end"
+	exit 1
+fi
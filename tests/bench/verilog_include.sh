@@ -0,0 +1,68 @@
+#!/usr/bin/env bash
+#
+# Measure the time of "read_verilog" on <num_files> generated files that all
+# include the same define header and parameter header, similar to a project
+# where every source file includes the package headers. The files are read
+# with one command, once one by one and once with -batch on <threads>
+# threads.
+#
+# Usage: bash verilog_include.sh [<num_files> [<threads>]]
+# Set YOSYS to use a different binary than the one in the source tree, and
+# YOSYS_REF to compare against a second binary (the -batch run is skipped
+# for it). The start-up time of yosys is measured separately and subtracted.
+
+source $(dirname $0)/common.sh
+
+num_files=${1:-500}
+threads=${2:-4}
+
+awk 'BEGIN {
+	print "// generated define header";
+	for (i = 0; i < 2000; i++)
+		printf "`define REG_%d_ADDR 16'\''h%04x // register %d\n", i, i * 4, i;
+	print "`define FIELD(reg, lsb, width) reg[(lsb)+:(width)]";
+}' > $workdir/defs.vh
+
+awk 'BEGIN {
+	for (i = 0; i < 500; i++)
+		printf "\tlocalparam [15:0] P_%d = `REG_%d_ADDR + %d;\n", i, i, i % 7;
+}' > $workdir/params.vh
+
+for ((i = 0; i < num_files; i++)); do
+	cat > $workdir/m$i.v <<EOT
+\`include "defs.vh"
+module m$i(input [15:0] a, output [7:0] y);
+\`include "params.vh"
+	assign y = \`FIELD(a, 4, 8) ^ P_$((i % 500));
+endmodule
+EOT
+done
+
+files=$(for ((i = 0; i < num_files; i++)); do echo -n "m$i.v "; done)
+
+# in_workdir <command> [<args> ..]: runs the command in $workdir
+in_workdir() {
+	(cd $workdir && "$@")
+}
+
+# run <binary> <args> <script>: prints the wall-clock time in seconds
+run() {
+	timed in_workdir $1 $2 -q -p "$3"
+}
+
+bench() {
+	local base t
+	base=$(run $1 "" "")
+	t=$(run $1 "" "read_verilog $files")
+	printf "  %-40s %-12s %8.3f s\n" "$1" "sequential" $(calc "$t - $base")
+	if [ "$2" = "batch" ]; then
+		t=$(run $1 "-j $threads" "read_verilog -batch $files")
+		printf "  %-40s %-12s %8.3f s\n" "$1" "-batch -j $threads" $(calc "$t - $base")
+	fi
+}
+
+printf "files: %d, header size: %.1f KB\n" $num_files $(calc "($(wc -c < $workdir/defs.vh) + $(wc -c < $workdir/params.vh)) / 1024")
+bench $(realpath $yosys) batch
+if [ -n "$YOSYS_REF" ]; then
+	bench $(realpath $YOSYS_REF)
+fi
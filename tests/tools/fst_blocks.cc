@@ -0,0 +1,87 @@
+/*
+ * Writes an FST file with a value change block every <block_steps> time
+ * steps, like the files of simulators that dump as they go. The scope "top"
+ * has a clock "clk", a reset "rst" and <num_signals> inputs "d<i>" of 1 to 64
+ * bits with pseudo-random values (with some x and z bits) that change at the
+ * falling clock edges. Used by tests/various/sim_fst_blocks.sh and
+ * tests/bench/fst_read.sh, build with:
+ * c++ -O2 -I../../libs/fst fst_blocks.cc ../../libs/fst/{fstapi,fastlz,lz4}.cc -lz
+ */
+
+#include "fstapi.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+static uint64_t state = 0x123456789abcdef;
+
+static uint64_t next()
+{
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return state;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc != 5) {
+		fprintf(stderr, "Usage: %s <file.fst> <num_signals> <num_steps> <block_steps>\n", argv[0]);
+		return 1;
+	}
+	int num_signals = atoi(argv[2]);
+	int num_steps = atoi(argv[3]);
+	int block_steps = atoi(argv[4]);
+
+	void *ctx = fstWriterCreate(argv[1], 1);
+	if (!ctx) {
+		fprintf(stderr, "Can't create %s\n", argv[1]);
+		return 1;
+	}
+	fstWriterSetPackType(ctx, FST_WR_PT_FASTLZ);
+	fstWriterSetTimescaleFromString(ctx, "1ns");
+	fstWriterSetScope(ctx, FST_ST_VCD_MODULE, "top", nullptr);
+	fstHandle clk = fstWriterCreateVar(ctx, FST_VT_VCD_WIRE, FST_VD_IMPLICIT, 1, "clk", 0);
+	fstHandle rst = fstWriterCreateVar(ctx, FST_VT_VCD_WIRE, FST_VD_IMPLICIT, 1, "rst", 0);
+	std::vector<fstHandle> handles;
+	std::vector<int> widths;
+	for (int i = 0; i < num_signals; i++) {
+		int width = i % 64 + 1;
+		std::string name = "d" + std::to_string(i);
+		widths.push_back(width);
+		handles.push_back(fstWriterCreateVar(ctx, FST_VT_VCD_WIRE, FST_VD_IMPLICIT, width, name.c_str(), 0));
+	}
+	fstWriterSetUpscope(ctx);
+
+	std::string value;
+	auto emit_inputs = [&](bool all) {
+		for (int i = 0; i < num_signals; i++) {
+			// not every signal changes in every step
+			if (!all && next() % 4 == 0)
+				continue;
+			value.clear();
+			uint64_t bits = next();
+			bool undef = next() % 16 == 0;
+			for (int j = 0; j < widths[i]; j++)
+				value += undef && j % 3 == 0 ? "xz"[j % 2] : "01"[(bits >> j) & 1];
+			fstWriterEmitValueChange(ctx, handles[i], value.c_str());
+		}
+	};
+	for (int step = 0; step < num_steps; step++) {
+		if (step > 0 && step % block_steps == 0)
+			fstWriterFlushContext(ctx);
+		fstWriterEmitTimeChange(ctx, 10 * step);
+		fstWriterEmitValueChange(ctx, clk, "1");
+		fstWriterEmitValueChange(ctx, rst, step < 2 ? "1" : "0");
+		if (step == 0)
+			emit_inputs(true);
+		fstWriterEmitTimeChange(ctx, 10 * step + 5);
+		fstWriterEmitValueChange(ctx, clk, "0");
+		emit_inputs(false);
+	}
+	fstWriterEmitTimeChange(ctx, 10 * num_steps);
+	fstWriterClose(ctx);
+	return 0;
+}
@@ -11,4 +11,29 @@ TEST(KernelRtlilTest, getReferenceValid)
 	EXPECT_EQ(33, 33);
 }
 
+TEST(KernelRtlilTest, idStringInterning)
+{
+	std::vector<RTLIL::IdString> ids;
+	for (int i = 0; i < 10000; i++)
+		ids.push_back(stringf("\\id_test_%d", i));
+
+	for (int i = 0; i < 10000; i++) {
+		RTLIL::IdString id = stringf("\\id_test_%d", i);
+		EXPECT_EQ(id.index_, ids[i].index_);
+		EXPECT_EQ(id.str(), stringf("\\id_test_%d", i));
+	}
+
+	// free every other name, the remaining ones must still be found
+	for (int i = 0; i < 10000; i += 2)
+		ids[i] = RTLIL::IdString();
+	for (int i = 1; i < 10000; i += 2) {
+		RTLIL::IdString id = stringf("\\id_test_%d", i);
+		EXPECT_EQ(id.index_, ids[i].index_);
+	}
+
+	RTLIL::IdString id = "\\id_test_42";
+	EXPECT_EQ(id.str(), "\\id_test_42");
+	EXPECT_EQ(RTLIL::IdString().str(), "");
+}
+
 YOSYS_NAMESPACE_END
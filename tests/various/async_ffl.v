@@ -0,0 +1,159 @@
+/* Generated by Yosys 0.32+74 (git sha1 35860a55f, gcc 12.2.0-14+deb12u1 -fPIC -Os) */
+
+(* hdlname = "\\uut" *)
+(* top =  1  *)
+(* src = "async.v:2.1-32.10" *)
+module ffl(clk, d, r, e, q);
+  (* src = "async.v:8.2-13.5" *)
+  wire _00_;
+  (* src = "async.v:16.2-21.5" *)
+  wire _01_;
+  (* src = "async.v:24.2-29.5" *)
+  wire _02_;
+  (* init = 1'h0 *)
+  wire _03_;
+  (* init = 1'h0 *)
+  wire _04_;
+  (* init = 1'h1 *)
+  wire _05_;
+  (* init = 1'h1 *)
+  wire _06_;
+  (* init = 1'h1 *)
+  wire _07_;
+  (* init = 1'h0 *)
+  wire _08_;
+  (* init = 1'h0 *)
+  wire _09_;
+  (* init = 1'h0 *)
+  wire _10_;
+  (* init = 1'hx *)
+  wire _11_;
+  (* init = 1'hx *)
+  wire _12_;
+  (* init = 1'hx *)
+  wire _13_;
+  wire _14_;
+  wire _15_;
+  wire _16_;
+  wire _17_;
+  wire _18_;
+  wire _19_;
+  wire _20_;
+  wire _21_;
+  wire _22_;
+  wire _23_;
+  wire _24_;
+  wire _25_;
+  (* src = "async.v:3.8-3.11" *)
+  input clk;
+  wire clk;
+  (* src = "async.v:4.8-4.9" *)
+  input d;
+  wire d;
+  (* src = "async.v:4.14-4.15" *)
+  input e;
+  wire e;
+  (* src = "async.v:5.15-5.16" *)
+  output [2:0] q;
+  wire [2:0] q;
+  (* keep = 32'd1 *)
+  (* src = "async.v:7.6-7.8" *)
+  wire q0;
+  (* keep = 32'd1 *)
+  (* src = "async.v:15.6-15.8" *)
+  wire q1;
+  (* keep = 32'd1 *)
+  (* src = "async.v:23.6-23.8" *)
+  wire q2;
+  (* src = "async.v:4.11-4.12" *)
+  input r;
+  wire r;
+  assign _18_ = _15_ ? _10_ : _13_;
+  assign _19_ = _03_ ? 1'h0 : _18_;
+  assign _20_ = _14_ ? 1'h0 : _19_;
+  assign _21_ = _16_ ? _09_ : _12_;
+  assign _22_ = _04_ ? 1'h0 : _21_;
+  assign _23_ = r ? 1'h0 : _22_;
+  assign _24_ = _17_ ? _08_ : _11_;
+  assign _14_ = ~ r;
+  \$ff  #(
+    .WIDTH(32'd1)
+  ) _34_ (
+    .D(_14_),
+    .Q(_03_)
+  );
+  \$ff  #(
+    .WIDTH(32'd1)
+  ) _35_ (
+    .D(r),
+    .Q(_04_)
+  );
+  \$ff  #(
+    .WIDTH(32'd1)
+  ) _36_ (
+    .D(clk),
+    .Q(_05_)
+  );
+  \$ff  #(
+    .WIDTH(32'd1)
+  ) _37_ (
+    .D(clk),
+    .Q(_06_)
+  );
+  \$ff  #(
+    .WIDTH(32'd1)
+  ) _38_ (
+    .D(clk),
+    .Q(_07_)
+  );
+  assign _15_ = { _05_, clk } === 2'h1;
+  assign _16_ = { _06_, clk } === 2'h1;
+  assign _17_ = { _07_, clk } === 2'h1;
+  (* clk2fflogic = 32'd1 *)
+  \$ff  #(
+    .WIDTH(32'd1)
+  ) _42_ (
+    .D(q2),
+    .Q(_13_)
+  );
+  \$ff  #(
+    .WIDTH(32'd1)
+  ) _43_ (
+    .D(_02_),
+    .Q(_10_)
+  );
+  (* clk2fflogic = 32'd1 *)
+  \$ff  #(
+    .WIDTH(32'd1)
+  ) _44_ (
+    .D(q1),
+    .Q(_12_)
+  );
+  \$ff  #(
+    .WIDTH(32'd1)
+  ) _45_ (
+    .D(_01_),
+    .Q(_09_)
+  );
+  (* clk2fflogic = 32'd1 *)
+  \$ff  #(
+    .WIDTH(32'd1)
+  ) _46_ (
+    .D(q0),
+    .Q(_11_)
+  );
+  \$ff  #(
+    .WIDTH(32'd1)
+  ) _47_ (
+    .D(_00_),
+    .Q(_08_)
+  );
+  assign _25_ = e ? (* src = "async.v:11.12-11.13|async.v:11.8-12.12" *) d : q0;
+  assign _00_ = r ? (* full_case = 32'd1 *) (* src = "async.v:9.7-9.8|async.v:9.3-12.12" *) 1'h0 : _25_;
+  assign _02_ = e ? (* src = "async.v:27.12-27.14|async.v:27.8-28.12" *) q2 : d;
+  assign _01_ = e ? (* src = "async.v:19.12-19.13|async.v:19.8-20.12" *) d : q1;
+  assign q = { q2, q1, q0 };
+  assign q2 = _20_;
+  assign q1 = _23_;
+  assign q0 = _24_;
+endmodule
@@ -0,0 +1,51 @@
+/* Generated by Yosys 0.32+74 (git sha1 35860a55f, gcc 12.2.0-14+deb12u1 -fPIC -Os) */
+
+(* hdlname = "\\uut" *)
+(* top =  1  *)
+(* src = "async.v:2.1-32.10" *)
+module prp(clk, d, r, e, q);
+  (* src = "async.v:8.2-13.5" *)
+  wire _00_;
+  (* src = "async.v:16.2-21.5" *)
+  wire _01_;
+  (* src = "async.v:24.2-29.5" *)
+  wire _02_;
+  wire _03_;
+  (* src = "async.v:3.8-3.11" *)
+  input clk;
+  wire clk;
+  (* src = "async.v:4.8-4.9" *)
+  input d;
+  wire d;
+  (* src = "async.v:4.14-4.15" *)
+  input e;
+  wire e;
+  (* src = "async.v:5.15-5.16" *)
+  output [2:0] q;
+  wire [2:0] q;
+  (* src = "async.v:7.6-7.8" *)
+  reg q0;
+  (* src = "async.v:15.6-15.8" *)
+  reg q1;
+  (* src = "async.v:23.6-23.8" *)
+  reg q2;
+  (* src = "async.v:4.11-4.12" *)
+  input r;
+  wire r;
+  (* src = "async.v:24.2-29.5" *)
+  always @(posedge clk, negedge r)
+    if (!r) q2 <= 1'h0;
+    else q2 <= _02_;
+  (* src = "async.v:16.2-21.5" *)
+  always @(posedge clk, posedge r)
+    if (r) q1 <= 1'h0;
+    else q1 <= _01_;
+  (* src = "async.v:8.2-13.5" *)
+  always @(posedge clk)
+    q0 <= _00_;
+  assign _03_ = e ? (* src = "async.v:11.12-11.13|async.v:11.8-12.12" *) d : q0;
+  assign _00_ = r ? (* full_case = 32'd1 *) (* src = "async.v:9.7-9.8|async.v:9.3-12.12" *) 1'h0 : _03_;
+  assign _02_ = e ? (* src = "async.v:27.12-27.14|async.v:27.8-28.12" *) q2 : d;
+  assign _01_ = e ? (* src = "async.v:19.12-19.13|async.v:19.8-20.12" *) d : q1;
+  assign q = { q2, q1, q0 };
+endmodule
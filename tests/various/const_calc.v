@@ -0,0 +1,136 @@
+module const_ops #(parameter W = 8) (
+	input [W-1:0] a, b, c, d,
+	input signed [W-1:0] sa, sm,
+	input [3:0] n,
+	input signed [3:0] sn,
+	output [W-1:0] y_and, y_or, y_xor, y_xnor, y_andx, y_orx, y_xorx, y_notz,
+	output [W:0] y_addn, y_carry,
+	output [W-1:0] y_sadd, y_sub, y_addx, y_smul, y_shl, y_sshr, y_shrx,
+	output y_seq, y_ueq, y_eq0, y_eqx, y_lt, y_slt, y_slt2, y_ult, y_gex, y_gt, y_ge,
+	output y_rand, y_randx, y_ror, y_rorx, y_rxor, y_rxor2, y_rxorx, y_rxnor, y_lor,
+	output y_lnot, y_lnotx, y_landx
+);
+	assign y_and = a & b;
+	assign y_or = a | b;
+	assign y_xor = a ^ b;
+	assign y_xnor = a ~^ b;
+	assign y_andx = a & c;
+	assign y_orx = a | c;
+	assign y_xorx = a ^ c;
+	assign y_notz = ~d;
+
+	assign y_addn = a + n;
+	assign y_carry = (a ^ b) + n;
+	assign y_sadd = sa + sn;
+	assign y_sub = n - a;
+	assign y_addx = a + c;
+	assign y_smul = sa * sn;
+	assign y_shl = a << n;
+	assign y_sshr = sa >>> n;
+	assign y_shrx = a >> c[7:4];
+
+	assign y_seq = sm == sn;
+	assign y_ueq = $unsigned(sm) == $unsigned(sn);
+	assign y_eq0 = a == c;
+	assign y_eqx = a == d;
+	assign y_lt = a < b;
+	assign y_slt = sa < sn;
+	assign y_slt2 = sm < sa;
+	assign y_ult = $unsigned(sm) < a;
+	assign y_gex = a >= c;
+	assign y_gt = b > a;
+	assign y_ge = a >= n;
+
+	assign y_rand = &sm;
+	assign y_randx = &{sm[W-1:1], d[0]};
+	assign y_ror = |a;
+	assign y_rorx = |c;
+	assign y_rxor = ^a;
+	assign y_rxor2 = ^a[W-1:2];
+	assign y_rxorx = ^{a, d[0]};
+	assign y_rxnor = ~^a;
+	assign y_lor = d || 1'b0;
+
+	assign y_lnot = !a;
+	assign y_lnotx = !c;
+	assign y_landx = c && a;
+endmodule
+
+module const_check #(parameter W = 8);
+	localparam N = W / 8;
+
+	wire [W-1:0] y_and, y_or, y_xor, y_xnor, y_andx, y_orx, y_xorx, y_notz;
+	wire [W:0] y_addn, y_carry;
+	wire [W-1:0] y_sadd, y_sub, y_addx, y_smul, y_shl, y_sshr, y_shrx;
+	wire y_seq, y_ueq, y_eq0, y_eqx, y_lt, y_slt, y_slt2, y_ult, y_gex, y_gt, y_ge;
+	wire y_rand, y_randx, y_ror, y_rorx, y_rxor, y_rxor2, y_rxorx, y_rxnor, y_lor;
+	wire y_lnot, y_lnotx, y_landx;
+
+	const_ops #(.W(W)) ops (
+		.a({N{8'h5a}}), .b({N{8'ha5}}), .c({N{8'hx0}}), .d({N{8'h5z}}),
+		.sa({N{8'h5a}}), .sm({W{1'b1}}), .n(4'd1), .sn(-4'sd1),
+		.y_and(y_and), .y_or(y_or), .y_xor(y_xor), .y_xnor(y_xnor),
+		.y_andx(y_andx), .y_orx(y_orx), .y_xorx(y_xorx), .y_notz(y_notz),
+		.y_addn(y_addn), .y_carry(y_carry), .y_sadd(y_sadd), .y_sub(y_sub),
+		.y_addx(y_addx), .y_smul(y_smul), .y_shl(y_shl), .y_sshr(y_sshr), .y_shrx(y_shrx),
+		.y_seq(y_seq), .y_ueq(y_ueq), .y_eq0(y_eq0), .y_eqx(y_eqx), .y_lt(y_lt),
+		.y_slt(y_slt), .y_slt2(y_slt2), .y_ult(y_ult), .y_gex(y_gex), .y_gt(y_gt), .y_ge(y_ge),
+		.y_rand(y_rand), .y_randx(y_randx), .y_ror(y_ror), .y_rorx(y_rorx), .y_rxor(y_rxor),
+		.y_rxor2(y_rxor2), .y_rxorx(y_rxorx), .y_rxnor(y_rxnor), .y_lor(y_lor),
+		.y_lnot(y_lnot), .y_lnotx(y_lnotx), .y_landx(y_landx)
+	);
+
+	always @* begin
+		assert (y_and === {W{1'b0}});
+		assert (y_or === {W{1'b1}});
+		assert (y_xor === {W{1'b1}});
+		assert (y_xnor === {W{1'b0}});
+		assert (y_andx === {N{8'b0x0x_0000}});
+		assert (y_orx === {N{8'bx1x1_1010}});
+		assert (y_xorx === {N{8'bxxxx_1010}});
+		assert (y_notz === {N{8'b1010_xxxx}});
+
+		assert (y_addn === {1'b0, {N-1{8'h5a}}, 8'h5b});
+		assert (y_carry === {1'b1, {W{1'b0}}});
+		assert (y_sadd === {{N-1{8'h5a}}, 8'h59});
+		assert (y_sub === {{N-1{8'ha5}}, 8'ha7});
+		assert (y_addx === {W{1'bx}});
+		assert (y_smul === {{N-1{8'ha5}}, 8'ha6});
+		assert (y_shl === {N{8'hb4}});
+		assert (y_sshr === {N{8'h2d}});
+		assert (y_shrx === {W{1'bx}});
+
+		assert (y_seq === 1'b1);
+		assert (y_ueq === 1'b0);
+		assert (y_eq0 === 1'b0);
+		assert (y_eqx === 1'bx);
+		assert (y_lt === 1'b1);
+		assert (y_slt === 1'b0);
+		assert (y_slt2 === 1'b1);
+		assert (y_ult === 1'b0);
+		assert (y_gex === 1'bx);
+		assert (y_gt === 1'b1);
+		assert (y_ge === 1'b1);
+
+		assert (y_rand === 1'b1);
+		assert (y_randx === 1'bx);
+		assert (y_ror === 1'b1);
+		assert (y_rorx === 1'bx);
+		assert (y_rxor === 1'b0);
+		assert (y_rxor2 === 1'b1);
+		assert (y_rxorx === 1'bx);
+		assert (y_rxnor === 1'b1);
+		assert (y_lor === 1'b1);
+
+		assert (y_lnot === 1'b0);
+		assert (y_lnotx === 1'bx);
+		assert (y_landx === 1'bx);
+	end
+endmodule
+
+module top;
+	// below, at and above the width from which calc.cc switches to PackedConst
+	const_check #(.W(64)) narrow ();
+	const_check #(.W(256)) boundary ();
+	const_check #(.W(328)) wide ();
+endmodule
@@ -0,0 +1,53 @@
+#!/usr/bin/env bash
+# A second run of "hierarchy -elab_cache" must load the parametric modules
+# from the cache and give a result equivalent to elaborating them.
+
+set -e
+
+rm -rf elab_cache.d
+mkdir elab_cache.d
+
+cat > elab_cache.v <<- EOV
+	module shreg #(parameter W = 1, parameter D = 1) (input clk, input [W-1:0] d, output [W-1:0] q);
+	  reg [W-1:0] r [0:D-1];
+	  integer i;
+	  always @(posedge clk) begin
+	    r[0] <= d;
+	    for (i = 1; i < D; i = i + 1)
+	      r[i] <= r[i-1];
+	  end
+	  assign q = r[D-1];
+	endmodule
+
+	module top (input clk, input [7:0] a, output [7:0] y0, y1, y2);
+	  shreg #(.W(8), .D(2)) s0 (clk, a, y0);
+	  shreg #(.W(8), .D(3)) s1 (clk, a, y1);
+	  shreg #(.W(4), .D(3)) s2 (clk, a[3:0], y2[3:0]);
+	  assign y2[7:4] = 0;
+	endmodule
+EOV
+
+../../yosys -p "read_verilog elab_cache.v; hierarchy -top top -elab_cache elab_cache.d; proc; flatten; hierarchy -top top; rename top gold; write_rtlil elab_cache_1.il" > elab_cache_1.log
+grep -q "Elaboration cache .*: 0 hits, 3 misses" elab_cache_1.log
+test $(ls elab_cache.d/*.il | wc -l) -eq 3
+
+../../yosys -p "read_verilog elab_cache.v; hierarchy -top top -elab_cache elab_cache.d; proc; flatten; hierarchy -top top; rename top gate; write_rtlil elab_cache_2.il" > elab_cache_2.log
+grep -q "Elaboration cache .*: 3 hits, 0 misses" elab_cache_2.log
+../../yosys -q -p "read_rtlil elab_cache_1.il; read_rtlil elab_cache_2.il" \
+		-p "miter -equiv -flatten -make_assert gold gate miter; sat -verify -prove-asserts -seq 8 -set-init-zero miter"
+
+# truncated or corrupt entries are misses and get replaced
+set -- elab_cache.d/*.il
+head -c 200 $1 > elab_cache.tmp && mv elab_cache.tmp $1
+sed -i 's/ wire / wire  /' $2
+../../yosys -p "read_verilog elab_cache.v; hierarchy -top top -elab_cache elab_cache.d" > elab_cache_4.log
+grep -q "Ignoring corrupt elaboration cache file \`$1'" elab_cache_4.log
+grep -q "Ignoring corrupt elaboration cache file \`$2'" elab_cache_4.log
+grep -q "Elaboration cache .*: 1 hits, 2 misses" elab_cache_4.log
+../../yosys -p "read_verilog elab_cache.v; hierarchy -top top -elab_cache elab_cache.d" > elab_cache_4.log
+grep -q "Elaboration cache .*: 3 hits, 0 misses" elab_cache_4.log
+test $(ls elab_cache.d | wc -l) -eq 3
+
+# a different frontend option is a miss
+../../yosys -p "read_verilog -nomem2reg elab_cache.v; scratchpad -set hierarchy.elab_cache elab_cache.d; hierarchy -top top" > elab_cache_3.log
+grep -q "Elaboration cache .*: 0 hits, 3 misses" elab_cache_3.log
@@ -0,0 +1,44 @@
+#!/usr/bin/env bash
+# Parametric modules derived by "hierarchy" in parallel ("yosys -j") must
+# give the same result, including the generated names, for any number of
+# threads (also for module-parallel passes such as "opt"), equivalent to
+# the serial elaboration.
+
+set -e
+
+cat > hierarchy_parallel.v <<- EOV
+	module shreg #(parameter W = 1, parameter D = 1) (input clk, input [W-1:0] d, output [W-1:0] q);
+	  reg [W-1:0] r [0:D-1];
+	  integer i;
+	  always @(posedge clk) begin
+	    r[0] <= d;
+	    for (i = 1; i < D; i = i + 1)
+	      r[i] <= r[i-1];
+	  end
+	  assign q = r[D-1];
+	endmodule
+
+	module lane #(parameter W = 4, parameter K = 1) (input clk, input [W-1:0] a, output [W-1:0] y);
+	  wire [W-1:0] t;
+	  shreg #(.W(W), .D(K)) s1 (clk, a, t);
+	  shreg #(.W(W), .D(K+1)) s2 (clk, t ^ K, y);
+	endmodule
+
+	module top (input clk, input [7:0] a, output [7:0] y0, y1, y2, y3, y4);
+	  lane #(.W(8), .K(1)) l0 (clk, a, y0);
+	  lane #(.W(8), .K(2)) l1 (clk, a, y1);
+	  lane #(.W(8), .K(3)) l2 (clk, a, y2);
+	  lane #(8, 2) l3 (clk, ~a, y3);
+	  shreg #(.W(8), .D(5)) l4 (clk, a, y4);
+	endmodule
+EOV
+
+for j in 1 2 4; do
+	../../yosys -q -j $j -p "read_verilog hierarchy_parallel.v; hierarchy -top top; proc; opt; write_rtlil hierarchy_parallel_j$j.il"
+done
+cmp hierarchy_parallel_j1.il hierarchy_parallel_j2.il
+cmp hierarchy_parallel_j1.il hierarchy_parallel_j4.il
+
+../../yosys -q -j 4 -p "read_verilog hierarchy_parallel.v; hierarchy -top top; proc; flatten; hierarchy -top top; rename top gate; write_rtlil hierarchy_parallel_gate.il"
+../../yosys -q -p "read_verilog hierarchy_parallel.v; hierarchy -top top; proc; flatten; hierarchy -top top; rename top gold" \
+		-p "read_rtlil hierarchy_parallel_gate.il; miter -equiv -flatten -make_assert gold gate miter; sat -verify -prove-asserts -seq 8 -set-init-zero miter"
@@ -0,0 +1,60 @@
+#!/usr/bin/env bash
+# A liberty file is parsed once per session and shared by read_liberty,
+# dfflibmap and stat, it is parsed again when the file changes. Braces in
+# strings and comments must not confuse the skipping of unparsed cells.
+
+set -e
+
+cat > liberty_cache.lib <<EOT
+library(test) {
+  /* a comment with a brace { */
+  cell(inv) {
+    area : 2;
+    pin(A) { direction : input; }
+    pin(Y) { direction : output; function : "A'"; }
+  }
+  cell(dff) {
+    area : 6; // } in a line comment
+    ff(IQ, IQN) { next_state : "D"; clocked_on : "CLK"; }
+    pin(D) { direction : input; }
+    pin(CLK) { direction : input; }
+    pin(Q) { direction : output; function : "IQ"; }
+    comment : "a string with a brace }";
+  }
+  cell(nand2) {
+    area : 3;
+    pin(A) { direction : input; }
+    pin(B) { direction : input; }
+    pin(Y) { direction : output; function : "(A B)'"; }
+  }
+}
+EOT
+
+cat > liberty_cache.v <<EOT
+module top(input C, D, output reg Q);
+	always @(posedge C) Q <= ~D;
+endmodule
+EOT
+
+cat > liberty_cache.ys <<EOT
+read_verilog liberty_cache.v
+synth -top top
+dfflibmap -liberty liberty_cache.lib
+logger -expect log "Using already parsed liberty file" 1
+stat -liberty liberty_cache.lib
+logger -check-expected
+tee -o liberty_cache_1.log stat -liberty liberty_cache.lib
+!sed -i "s/area : 6/area : 7/" liberty_cache.lib
+!touch -d "+1 minute" liberty_cache.lib
+tee -o liberty_cache_2.log stat -liberty liberty_cache.lib
+read_liberty -lib liberty_cache.lib
+select -assert-count 2 =inv/w:*
+select -assert-count 3 =dff/w:*
+select -assert-count 1 =dff/o:Q
+select -assert-count 3 =nand2/w:*
+EOT
+
+../../yosys -s liberty_cache.ys
+
+grep -q "Chip area for module .\\\\top.: 6.000000" liberty_cache_1.log
+grep -q "Chip area for module .\\\\top.: 7.000000" liberty_cache_2.log
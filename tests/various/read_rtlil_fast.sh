@@ -0,0 +1,75 @@
+#!/usr/bin/env bash
+# "read_rtlil -fast" must read the same design as the flex/bison parser.
+
+set -e
+
+roundtrip() {
+	../../yosys -q -p "read_rtlil $1; write_rtlil read_rtlil_fast_slow.il"
+	../../yosys -q -p "read_rtlil -fast $1; write_rtlil read_rtlil_fast_fast.il"
+	cmp read_rtlil_fast_slow.il read_rtlil_fast_fast.il
+}
+
+for v in ../simple/process.v ../simple/memory.v ../simple/attrib09_case.v ../simple/realexpr.v ../simple/paramods.v; do
+	../../yosys -q -p "read_verilog $v; write_rtlil read_rtlil_fast_1.il; hierarchy; proc -noopt; write_rtlil read_rtlil_fast_2.il; synth -run coarse; write_rtlil read_rtlil_fast_3.il"
+	roundtrip read_rtlil_fast_1.il
+	roundtrip read_rtlil_fast_2.il
+	roundtrip read_rtlil_fast_3.il
+done
+
+# comments, CRLF line endings, escapes, empty concatenations and the
+# constructs the Verilog frontend does not produce (memwr, sync types)
+printf '%s\r\n' '# comment' '' 'autoidx 42' 'attribute \top 1' > read_rtlil_fast_1.il
+cat >> read_rtlil_fast_1.il <<- 'EOT'
+	module \m   # comment
+	  parameter \W
+	  parameter \D 8'00001111
+	  wire width 4 upto offset 2 signed input 1 \a
+	  wire width 1 output 2 \y
+	  wire inout 3 \io
+	  wire width 8 \r
+	  memory width 8 size 4 offset 1 \mem
+	  attribute \x "s p\"a\\c\101\n\t"
+	  cell \foo $c
+	    parameter \A 1
+	    parameter signed \B -1
+	    parameter real \R "1.5"
+	    parameter \V 5'1x
+	    parameter \E 3'
+	    connect \A \a [2]
+	    connect \B { \a [3:2] 2'z1 { } }
+	  end
+	  process $p
+	    attribute \sw 1
+	    switch { \a [0] \io }
+	      attribute \ca 1
+	      case 2'01 , 2'1-
+	        assign \r [3:0] \a
+	        switch \io
+	          case
+	        end
+	      case
+	        assign \r 8'm
+	    end
+	    sync posedge \io
+	      update \r { \r [6:0] \io }
+	      attribute \ma "w"
+	      memwr \mem 2'00 \r 8'11111111 0
+	    sync low \y
+	    sync high \y
+	    sync negedge \y
+	    sync edge \y
+	    sync always
+	    sync global
+	    sync init
+	      update \r 8'0
+	  end
+	  connect \y \a [1]
+	end
+EOT
+roundtrip read_rtlil_fast_1.il
+
+# errors are reported like in the flex/bison parser
+printf 'module \\m\n  wire \\a\n  wire \\a\nend\n' > read_rtlil_fast_1.il
+../../yosys -p "logger -expect error \"Parser error in line 4: RTLIL error: redefinition of wire .a\\.\" 1; read_rtlil -fast read_rtlil_fast_1.il"
+printf 'module \\m\n  connect \\a [1] \\a\nend\n' > read_rtlil_fast_1.il
+../../yosys -p "logger -expect error \"Parser error in line 2: RTLIL error: wire .a not found\" 1; read_rtlil -fast read_rtlil_fast_1.il"
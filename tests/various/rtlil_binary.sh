@@ -0,0 +1,91 @@
+#!/usr/bin/env bash
+# "write_rtlil -binary" followed by "read_rtlil -binary" must restore the
+# same design as "write_rtlil" followed by "read_rtlil".
+
+set -e
+
+roundtrip() {
+	../../yosys -q -p "read_rtlil $1; write_rtlil rtlil_binary_text.il; write_rtlil -binary rtlil_binary.rtlil; write_rtlil -binary rtlil_binary.rtlil.gz"
+	../../yosys -q -p "read_rtlil rtlil_binary_text.il; write_rtlil rtlil_binary_text.il"
+	../../yosys -q -p "read_rtlil -binary rtlil_binary.rtlil; write_rtlil rtlil_binary_1.il"
+	../../yosys -q -j 4 -p "read_rtlil -binary rtlil_binary.rtlil.gz; write_rtlil rtlil_binary_2.il"
+	cmp rtlil_binary_text.il rtlil_binary_1.il
+	cmp rtlil_binary_text.il rtlil_binary_2.il
+}
+
+for v in ../simple/process.v ../simple/memory.v ../simple/attrib09_case.v ../simple/realexpr.v ../simple/paramods.v; do
+	../../yosys -q -p "read_verilog $v; write_rtlil rtlil_binary_in_1.il; hierarchy; proc -noopt; write_rtlil rtlil_binary_in_2.il; synth -run coarse; write_rtlil rtlil_binary_in_3.il"
+	roundtrip rtlil_binary_in_1.il
+	roundtrip rtlil_binary_in_2.il
+	roundtrip rtlil_binary_in_3.il
+done
+
+# the constructs the Verilog frontend does not produce, see read_rtlil_fast.sh
+cat > rtlil_binary_in_1.il <<- 'EOT'
+	autoidx 42
+	attribute \top 1
+	module \m
+	  parameter \W
+	  parameter \D 8'00001111
+	  wire width 4 upto offset -2 signed input 1 \a
+	  wire width 1 output 2 \y
+	  wire inout 3 \io
+	  wire width 8 \r
+	  memory width 8 size 4 offset 1 \mem
+	  attribute \x "s p\"a\\c\101\n\t"
+	  cell \foo $c
+	    parameter \A 1
+	    parameter signed \B -1
+	    parameter real \R "1.5"
+	    parameter \V 5'1x
+	    parameter \E 3'
+	    connect \A \a [2]
+	    connect \B { \a [3:2] 2'z1 { } }
+	  end
+	  process $p
+	    attribute \sw 1
+	    switch { \a [0] \io }
+	      attribute \ca 1
+	      case 2'01 , 2'1-
+	        assign \r [3:0] \a
+	        switch \io
+	          case
+	        end
+	      case
+	        assign \r 8'm
+	    end
+	    sync posedge \io
+	      update \r { \r [6:0] \io }
+	      attribute \ma "w"
+	      memwr \mem 2'00 \r 8'11111111 0
+	    sync low \y
+	    sync high \y
+	    sync negedge \y
+	    sync edge \y
+	    sync always
+	    sync global
+	    sync init
+	      update \r 8'0
+	  end
+	  connect \y \a [1]
+	end
+	module \n
+	  wire \w
+	end
+EOT
+roundtrip rtlil_binary_in_1.il
+
+# autoidx is restored, -selected writes whole modules only
+../../yosys -q -p "read_rtlil -binary rtlil_binary.rtlil; write_rtlil rtlil_binary_1.il"
+grep -q "^autoidx 42$" rtlil_binary_1.il
+../../yosys -q -p "read_rtlil rtlil_binary_in_1.il; select n; write_rtlil -selected -binary rtlil_binary.rtlil; design -reset; read_rtlil -binary rtlil_binary.rtlil; select -assert-none m; select -assert-count 1 n/w"
+
+# redefinitions are handled like in the text reader
+../../yosys -p "logger -expect error \"RTLIL error: redefinition of module .n\\.\" 1; read_rtlil -binary rtlil_binary.rtlil; read_rtlil -binary rtlil_binary.rtlil"
+../../yosys -q -p "read_rtlil -binary rtlil_binary.rtlil; read_rtlil -binary -overwrite rtlil_binary.rtlil; read_rtlil -binary -nooverwrite rtlil_binary.rtlil"
+
+# text files and truncated files are rejected
+../../yosys -p "logger -expect error \"is not a binary RTLIL file\" 1; read_rtlil -binary rtlil_binary_in_1.il"
+../../yosys -q -p "read_rtlil rtlil_binary_in_1.il; write_rtlil -binary rtlil_binary.rtlil"
+head -c -20 rtlil_binary.rtlil > rtlil_binary_1.il
+../../yosys -p "logger -expect error \"truncated or corrupt\" 1; read_rtlil -binary rtlil_binary_1.il"
@@ -0,0 +1,87 @@
+#!/usr/bin/env bash
+# "sim -compiled" must give the same traces as the default engine, for
+# hierarchical RTL and gate-level netlists with all kinds of flip-flops,
+# memories, tri-state values and combinational loops.
+
+set -e
+
+cat > sim_compiled.v <<EOT
+module lfsr(input clk, input rst, output reg [15:0] q);
+	always @(posedge clk)
+		if (rst) q <= 16'hace1;
+		else q <= {q[14:0], q[15] ^ q[13] ^ q[12] ^ q[10]};
+endmodule
+
+module alu(input [7:0] a, input [7:0] b, input [2:0] op, output reg [8:0] y, output z);
+	always @*
+		case (op)
+			0: y = a + b;
+			1: y = a - b;
+			2: y = {1'b0, a & b} | {8'b0, ^a};
+			3: y = \$signed(a) < \$signed(b);
+			4: y = a == b ? ~a : a >>> b[2:0];
+			5: y = -a;
+			6: y = {a[3:0], b[7:4]} ^ ~b;
+			default: y = a >= b ? {&a, |b, a[6:0]} : a * b[2:0];
+		endcase
+	assign z = !y && (a || b);
+endmodule
+
+module regs(input clk, input [15:0] r, output [31:0] o);
+	wire [7:0] d = r[7:0];
+	wire en = r[8], sr = r[9], ar = r[10], al = r[11], g = r[12];
+	reg [7:0] r0, r1, r2, r3, r4, r5;
+	always @(posedge clk or posedge ar) if (ar) r0 <= 8'h5a; else if (en) r0 <= d;
+	always @(negedge clk) if (sr) r1 <= 0; else if (en) r1 <= d ^ r0;
+	always @(posedge clk) if (en) begin if (sr) r2 <= 8'hff; else r2 <= r1 + d; end
+	always @(posedge clk or posedge al) if (al) r3 <= d; else r3 <= r2;
+	always @* if (g) r4 = r3 ^ d;
+	always @(posedge clk, posedge r[13], posedge r[14])
+		if (r[13]) r5 <= 0; else if (r[14]) r5 <= 8'hff; else r5 <= r4;
+	assign o = {r0 ^ r5, r1, r2, r3 ^ r4};
+endmodule
+
+module sr(input s, input r, output q, output qn);
+	assign q = ~(r | qn);
+	assign qn = ~(s | q);
+endmodule
+
+module top(input clk, input rst, output [8:0] out, output reg [7:0] acc, output reg [7:0] rd,
+		output [31:0] o, output q, output qn, output [7:0] t);
+	wire [15:0] r;
+	wire z;
+	lfsr gen (.clk(clk), .rst(rst), .q(r));
+	alu u (.a(r[7:0]), .b(acc), .op(r[15:13]), .y(out), .z(z));
+	regs f (.clk(clk), .r(r), .o(o));
+	sr latch (.s(acc[3:0] == 3), .r(acc[3:0] == 9), .q(q), .qn(qn));
+	reg [7:0] mem [0:15];
+	wire [7:0] tri_y = z ? 8'bz : out[7:0];
+	always @(posedge clk) begin
+		if (rst) acc <= 0;
+		else acc <= acc + out[7:0] + z;
+		mem[r[3:0]] <= out[7:0];
+		rd <= mem[acc[3:0]] ^ tri_y;
+	end
+	assign t = acc[1] ? {4'bz, acc[3:0]} : {acc[3:0], 4'bx};
+endmodule
+EOT
+
+run() {
+	for mode in "" -compiled; do
+		../../yosys -q -p "read_verilog sim_compiled.v; hierarchy -top top; $1; sim $mode $2 -clock clk -reset rst -n 100 -vcd sim_compiled$mode.vcd -w; write_rtlil sim_compiled$mode.il" \
+				-w 'Yosys has only limited support for tri-state logic at the moment.' \
+				-w 'Complex async reset' -w 'Async reset value'
+		grep -v '^\$date\|^ *[A-Z][a-z][a-z] ' sim_compiled$mode.vcd > sim_compiled$mode.out
+		grep -v '^# Generated' sim_compiled$mode.il > sim_compiled_wb$mode.out
+	done
+	cmp sim_compiled.out sim_compiled-compiled.out
+	cmp sim_compiled_wb.out sim_compiled_wb-compiled.out
+}
+
+run "proc"
+run "proc; flatten; opt; memory -nomap -nordff" -zinit
+run "proc; opt; techmap; opt"
+run "proc; opt; dfflegalize -cell \$_DFFSRE_PNPP_ x -cell \$_DLATCH_N_ x; techmap; opt"
+run "proc; opt; clk2fflogic" -multiclock
+
+rm -f sim_compiled*.v sim_compiled*.vcd sim_compiled*.il sim_compiled*.out
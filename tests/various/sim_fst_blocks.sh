@@ -0,0 +1,32 @@
+#!/usr/bin/env bash
+# Reading an FST file with many value change blocks with "yosys -j 4", which
+# decodes runs of blocks in parallel, must give the same simulation as
+# reading it with one thread, also for time ranges that start or end within
+# a block or at a block boundary.
+
+set -e
+
+${CXX:-c++} -O1 -o sim_fst_blocks -I../../libs/fst ../tools/fst_blocks.cc \
+	../../libs/fst/fstapi.cc ../../libs/fst/fastlz.cc ../../libs/fst/lz4.cc -lz
+./sim_fst_blocks sim_fst_blocks.fst 24 600 7
+
+awk -v n=24 'BEGIN {
+	print "module top(input clk, input rst,";
+	for (i = 0; i < n; i++)
+		printf "\tinput [%d:0] d%d,\n", i % 64, i;
+	print "\toutput reg [63:0] acc);";
+	print "\talways @(posedge clk)";
+	print "\t\tif (rst) acc <= 0;";
+	printf "\t\telse acc <= {acc[62:0], acc[63]}";
+	for (i = 0; i < n; i++)
+		printf " ^ d%d", i;
+	print ";";
+	print "endmodule";
+}' > sim_fst_blocks.v
+
+for args in "" "-clock clk" "-start 1000 -stop 4005" "-start 75 -stop 1415 -clock clk" "-at 2105"; do
+	for j in 1 4; do
+		../../yosys -q -j $j -w "Unable to find wire" -p "read_verilog sim_fst_blocks.v; proc; sim -r sim_fst_blocks.fst -scope top $args -vcd sim_fst_blocks_j$j.vcd"
+	done
+	cmp sim_fst_blocks_j1.vcd sim_fst_blocks_j4.vcd
+done
@@ -0,0 +1,100 @@
+#!/usr/bin/env bash
+# Replaying several Yosys witness files with one "sim" call must trigger the
+# same assertions in each of them as replaying them one at a time. 70 files
+# take two batches of lanes.
+
+set -e
+
+cat > sim_lanes.sv <<EOT
+module sub(input clk, input arst, input [7:0] x, output reg [7:0] q);
+	always @(posedge clk, posedge arst)
+		if (arst) q <= 8'h5a; else q <= {q[6:0], ^x} ^ (x >>> 2);
+endmodule
+
+module top(input clk, input rst, input [1:0] op, input [7:0] a, input [7:0] b);
+	reg [7:0] acc;
+	reg [3:0] cnt;
+	wire [7:0] q;
+	sub s(clk, rst & op[0], a ^ acc, q);
+	always @(posedge clk)
+		if (rst) cnt <= 0;
+		else if (op != 0 && !(&cnt)) cnt <= cnt + 1;
+	always @(posedge clk)
+		case (op)
+			0: acc <= acc + a;
+			1: acc <= acc - b;
+			2: acc <= a * b;
+			3: acc <= (\$signed(a) < \$signed(b)) ? a ^ acc : acc << b[2:0];
+		endcase
+	always @* begin
+		if (!rst) assert (acc != 8'hff);
+		assert (!(q == 8'h00 && cnt > 3));
+		if (a == b || (op == 2 && a[0])) cover (cnt == 4'd5);
+		assert (acc[7:4] <= 4'd14 || q[0]);
+	end
+endmodule
+EOT
+
+# pseudo-random inputs with some x and unset bits, and an initial value for
+# acc in the first step
+for i in $(seq 0 69); do
+	awk -v seed=$i -v steps=$((5 + i % 23)) 'BEGIN {
+		s = seed * 7919 + 1
+		print "{\"format\": \"Yosys Witness Trace\","
+		print "\"clocks\": [{\"path\": [\"\\\\clk\"], \"edge\": \"posedge\", \"offset\": 0}],"
+		print "\"signals\": ["
+		print "{\"path\": [\"\\\\clk\"], \"width\": 1, \"offset\": 0, \"init_only\": false},"
+		print "{\"path\": [\"\\\\rst\"], \"width\": 1, \"offset\": 0, \"init_only\": false},"
+		print "{\"path\": [\"\\\\op\"], \"width\": 2, \"offset\": 0, \"init_only\": false},"
+		print "{\"path\": [\"\\\\a\"], \"width\": 8, \"offset\": 0, \"init_only\": false},"
+		print "{\"path\": [\"\\\\b\"], \"width\": 8, \"offset\": 0, \"init_only\": false},"
+		print "{\"path\": [\"\\\\acc\"], \"width\": 8, \"offset\": 0, \"init_only\": true}],"
+		print "\"steps\": ["
+		for (t = 0; t < steps; t++) {
+			bits = ""
+			for (j = 0; j < 28; j++) {
+				s = (s * 1103515245 + 12345) % 2147483648
+				r = int(s / 65536) % 64
+				c = r < 2 ? "x" : r < 3 ? "?" : r % 2 ? "1" : "0"
+				if (j == 26)
+					c = t == 0 || r < 8 ? "1" : "0"
+				if (j == 27)
+					c = "0"
+				bits = bits c
+			}
+			if (t > 0)
+				bits = substr(bits, 9)
+			printf "{\"bits\": \"%s\"}%s\n", bits, t < steps - 1 ? "," : ""
+		}
+		print "]}"
+	}' > sim_lanes_$i.yw
+done
+
+# one line per triggered assertion: witness file, step, type and path
+summary_lines() {
+	awk -v witness=$2 '/"step": / { line = $0 }
+		/"(type|path)": / { line = line $0 }
+		/"witness": / { witness = $2 }
+		/^ *}/ && line != "" { gsub(/[ ",]+/, " ", line); gsub(/[",]/, "", witness); print witness line; line = "" }' $1
+}
+
+for flow in "proc" "proc; flatten; techmap; opt"; do
+	../../yosys -q -p "read_verilog -formal sim_lanes.sv; hierarchy -top top; $flow; write_rtlil sim_lanes_design.il"
+	rm -f sim_lanes_single.out
+	files=""
+	for i in $(seq 0 69); do
+		../../yosys -q -p "read_rtlil sim_lanes_design.il; sim -r sim_lanes_$i.yw -append 2 -summary sim_lanes.json" \
+				-w 'Assert .* failed' > /dev/null
+		summary_lines sim_lanes.json sim_lanes_$i.yw >> sim_lanes_single.out
+		files="$files -r sim_lanes_$i.yw"
+	done
+	../../yosys -q -p "read_rtlil sim_lanes_design.il; sim $files -append 2 -summary sim_lanes.json" \
+			-w 'Assert .* failed' > /dev/null
+	summary_lines sim_lanes.json > sim_lanes_batch.out
+	sort -o sim_lanes_single.out sim_lanes_single.out
+	sort -o sim_lanes_batch.out sim_lanes_batch.out
+	cmp sim_lanes_single.out sim_lanes_batch.out
+	grep -q '\$cover' sim_lanes_batch.out
+done
+
+rm -f sim_lanes.sv sim_lanes_* sim_lanes.json
@@ -0,0 +1,59 @@
+#!/usr/bin/env bash
+# "sim -j" must give the same traces and assertion results for any number of
+# threads, and the same values as the sequential scheduler.
+
+set -e
+
+cat > sim_parallel.sv <<EOT
+module cnt(input clk, input rst, input [3:0] lim, output reg [3:0] c, output [3:0] m);
+	reg [3:0] mem [0:15];
+	always @(posedge clk) begin
+		c <= rst ? 0 : c + 1;
+		mem[c] <= c ^ lim;
+	end
+	assign m = mem[lim];
+	always @* if (!rst) begin
+		assert (c != lim);
+		cover (c == 4'd5);
+	end
+endmodule
+
+module pair(input clk, input rst, input [3:0] lim, output [7:0] c, output [7:0] m);
+	cnt lo(clk, rst, lim, c[3:0], m[3:0]);
+	cnt hi(clk, rst, ~lim, c[7:4], m[7:4]);
+endmodule
+
+module top(input clk, input rst, output [31:0] c, output [31:0] m, output [3:0] t);
+	pair a(clk, rst, 4'd3, c[7:0], m[7:0]);
+	pair b(clk, rst, 4'd7, c[15:8], m[15:8]);
+	pair d(clk, rst, 4'd9, c[23:16], m[23:16]);
+	cnt e(clk, rst, 4'd15, c[27:24], m[27:24]);
+	cnt f(clk, rst, 4'd1, c[31:28], m[31:28]);
+	assign t = c[3:0] == 4'd2 ? 4'bz : m[3:0] ^ c[31:28];
+endmodule
+EOT
+
+for j in "" 1 4; do
+	../../yosys -q -p "read_verilog -formal sim_parallel.sv; hierarchy -top top; proc; memory -nomap -nordff; sim ${j:+-j $j} -clock clk -reset rst -n 40 -vcd sim_parallel_$j.vcd -summary sim_parallel_$j.json" \
+			-w 'Yosys has only limited support for tri-state logic at the moment.' -w 'Assert .* failed' > sim_parallel_$j.log
+	grep -v '^\$date\|^ *[A-Z][a-z][a-z] ' sim_parallel_$j.vcd > sim_parallel_vcd_$j.out
+	grep -v '"generator"' sim_parallel_$j.json > sim_parallel_json_$j.out
+done
+
+cmp sim_parallel_vcd_1.out sim_parallel_vcd_4.out
+cmp sim_parallel_json_.out sim_parallel_json_1.out
+cmp sim_parallel_json_.out sim_parallel_json_4.out
+grep -q '"type": "\$assert"' sim_parallel_json_.out
+
+# without -j, memory words get their VCD identifiers in a different order
+for f in sim_parallel_.vcd sim_parallel_4.vcd; do
+	awk '/^\$scope/ { scope[++depth] = $3 }
+		/^\$upscope/ { depth-- }
+		/^\$var/ { name = ""; for (i = 1; i <= depth; i++) name = name scope[i] "."; names[$4] = name $5 }
+		/^#/ { time = substr($0, 2) }
+		/^b/ { print time, names[$2], $1 }
+		/^[01xz]/ { print time, names[substr($0, 2)], substr($0, 1, 1) }' $f | sort > $f.out
+done
+cmp sim_parallel_.vcd.out sim_parallel_4.vcd.out
+
+rm -f sim_parallel.sv sim_parallel_*
@@ -0,0 +1,34 @@
+#!/usr/bin/env bash
+# The VCD and FST traces that "sim" streams through the trace writer thread
+# must be identical to the ones written after the simulation, also with a
+# queue small enough to make the simulation wait, and when streaming is not
+# possible (-x, traced memories).
+
+set -e
+
+cat > sim_trace_stream.v <<EOT
+module top(input clk, input rst, output reg [15:0] q, output [7:0] m);
+	reg [7:0] a;
+	reg [7:0] mem [0:3];
+	always @(posedge clk) begin
+		a <= a + 3;
+		if (rst) q <= 1;
+		else q <= {q[14:0], q[15] ^ q[13] ^ q[12] ^ q[10]} ^ a;
+		mem[q[1:0]] <= q[15:8];
+	end
+	assign m = mem[a[1:0]];
+endmodule
+EOT
+
+for design in "memory" "memory -nomap -nordff"; do
+	for args in "" "-x"; do
+		for buffer in 0 1 4096; do
+			../../yosys -q -p "read_verilog sim_trace_stream.v; proc; $design; sim -clock clk -reset rst -n 300 $args -trace_buffer $buffer -vcd sim_trace_stream_$buffer.vcd -fst sim_trace_stream_$buffer.fst"
+			../../yosys -q -w "Unable to find wire" -p "read_verilog sim_trace_stream.v; proc; $design; sim -r sim_trace_stream_$buffer.fst -scope top -vcd sim_trace_stream_$buffer.fst.vcd"
+		done
+		for buffer in 1 4096; do
+			cmp sim_trace_stream_0.vcd sim_trace_stream_$buffer.vcd
+			cmp sim_trace_stream_0.fst.vcd sim_trace_stream_$buffer.fst.vcd
+		done
+	done
+done
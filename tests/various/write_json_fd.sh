@@ -0,0 +1,16 @@
+#!/usr/bin/env bash
+# "write_json -fd" and "yosys -j" must produce the same output as writing
+# the file serially.
+
+set -e
+
+../../yosys -q -p "read_verilog ../simple/hierarchy.v ../simple/memory.v; hierarchy; proc; write_rtlil write_json_fd.il"
+../../yosys -q -p "read_rtlil write_json_fd.il; write_json -aig write_json_fd_1.json"
+../../yosys -q -j 4 -p "read_rtlil write_json_fd.il; write_json -aig write_json_fd_2.json"
+../../yosys -q -p "read_rtlil write_json_fd.il; write_json -aig -fd 3" 3> write_json_fd_3.json
+../../yosys -q -j 4 -p "read_rtlil write_json_fd.il; write_json -aig -fd 3" 3>&1 > /dev/null | cat > write_json_fd_4.json
+cmp write_json_fd_1.json write_json_fd_2.json
+cmp write_json_fd_1.json write_json_fd_3.json
+cmp write_json_fd_1.json write_json_fd_4.json
+
+../../yosys -p "logger -expect error \"can't be combined with an output filename\" 1; write_json -fd 3 write_json_fd_5.json"
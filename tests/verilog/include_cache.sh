@@ -0,0 +1,73 @@
+#!/usr/bin/env bash
+# Included files are cached for the session: the output must be the same as
+# preprocessing them again, and a changed header must be read again.
+# "read_verilog -batch" must give the same design as reading the files one
+# by one.
+
+set -e
+
+rm -rf include_cache
+mkdir -p include_cache/inc
+cd include_cache
+
+cat > inc/defs.vh <<EOT
+\`ifndef DEFS_VH
+\`define DEFS_VH
+\`define WIDTH 8
+\`define ADD(a, b = 1) ((a) + (b))
+\`include "inner.vh"
+/* \`include "missing.vh" in a comment */
+\`endif
+EOT
+
+cat > inc/inner.vh <<EOT
+\`define INNER 3
+EOT
+
+cat > inc/body.vh <<EOT
+	wire [\`WIDTH-1:0] t = \`ADD(a, \`INNER);
+	assign y = t ^ \`SEED;
+EOT
+
+for n in 1 2 3 4; do
+	cat > m$n.v <<EOT
+\`include "defs.vh"
+\`define SEED $n
+module m$n(input [\`WIDTH-1:0] a, output [\`WIDTH-1:0] y);
+\`include "body.vh"
+endmodule
+\`undef SEED
+EOT
+done
+
+# the reference: every file in a new session, so nothing comes from the cache
+for n in 1 2 3 4; do
+	../../../yosys -q -p "read_verilog -Iinc m$n.v; rename -enumerate; write_rtlil single_$n.il"
+	grep -v "^autoidx\|^# Generated" single_$n.il >> single.il
+done
+
+# -batch reserves an autoidx value per file, the names of the cells differ
+# from a plain read until they are enumerated, but not between thread counts
+../../../yosys -q -p "read_verilog -Iinc m1.v m2.v m3.v m4.v; rename -enumerate; write_rtlil all.il"
+../../../yosys -q -p "read_verilog -batch -Iinc m1.v m2.v m3.v m4.v; rename -enumerate; write_rtlil batch_1.il"
+../../../yosys -q -j 3 -p "read_verilog -batch -Iinc m1.v m2.v m3.v m4.v; rename -enumerate; write_rtlil batch_3.il"
+grep -v "^autoidx\|^# Generated" all.il | cmp - single.il
+grep -v "^autoidx\|^# Generated" batch_1.il | cmp - single.il
+grep -v "^autoidx\|^# Generated" batch_3.il | cmp - single.il
+../../../yosys -q -p "read_verilog -batch -Iinc m1.v m2.v m3.v m4.v; write_rtlil batch_names_1.il"
+../../../yosys -q -j 3 -p "read_verilog -batch -Iinc m1.v m2.v m3.v m4.v; write_rtlil batch_names_3.il"
+cmp batch_names_1.il batch_names_3.il
+
+# the second read of m1.v gets body.vh from the cache, the third one must
+# see the change
+cat > changed.ys <<EOT
+read_verilog -Iinc m1.v
+sat -verify -prove y 8'h02 -set a 8'h00 m1
+read_verilog -overwrite -Iinc m1.v
+sat -verify -prove y 8'h02 -set a 8'h00 m1
+!sed -i "s/t ^/t +/" inc/body.vh
+!touch -d "+1 minute" inc/body.vh
+read_verilog -overwrite -Iinc m1.v
+sat -verify -prove y 8'h04 -set a 8'h00 m1
+EOT
+../../../yosys -q -s changed.ys